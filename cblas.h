@@ -47,6 +47,65 @@ int openblas_get_parallel(void);
 /* OpenBLAS is compiled using OpenMP threading model */
 #define OPENBLAS_OPENMP 2
 
+/* Per-call profiling, also switched on at startup by OPENBLAS_PROFILE=1 */
+/* Code path flags reported for a call */
+#define OPENBLAS_PROFILE_SMALL_KERNEL  0x1
+#define OPENBLAS_PROFILE_GEMV_FORWARD  0x2
+#define OPENBLAS_PROFILE_THREADED      0x4
+#define OPENBLAS_PROFILE_PACKED        0x8
+
+/* One call, as passed to the profiling callback */
+typedef struct {
+  const char *name;
+  unsigned int path;
+  int nthreads;
+  unsigned long long cycles;
+  double flops, bytes;
+} openblas_profile_event;
+
+/* Accumulated counters for one routine. Level 3 drivers (e.g. dgemm_nn)
+   have their own entries holding the time spent packing and in kernels. */
+typedef struct {
+  const char *name;
+  unsigned long long calls, cycles;
+  unsigned long long small_kernel_calls, gemv_forward_calls, threaded_calls, packed_calls;
+  unsigned long long thread_sum;
+  unsigned long long pack_cycles, kernel_cycles;
+  double flops, bytes;
+} openblas_profile_entry;
+
+typedef void (*openblas_profile_callback)(const openblas_profile_event *event, void *data);
+
+void openblas_profile_enable(int enable);
+int  openblas_profile_enabled(void);
+void openblas_profile_reset(void);
+/* Copies up to max_entries routines into entries, returns the number of routines seen */
+int  openblas_profile_snapshot(openblas_profile_entry *entries, int max_entries);
+void openblas_profile_set_callback(openblas_profile_callback callback, void *data);
+
+/* GEMM blocking profiles (DYNAMIC_ARCH builds only, -1 otherwise). OPENBLAS_GEMM_PROFILE=<file>
+   loads one at startup; with OPENBLAS_GEMM_TUNE=1 a core missing from it is tuned on the first
+   level 3 call and added. Both calls below change the blocking in place and must not overlap
+   any other BLAS or LAPACK call in the process. */
+/* Times P/Q/R of each precision and switch_ratio, applies the fastest and stores them in path unless NULL */
+int  openblas_gemm_tune(const char *path);
+/* Applies the lines of path for this core, returns how many were applied */
+int  openblas_gemm_load_profile(const char *path);
+
+/* Backing of the packing buffers, also chosen at startup by OPENBLAS_BUFFER_BACKEND=mmap|thp|hugetlb.
+   OPENBLAS_BUFFER_SIZE (MiB) and OPENBLAS_NUM_BUFFERS set the buffer size and pool size. */
+#define OPENBLAS_BUFFER_MMAP     0
+/* Transparent huge pages through madvise(MADV_HUGEPAGE) */
+#define OPENBLAS_BUFFER_THP      1
+/* MAP_HUGETLB from the reserved pool, transparent huge pages once it is empty */
+#define OPENBLAS_BUFFER_HUGETLB  2
+int  openblas_get_buffer_backend(void);
+/* Applies to buffers mapped after the call, returns -1 if the backend is not available (non-Linux) */
+int  openblas_set_buffer_backend(int backend);
+/* Unmaps the buffers no call is using and returns the number of bytes released.
+   OPENBLAS_BUFFER_IDLE_TIMEOUT (seconds) does the same for buffers idle that long. */
+size_t openblas_trim_memory(void);
+
 
 /*
  * Since all of GotoBlas was written without const,
@@ -64,6 +123,9 @@ typedef enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=1
 typedef enum CBLAS_UPLO      {CblasUpper=121, CblasLower=122} CBLAS_UPLO;
 typedef enum CBLAS_DIAG      {CblasNonUnit=131, CblasUnit=132} CBLAS_DIAG;
 typedef enum CBLAS_SIDE      {CblasLeft=141, CblasRight=142} CBLAS_SIDE;
+typedef enum CBLAS_STORAGE   {CblasPacked=151} CBLAS_STORAGE;
+typedef enum CBLAS_IDENTIFIER {CblasAMatrix=161, CblasBMatrix=162} CBLAS_IDENTIFIER;
+typedef enum CBLAS_OFFSET    {CblasRowOffset=171, CblasColOffset=172, CblasFixOffset=173} CBLAS_OFFSET;
 typedef CBLAS_ORDER CBLAS_LAYOUT;
 	
 float  cblas_sdsdot(OPENBLAS_CONST blasint n, OPENBLAS_CONST float alpha, OPENBLAS_CONST float *x, OPENBLAS_CONST blasint incx, OPENBLAS_CONST float *y, OPENBLAS_CONST blasint incy);
@@ -428,6 +490,67 @@ void cblas_cgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enu
 void cblas_zgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransA_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransB_array, OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST blasint * K_array,
 		       OPENBLAS_CONST void * alpha_array, OPENBLAS_CONST void ** A_array, OPENBLAS_CONST blasint * lda_array, OPENBLAS_CONST void ** B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST void * beta_array, void ** C_array, OPENBLAS_CONST blasint * ldc_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
 
+void cblas_sgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		       OPENBLAS_CONST float alpha, OPENBLAS_CONST float * A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint stridea, OPENBLAS_CONST float * B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideb,
+		       OPENBLAS_CONST float beta, float * C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint stridec, OPENBLAS_CONST blasint batch_size);
+
+void cblas_dgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		       OPENBLAS_CONST double alpha, OPENBLAS_CONST double * A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint stridea, OPENBLAS_CONST double * B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideb,
+		       OPENBLAS_CONST double beta, double * C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint stridec, OPENBLAS_CONST blasint batch_size);
+
+void cblas_cgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		       OPENBLAS_CONST void * alpha, OPENBLAS_CONST void * A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint stridea, OPENBLAS_CONST void * B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideb,
+		       OPENBLAS_CONST void * beta, void * C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint stridec, OPENBLAS_CONST blasint batch_size);
+
+void cblas_zgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		       OPENBLAS_CONST void * alpha, OPENBLAS_CONST void * A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint stridea, OPENBLAS_CONST void * B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideb,
+		       OPENBLAS_CONST void * beta, void * C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint stridec, OPENBLAS_CONST blasint batch_size);
+
+void cblas_strsm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_SIDE * Side_array, OPENBLAS_CONST enum CBLAS_UPLO * Uplo_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransA_array, OPENBLAS_CONST enum CBLAS_DIAG * Diag_array,
+		       OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST float * alpha_array, OPENBLAS_CONST float ** A_array, OPENBLAS_CONST blasint * lda_array, float ** B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+
+void cblas_dtrsm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_SIDE * Side_array, OPENBLAS_CONST enum CBLAS_UPLO * Uplo_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransA_array, OPENBLAS_CONST enum CBLAS_DIAG * Diag_array,
+		       OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST double * alpha_array, OPENBLAS_CONST double ** A_array, OPENBLAS_CONST blasint * lda_array, double ** B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+
+void cblas_ctrsm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_SIDE * Side_array, OPENBLAS_CONST enum CBLAS_UPLO * Uplo_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransA_array, OPENBLAS_CONST enum CBLAS_DIAG * Diag_array,
+		       OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST void * alpha_array, OPENBLAS_CONST void ** A_array, OPENBLAS_CONST blasint * lda_array, void ** B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+
+void cblas_ztrsm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_SIDE * Side_array, OPENBLAS_CONST enum CBLAS_UPLO * Uplo_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransA_array, OPENBLAS_CONST enum CBLAS_DIAG * Diag_array,
+		       OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST void * alpha_array, OPENBLAS_CONST void ** A_array, OPENBLAS_CONST blasint * lda_array, void ** B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
+
+/* Pack one GEMM operand once and reuse it; TransA/TransB of ?gemm_compute may be CblasPacked */
+size_t cblas_sgemm_pack_get_size(OPENBLAS_CONST enum CBLAS_IDENTIFIER Identifier, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K);
+size_t cblas_dgemm_pack_get_size(OPENBLAS_CONST enum CBLAS_IDENTIFIER Identifier, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K);
+void cblas_sgemm_pack(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_IDENTIFIER Identifier, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		      OPENBLAS_CONST float alpha, OPENBLAS_CONST float *src, OPENBLAS_CONST blasint ld, float *dest);
+void cblas_dgemm_pack(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_IDENTIFIER Identifier, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		      OPENBLAS_CONST double alpha, OPENBLAS_CONST double *src, OPENBLAS_CONST blasint ld, double *dest);
+void cblas_sgemm_compute(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST blasint TransA, OPENBLAS_CONST blasint TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			 OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc);
+void cblas_dgemm_compute(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST blasint TransA, OPENBLAS_CONST blasint TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			 OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST double *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST double beta, double *C, OPENBLAS_CONST blasint ldc);
+
+/* GEMM with a fused epilogue, C := act(alpha*op(A)*op(B) + beta*C + bias), applied to each
+   block of C as soon as it is finished instead of in a second pass over C */
+typedef enum OPENBLAS_BIAS       {OpenblasBiasNone=0, OpenblasBiasRow=1, OpenblasBiasCol=2} OPENBLAS_BIAS;
+typedef enum OPENBLAS_ACTIVATION {OpenblasActNone=0, OpenblasActReLU=1, OpenblasActGELU=2, OpenblasActClamp=3} OPENBLAS_ACTIVATION;
+
+typedef struct {
+  OPENBLAS_BIAS bias;              /* Row: M values, one per row of C; Col: N values, one per column */
+  const void *bias_vector;         /* float for sgemm, double for dgemm */
+  OPENBLAS_ACTIVATION activation;  /* GELU is the exact erf form */
+  double clamp_min, clamp_max;     /* bounds for OpenblasActClamp */
+  bfloat16 *bf16_out;              /* if not NULL, the result is also stored here as bf16 */
+  blasint ld_bf16;                 /* leading dimension of bf16_out, laid out like C */
+} openblas_gemm_epilogue;
+
+void cblas_sgemm_epilogue(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			  OPENBLAS_CONST float alpha, OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc,
+			  OPENBLAS_CONST openblas_gemm_epilogue *epilogue);
+void cblas_dgemm_epilogue(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			  OPENBLAS_CONST double alpha, OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST double *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST double beta, double *C, OPENBLAS_CONST blasint ldc,
+			  OPENBLAS_CONST openblas_gemm_epilogue *epilogue);
+
 /*** BFLOAT16 and INT8 extensions ***/
 /* convert float array to BFLOAT16 array by rounding */
 void   cblas_sbstobf16(OPENBLAS_CONST blasint n, OPENBLAS_CONST float  *in, OPENBLAS_CONST blasint incin, bfloat16 *out, OPENBLAS_CONST blasint incout);
@@ -446,6 +569,78 @@ void   cblas_sbgemm(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum C
 void cblas_sbgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransA_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE * TransB_array, OPENBLAS_CONST blasint * M_array, OPENBLAS_CONST blasint * N_array, OPENBLAS_CONST blasint * K_array,
 		       OPENBLAS_CONST float * alpha_array, OPENBLAS_CONST bfloat16 ** A_array, OPENBLAS_CONST blasint * lda_array, OPENBLAS_CONST bfloat16 ** B_array, OPENBLAS_CONST blasint * ldb_array, OPENBLAS_CONST float * beta_array, float ** C_array, OPENBLAS_CONST blasint * ldc_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint * group_size);
 
+/* C := alpha * (op(A) + ao) * (op(B) + bo) + beta * C + co, with int8 A, uint8 B and int32 accumulation.
+   co holds one value (CblasFixOffset), M values added to every column (CblasColOffset)
+   or N values added to every row (CblasRowOffset); results are rounded and saturated */
+void   cblas_gemm_s8u8s32(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST enum CBLAS_OFFSET OffsetC,
+			  OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K, OPENBLAS_CONST float alpha,
+			  OPENBLAS_CONST int8_t *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST int8_t ao, OPENBLAS_CONST uint8_t *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST int8_t bo,
+			  OPENBLAS_CONST float beta, int32_t *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST int32_t *co);
+
+/*** IEEE half precision (fp16) extensions, accumulating in float ***/
+/* convert float array to fp16 array by rounding to nearest even */
+void   cblas_shstohf16(OPENBLAS_CONST blasint n, OPENBLAS_CONST float  *in, OPENBLAS_CONST blasint incin, hfloat16 *out, OPENBLAS_CONST blasint incout);
+/* convert fp16 array to float array */
+void   cblas_shf16tos(OPENBLAS_CONST blasint n, OPENBLAS_CONST hfloat16 *in, OPENBLAS_CONST blasint incin, float  *out, OPENBLAS_CONST blasint incout);
+void   cblas_shgemv(OPENBLAS_CONST enum CBLAS_ORDER order,  OPENBLAS_CONST enum CBLAS_TRANSPOSE trans,  OPENBLAS_CONST blasint m, OPENBLAS_CONST blasint n, OPENBLAS_CONST float alpha, OPENBLAS_CONST hfloat16 *a, OPENBLAS_CONST blasint lda, OPENBLAS_CONST hfloat16 *x, OPENBLAS_CONST blasint incx, OPENBLAS_CONST float beta, float *y, OPENBLAS_CONST blasint incy);
+void   cblas_shgemm(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		    OPENBLAS_CONST float alpha, OPENBLAS_CONST hfloat16 *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST hfloat16 *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc);
+
+/*** Stream-ordered asynchronous calls ***/
+/* Calls enqueued on one stream run in submission order and return at once;
+   calls on different streams may run at the same time on the worker threads,
+   and are ordered across streams with events. Operands must stay valid until
+   the call has completed. A NULL stream runs the call before returning, and
+   builds without the pthreads server run every call as it is enqueued. */
+typedef struct openblas_stream_s *openblas_stream_t;
+typedef struct openblas_event_s  *openblas_event_t;
+
+openblas_stream_t openblas_stream_create(void);
+/* Waits for the work enqueued on the stream, then releases it */
+void openblas_stream_destroy(openblas_stream_t stream);
+void openblas_stream_synchronize(openblas_stream_t stream);
+/* Calls enqueued on stream from now on wait until the latest record of event has completed */
+void openblas_stream_wait_event(openblas_stream_t stream, openblas_event_t event);
+
+openblas_event_t openblas_event_create(void);
+void openblas_event_destroy(openblas_event_t event);
+/* The event completes once everything enqueued on stream so far has */
+void openblas_event_record(openblas_event_t event, openblas_stream_t stream);
+void openblas_event_synchronize(openblas_event_t event);
+/* 1 if the latest record has completed, or the event was never recorded */
+int  openblas_event_query(openblas_event_t event);
+
+void openblas_stream_sgemm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint M, blasint N, blasint K, float alpha, const float *A, blasint lda, const float *B, blasint ldb,
+			   float beta, float *C, blasint ldc);
+void openblas_stream_dgemm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint M, blasint N, blasint K, double alpha, const double *A, blasint lda, const double *B, blasint ldb,
+			   double beta, double *C, blasint ldc);
+void openblas_stream_cgemm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint M, blasint N, blasint K, const void *alpha, const void *A, blasint lda, const void *B, blasint ldb,
+			   const void *beta, void *C, blasint ldc);
+void openblas_stream_zgemm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint M, blasint N, blasint K, const void *alpha, const void *A, blasint lda, const void *B, blasint ldb,
+			   const void *beta, void *C, blasint ldc);
+
+void openblas_stream_strsm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_DIAG Diag, blasint M, blasint N,
+			   float alpha, const float *A, blasint lda, float *B, blasint ldb);
+void openblas_stream_dtrsm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_DIAG Diag, blasint M, blasint N,
+			   double alpha, const double *A, blasint lda, double *B, blasint ldb);
+void openblas_stream_ctrsm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_DIAG Diag, blasint M, blasint N,
+			   const void *alpha, const void *A, blasint lda, void *B, blasint ldb);
+void openblas_stream_ztrsm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_DIAG Diag, blasint M, blasint N,
+			   const void *alpha, const void *A, blasint lda, void *B, blasint ldb);
+
+void openblas_stream_saxpy(openblas_stream_t stream, blasint n, float  alpha, const float  *x, blasint incx, float  *y, blasint incy);
+void openblas_stream_daxpy(openblas_stream_t stream, blasint n, double alpha, const double *x, blasint incx, double *y, blasint incy);
+void openblas_stream_caxpy(openblas_stream_t stream, blasint n, const void *alpha, const void *x, blasint incx, void *y, blasint incy);
+void openblas_stream_zaxpy(openblas_stream_t stream, blasint n, const void *alpha, const void *x, blasint incx, void *y, blasint incy);
+
 #ifdef __cplusplus
 }
 #endif  /* __cplusplus */
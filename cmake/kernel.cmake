@@ -141,6 +141,12 @@ if (BUILD_BFLOAT16)
   SetFallback(SBGEMVNKERNEL ../x86_64/sbgemv_n.c)
   SetFallback(SBGEMVTKERNEL ../x86_64/sbgemv_t.c)
 endif ()
+if (BUILD_HFLOAT16)
+  SetFallback(TOHF16KERNEL ../generic/tohf16.c)
+  SetFallback(HF16TOKERNEL ../generic/hf16to.c)
+  SetFallback(SHGEMVNKERNEL ../generic/shgemv_n.c)
+  SetFallback(SHGEMVTKERNEL ../generic/shgemv_t.c)
+endif ()
 endmacro ()
 
 macro(SetDefaultL2)
@@ -214,5 +220,28 @@ if (BUILD_BFLOAT16)
   SetFallback(SBGEMMONCOPYOBJ sbgemm_oncopy.o)
   SetFallback(SBGEMMOTCOPYOBJ sbgemm_otcopy.o)
 endif ()
+if (BUILD_HFLOAT16)
+  if (ARM64)
+    SetFallback(SHGEMMKERNEL ../arm64/shgemm_kernel_8x4_neon.c)
+    SetFallback(SHGEMMINCOPY ../generic/gemm_ncopy_8.c)
+    SetFallback(SHGEMMITCOPY ../generic/gemm_tcopy_8.c)
+    SetFallback(SHGEMMONCOPY ../generic/gemm_ncopy_4.c)
+    SetFallback(SHGEMMOTCOPY ../generic/gemm_tcopy_4.c)
+  else ()
+    SetFallback(SHGEMMKERNEL ../generic/gemmkernel_2x2.c)
+    SetFallback(SHGEMMINCOPY ../generic/gemm_ncopy_2.c)
+    SetFallback(SHGEMMITCOPY ../generic/gemm_tcopy_2.c)
+    SetFallback(SHGEMMONCOPY ../generic/gemm_ncopy_2.c)
+    SetFallback(SHGEMMOTCOPY ../generic/gemm_tcopy_2.c)
+  endif ()
+  SetFallback(SHGEMM_BETA  ../generic/gemm_beta.c)
+endif ()
+if (BUILD_SINGLE)
+  SetFallback(I8GEMMKERNEL ../generic/i8gemm_kernel.c)
+  SetFallback(I8GEMMINCOPY ../generic/i8gemm_ncopy.c)
+  SetFallback(I8GEMMITCOPY ../generic/i8gemm_tcopy.c)
+  SetFallback(I8GEMMONCOPY ../generic/i8gemm_ncopy.c)
+  SetFallback(I8GEMMOTCOPY ../generic/i8gemm_tcopy.c)
+endif ()
 
 endmacro ()
@@ -390,7 +390,7 @@ if (NEED_PIC)
   endif()
 endif ()
 
-if (X86_64 OR ${CORE} STREQUAL POWER10 OR ARM64 OR LOONGARCH64)
+if (X86_64 OR ${CORE} STREQUAL POWER10 OR ARM64 OR LOONGARCH64 OR RISCV64)
   set(SMALL_MATRIX_OPT TRUE)
 endif ()
 if (ARM64)
@@ -615,6 +615,9 @@ endif()
 if (BUILD_BFLOAT16)
        set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -DBUILD_BFLOAT16")
 endif()
+if (BUILD_HFLOAT16)
+       set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -DBUILD_HFLOAT16")
+endif()
 if(NOT MSVC)
 set(CMAKE_ASM_FLAGS "${CMAKE_ASM_FLAGS} ${CCOMMON_OPT}")
 endif()
@@ -326,6 +326,7 @@ function(GenerateNamedObjects sources_in)
     list(REMOVE_ITEM float_list "SINGLE")
     list(REMOVE_ITEM float_list "DOUBLE")
     list(REMOVE_ITEM float_list "BFLOAT16")
+    list(REMOVE_ITEM float_list "HFLOAT16")
   elseif (real_only)
     list(REMOVE_ITEM float_list "COMPLEX")
     list(REMOVE_ITEM float_list "ZCOMPLEX")
@@ -342,6 +343,9 @@ function(GenerateNamedObjects sources_in)
 	if (${float_type} STREQUAL "BFLOAT16")
 		set (float_char "sb")
 	endif ()
+	if (${float_type} STREQUAL "HFLOAT16")
+		set (float_char "sh")
+	endif ()
       endif ()
 
       if (NOT name_in)
@@ -392,6 +396,9 @@ function(GenerateNamedObjects sources_in)
       if (${float_type} STREQUAL "BFLOAT16")
         list(APPEND obj_defines "BFLOAT16")
       endif ()
+      if (${float_type} STREQUAL "HFLOAT16")
+        list(APPEND obj_defines "HFLOAT16")
+      endif ()
       if (${float_type} STREQUAL "COMPLEX" OR ${float_type} STREQUAL "ZCOMPLEX")
         list(APPEND obj_defines "COMPLEX")
         if (mangle_complex_sources)
@@ -266,6 +266,11 @@ typedef uint16_t bfloat16;
 #define BFLOAT16CONVERSION 1
 #endif
 
+#ifndef hfloat16
+#include <stdint.h>
+typedef uint16_t hfloat16;
+#endif
+
 #ifdef USE64BITINT
 typedef BLASLONG blasint;
 #if defined(OS_WINDOWS) && defined(__64BIT__)
@@ -313,6 +318,13 @@ typedef int blasint;
 #define SIZE   2
 #define BASE_SHIFT 1
 #define ZBASE_SHIFT 2
+#elif defined(HFLOAT16)
+#define IFLOAT	hfloat16
+#define XFLOAT IFLOAT
+#define FLOAT	float
+#define SIZE   2
+#define BASE_SHIFT 1
+#define ZBASE_SHIFT 2
 #else
 #define FLOAT	float
 #define SIZE    4
@@ -683,6 +695,8 @@ void *blas_memory_alloc  (int);
 void  blas_memory_free   (void *);
 void *blas_memory_alloc_nolock  (int); //use malloc without blas_lock
 void  blas_memory_free_nolock   (void *);
+void *blas_memory_alloc_size  (int, BLASLONG); //right-sized buffer from the pool
+void  blas_memory_discard     (void *);        //free and unmap at once
 
 int  get_num_procs (void);
 
@@ -700,6 +714,12 @@ void gotoblas_dynamic_init(void);
 void gotoblas_dynamic_quit(void);
 void gotoblas_profile_init(void);
 void gotoblas_profile_quit(void);
+void gotoblas_gemm_tune_init(void);
+#ifdef DYNAMIC_ARCH
+extern volatile int gotoblas_gemm_tune_pending;
+void gotoblas_gemm_tune_deferred(void);
+#endif
+BLASLONG blas_buffer_size(void);
 	
 int support_avx512(void);	
 
@@ -871,52 +891,46 @@ typedef struct {
 #define IDEBUG_END
 #endif
 
-#if !defined(ASSEMBLER) && defined(FUNCTION_PROFILE)
-
-typedef struct {
-  int func;
-  unsigned long long calls, fops, area, cycles, tcycles;
-} func_profile_t;
+#ifndef ASSEMBLER
 
-extern func_profile_t function_profile_table[];
+/* Per-call profiling. Collection is switched on at run time, either with
+   openblas_profile_enable() or by setting OPENBLAS_PROFILE=1, so the hooks
+   below cost a single load and branch while it is off. */
 extern int gotoblas_profile;
 
-#ifdef XDOUBLE
-#define NUMOPT	QNUMOPT
-#elif defined DOUBLE
-#define NUMOPT	DNUMOPT
-#else
-#define NUMOPT	SNUMOPT
+void gotoblas_profile_record(const char *name, int path, int nthreads,
+			     unsigned long long cycles, double flops, double bytes);
+void gotoblas_profile_level3(const char *name, int first, unsigned long long pack_cycles,
+			     unsigned long long kernel_cycles);
+
+#define FUNCTION_PROFILE_START() \
+	int profile_on = gotoblas_profile, profile_path = 0, profile_threads = 1; \
+	unsigned long long profile_start = profile_on ? rpcc() : 0;
+
+/* Code path flags, as in cblas.h which only CBLAS objects include */
+#ifndef OPENBLAS_PROFILE_SMALL_KERNEL
+#define OPENBLAS_PROFILE_SMALL_KERNEL  0x1
+#define OPENBLAS_PROFILE_GEMV_FORWARD  0x2
+#define OPENBLAS_PROFILE_THREADED      0x4
+#define OPENBLAS_PROFILE_PACKED        0x8
 #endif
 
-#define FUNCTION_PROFILE_START() { unsigned long long profile_start = rpcc(), profile_end;
-#ifdef SMP
-#define FUNCTION_PROFILE_END(COMP, AREA, OPS) \
-	if (gotoblas_profile) { \
-	profile_end = rpcc(); \
-	function_profile_table[PROFILE_FUNC_NAME].calls ++; \
-	function_profile_table[PROFILE_FUNC_NAME].area    += SIZE * COMPSIZE * (AREA); \
-	function_profile_table[PROFILE_FUNC_NAME].fops    += (COMP) * (OPS) / NUMOPT; \
-	function_profile_table[PROFILE_FUNC_NAME].cycles  += (profile_end - profile_start); \
-	function_profile_table[PROFILE_FUNC_NAME].tcycles += blas_cpu_number * (profile_end - profile_start); \
-	} \
-	}
-#else
+/* Note the code path taken by this call */
+#define FUNCTION_PROFILE_PATH(PATH, THREADS) \
+	do { profile_path |= (PATH); profile_threads = (THREADS); } while (0)
+
+/* Note the thread count the interface picked, where it picks it */
+#define FUNCTION_PROFILE_THREADS(THREADS) \
+	do { if ((THREADS) > 1) FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_THREADED, THREADS); } while (0)
+
 #define FUNCTION_PROFILE_END(COMP, AREA, OPS) \
-	if (gotoblas_profile) { \
-	profile_end = rpcc(); \
-	function_profile_table[PROFILE_FUNC_NAME].calls ++; \
-	function_profile_table[PROFILE_FUNC_NAME].area    += SIZE * COMPSIZE * (AREA); \
-	function_profile_table[PROFILE_FUNC_NAME].fops    += (COMP) * (OPS) / NUMOPT; \
-	function_profile_table[PROFILE_FUNC_NAME].cycles  += (profile_end - profile_start); \
-	function_profile_table[PROFILE_FUNC_NAME].tcycles += (profile_end - profile_start); \
-	} \
-	}
-#endif
+	do { \
+	  if (profile_on) \
+	    gotoblas_profile_record(CHAR_CNAME, profile_path, profile_threads, \
+				    rpcc() - profile_start, (double)(COMP) * (double)(OPS), \
+				    (double)(SIZE * COMPSIZE) * (double)(AREA)); \
+	} while (0)
 
-#else
-#define FUNCTION_PROFILE_START()
-#define FUNCTION_PROFILE_END(COMP, AREA, OPS)
 #endif
 
 #if 1
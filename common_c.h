@@ -512,6 +512,46 @@
 #define	CSYRK_KERNEL_U		csyrk_kernel_U
 #define	CSYRK_KERNEL_L		csyrk_kernel_L
 
+#define	CGEMMT_UNN		cgemmt_UNN
+#define	CGEMMT_UTN		cgemmt_UTN
+#define	CGEMMT_URN		cgemmt_URN
+#define	CGEMMT_UCN		cgemmt_UCN
+#define	CGEMMT_UNT		cgemmt_UNT
+#define	CGEMMT_UTT		cgemmt_UTT
+#define	CGEMMT_URT		cgemmt_URT
+#define	CGEMMT_UCT		cgemmt_UCT
+#define	CGEMMT_UNR		cgemmt_UNR
+#define	CGEMMT_UTR		cgemmt_UTR
+#define	CGEMMT_URR		cgemmt_URR
+#define	CGEMMT_UCR		cgemmt_UCR
+#define	CGEMMT_UNC		cgemmt_UNC
+#define	CGEMMT_UTC		cgemmt_UTC
+#define	CGEMMT_URC		cgemmt_URC
+#define	CGEMMT_UCC		cgemmt_UCC
+#define	CGEMMT_LNN		cgemmt_LNN
+#define	CGEMMT_LTN		cgemmt_LTN
+#define	CGEMMT_LRN		cgemmt_LRN
+#define	CGEMMT_LCN		cgemmt_LCN
+#define	CGEMMT_LNT		cgemmt_LNT
+#define	CGEMMT_LTT		cgemmt_LTT
+#define	CGEMMT_LRT		cgemmt_LRT
+#define	CGEMMT_LCT		cgemmt_LCT
+#define	CGEMMT_LNR		cgemmt_LNR
+#define	CGEMMT_LTR		cgemmt_LTR
+#define	CGEMMT_LRR		cgemmt_LRR
+#define	CGEMMT_LCR		cgemmt_LCR
+#define	CGEMMT_LNC		cgemmt_LNC
+#define	CGEMMT_LTC		cgemmt_LTC
+#define	CGEMMT_LRC		cgemmt_LRC
+#define	CGEMMT_LCC		cgemmt_LCC
+
+#define	CGEMMT_KERNEL_UL	cgemmt_kernel_UL
+#define	CGEMMT_KERNEL_UR	cgemmt_kernel_UR
+#define	CGEMMT_KERNEL_UB	cgemmt_kernel_UB
+#define	CGEMMT_KERNEL_LL	cgemmt_kernel_LL
+#define	CGEMMT_KERNEL_LR	cgemmt_kernel_LR
+#define	CGEMMT_KERNEL_LB	cgemmt_kernel_LB
+
 #define	CHERK_UN		cherk_UN
 #define	CHERK_LN		cherk_LN
 #define	CHERK_UC		cherk_UC
@@ -600,6 +640,9 @@
 #define	CTRSM_RCLU		ctrsm_RCLU
 #define	CTRSM_RCLN		ctrsm_RCLN
 
+#define	CTRSM_TASK		ctrsm_task
+#define	CTRMM_TASK		ctrmm_task
+
 #define	CGEMM_THREAD_NN		cgemm_thread_nn
 #define	CGEMM_THREAD_CN		cgemm_thread_cn
 #define	CGEMM_THREAD_TN		cgemm_thread_tn
@@ -636,6 +679,39 @@
 #define	CSYRK_THREAD_LR		csyrk_thread_LN
 #define	CSYRK_THREAD_LC		csyrk_thread_LT
 
+#define	CGEMMT_THREAD_UNN	cgemmt_thread_UNN
+#define	CGEMMT_THREAD_UTN	cgemmt_thread_UTN
+#define	CGEMMT_THREAD_URN	cgemmt_thread_URN
+#define	CGEMMT_THREAD_UCN	cgemmt_thread_UCN
+#define	CGEMMT_THREAD_UNT	cgemmt_thread_UNT
+#define	CGEMMT_THREAD_UTT	cgemmt_thread_UTT
+#define	CGEMMT_THREAD_URT	cgemmt_thread_URT
+#define	CGEMMT_THREAD_UCT	cgemmt_thread_UCT
+#define	CGEMMT_THREAD_UNR	cgemmt_thread_UNR
+#define	CGEMMT_THREAD_UTR	cgemmt_thread_UTR
+#define	CGEMMT_THREAD_URR	cgemmt_thread_URR
+#define	CGEMMT_THREAD_UCR	cgemmt_thread_UCR
+#define	CGEMMT_THREAD_UNC	cgemmt_thread_UNC
+#define	CGEMMT_THREAD_UTC	cgemmt_thread_UTC
+#define	CGEMMT_THREAD_URC	cgemmt_thread_URC
+#define	CGEMMT_THREAD_UCC	cgemmt_thread_UCC
+#define	CGEMMT_THREAD_LNN	cgemmt_thread_LNN
+#define	CGEMMT_THREAD_LTN	cgemmt_thread_LTN
+#define	CGEMMT_THREAD_LRN	cgemmt_thread_LRN
+#define	CGEMMT_THREAD_LCN	cgemmt_thread_LCN
+#define	CGEMMT_THREAD_LNT	cgemmt_thread_LNT
+#define	CGEMMT_THREAD_LTT	cgemmt_thread_LTT
+#define	CGEMMT_THREAD_LRT	cgemmt_thread_LRT
+#define	CGEMMT_THREAD_LCT	cgemmt_thread_LCT
+#define	CGEMMT_THREAD_LNR	cgemmt_thread_LNR
+#define	CGEMMT_THREAD_LTR	cgemmt_thread_LTR
+#define	CGEMMT_THREAD_LRR	cgemmt_thread_LRR
+#define	CGEMMT_THREAD_LCR	cgemmt_thread_LCR
+#define	CGEMMT_THREAD_LNC	cgemmt_thread_LNC
+#define	CGEMMT_THREAD_LTC	cgemmt_thread_LTC
+#define	CGEMMT_THREAD_LRC	cgemmt_thread_LRC
+#define	CGEMMT_THREAD_LCC	cgemmt_thread_LCC
+
 #define	CHERK_THREAD_UN		cherk_thread_UN
 #define	CHERK_THREAD_UT		cherk_thread_UT
 #define	CHERK_THREAD_LN		cherk_thread_LN
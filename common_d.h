@@ -337,6 +337,15 @@
 #define	DSYRK_KERNEL_U		dsyrk_kernel_U
 #define	DSYRK_KERNEL_L		dsyrk_kernel_L
 
+#define	DGEMMT_UNN		dgemmt_UNN
+#define	DGEMMT_UTN		dgemmt_UTN
+#define	DGEMMT_UNT		dgemmt_UNT
+#define	DGEMMT_UTT		dgemmt_UTT
+#define	DGEMMT_LNN		dgemmt_LNN
+#define	DGEMMT_LTN		dgemmt_LTN
+#define	DGEMMT_LNT		dgemmt_LNT
+#define	DGEMMT_LTT		dgemmt_LTT
+
 #define	DHERK_UN		dsyrk_UN
 #define	DHERK_LN		dsyrk_LN
 #define	DHERK_UC		dsyrk_UT
@@ -425,6 +434,9 @@
 #define	DTRSM_RCLU		dtrsm_RTLU
 #define	DTRSM_RCLN		dtrsm_RTLN
 
+#define	DTRSM_TASK		dtrsm_task
+#define	DTRMM_TASK		dtrmm_task
+
 #define	DGEMM_THREAD_NN		dgemm_thread_nn
 #define	DGEMM_THREAD_CN		dgemm_thread_tn
 #define	DGEMM_THREAD_TN		dgemm_thread_tn
@@ -442,6 +454,16 @@
 #define	DGEMM_THREAD_RC		dgemm_thread_nt
 #define	DGEMM_THREAD_RR		dgemm_thread_nn
 
+#define	DGEMM_EPILOGUE		dgemm_epilogue
+#define	DGEMM_EPILOGUE_NN	dgemm_epilogue_nn
+#define	DGEMM_EPILOGUE_NT	dgemm_epilogue_nt
+#define	DGEMM_EPILOGUE_TN	dgemm_epilogue_tn
+#define	DGEMM_EPILOGUE_TT	dgemm_epilogue_tt
+#define	DGEMM_EPILOGUE_THREAD_NN	dgemm_epilogue_thread_nn
+#define	DGEMM_EPILOGUE_THREAD_NT	dgemm_epilogue_thread_nt
+#define	DGEMM_EPILOGUE_THREAD_TN	dgemm_epilogue_thread_tn
+#define	DGEMM_EPILOGUE_THREAD_TT	dgemm_epilogue_thread_tt
+
 #define	DSYMM_THREAD_LU		dsymm_thread_LU
 #define	DSYMM_THREAD_LL		dsymm_thread_LL
 #define	DSYMM_THREAD_RU		dsymm_thread_RU
@@ -461,6 +483,15 @@
 #define	DSYRK_THREAD_LR		dsyrk_thread_LN
 #define	DSYRK_THREAD_LC		dsyrk_thread_LT
 
+#define	DGEMMT_THREAD_UNN	dgemmt_thread_UNN
+#define	DGEMMT_THREAD_UTN	dgemmt_thread_UTN
+#define	DGEMMT_THREAD_UNT	dgemmt_thread_UNT
+#define	DGEMMT_THREAD_UTT	dgemmt_thread_UTT
+#define	DGEMMT_THREAD_LNN	dgemmt_thread_LNN
+#define	DGEMMT_THREAD_LTN	dgemmt_thread_LTN
+#define	DGEMMT_THREAD_LNT	dgemmt_thread_LNT
+#define	DGEMMT_THREAD_LTT	dgemmt_thread_LTT
+
 #define	DHERK_THREAD_UN		dsyrk_thread_UN
 #define	DHERK_THREAD_UT		dsyrk_thread_UT
 #define	DHERK_THREAD_LN		dsyrk_thread_LN
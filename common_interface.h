@@ -64,6 +64,8 @@ void   BLASFUNC(sbstobf16) (blasint *, float *,    blasint *, bfloat16 *, blasin
 void   BLASFUNC(sbdtobf16) (blasint *, double *,   blasint *, bfloat16 *, blasint *);
 void   BLASFUNC(sbf16tos)  (blasint *, bfloat16 *, blasint *, float *,    blasint *);
 void   BLASFUNC(dbf16tod)  (blasint *, bfloat16 *, blasint *, double *,   blasint *);
+void   BLASFUNC(shstohf16) (blasint *, float *,    blasint *, hfloat16 *, blasint *);
+void   BLASFUNC(shf16tos)  (blasint *, hfloat16 *, blasint *, float *,    blasint *);
 
 #ifdef RETURN_BY_STRUCT
 typedef struct {
@@ -257,6 +259,8 @@ void BLASFUNC(xgerc)(blasint *,    blasint *, xdouble *, xdouble *, blasint *,
 
 void BLASFUNC(sbgemv)(char *, blasint *, blasint *, float  *, bfloat16 *, blasint *,
             bfloat16  *, blasint *, float  *, float  *, blasint *);
+void BLASFUNC(shgemv)(char *, blasint *, blasint *, float  *, hfloat16 *, blasint *,
+            hfloat16  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(sgemv)(char *, blasint *, blasint *, float  *, float  *, blasint *,
 		    float  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(dgemv)(char *, blasint *, blasint *, double *, double *, blasint *,
@@ -483,6 +487,8 @@ void BLASFUNC(xhbmv)(char *, blasint *, blasint *, xdouble *, xdouble *, blasint
 
 void BLASFUNC(sbgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
 	   bfloat16 *, blasint *, bfloat16 *, blasint *, float *, float *, blasint *);
+void BLASFUNC(shgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
+	   hfloat16 *, blasint *, hfloat16 *, blasint *, float *, float *, blasint *);
 void BLASFUNC(sgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
 	   float  *, blasint *, float  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(dgemm)(char *, char *, blasint *, blasint *, blasint *, double *,
@@ -737,6 +743,31 @@ int BLASFUNC(cpotrs)(char *, blasint *, blasint *, float   *, blasint *, float
 int BLASFUNC(zpotrs)(char *, blasint *, blasint *, double  *, blasint *, double  *, blasint *, blasint *);
 int BLASFUNC(xpotrs)(char *, blasint *, blasint *, xdouble *, blasint *, xdouble *, blasint *, blasint *);
 
+int BLASFUNC(sgetrf_batch)(blasint *, blasint *, float  **, blasint *, blasint **, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrf_batch)(blasint *, blasint *, double **, blasint *, blasint **, blasint *, blasint *, blasint *);
+int BLASFUNC(cgetrf_batch)(blasint *, blasint *, float  **, blasint *, blasint **, blasint *, blasint *, blasint *);
+int BLASFUNC(zgetrf_batch)(blasint *, blasint *, double **, blasint *, blasint **, blasint *, blasint *, blasint *);
+
+int BLASFUNC(spotrf_batch)(char *, blasint *, float  **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dpotrf_batch)(char *, blasint *, double **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(cpotrf_batch)(char *, blasint *, float  **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(zpotrf_batch)(char *, blasint *, double **, blasint *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(sgetrs_batch)(char *, blasint *, blasint *, float  **, blasint *, blasint **, float  **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrs_batch)(char *, blasint *, blasint *, double **, blasint *, blasint **, double **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(cgetrs_batch)(char *, blasint *, blasint *, float  **, blasint *, blasint **, float  **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(zgetrs_batch)(char *, blasint *, blasint *, double **, blasint *, blasint **, double **, blasint *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(sgetrf_rowmajor)(blasint *, blasint *, float  *, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrf_rowmajor)(blasint *, blasint *, double *, blasint *, blasint *, blasint *);
+int BLASFUNC(cgetrf_rowmajor)(blasint *, blasint *, float  *, blasint *, blasint *, blasint *);
+int BLASFUNC(zgetrf_rowmajor)(blasint *, blasint *, double *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(sgetrs_rowmajor)(char *, blasint *, blasint *, float  *, blasint *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dgetrs_rowmajor)(char *, blasint *, blasint *, double *, blasint *, blasint *, double *, blasint *, blasint *);
+int BLASFUNC(cgetrs_rowmajor)(char *, blasint *, blasint *, float  *, blasint *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(zgetrs_rowmajor)(char *, blasint *, blasint *, double *, blasint *, blasint *, double *, blasint *, blasint *);
+
 int BLASFUNC(slauu2)(char *, blasint *, float  *, blasint *, blasint *);
 int BLASFUNC(dlauu2)(char *, blasint *, double *, blasint *, blasint *);
 int BLASFUNC(qlauu2)(char *, blasint *, xdouble *, blasint *, blasint *);
@@ -765,6 +796,16 @@ int BLASFUNC(ctrtri)(char *, char *, blasint *, float  *, blasint *, blasint *);
 int BLASFUNC(ztrtri)(char *, char *, blasint *, double *, blasint *, blasint *);
 int BLASFUNC(xtrtri)(char *, char *, blasint *, xdouble *, blasint *, blasint *);
 
+int BLASFUNC(sgeqrf)(blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(dgeqrf)(blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+int BLASFUNC(cgeqrf)(blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(zgeqrf)(blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+
+int BLASFUNC(sormqr)(char *, char *, blasint *, blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dormqr)(char *, char *, blasint *, blasint *, blasint *, double *, blasint *, double *, double *, blasint *, double *, blasint *, blasint *);
+int BLASFUNC(cunmqr)(char *, char *, blasint *, blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(zunmqr)(char *, char *, blasint *, blasint *, blasint *, double *, blasint *, double *, double *, blasint *, double *, blasint *, blasint *);
+
 
 FLOATRET  BLASFUNC(slamch)(char *);
 double    BLASFUNC(dlamch)(char *);
@@ -57,6 +57,8 @@ int sgemm_direct_performant(BLASLONG M, BLASLONG N, BLASLONG K);
 
 int sbgemm_beta(BLASLONG, BLASLONG, BLASLONG, float,
 	       bfloat16 *, BLASLONG, bfloat16 *, BLASLONG, float *, BLASLONG);
+int shgemm_beta(BLASLONG, BLASLONG, BLASLONG, float,
+	       hfloat16 *, BLASLONG, hfloat16 *, BLASLONG, float *, BLASLONG);
 int sgemm_beta(BLASLONG, BLASLONG, BLASLONG, float,
 	       float  *, BLASLONG, float   *, BLASLONG, float  *, BLASLONG);
 int dgemm_beta(BLASLONG, BLASLONG, BLASLONG, double,
@@ -82,6 +84,14 @@ int sbgemm_incopy(BLASLONG m, BLASLONG n, bfloat16 *a, BLASLONG lda, bfloat16 *b
 int sbgemm_itcopy(BLASLONG m, BLASLONG n, bfloat16 *a, BLASLONG lda, bfloat16 *b);
 int sbgemm_oncopy(BLASLONG m, BLASLONG n, bfloat16 *a, BLASLONG lda, bfloat16 *b);
 int sbgemm_otcopy(BLASLONG m, BLASLONG n, bfloat16 *a, BLASLONG lda, bfloat16 *b);
+int shgemm_incopy(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, hfloat16 *b);
+int shgemm_itcopy(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, hfloat16 *b);
+int shgemm_oncopy(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, hfloat16 *b);
+int shgemm_otcopy(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, hfloat16 *b);
+int i8gemm_incopy(BLASLONG m, BLASLONG n, int8_t *a, BLASLONG lda, int8_t *b);
+int i8gemm_itcopy(BLASLONG m, BLASLONG n, int8_t *a, BLASLONG lda, int8_t *b);
+int i8gemm_oncopy(BLASLONG m, BLASLONG n, uint8_t *a, BLASLONG lda, uint8_t *b);
+int i8gemm_otcopy(BLASLONG m, BLASLONG n, uint8_t *a, BLASLONG lda, uint8_t *b);
 int sgemm_incopy(BLASLONG m, BLASLONG n, float *a, BLASLONG lda, float *b);
 int sgemm_itcopy(BLASLONG m, BLASLONG n, float *a, BLASLONG lda, float *b);
 int sgemm_oncopy(BLASLONG m, BLASLONG n, float *a, BLASLONG lda, float *b);
@@ -490,6 +500,27 @@ int xherk_kernel_UC(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble
 int xherk_kernel_LN(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset);
 int xherk_kernel_LC(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset);
 
+int cgemmt_kernel_UL(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset);
+int cgemmt_kernel_UR(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset);
+int cgemmt_kernel_UB(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset);
+int cgemmt_kernel_LL(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset);
+int cgemmt_kernel_LR(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset);
+int cgemmt_kernel_LB(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset);
+
+int zgemmt_kernel_UL(BLASLONG m, BLASLONG n, BLASLONG k, double alpha_r, double alpha_i, double *a, double *b, double *c, BLASLONG ldc, BLASLONG offset);
+int zgemmt_kernel_UR(BLASLONG m, BLASLONG n, BLASLONG k, double alpha_r, double alpha_i, double *a, double *b, double *c, BLASLONG ldc, BLASLONG offset);
+int zgemmt_kernel_UB(BLASLONG m, BLASLONG n, BLASLONG k, double alpha_r, double alpha_i, double *a, double *b, double *c, BLASLONG ldc, BLASLONG offset);
+int zgemmt_kernel_LL(BLASLONG m, BLASLONG n, BLASLONG k, double alpha_r, double alpha_i, double *a, double *b, double *c, BLASLONG ldc, BLASLONG offset);
+int zgemmt_kernel_LR(BLASLONG m, BLASLONG n, BLASLONG k, double alpha_r, double alpha_i, double *a, double *b, double *c, BLASLONG ldc, BLASLONG offset);
+int zgemmt_kernel_LB(BLASLONG m, BLASLONG n, BLASLONG k, double alpha_r, double alpha_i, double *a, double *b, double *c, BLASLONG ldc, BLASLONG offset);
+
+int xgemmt_kernel_UL(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble alpha_i, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset);
+int xgemmt_kernel_UR(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble alpha_i, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset);
+int xgemmt_kernel_UB(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble alpha_i, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset);
+int xgemmt_kernel_LL(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble alpha_i, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset);
+int xgemmt_kernel_LR(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble alpha_i, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset);
+int xgemmt_kernel_LB(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble alpha_i, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset);
+
 int cher2k_kernel_UN(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset, int flag);
 int cher2k_kernel_UC(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset, int flag);
 int cher2k_kernel_LN(BLASLONG m, BLASLONG n, BLASLONG k, float alpha_r, float alpha_i, float *a, float *b, float *c, BLASLONG ldc, BLASLONG offset, int flag);
@@ -506,6 +537,8 @@ int xher2k_kernel_LN(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdoubl
 int xher2k_kernel_LC(BLASLONG m, BLASLONG n, BLASLONG k, xdouble alpha_r, xdouble alpha_i, xdouble *a, xdouble *b, xdouble *c, BLASLONG ldc, BLASLONG offset, int flag);
 
 int sbgemm_kernel(BLASLONG, BLASLONG, BLASLONG, float,  bfloat16 *, bfloat16 *, float *, BLASLONG);
+int shgemm_kernel(BLASLONG, BLASLONG, BLASLONG, float,  hfloat16 *, hfloat16 *, float *, BLASLONG);
+int i8gemm_kernel(BLASLONG, BLASLONG, BLASLONG, int8_t *, uint8_t *, int32_t *, BLASLONG);
 int sgemm_kernel(BLASLONG, BLASLONG, BLASLONG, float,  float  *, float  *, float  *, BLASLONG);
 int dgemm_kernel(BLASLONG, BLASLONG, BLASLONG, double, double *, double *, double *, BLASLONG);
 
@@ -661,6 +694,10 @@ int sbgemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLAS
 int sbgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
 int sbgemm_tn(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
 int sbgemm_tt(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
+int shgemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_tn(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_tt(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
 
 int sgemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 int sgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
@@ -758,6 +795,10 @@ int sbgemm_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16
 int sbgemm_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
 int sbgemm_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
 int sbgemm_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, bfloat16 *, bfloat16 *, BLASLONG);
+int shgemm_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
+int shgemm_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, hfloat16 *, hfloat16 *, BLASLONG);
 
 int sgemm_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 int sgemm_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
@@ -1362,6 +1403,19 @@ int xtrmm_RCUN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASL
 int xtrmm_RCLU(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 int xtrmm_RCLN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 
+int strsm_task(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int strmm_task(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int dtrsm_task(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dtrmm_task(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int qtrsm_task(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qtrmm_task(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int ctrsm_task(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int ctrmm_task(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int ztrsm_task(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int ztrmm_task(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int xtrsm_task(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xtrmm_task(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+
 int ssymm_LU(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 int ssymm_LL(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 int ssymm_RU(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
@@ -1572,6 +1626,258 @@ int xsyrk_thread_UT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *,
 int xsyrk_thread_LN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 int xsyrk_thread_LT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 
+int sgemmt_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+
+int dgemmt_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+int qgemmt_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+
+int cgemmt_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_URN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UCN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_URT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UCT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UNR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UTR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_URR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UCR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UNC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UTC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_URC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_UCC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LRN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LCN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LRT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LCT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LNR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LTR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LRR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LCR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LNC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LTC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LRC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_LCC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+
+int zgemmt_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_URN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UCN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_URT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UCT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UNR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UTR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_URR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UCR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UNC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UTC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_URC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_UCC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LRN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LCN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LRT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LCT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LNR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LTR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LRR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LCR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LNC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LTC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LRC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_LCC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+int xgemmt_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_URN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UCN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_URT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UCT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UNR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UTR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_URR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UCR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UNC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UTC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_URC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_UCC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LRN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LCN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LRT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LCT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LNR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LTR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LRR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LCR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LNC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LTC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LRC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_LCC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+
+int sgemmt_thread_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_thread_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_thread_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_thread_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_thread_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_thread_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_thread_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemmt_thread_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+
+int dgemmt_thread_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_thread_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_thread_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_thread_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_thread_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_thread_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_thread_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemmt_thread_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+int qgemmt_thread_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_thread_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_thread_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_thread_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_thread_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_thread_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_thread_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int qgemmt_thread_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+
+int cgemmt_thread_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_URN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UCN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_URT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UCT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UNR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UTR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_URR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UCR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UNC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UTC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_URC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_UCC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LRN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LCN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LRT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LCT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LNR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LTR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LRR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LCR(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LNC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LTC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LRC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int cgemmt_thread_LCC(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+
+int zgemmt_thread_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_URN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UCN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_URT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UCT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UNR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UTR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_URR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UCR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UNC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UTC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_URC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_UCC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LRN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LCN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LRT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LCT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LNR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LTR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LRR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LCR(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LNC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LTC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LRC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int zgemmt_thread_LCC(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+int xgemmt_thread_UNN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UTN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_URN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UCN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UNT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UTT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_URT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UCT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UNR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UTR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_URR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UCR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UNC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UTC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_URC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_UCC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LNN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LTN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LRN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LCN(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LNT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LTT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LRT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LCT(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LNR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LTR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LRR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LCR(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LNC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LTC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LRC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+int xgemmt_thread_LCC(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+
 int ssyr2k_UN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 int ssyr2k_UT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 int ssyr2k_LN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
@@ -1945,6 +2251,79 @@ int cgemm_batch_thread(blas_arg_t * queue, BLASLONG nums);
 int zgemm_batch_thread(blas_arg_t * queue, BLASLONG nums);
 int sbgemm_batch_thread(blas_arg_t * queue, BLASLONG nums);
 
+int sgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG);
+int dgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG);
+int cgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG);
+int zgemm_batch_strided_thread(blas_arg_t *, BLASLONG, BLASLONG, BLASLONG, BLASLONG);
+
+/* routine_mode bits of the ?batch_small members */
+#define BATCH_SMALL_RSIDE	0x01
+#define BATCH_SMALL_LOWER	0x02
+#define BATCH_SMALL_TRANS	0x04
+#define BATCH_SMALL_CONJ	0x08
+#define BATCH_SMALL_UNIT	0x10
+
+blasint sgetrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+blasint dgetrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint cgetrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+blasint zgetrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint spotrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+blasint dpotrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint cpotrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+blasint zpotrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint sgetrs_small(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+blasint dgetrs_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint cgetrs_small(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+blasint zgetrs_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint strsm_small(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+blasint dtrsm_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint ctrsm_small(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+blasint ztrsm_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+int sbatch_small_thread(blas_arg_t * queue, BLASLONG nums);
+int dbatch_small_thread(blas_arg_t * queue, BLASLONG nums);
+int cbatch_small_thread(blas_arg_t * queue, BLASLONG nums);
+int zbatch_small_thread(blas_arg_t * queue, BLASLONG nums);
+
+/* Packed operands for ?gemm_pack / ?gemm_compute */
+#define GEMM_PACK_A	0
+#define GEMM_PACK_B	1
+#define GEMM_PACKED	2
+
+size_t sgemm_pack_size(int side, BLASLONG m, BLASLONG n, BLASLONG k);
+size_t dgemm_pack_size(int side, BLASLONG m, BLASLONG n, BLASLONG k);
+int sgemm_pack_copy(blas_arg_t *args, int side, int trans, void *dest);
+int dgemm_pack_copy(blas_arg_t *args, int side, int trans, void *dest);
+int sgemm_pack_check(void *packed, int side, BLASLONG dim, BLASLONG k, BLASLONG *q);
+int dgemm_pack_check(void *packed, int side, BLASLONG dim, BLASLONG k, BLASLONG *q);
+int sgemm_packed(blas_arg_t *args, int transa, int transb, float  *sa, float  *sb);
+int dgemm_packed(blas_arg_t *args, int transa, int transb, double *sa, double *sb);
+
+/* Epilogue of ?gemm_epilogue; the gemm_epilogue_t descriptor is passed in args -> d */
+int sgemm_epilogue(BLASLONG m, BLASLONG n, BLASLONG i, BLASLONG j, float  *c, BLASLONG ldc, gemm_epilogue_t *ep);
+int dgemm_epilogue(BLASLONG m, BLASLONG n, BLASLONG i, BLASLONG j, double *c, BLASLONG ldc, gemm_epilogue_t *ep);
+
+int sgemm_epilogue_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_epilogue_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_epilogue_tn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_epilogue_tt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int dgemm_epilogue_nn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_epilogue_nt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_epilogue_tn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_epilogue_tt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+int sgemm_epilogue_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_epilogue_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_epilogue_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_epilogue_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int dgemm_epilogue_thread_nn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_epilogue_thread_nt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_epilogue_thread_tn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_epilogue_thread_tt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+/* int8 x uint8 -> int32 gemm (cblas_gemm_s8u8s32) */
+int gemm_s8u8s32(blas_arg_t *args, i8gemm_opt_t *opt, void *sa, void *sb);
+
 #ifdef __CUDACC__
 }
 #endif
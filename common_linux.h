@@ -53,6 +53,10 @@ extern long int syscall (long int __sysno, ...);
 #define MPOL_INTERLEAVE 3
 #endif
 
+#ifndef MPOL_MF_MOVE
+#define MPOL_MF_MOVE (1 << 1)
+#endif
+
 #if defined(ARCH_IA64) && defined(__ECC)
 #ifndef __NR_mbind
 #define __NR_mbind			1259
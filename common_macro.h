@@ -40,6 +40,7 @@
 #define COMMON_MACRO
 
 #include "common_sb.h"
+#include "common_sh.h"
 #include "common_s.h"
 #include "common_d.h"
 #include "common_q.h"
@@ -207,6 +208,15 @@
 #define	SYRK_KERNEL_U		QSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		QSYRK_KERNEL_L
 
+#define	GEMMT_UNN		QGEMMT_UNN
+#define	GEMMT_UTN		QGEMMT_UTN
+#define	GEMMT_UNT		QGEMMT_UNT
+#define	GEMMT_UTT		QGEMMT_UTT
+#define	GEMMT_LNN		QGEMMT_LNN
+#define	GEMMT_LTN		QGEMMT_LTN
+#define	GEMMT_LNT		QGEMMT_LNT
+#define	GEMMT_LTT		QGEMMT_LTT
+
 #define	HERK_UN			QSYRK_UN
 #define	HERK_LN			QSYRK_LN
 #define	HERK_UC			QSYRK_UT
@@ -295,6 +305,9 @@
 #define	TRSM_RCLU		QTRSM_RTLU
 #define	TRSM_RCLN		QTRSM_RTLN
 
+#define	TRSM_TASK		QTRSM_TASK
+#define	TRMM_TASK		QTRMM_TASK
+
 #define	GEMM_THREAD_NN		QGEMM_THREAD_NN
 #define	GEMM_THREAD_CN		QGEMM_THREAD_TN
 #define	GEMM_THREAD_TN		QGEMM_THREAD_TN
@@ -331,6 +344,15 @@
 #define	SYRK_THREAD_LR		QSYRK_THREAD_LN
 #define	SYRK_THREAD_LC		QSYRK_THREAD_LT
 
+#define	GEMMT_THREAD_UNN		QGEMMT_THREAD_UNN
+#define	GEMMT_THREAD_UTN		QGEMMT_THREAD_UTN
+#define	GEMMT_THREAD_UNT		QGEMMT_THREAD_UNT
+#define	GEMMT_THREAD_UTT		QGEMMT_THREAD_UTT
+#define	GEMMT_THREAD_LNN		QGEMMT_THREAD_LNN
+#define	GEMMT_THREAD_LTN		QGEMMT_THREAD_LTN
+#define	GEMMT_THREAD_LNT		QGEMMT_THREAD_LNT
+#define	GEMMT_THREAD_LTT		QGEMMT_THREAD_LTT
+
 #define	HERK_THREAD_UN		QSYRK_THREAD_UN
 #define	HERK_THREAD_UT		QSYRK_THREAD_UT
 #define	HERK_THREAD_LN		QSYRK_THREAD_LN
@@ -498,6 +520,15 @@
 #define	SYRK_KERNEL_U		DSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		DSYRK_KERNEL_L
 
+#define	GEMMT_UNN		DGEMMT_UNN
+#define	GEMMT_UTN		DGEMMT_UTN
+#define	GEMMT_UNT		DGEMMT_UNT
+#define	GEMMT_UTT		DGEMMT_UTT
+#define	GEMMT_LNN		DGEMMT_LNN
+#define	GEMMT_LTN		DGEMMT_LTN
+#define	GEMMT_LNT		DGEMMT_LNT
+#define	GEMMT_LTT		DGEMMT_LTT
+
 #define	HERK_UN			DSYRK_UN
 #define	HERK_LN			DSYRK_LN
 #define	HERK_UC			DSYRK_UT
@@ -586,6 +617,9 @@
 #define	TRSM_RCLU		DTRSM_RTLU
 #define	TRSM_RCLN		DTRSM_RTLN
 
+#define	TRSM_TASK		DTRSM_TASK
+#define	TRMM_TASK		DTRMM_TASK
+
 #define	GEMM_THREAD_NN		DGEMM_THREAD_NN
 #define	GEMM_THREAD_CN		DGEMM_THREAD_TN
 #define	GEMM_THREAD_TN		DGEMM_THREAD_TN
@@ -603,6 +637,16 @@
 #define	GEMM_THREAD_RC		DGEMM_THREAD_NT
 #define	GEMM_THREAD_RR		DGEMM_THREAD_NN
 
+#define	GEMM_EPILOGUE		DGEMM_EPILOGUE
+#define	GEMM_EPILOGUE_NN	DGEMM_EPILOGUE_NN
+#define	GEMM_EPILOGUE_NT	DGEMM_EPILOGUE_NT
+#define	GEMM_EPILOGUE_TN	DGEMM_EPILOGUE_TN
+#define	GEMM_EPILOGUE_TT	DGEMM_EPILOGUE_TT
+#define	GEMM_EPILOGUE_THREAD_NN	DGEMM_EPILOGUE_THREAD_NN
+#define	GEMM_EPILOGUE_THREAD_NT	DGEMM_EPILOGUE_THREAD_NT
+#define	GEMM_EPILOGUE_THREAD_TN	DGEMM_EPILOGUE_THREAD_TN
+#define	GEMM_EPILOGUE_THREAD_TT	DGEMM_EPILOGUE_THREAD_TT
+
 #define	SYMM_THREAD_LU		DSYMM_THREAD_LU
 #define	SYMM_THREAD_LL		DSYMM_THREAD_LL
 #define	SYMM_THREAD_RU		DSYMM_THREAD_RU
@@ -622,6 +666,15 @@
 #define	SYRK_THREAD_LR		DSYRK_THREAD_LN
 #define	SYRK_THREAD_LC		DSYRK_THREAD_LT
 
+#define	GEMMT_THREAD_UNN		DGEMMT_THREAD_UNN
+#define	GEMMT_THREAD_UTN		DGEMMT_THREAD_UTN
+#define	GEMMT_THREAD_UNT		DGEMMT_THREAD_UNT
+#define	GEMMT_THREAD_UTT		DGEMMT_THREAD_UTT
+#define	GEMMT_THREAD_LNN		DGEMMT_THREAD_LNN
+#define	GEMMT_THREAD_LTN		DGEMMT_THREAD_LTN
+#define	GEMMT_THREAD_LNT		DGEMMT_THREAD_LNT
+#define	GEMMT_THREAD_LTT		DGEMMT_THREAD_LTT
+
 #define	HERK_THREAD_UN		DSYRK_THREAD_UN
 #define	HERK_THREAD_UT		DSYRK_THREAD_UT
 #define	HERK_THREAD_LN		DSYRK_THREAD_LN
@@ -880,6 +933,9 @@
 #define	TRSM_RCUN		STRSM_RTUN
 #define	TRSM_RCLU		STRSM_RTLU
 #define	TRSM_RCLN		STRSM_RTLN
+
+#define	TRSM_TASK		STRSM_TASK
+#define	TRMM_TASK		STRMM_TASK
 #define	SYRK_UN			SSYRK_UN
 #define	SYRK_UT			SSYRK_UT
 #define	SYRK_LN			SSYRK_LN
@@ -956,6 +1012,59 @@
 
 #endif
 
+#elif defined(HFLOAT16)
+
+#define S_TO_HF16_K     SHSTOHF16_K
+#define S_HF16_TO_K     SHF16TOS_K
+#define SHGEMV_N        SHGEMV_N_K
+#define SHGEMV_T        SHGEMV_T_K
+
+#define SCAL_K			SSCAL_K
+
+#define GEMM_BETA               SHGEMM_BETA
+#define	GEMM_KERNEL_N		SHGEMM_KERNEL
+#define	GEMM_KERNEL_L		SHGEMM_KERNEL
+#define	GEMM_KERNEL_R		SHGEMM_KERNEL
+#define	GEMM_KERNEL_B		SHGEMM_KERNEL
+
+#define	GEMM_NN			SHGEMM_NN
+#define	GEMM_CN			SHGEMM_TN
+#define	GEMM_TN			SHGEMM_TN
+#define	GEMM_NC			SHGEMM_NT
+#define	GEMM_NT			SHGEMM_NT
+#define	GEMM_CC			SHGEMM_TT
+#define	GEMM_CT			SHGEMM_TT
+#define	GEMM_TC			SHGEMM_TT
+#define	GEMM_TT			SHGEMM_TT
+#define	GEMM_NR			SHGEMM_NN
+#define	GEMM_TR			SHGEMM_TN
+#define	GEMM_CR			SHGEMM_TN
+#define	GEMM_RN			SHGEMM_NN
+#define	GEMM_RT			SHGEMM_NT
+#define	GEMM_RC			SHGEMM_NT
+#define	GEMM_RR			SHGEMM_NN
+#define	GEMM_ONCOPY		SHGEMM_ONCOPY
+#define	GEMM_OTCOPY		SHGEMM_OTCOPY
+#define	GEMM_INCOPY		SHGEMM_INCOPY
+#define	GEMM_ITCOPY		SHGEMM_ITCOPY
+
+#define	GEMM_THREAD_NN		SHGEMM_THREAD_NN
+#define	GEMM_THREAD_CN		SHGEMM_THREAD_TN
+#define	GEMM_THREAD_TN		SHGEMM_THREAD_TN
+#define	GEMM_THREAD_NC		SHGEMM_THREAD_NT
+#define	GEMM_THREAD_NT		SHGEMM_THREAD_NT
+#define	GEMM_THREAD_CC		SHGEMM_THREAD_TT
+#define	GEMM_THREAD_CT		SHGEMM_THREAD_TT
+#define	GEMM_THREAD_TC		SHGEMM_THREAD_TT
+#define	GEMM_THREAD_TT		SHGEMM_THREAD_TT
+#define	GEMM_THREAD_NR		SHGEMM_THREAD_NN
+#define	GEMM_THREAD_TR		SHGEMM_THREAD_TN
+#define	GEMM_THREAD_CR		SHGEMM_THREAD_TN
+#define	GEMM_THREAD_RN		SHGEMM_THREAD_NN
+#define	GEMM_THREAD_RT		SHGEMM_THREAD_NT
+#define	GEMM_THREAD_RC		SHGEMM_THREAD_NT
+#define	GEMM_THREAD_RR		SHGEMM_THREAD_NN
+
 #else
 
 #define	AMAX_K			SAMAX_K
@@ -1114,6 +1223,15 @@
 #define	SYRK_KERNEL_U		SSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		SSYRK_KERNEL_L
 
+#define	GEMMT_UNN		SGEMMT_UNN
+#define	GEMMT_UTN		SGEMMT_UTN
+#define	GEMMT_UNT		SGEMMT_UNT
+#define	GEMMT_UTT		SGEMMT_UTT
+#define	GEMMT_LNN		SGEMMT_LNN
+#define	GEMMT_LTN		SGEMMT_LTN
+#define	GEMMT_LNT		SGEMMT_LNT
+#define	GEMMT_LTT		SGEMMT_LTT
+
 #define	HERK_UN			SSYRK_UN
 #define	HERK_LN			SSYRK_LN
 #define	HERK_UC			SSYRK_UT
@@ -1202,6 +1320,9 @@
 #define	TRSM_RCLU		STRSM_RTLU
 #define	TRSM_RCLN		STRSM_RTLN
 
+#define	TRSM_TASK		STRSM_TASK
+#define	TRMM_TASK		STRMM_TASK
+
 #define	GEMM_THREAD_NN		SGEMM_THREAD_NN
 #define	GEMM_THREAD_CN		SGEMM_THREAD_TN
 #define	GEMM_THREAD_TN		SGEMM_THREAD_TN
@@ -1219,6 +1340,16 @@
 #define	GEMM_THREAD_RC		SGEMM_THREAD_NT
 #define	GEMM_THREAD_RR		SGEMM_THREAD_NN
 
+#define	GEMM_EPILOGUE		SGEMM_EPILOGUE
+#define	GEMM_EPILOGUE_NN	SGEMM_EPILOGUE_NN
+#define	GEMM_EPILOGUE_NT	SGEMM_EPILOGUE_NT
+#define	GEMM_EPILOGUE_TN	SGEMM_EPILOGUE_TN
+#define	GEMM_EPILOGUE_TT	SGEMM_EPILOGUE_TT
+#define	GEMM_EPILOGUE_THREAD_NN	SGEMM_EPILOGUE_THREAD_NN
+#define	GEMM_EPILOGUE_THREAD_NT	SGEMM_EPILOGUE_THREAD_NT
+#define	GEMM_EPILOGUE_THREAD_TN	SGEMM_EPILOGUE_THREAD_TN
+#define	GEMM_EPILOGUE_THREAD_TT	SGEMM_EPILOGUE_THREAD_TT
+
 #define	SYMM_THREAD_LU		SSYMM_THREAD_LU
 #define	SYMM_THREAD_LL		SSYMM_THREAD_LL
 #define	SYMM_THREAD_RU		SSYMM_THREAD_RU
@@ -1238,6 +1369,15 @@
 #define	SYRK_THREAD_LR		SSYRK_THREAD_LN
 #define	SYRK_THREAD_LC		SSYRK_THREAD_LT
 
+#define	GEMMT_THREAD_UNN		SGEMMT_THREAD_UNN
+#define	GEMMT_THREAD_UTN		SGEMMT_THREAD_UTN
+#define	GEMMT_THREAD_UNT		SGEMMT_THREAD_UNT
+#define	GEMMT_THREAD_UTT		SGEMMT_THREAD_UTT
+#define	GEMMT_THREAD_LNN		SGEMMT_THREAD_LNN
+#define	GEMMT_THREAD_LTN		SGEMMT_THREAD_LTN
+#define	GEMMT_THREAD_LNT		SGEMMT_THREAD_LNT
+#define	GEMMT_THREAD_LTT		SGEMMT_THREAD_LTT
+
 #define	HERK_THREAD_UN		SSYRK_THREAD_UN
 #define	HERK_THREAD_UT		SSYRK_THREAD_UT
 #define	HERK_THREAD_LN		SSYRK_THREAD_LN
@@ -1483,6 +1623,46 @@
 #define	SYRK_KERNEL_U		XSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		XSYRK_KERNEL_L
 
+#define	GEMMT_UNN		XGEMMT_UNN
+#define	GEMMT_UTN		XGEMMT_UTN
+#define	GEMMT_URN		XGEMMT_URN
+#define	GEMMT_UCN		XGEMMT_UCN
+#define	GEMMT_UNT		XGEMMT_UNT
+#define	GEMMT_UTT		XGEMMT_UTT
+#define	GEMMT_URT		XGEMMT_URT
+#define	GEMMT_UCT		XGEMMT_UCT
+#define	GEMMT_UNR		XGEMMT_UNR
+#define	GEMMT_UTR		XGEMMT_UTR
+#define	GEMMT_URR		XGEMMT_URR
+#define	GEMMT_UCR		XGEMMT_UCR
+#define	GEMMT_UNC		XGEMMT_UNC
+#define	GEMMT_UTC		XGEMMT_UTC
+#define	GEMMT_URC		XGEMMT_URC
+#define	GEMMT_UCC		XGEMMT_UCC
+#define	GEMMT_LNN		XGEMMT_LNN
+#define	GEMMT_LTN		XGEMMT_LTN
+#define	GEMMT_LRN		XGEMMT_LRN
+#define	GEMMT_LCN		XGEMMT_LCN
+#define	GEMMT_LNT		XGEMMT_LNT
+#define	GEMMT_LTT		XGEMMT_LTT
+#define	GEMMT_LRT		XGEMMT_LRT
+#define	GEMMT_LCT		XGEMMT_LCT
+#define	GEMMT_LNR		XGEMMT_LNR
+#define	GEMMT_LTR		XGEMMT_LTR
+#define	GEMMT_LRR		XGEMMT_LRR
+#define	GEMMT_LCR		XGEMMT_LCR
+#define	GEMMT_LNC		XGEMMT_LNC
+#define	GEMMT_LTC		XGEMMT_LTC
+#define	GEMMT_LRC		XGEMMT_LRC
+#define	GEMMT_LCC		XGEMMT_LCC
+
+#define	GEMMT_KERNEL_UL		XGEMMT_KERNEL_UL
+#define	GEMMT_KERNEL_UR		XGEMMT_KERNEL_UR
+#define	GEMMT_KERNEL_UB		XGEMMT_KERNEL_UB
+#define	GEMMT_KERNEL_LL		XGEMMT_KERNEL_LL
+#define	GEMMT_KERNEL_LR		XGEMMT_KERNEL_LR
+#define	GEMMT_KERNEL_LB		XGEMMT_KERNEL_LB
+
 #define	HERK_UN			XHERK_UN
 #define	HERK_LN			XHERK_LN
 #define	HERK_UC			XHERK_UC
@@ -1571,6 +1751,9 @@
 #define	TRSM_RCLU		XTRSM_RCLU
 #define	TRSM_RCLN		XTRSM_RCLN
 
+#define	TRSM_TASK		XTRSM_TASK
+#define	TRMM_TASK		XTRMM_TASK
+
 
 #define	GEMM_THREAD_NN		XGEMM_THREAD_NN
 #define	GEMM_THREAD_CN		XGEMM_THREAD_CN
@@ -1608,6 +1791,39 @@
 #define	SYRK_THREAD_LR		XSYRK_THREAD_LR
 #define	SYRK_THREAD_LC		XSYRK_THREAD_LC
 
+#define	GEMMT_THREAD_UNN		XGEMMT_THREAD_UNN
+#define	GEMMT_THREAD_UTN		XGEMMT_THREAD_UTN
+#define	GEMMT_THREAD_URN		XGEMMT_THREAD_URN
+#define	GEMMT_THREAD_UCN		XGEMMT_THREAD_UCN
+#define	GEMMT_THREAD_UNT		XGEMMT_THREAD_UNT
+#define	GEMMT_THREAD_UTT		XGEMMT_THREAD_UTT
+#define	GEMMT_THREAD_URT		XGEMMT_THREAD_URT
+#define	GEMMT_THREAD_UCT		XGEMMT_THREAD_UCT
+#define	GEMMT_THREAD_UNR		XGEMMT_THREAD_UNR
+#define	GEMMT_THREAD_UTR		XGEMMT_THREAD_UTR
+#define	GEMMT_THREAD_URR		XGEMMT_THREAD_URR
+#define	GEMMT_THREAD_UCR		XGEMMT_THREAD_UCR
+#define	GEMMT_THREAD_UNC		XGEMMT_THREAD_UNC
+#define	GEMMT_THREAD_UTC		XGEMMT_THREAD_UTC
+#define	GEMMT_THREAD_URC		XGEMMT_THREAD_URC
+#define	GEMMT_THREAD_UCC		XGEMMT_THREAD_UCC
+#define	GEMMT_THREAD_LNN		XGEMMT_THREAD_LNN
+#define	GEMMT_THREAD_LTN		XGEMMT_THREAD_LTN
+#define	GEMMT_THREAD_LRN		XGEMMT_THREAD_LRN
+#define	GEMMT_THREAD_LCN		XGEMMT_THREAD_LCN
+#define	GEMMT_THREAD_LNT		XGEMMT_THREAD_LNT
+#define	GEMMT_THREAD_LTT		XGEMMT_THREAD_LTT
+#define	GEMMT_THREAD_LRT		XGEMMT_THREAD_LRT
+#define	GEMMT_THREAD_LCT		XGEMMT_THREAD_LCT
+#define	GEMMT_THREAD_LNR		XGEMMT_THREAD_LNR
+#define	GEMMT_THREAD_LTR		XGEMMT_THREAD_LTR
+#define	GEMMT_THREAD_LRR		XGEMMT_THREAD_LRR
+#define	GEMMT_THREAD_LCR		XGEMMT_THREAD_LCR
+#define	GEMMT_THREAD_LNC		XGEMMT_THREAD_LNC
+#define	GEMMT_THREAD_LTC		XGEMMT_THREAD_LTC
+#define	GEMMT_THREAD_LRC		XGEMMT_THREAD_LRC
+#define	GEMMT_THREAD_LCC		XGEMMT_THREAD_LCC
+
 #define	HERK_THREAD_UN		XHERK_THREAD_UN
 #define	HERK_THREAD_UT		XHERK_THREAD_UT
 #define	HERK_THREAD_LN		XHERK_THREAD_LN
@@ -1885,6 +2101,46 @@
 #define	SYRK_KERNEL_U		ZSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		ZSYRK_KERNEL_L
 
+#define	GEMMT_UNN		ZGEMMT_UNN
+#define	GEMMT_UTN		ZGEMMT_UTN
+#define	GEMMT_URN		ZGEMMT_URN
+#define	GEMMT_UCN		ZGEMMT_UCN
+#define	GEMMT_UNT		ZGEMMT_UNT
+#define	GEMMT_UTT		ZGEMMT_UTT
+#define	GEMMT_URT		ZGEMMT_URT
+#define	GEMMT_UCT		ZGEMMT_UCT
+#define	GEMMT_UNR		ZGEMMT_UNR
+#define	GEMMT_UTR		ZGEMMT_UTR
+#define	GEMMT_URR		ZGEMMT_URR
+#define	GEMMT_UCR		ZGEMMT_UCR
+#define	GEMMT_UNC		ZGEMMT_UNC
+#define	GEMMT_UTC		ZGEMMT_UTC
+#define	GEMMT_URC		ZGEMMT_URC
+#define	GEMMT_UCC		ZGEMMT_UCC
+#define	GEMMT_LNN		ZGEMMT_LNN
+#define	GEMMT_LTN		ZGEMMT_LTN
+#define	GEMMT_LRN		ZGEMMT_LRN
+#define	GEMMT_LCN		ZGEMMT_LCN
+#define	GEMMT_LNT		ZGEMMT_LNT
+#define	GEMMT_LTT		ZGEMMT_LTT
+#define	GEMMT_LRT		ZGEMMT_LRT
+#define	GEMMT_LCT		ZGEMMT_LCT
+#define	GEMMT_LNR		ZGEMMT_LNR
+#define	GEMMT_LTR		ZGEMMT_LTR
+#define	GEMMT_LRR		ZGEMMT_LRR
+#define	GEMMT_LCR		ZGEMMT_LCR
+#define	GEMMT_LNC		ZGEMMT_LNC
+#define	GEMMT_LTC		ZGEMMT_LTC
+#define	GEMMT_LRC		ZGEMMT_LRC
+#define	GEMMT_LCC		ZGEMMT_LCC
+
+#define	GEMMT_KERNEL_UL		ZGEMMT_KERNEL_UL
+#define	GEMMT_KERNEL_UR		ZGEMMT_KERNEL_UR
+#define	GEMMT_KERNEL_UB		ZGEMMT_KERNEL_UB
+#define	GEMMT_KERNEL_LL		ZGEMMT_KERNEL_LL
+#define	GEMMT_KERNEL_LR		ZGEMMT_KERNEL_LR
+#define	GEMMT_KERNEL_LB		ZGEMMT_KERNEL_LB
+
 #define	HERK_UN			ZHERK_UN
 #define	HERK_LN			ZHERK_LN
 #define	HERK_UC			ZHERK_UC
@@ -1973,6 +2229,9 @@
 #define	TRSM_RCLU		ZTRSM_RCLU
 #define	TRSM_RCLN		ZTRSM_RCLN
 
+#define	TRSM_TASK		ZTRSM_TASK
+#define	TRMM_TASK		ZTRMM_TASK
+
 
 #define	GEMM_THREAD_NN		ZGEMM_THREAD_NN
 #define	GEMM_THREAD_CN		ZGEMM_THREAD_CN
@@ -2010,6 +2269,39 @@
 #define	SYRK_THREAD_LR		ZSYRK_THREAD_LR
 #define	SYRK_THREAD_LC		ZSYRK_THREAD_LC
 
+#define	GEMMT_THREAD_UNN		ZGEMMT_THREAD_UNN
+#define	GEMMT_THREAD_UTN		ZGEMMT_THREAD_UTN
+#define	GEMMT_THREAD_URN		ZGEMMT_THREAD_URN
+#define	GEMMT_THREAD_UCN		ZGEMMT_THREAD_UCN
+#define	GEMMT_THREAD_UNT		ZGEMMT_THREAD_UNT
+#define	GEMMT_THREAD_UTT		ZGEMMT_THREAD_UTT
+#define	GEMMT_THREAD_URT		ZGEMMT_THREAD_URT
+#define	GEMMT_THREAD_UCT		ZGEMMT_THREAD_UCT
+#define	GEMMT_THREAD_UNR		ZGEMMT_THREAD_UNR
+#define	GEMMT_THREAD_UTR		ZGEMMT_THREAD_UTR
+#define	GEMMT_THREAD_URR		ZGEMMT_THREAD_URR
+#define	GEMMT_THREAD_UCR		ZGEMMT_THREAD_UCR
+#define	GEMMT_THREAD_UNC		ZGEMMT_THREAD_UNC
+#define	GEMMT_THREAD_UTC		ZGEMMT_THREAD_UTC
+#define	GEMMT_THREAD_URC		ZGEMMT_THREAD_URC
+#define	GEMMT_THREAD_UCC		ZGEMMT_THREAD_UCC
+#define	GEMMT_THREAD_LNN		ZGEMMT_THREAD_LNN
+#define	GEMMT_THREAD_LTN		ZGEMMT_THREAD_LTN
+#define	GEMMT_THREAD_LRN		ZGEMMT_THREAD_LRN
+#define	GEMMT_THREAD_LCN		ZGEMMT_THREAD_LCN
+#define	GEMMT_THREAD_LNT		ZGEMMT_THREAD_LNT
+#define	GEMMT_THREAD_LTT		ZGEMMT_THREAD_LTT
+#define	GEMMT_THREAD_LRT		ZGEMMT_THREAD_LRT
+#define	GEMMT_THREAD_LCT		ZGEMMT_THREAD_LCT
+#define	GEMMT_THREAD_LNR		ZGEMMT_THREAD_LNR
+#define	GEMMT_THREAD_LTR		ZGEMMT_THREAD_LTR
+#define	GEMMT_THREAD_LRR		ZGEMMT_THREAD_LRR
+#define	GEMMT_THREAD_LCR		ZGEMMT_THREAD_LCR
+#define	GEMMT_THREAD_LNC		ZGEMMT_THREAD_LNC
+#define	GEMMT_THREAD_LTC		ZGEMMT_THREAD_LTC
+#define	GEMMT_THREAD_LRC		ZGEMMT_THREAD_LRC
+#define	GEMMT_THREAD_LCC		ZGEMMT_THREAD_LCC
+
 #define	HERK_THREAD_UN		ZHERK_THREAD_UN
 #define	HERK_THREAD_UT		ZHERK_THREAD_UT
 #define	HERK_THREAD_LN		ZHERK_THREAD_LN
@@ -2350,6 +2642,46 @@
 #define	SYRK_KERNEL_U		CSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		CSYRK_KERNEL_L
 
+#define	GEMMT_UNN		CGEMMT_UNN
+#define	GEMMT_UTN		CGEMMT_UTN
+#define	GEMMT_URN		CGEMMT_URN
+#define	GEMMT_UCN		CGEMMT_UCN
+#define	GEMMT_UNT		CGEMMT_UNT
+#define	GEMMT_UTT		CGEMMT_UTT
+#define	GEMMT_URT		CGEMMT_URT
+#define	GEMMT_UCT		CGEMMT_UCT
+#define	GEMMT_UNR		CGEMMT_UNR
+#define	GEMMT_UTR		CGEMMT_UTR
+#define	GEMMT_URR		CGEMMT_URR
+#define	GEMMT_UCR		CGEMMT_UCR
+#define	GEMMT_UNC		CGEMMT_UNC
+#define	GEMMT_UTC		CGEMMT_UTC
+#define	GEMMT_URC		CGEMMT_URC
+#define	GEMMT_UCC		CGEMMT_UCC
+#define	GEMMT_LNN		CGEMMT_LNN
+#define	GEMMT_LTN		CGEMMT_LTN
+#define	GEMMT_LRN		CGEMMT_LRN
+#define	GEMMT_LCN		CGEMMT_LCN
+#define	GEMMT_LNT		CGEMMT_LNT
+#define	GEMMT_LTT		CGEMMT_LTT
+#define	GEMMT_LRT		CGEMMT_LRT
+#define	GEMMT_LCT		CGEMMT_LCT
+#define	GEMMT_LNR		CGEMMT_LNR
+#define	GEMMT_LTR		CGEMMT_LTR
+#define	GEMMT_LRR		CGEMMT_LRR
+#define	GEMMT_LCR		CGEMMT_LCR
+#define	GEMMT_LNC		CGEMMT_LNC
+#define	GEMMT_LTC		CGEMMT_LTC
+#define	GEMMT_LRC		CGEMMT_LRC
+#define	GEMMT_LCC		CGEMMT_LCC
+
+#define	GEMMT_KERNEL_UL		CGEMMT_KERNEL_UL
+#define	GEMMT_KERNEL_UR		CGEMMT_KERNEL_UR
+#define	GEMMT_KERNEL_UB		CGEMMT_KERNEL_UB
+#define	GEMMT_KERNEL_LL		CGEMMT_KERNEL_LL
+#define	GEMMT_KERNEL_LR		CGEMMT_KERNEL_LR
+#define	GEMMT_KERNEL_LB		CGEMMT_KERNEL_LB
+
 #define	HERK_UN			CHERK_UN
 #define	HERK_LN			CHERK_LN
 #define	HERK_UC			CHERK_UC
@@ -2438,6 +2770,9 @@
 #define	TRSM_RCLU		CTRSM_RCLU
 #define	TRSM_RCLN		CTRSM_RCLN
 
+#define	TRSM_TASK		CTRSM_TASK
+#define	TRMM_TASK		CTRMM_TASK
+
 
 #define	GEMM_THREAD_NN		CGEMM_THREAD_NN
 #define	GEMM_THREAD_CN		CGEMM_THREAD_CN
@@ -2475,6 +2810,39 @@
 #define	SYRK_THREAD_LR		CSYRK_THREAD_LR
 #define	SYRK_THREAD_LC		CSYRK_THREAD_LC
 
+#define	GEMMT_THREAD_UNN		CGEMMT_THREAD_UNN
+#define	GEMMT_THREAD_UTN		CGEMMT_THREAD_UTN
+#define	GEMMT_THREAD_URN		CGEMMT_THREAD_URN
+#define	GEMMT_THREAD_UCN		CGEMMT_THREAD_UCN
+#define	GEMMT_THREAD_UNT		CGEMMT_THREAD_UNT
+#define	GEMMT_THREAD_UTT		CGEMMT_THREAD_UTT
+#define	GEMMT_THREAD_URT		CGEMMT_THREAD_URT
+#define	GEMMT_THREAD_UCT		CGEMMT_THREAD_UCT
+#define	GEMMT_THREAD_UNR		CGEMMT_THREAD_UNR
+#define	GEMMT_THREAD_UTR		CGEMMT_THREAD_UTR
+#define	GEMMT_THREAD_URR		CGEMMT_THREAD_URR
+#define	GEMMT_THREAD_UCR		CGEMMT_THREAD_UCR
+#define	GEMMT_THREAD_UNC		CGEMMT_THREAD_UNC
+#define	GEMMT_THREAD_UTC		CGEMMT_THREAD_UTC
+#define	GEMMT_THREAD_URC		CGEMMT_THREAD_URC
+#define	GEMMT_THREAD_UCC		CGEMMT_THREAD_UCC
+#define	GEMMT_THREAD_LNN		CGEMMT_THREAD_LNN
+#define	GEMMT_THREAD_LTN		CGEMMT_THREAD_LTN
+#define	GEMMT_THREAD_LRN		CGEMMT_THREAD_LRN
+#define	GEMMT_THREAD_LCN		CGEMMT_THREAD_LCN
+#define	GEMMT_THREAD_LNT		CGEMMT_THREAD_LNT
+#define	GEMMT_THREAD_LTT		CGEMMT_THREAD_LTT
+#define	GEMMT_THREAD_LRT		CGEMMT_THREAD_LRT
+#define	GEMMT_THREAD_LCT		CGEMMT_THREAD_LCT
+#define	GEMMT_THREAD_LNR		CGEMMT_THREAD_LNR
+#define	GEMMT_THREAD_LTR		CGEMMT_THREAD_LTR
+#define	GEMMT_THREAD_LRR		CGEMMT_THREAD_LRR
+#define	GEMMT_THREAD_LCR		CGEMMT_THREAD_LCR
+#define	GEMMT_THREAD_LNC		CGEMMT_THREAD_LNC
+#define	GEMMT_THREAD_LTC		CGEMMT_THREAD_LTC
+#define	GEMMT_THREAD_LRC		CGEMMT_THREAD_LRC
+#define	GEMMT_THREAD_LCC		CGEMMT_THREAD_LCC
+
 #define	HERK_THREAD_UN		CHERK_THREAD_UN
 #define	HERK_THREAD_UT		CHERK_THREAD_UT
 #define	HERK_THREAD_LN		CHERK_THREAD_LN
@@ -2661,6 +3029,36 @@ typedef struct {
   int routine_mode;
 
 } blas_arg_t;
+
+/* Epilogue of ?gemm_epilogue, applied to each block of C after its last k step.
+   The descriptor is passed to the drivers in args -> d. */
+#define GEMM_BIAS_NONE	0
+#define GEMM_BIAS_ROW	1	/* one value per row of C */
+#define GEMM_BIAS_COL	2	/* one value per column of C */
+
+#define GEMM_ACT_NONE	0
+#define GEMM_ACT_RELU	1
+#define GEMM_ACT_GELU	2
+#define GEMM_ACT_CLAMP	3
+
+typedef struct {
+  int bias, act;
+  void *bias_vector;
+  double lo, hi;
+  bfloat16 *bf16;	/* optional bf16 copy of C */
+  BLASLONG ldbf16;
+} gemm_epilogue_t;
+
+/* int8 x uint8 -> int32 gemm (cblas_gemm_s8u8s32) */
+#define I8GEMM_CO_FIX	0
+#define I8GEMM_CO_COL	1
+#define I8GEMM_CO_ROW	2
+
+typedef struct {
+  int transa, transb, offsetc;
+  int ao, bo;
+  BLASLONG c_rs, c_cs;	/* strides of C between rows and between columns */
+} i8gemm_opt_t;
 #endif
 
 #ifdef SMALL_MATRIX_OPT
@@ -2963,6 +3361,14 @@ typedef struct {
 #define GETRS_T		QGETRS_T
 #define GETRF_SINGLE	qgetrf_single
 #define GETRF_PARALLEL	qgetrf_parallel
+#define GETRF_ROWMAJOR_SINGLE	qgetrf_rowmajor_single
+#define GETRF_ROWMAJOR_PARALLEL	qgetrf_rowmajor_parallel
+#define GETRS_ROWMAJOR_SINGLE	qgetrs_rowmajor_single
+#define GETRS_ROWMAJOR_PARALLEL	qgetrs_rowmajor_parallel
+#define GEQRF_SINGLE	qgeqrf_single
+#define GEQRF_PARALLEL	qgeqrf_parallel
+#define ORMQR_SINGLE	qormqr_single
+#define ORMQR_PARALLEL	qormqr_parallel
 #define NEG_TCOPY	QNEG_TCOPY
 #define	LARF_L		QLARF_L
 #define	LARF_R		QLARF_R
@@ -2984,6 +3390,14 @@ typedef struct {
 #define GETRS_T		DGETRS_T
 #define GETRF_SINGLE	dgetrf_single
 #define GETRF_PARALLEL	dgetrf_parallel
+#define GETRF_ROWMAJOR_SINGLE	dgetrf_rowmajor_single
+#define GETRF_ROWMAJOR_PARALLEL	dgetrf_rowmajor_parallel
+#define GETRS_ROWMAJOR_SINGLE	dgetrs_rowmajor_single
+#define GETRS_ROWMAJOR_PARALLEL	dgetrs_rowmajor_parallel
+#define GEQRF_SINGLE	dgeqrf_single
+#define GEQRF_PARALLEL	dgeqrf_parallel
+#define ORMQR_SINGLE	dormqr_single
+#define ORMQR_PARALLEL	dormqr_parallel
 #define NEG_TCOPY	DNEG_TCOPY
 #define	LARF_L		DLARF_L
 #define	LARF_R		DLARF_R
@@ -3005,6 +3419,14 @@ typedef struct {
 #define GETRS_T		SGETRS_T
 #define GETRF_SINGLE	sgetrf_single
 #define GETRF_PARALLEL	sgetrf_parallel
+#define GETRF_ROWMAJOR_SINGLE	sgetrf_rowmajor_single
+#define GETRF_ROWMAJOR_PARALLEL	sgetrf_rowmajor_parallel
+#define GETRS_ROWMAJOR_SINGLE	sgetrs_rowmajor_single
+#define GETRS_ROWMAJOR_PARALLEL	sgetrs_rowmajor_parallel
+#define GEQRF_SINGLE	sgeqrf_single
+#define GEQRF_PARALLEL	sgeqrf_parallel
+#define ORMQR_SINGLE	sormqr_single
+#define ORMQR_PARALLEL	sormqr_parallel
 #define NEG_TCOPY	SNEG_TCOPY
 #define	LARF_L		SLARF_L
 #define	LARF_R		SLARF_R
@@ -3028,6 +3450,14 @@ typedef struct {
 #define GETRS_T		XGETRS_T
 #define GETRF_SINGLE	xgetrf_single
 #define GETRF_PARALLEL	xgetrf_parallel
+#define GETRF_ROWMAJOR_SINGLE	xgetrf_rowmajor_single
+#define GETRF_ROWMAJOR_PARALLEL	xgetrf_rowmajor_parallel
+#define GETRS_ROWMAJOR_SINGLE	xgetrs_rowmajor_single
+#define GETRS_ROWMAJOR_PARALLEL	xgetrs_rowmajor_parallel
+#define GEQRF_SINGLE	xgeqrf_single
+#define GEQRF_PARALLEL	xgeqrf_parallel
+#define ORMQR_SINGLE	xormqr_single
+#define ORMQR_PARALLEL	xormqr_parallel
 #define NEG_TCOPY	XNEG_TCOPY
 #define	LARF_L		XLARF_L
 #define	LARF_R		XLARF_R
@@ -3049,6 +3479,14 @@ typedef struct {
 #define GETRS_T		ZGETRS_T
 #define GETRF_SINGLE	zgetrf_single
 #define GETRF_PARALLEL	zgetrf_parallel
+#define GETRF_ROWMAJOR_SINGLE	zgetrf_rowmajor_single
+#define GETRF_ROWMAJOR_PARALLEL	zgetrf_rowmajor_parallel
+#define GETRS_ROWMAJOR_SINGLE	zgetrs_rowmajor_single
+#define GETRS_ROWMAJOR_PARALLEL	zgetrs_rowmajor_parallel
+#define GEQRF_SINGLE	zgeqrf_single
+#define GEQRF_PARALLEL	zgeqrf_parallel
+#define ORMQR_SINGLE	zormqr_single
+#define ORMQR_PARALLEL	zormqr_parallel
 #define NEG_TCOPY	ZNEG_TCOPY
 #define	LARF_L		ZLARF_L
 #define	LARF_R		ZLARF_R
@@ -3070,6 +3508,14 @@ typedef struct {
 #define GETRS_T		CGETRS_T
 #define GETRF_SINGLE	cgetrf_single
 #define GETRF_PARALLEL	cgetrf_parallel
+#define GETRF_ROWMAJOR_SINGLE	cgetrf_rowmajor_single
+#define GETRF_ROWMAJOR_PARALLEL	cgetrf_rowmajor_parallel
+#define GETRS_ROWMAJOR_SINGLE	cgetrs_rowmajor_single
+#define GETRS_ROWMAJOR_PARALLEL	cgetrs_rowmajor_parallel
+#define GEQRF_SINGLE	cgeqrf_single
+#define GEQRF_PARALLEL	cgeqrf_parallel
+#define ORMQR_SINGLE	cormqr_single
+#define ORMQR_PARALLEL	cormqr_parallel
 #define NEG_TCOPY	CNEG_TCOPY
 #define	LARF_L		CLARF_L
 #define	LARF_R		CLARF_R
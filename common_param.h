@@ -48,12 +48,12 @@ typedef struct {
   int dtb_entries;
   int switch_ratio;
   int offsetA, offsetB, align;
+  int need_amxtile_permission;  // 0 default, 1 for device support amx.
 
 #if BUILD_BFLOAT16 == 1
   int sbgemm_p, sbgemm_q, sbgemm_r;
   int sbgemm_unroll_m, sbgemm_unroll_n, sbgemm_unroll_mn;
   int sbgemm_align_k;
-  int need_amxtile_permission;  // 0 default, 1 for device support amx.
 
   void   (*sbstobf16_k) (BLASLONG, float    *, BLASLONG, bfloat16 *, BLASLONG);
   void   (*sbdtobf16_k) (BLASLONG, double   *, BLASLONG, bfloat16 *, BLASLONG);
@@ -164,6 +164,38 @@ BLASLONG (*isbmin_k) (BLASLONG, float *, BLASLONG);
 #endif
 #endif
 
+#if BUILD_HFLOAT16 == 1
+  int shgemm_p, shgemm_q, shgemm_r;
+  int shgemm_unroll_m, shgemm_unroll_n, shgemm_unroll_mn;
+
+  void   (*shstohf16_k) (BLASLONG, float    *, BLASLONG, hfloat16 *, BLASLONG);
+  void   (*shf16tos_k)  (BLASLONG, hfloat16 *, BLASLONG, float    *, BLASLONG);
+
+  int    (*shgemv_n) (BLASLONG, BLASLONG, float, hfloat16 *, BLASLONG, hfloat16 *, BLASLONG, float, float *, BLASLONG);
+  int    (*shgemv_t) (BLASLONG, BLASLONG, float, hfloat16 *, BLASLONG, hfloat16 *, BLASLONG, float, float *, BLASLONG);
+
+  int    (*shgemm_kernel   )(BLASLONG, BLASLONG, BLASLONG, float, hfloat16 *, hfloat16 *, float *, BLASLONG);
+  int    (*shgemm_beta     )(BLASLONG, BLASLONG, BLASLONG, float, hfloat16 *, BLASLONG, hfloat16 *, BLASLONG, float *, BLASLONG);
+
+  int    (*shgemm_incopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, hfloat16 *);
+  int    (*shgemm_itcopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, hfloat16 *);
+  int    (*shgemm_oncopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, hfloat16 *);
+  int    (*shgemm_otcopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, hfloat16 *);
+#endif
+
+#if (BUILD_SINGLE == 1)
+  int i8gemm_p, i8gemm_q, i8gemm_r;
+  int i8gemm_unroll_m, i8gemm_unroll_n;
+  int i8gemm_align_k;
+
+  int    (*i8gemm_kernel   )(BLASLONG, BLASLONG, BLASLONG, int8_t *, uint8_t *, int32_t *, BLASLONG);
+
+  int    (*i8gemm_incopy   )(BLASLONG, BLASLONG, int8_t *, BLASLONG, int8_t *);
+  int    (*i8gemm_itcopy   )(BLASLONG, BLASLONG, int8_t *, BLASLONG, int8_t *);
+  int    (*i8gemm_oncopy   )(BLASLONG, BLASLONG, uint8_t *, BLASLONG, uint8_t *);
+  int    (*i8gemm_otcopy   )(BLASLONG, BLASLONG, uint8_t *, BLASLONG, uint8_t *);
+#endif
+
 #if (BUILD_SINGLE == 1) || (BUILD_DOUBLE == 1) || (BUILD_COMPLEX == 1) || (BUILD_COMPLEX16 == 1)
   int sgemm_p, sgemm_q, sgemm_r;
   int sgemm_unroll_m, sgemm_unroll_n, sgemm_unroll_mn;
@@ -1230,6 +1262,24 @@ extern gotoblas_t *gotoblas;
 #define	SBGEMM_UNROLL_MN	gotoblas -> sbgemm_unroll_mn
 #endif
 
+#if (BUILD_HFLOAT16==1)
+#define	SHGEMM_P		gotoblas -> shgemm_p
+#define	SHGEMM_Q		gotoblas -> shgemm_q
+#define	SHGEMM_R		gotoblas -> shgemm_r
+#define	SHGEMM_UNROLL_M	gotoblas -> shgemm_unroll_m
+#define	SHGEMM_UNROLL_N	gotoblas -> shgemm_unroll_n
+#define	SHGEMM_UNROLL_MN	gotoblas -> shgemm_unroll_mn
+#endif
+
+#if (BUILD_SINGLE==1)
+#define	I8GEMM_P		gotoblas -> i8gemm_p
+#define	I8GEMM_Q		gotoblas -> i8gemm_q
+#define	I8GEMM_R		gotoblas -> i8gemm_r
+#define	I8GEMM_UNROLL_M	gotoblas -> i8gemm_unroll_m
+#define	I8GEMM_UNROLL_N	gotoblas -> i8gemm_unroll_n
+#define	I8GEMM_ALIGN	gotoblas -> i8gemm_align_k
+#endif
+
 #if (BUILD_SINGLE==1)
 #define	SGEMM_P		gotoblas -> sgemm_p
 #define	SGEMM_Q		gotoblas -> sgemm_q
@@ -1362,6 +1412,24 @@ extern gotoblas_t *gotoblas;
 #endif
 #endif
 
+#if (BUILD_HFLOAT16 == 1)
+#define	SHGEMM_P		SHGEMM_DEFAULT_P
+#define	SHGEMM_Q		SHGEMM_DEFAULT_Q
+#define	SHGEMM_R		SHGEMM_DEFAULT_R
+#define SHGEMM_UNROLL_M	SHGEMM_DEFAULT_UNROLL_M
+#define SHGEMM_UNROLL_N	SHGEMM_DEFAULT_UNROLL_N
+#define SHGEMM_UNROLL_MN	MAX((SHGEMM_UNROLL_M), (SHGEMM_UNROLL_N))
+#endif
+
+#if (BUILD_SINGLE == 1)
+#define	I8GEMM_P		I8GEMM_DEFAULT_P
+#define	I8GEMM_Q		I8GEMM_DEFAULT_Q
+#define	I8GEMM_R		I8GEMM_DEFAULT_R
+#define I8GEMM_UNROLL_M	I8GEMM_DEFAULT_UNROLL_M
+#define I8GEMM_UNROLL_N	I8GEMM_DEFAULT_UNROLL_N
+#define I8GEMM_ALIGN	I8GEMM_ALIGN_K
+#endif
+
 #define	SGEMM_P		SGEMM_DEFAULT_P
 #define	SGEMM_Q		SGEMM_DEFAULT_Q
 #define	SGEMM_R		SGEMM_DEFAULT_R
@@ -1509,6 +1577,18 @@ extern gotoblas_t *gotoblas;
 #define GEMM_DEFAULT_R		SBGEMM_DEFAULT_R
 #define GEMM_DEFAULT_UNROLL_M	SBGEMM_DEFAULT_UNROLL_M
 #define GEMM_DEFAULT_UNROLL_N	SBGEMM_DEFAULT_UNROLL_N
+#elif defined(HFLOAT16)
+#define GEMM_P			SHGEMM_P
+#define GEMM_Q			SHGEMM_Q
+#define GEMM_R			SHGEMM_R
+#define GEMM_UNROLL_M		SHGEMM_UNROLL_M
+#define GEMM_UNROLL_N		SHGEMM_UNROLL_N
+#define GEMM_UNROLL_MN		SHGEMM_UNROLL_MN
+#define GEMM_DEFAULT_P		SHGEMM_DEFAULT_P
+#define GEMM_DEFAULT_Q		SHGEMM_DEFAULT_Q
+#define GEMM_DEFAULT_R		SHGEMM_DEFAULT_R
+#define GEMM_DEFAULT_UNROLL_M	SHGEMM_DEFAULT_UNROLL_M
+#define GEMM_DEFAULT_UNROLL_N	SHGEMM_DEFAULT_UNROLL_N
 #else
 #define GEMM_P			SGEMM_P
 #define GEMM_Q			SGEMM_Q
@@ -1598,6 +1678,10 @@ extern gotoblas_t *gotoblas;
 #define SBGEMM_DEFAULT_R (((BUFFER_SIZE - ((SBGEMM_DEFAULT_P * SBGEMM_DEFAULT_Q *  4 + GEMM_DEFAULT_OFFSET_A + GEMM_DEFAULT_ALIGN) & ~GEMM_DEFAULT_ALIGN)) / (SBGEMM_DEFAULT_Q *  4) - 15) & ~15UL)
 #endif
 
+#ifndef SHGEMM_DEFAULT_R
+#define SHGEMM_DEFAULT_R (((BUFFER_SIZE - ((SHGEMM_DEFAULT_P * SHGEMM_DEFAULT_Q *  4 + GEMM_DEFAULT_OFFSET_A + GEMM_DEFAULT_ALIGN) & ~GEMM_DEFAULT_ALIGN)) / (SHGEMM_DEFAULT_Q *  4) - 15) & ~15UL)
+#endif
+
 #ifndef SGEMM_DEFAULT_R
 #define SGEMM_DEFAULT_R (((BUFFER_SIZE - ((SGEMM_DEFAULT_P * SGEMM_DEFAULT_Q *  4 + GEMM_DEFAULT_OFFSET_A + GEMM_DEFAULT_ALIGN) & ~GEMM_DEFAULT_ALIGN)) / (SGEMM_DEFAULT_Q *  4) - 15) & ~15UL)
 #endif
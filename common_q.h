@@ -297,6 +297,15 @@
 #define	QSYRK_KERNEL_U		qsyrk_kernel_U
 #define	QSYRK_KERNEL_L		qsyrk_kernel_L
 
+#define	QGEMMT_UNN		qgemmt_UNN
+#define	QGEMMT_UTN		qgemmt_UTN
+#define	QGEMMT_UNT		qgemmt_UNT
+#define	QGEMMT_UTT		qgemmt_UTT
+#define	QGEMMT_LNN		qgemmt_LNN
+#define	QGEMMT_LTN		qgemmt_LTN
+#define	QGEMMT_LNT		qgemmt_LNT
+#define	QGEMMT_LTT		qgemmt_LTT
+
 #define	QHERK_UN		qsyrk_UN
 #define	QHERK_LN		qsyrk_LN
 #define	QHERK_UC		qsyrk_UT
@@ -385,6 +394,9 @@
 #define	QTRSM_RCLU		qtrsm_RTLU
 #define	QTRSM_RCLN		qtrsm_RTLN
 
+#define	QTRSM_TASK		qtrsm_task
+#define	QTRMM_TASK		qtrmm_task
+
 #define	QGEMM_THREAD_NN		qgemm_thread_nn
 #define	QGEMM_THREAD_CN		qgemm_thread_tn
 #define	QGEMM_THREAD_TN		qgemm_thread_tn
@@ -421,6 +433,15 @@
 #define	QSYRK_THREAD_LR		qsyrk_thread_LN
 #define	QSYRK_THREAD_LC		qsyrk_thread_LT
 
+#define	QGEMMT_THREAD_UNN	qgemmt_thread_UNN
+#define	QGEMMT_THREAD_UTN	qgemmt_thread_UTN
+#define	QGEMMT_THREAD_UNT	qgemmt_thread_UNT
+#define	QGEMMT_THREAD_UTT	qgemmt_thread_UTT
+#define	QGEMMT_THREAD_LNN	qgemmt_thread_LNN
+#define	QGEMMT_THREAD_LTN	qgemmt_thread_LTN
+#define	QGEMMT_THREAD_LNT	qgemmt_thread_LNT
+#define	QGEMMT_THREAD_LTT	qgemmt_thread_LTT
+
 #define	QHERK_THREAD_UN		qsyrk_thread_UN
 #define	QHERK_THREAD_UT		qsyrk_thread_UT
 #define	QHERK_THREAD_LN		qsyrk_thread_LN
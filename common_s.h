@@ -120,6 +120,12 @@
 
 #define	SGEMM_KERNEL		sgemm_kernel
 
+#define	I8GEMM_KERNEL		i8gemm_kernel
+#define	I8GEMM_INCOPY		i8gemm_incopy
+#define	I8GEMM_ITCOPY		i8gemm_itcopy
+#define	I8GEMM_ONCOPY		i8gemm_oncopy
+#define	I8GEMM_OTCOPY		i8gemm_otcopy
+
 #define	STRMM_KERNEL_LN		strmm_kernel_LN
 #define	STRMM_KERNEL_LT		strmm_kernel_LT
 #define	STRMM_KERNEL_LR		strmm_kernel_LN
@@ -262,6 +268,12 @@
 #define	SGEMM_BETA		gotoblas -> sgemm_beta
 #define	SGEMM_KERNEL		gotoblas -> sgemm_kernel
 
+#define	I8GEMM_KERNEL		gotoblas -> i8gemm_kernel
+#define	I8GEMM_INCOPY		gotoblas -> i8gemm_incopy
+#define	I8GEMM_ITCOPY		gotoblas -> i8gemm_itcopy
+#define	I8GEMM_ONCOPY		gotoblas -> i8gemm_oncopy
+#define	I8GEMM_OTCOPY		gotoblas -> i8gemm_otcopy
+
 #define	STRMM_KERNEL_LN		gotoblas -> strmm_kernel_LN
 #define	STRMM_KERNEL_LT		gotoblas -> strmm_kernel_LT
 #define	STRMM_KERNEL_LR		gotoblas -> strmm_kernel_LN
@@ -355,6 +367,15 @@
 #define	SSYRK_KERNEL_U		ssyrk_kernel_U
 #define	SSYRK_KERNEL_L		ssyrk_kernel_L
 
+#define	SGEMMT_UNN		sgemmt_UNN
+#define	SGEMMT_UTN		sgemmt_UTN
+#define	SGEMMT_UNT		sgemmt_UNT
+#define	SGEMMT_UTT		sgemmt_UTT
+#define	SGEMMT_LNN		sgemmt_LNN
+#define	SGEMMT_LTN		sgemmt_LTN
+#define	SGEMMT_LNT		sgemmt_LNT
+#define	SGEMMT_LTT		sgemmt_LTT
+
 #define	SHERK_UN		ssyrk_UN
 #define	SHERK_LN		ssyrk_LN
 #define	SHERK_UC		ssyrk_UT
@@ -443,6 +464,9 @@
 #define	STRSM_RCLU		strsm_RTLU
 #define	STRSM_RCLN		strsm_RTLN
 
+#define	STRSM_TASK		strsm_task
+#define	STRMM_TASK		strmm_task
+
 #define	SGEMM_THREAD_NN		sgemm_thread_nn
 #define	SGEMM_THREAD_CN		sgemm_thread_tn
 #define	SGEMM_THREAD_TN		sgemm_thread_tn
@@ -460,6 +484,16 @@
 #define	SGEMM_THREAD_RC		sgemm_thread_nt
 #define	SGEMM_THREAD_RR		sgemm_thread_nn
 
+#define	SGEMM_EPILOGUE		sgemm_epilogue
+#define	SGEMM_EPILOGUE_NN	sgemm_epilogue_nn
+#define	SGEMM_EPILOGUE_NT	sgemm_epilogue_nt
+#define	SGEMM_EPILOGUE_TN	sgemm_epilogue_tn
+#define	SGEMM_EPILOGUE_TT	sgemm_epilogue_tt
+#define	SGEMM_EPILOGUE_THREAD_NN	sgemm_epilogue_thread_nn
+#define	SGEMM_EPILOGUE_THREAD_NT	sgemm_epilogue_thread_nt
+#define	SGEMM_EPILOGUE_THREAD_TN	sgemm_epilogue_thread_tn
+#define	SGEMM_EPILOGUE_THREAD_TT	sgemm_epilogue_thread_tt
+
 #define	SSYMM_THREAD_LU		ssymm_thread_LU
 #define	SSYMM_THREAD_LL		ssymm_thread_LL
 #define	SSYMM_THREAD_RU		ssymm_thread_RU
@@ -479,6 +513,15 @@
 #define	SSYRK_THREAD_LR		ssyrk_thread_LN
 #define	SSYRK_THREAD_LC		ssyrk_thread_LT
 
+#define	SGEMMT_THREAD_UNN	sgemmt_thread_UNN
+#define	SGEMMT_THREAD_UTN	sgemmt_thread_UTN
+#define	SGEMMT_THREAD_UNT	sgemmt_thread_UNT
+#define	SGEMMT_THREAD_UTT	sgemmt_thread_UTT
+#define	SGEMMT_THREAD_LNN	sgemmt_thread_LNN
+#define	SGEMMT_THREAD_LTN	sgemmt_thread_LTN
+#define	SGEMMT_THREAD_LNT	sgemmt_thread_LNT
+#define	SGEMMT_THREAD_LTT	sgemmt_thread_LTT
+
 #define	SHERK_THREAD_UN		ssyrk_thread_UN
 #define	SHERK_THREAD_UT		ssyrk_thread_UT
 #define	SHERK_THREAD_LN		ssyrk_thread_LN
@@ -139,6 +139,16 @@ extern int blas_server_avail;
 extern int blas_omp_number_max;
 extern int blas_omp_threads_local;
 
+#if !defined(USE_OPENMP) && !defined(OS_WINDOWS)
+extern __thread int blas_in_parallel;
+#endif
+
+#if defined(SMP_SERVER) && !defined(USE_OPENMP) && !defined(OS_WINDOWS)
+/* Stream work waiting for a worker of the thread server (blas_stream.c) */
+extern volatile int blas_stream_pending;
+void blas_stream_resume(void);
+#endif
+
 static __inline int num_cpu_avail(int level) {
 
 #ifdef USE_OPENMP
@@ -149,6 +159,9 @@ int openmp_nthreads;
 
 #ifndef USE_OPENMP 
   if (blas_cpu_number == 1
+#ifndef OS_WINDOWS
+      || blas_in_parallel
+#endif
 #else
      if (openmp_nthreads == 1 
 #endif
@@ -179,8 +192,10 @@ static __inline void blas_queue_init(blas_queue_t *queue){
 
 int blas_thread_init(void);
 int BLASFUNC(blas_thread_shutdown)(void);
+int blas_thread_buffer_trim(void);
 int exec_blas(BLASLONG, blas_queue_t *);
 int exec_blas_async(BLASLONG, blas_queue_t *);
+int exec_blas_async_try(BLASLONG, blas_queue_t *);
 int exec_blas_async_wait(BLASLONG, blas_queue_t *);
 
 #else
@@ -196,6 +211,33 @@ int blas_level1_thread(int mode, BLASLONG m, BLASLONG n, BLASLONG k, void *alpha
 		       void *b, BLASLONG ldb,
 		       void *c, BLASLONG ldc, int (*function)(void), int threads);
 
+/* Shortest piece of a vector that blas_level1_reduce() hands to a thread */
+#define L1_REDUCE_WIDTH		32768
+
+int blas_level1_reduce(int mode, BLASLONG n,
+		       void *x, BLASLONG incx,
+		       void *y, BLASLONG incy,
+		       void *result, int (*function)(void), int threads);
+
+/* Shapes of level 3 calls for blas_level3_threads() */
+#define BLAS_MODEL_SPLIT_M	0x1	/* rows of C may be divided between threads */
+#define BLAS_MODEL_SPLIT_N	0x2	/* columns of C may be divided between threads */
+#define BLAS_MODEL_TRIANGULAR	0x4	/* one operand is triangular, half the flops */
+#define BLAS_MODEL_SHARED	0x8	/* threads share packed panels and sync per k block */
+
+#define BLAS_MODEL_GEMM		(BLAS_MODEL_SPLIT_M | BLAS_MODEL_SPLIT_N | BLAS_MODEL_SHARED)
+#define BLAS_MODEL_SYMM		BLAS_MODEL_GEMM
+#define BLAS_MODEL_SYRK		(BLAS_MODEL_SPLIT_N | BLAS_MODEL_TRIANGULAR | BLAS_MODEL_SHARED)
+#define BLAS_MODEL_TRSM_L	(BLAS_MODEL_SPLIT_N | BLAS_MODEL_TRIANGULAR)
+#define BLAS_MODEL_TRSM_R	(BLAS_MODEL_SPLIT_M | BLAS_MODEL_TRIANGULAR)
+
+/* Number of threads worth using for an m x n x k call, at most nthreads.
+   unroll_m, unroll_n and q are the blocking of the kernels used. If
+   nthreads_m is not NULL, it receives how many of the threads divide m. */
+int blas_level3_threads(int shape, int mode, BLASLONG m, BLASLONG n, BLASLONG k,
+			BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q,
+			int nthreads, BLASLONG *nthreads_m);
+
 int gemm_thread_m (int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG ), void *, void *, BLASLONG);
 
 int gemm_thread_n (int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT*, FLOAT*, BLASLONG), void *, void *, BLASLONG);
@@ -423,6 +423,46 @@
 #define	XSYRK_KERNEL_U		xsyrk_kernel_U
 #define	XSYRK_KERNEL_L		xsyrk_kernel_L
 
+#define	XGEMMT_UNN		xgemmt_UNN
+#define	XGEMMT_UTN		xgemmt_UTN
+#define	XGEMMT_URN		xgemmt_URN
+#define	XGEMMT_UCN		xgemmt_UCN
+#define	XGEMMT_UNT		xgemmt_UNT
+#define	XGEMMT_UTT		xgemmt_UTT
+#define	XGEMMT_URT		xgemmt_URT
+#define	XGEMMT_UCT		xgemmt_UCT
+#define	XGEMMT_UNR		xgemmt_UNR
+#define	XGEMMT_UTR		xgemmt_UTR
+#define	XGEMMT_URR		xgemmt_URR
+#define	XGEMMT_UCR		xgemmt_UCR
+#define	XGEMMT_UNC		xgemmt_UNC
+#define	XGEMMT_UTC		xgemmt_UTC
+#define	XGEMMT_URC		xgemmt_URC
+#define	XGEMMT_UCC		xgemmt_UCC
+#define	XGEMMT_LNN		xgemmt_LNN
+#define	XGEMMT_LTN		xgemmt_LTN
+#define	XGEMMT_LRN		xgemmt_LRN
+#define	XGEMMT_LCN		xgemmt_LCN
+#define	XGEMMT_LNT		xgemmt_LNT
+#define	XGEMMT_LTT		xgemmt_LTT
+#define	XGEMMT_LRT		xgemmt_LRT
+#define	XGEMMT_LCT		xgemmt_LCT
+#define	XGEMMT_LNR		xgemmt_LNR
+#define	XGEMMT_LTR		xgemmt_LTR
+#define	XGEMMT_LRR		xgemmt_LRR
+#define	XGEMMT_LCR		xgemmt_LCR
+#define	XGEMMT_LNC		xgemmt_LNC
+#define	XGEMMT_LTC		xgemmt_LTC
+#define	XGEMMT_LRC		xgemmt_LRC
+#define	XGEMMT_LCC		xgemmt_LCC
+
+#define	XGEMMT_KERNEL_UL	xgemmt_kernel_UL
+#define	XGEMMT_KERNEL_UR	xgemmt_kernel_UR
+#define	XGEMMT_KERNEL_UB	xgemmt_kernel_UB
+#define	XGEMMT_KERNEL_LL	xgemmt_kernel_LL
+#define	XGEMMT_KERNEL_LR	xgemmt_kernel_LR
+#define	XGEMMT_KERNEL_LB	xgemmt_kernel_LB
+
 #define	XHERK_UN		xherk_UN
 #define	XHERK_LN		xherk_LN
 #define	XHERK_UC		xherk_UC
@@ -511,6 +551,9 @@
 #define	XTRSM_RCLU		xtrsm_RCLU
 #define	XTRSM_RCLN		xtrsm_RCLN
 
+#define	XTRSM_TASK		xtrsm_task
+#define	XTRMM_TASK		xtrmm_task
+
 #define	XGEMM_THREAD_NN		xgemm_thread_nn
 #define	XGEMM_THREAD_CN		xgemm_thread_cn
 #define	XGEMM_THREAD_TN		xgemm_thread_tn
@@ -547,6 +590,39 @@
 #define	XSYRK_THREAD_LR		xsyrk_thread_LN
 #define	XSYRK_THREAD_LC		xsyrk_thread_LT
 
+#define	XGEMMT_THREAD_UNN	xgemmt_thread_UNN
+#define	XGEMMT_THREAD_UTN	xgemmt_thread_UTN
+#define	XGEMMT_THREAD_URN	xgemmt_thread_URN
+#define	XGEMMT_THREAD_UCN	xgemmt_thread_UCN
+#define	XGEMMT_THREAD_UNT	xgemmt_thread_UNT
+#define	XGEMMT_THREAD_UTT	xgemmt_thread_UTT
+#define	XGEMMT_THREAD_URT	xgemmt_thread_URT
+#define	XGEMMT_THREAD_UCT	xgemmt_thread_UCT
+#define	XGEMMT_THREAD_UNR	xgemmt_thread_UNR
+#define	XGEMMT_THREAD_UTR	xgemmt_thread_UTR
+#define	XGEMMT_THREAD_URR	xgemmt_thread_URR
+#define	XGEMMT_THREAD_UCR	xgemmt_thread_UCR
+#define	XGEMMT_THREAD_UNC	xgemmt_thread_UNC
+#define	XGEMMT_THREAD_UTC	xgemmt_thread_UTC
+#define	XGEMMT_THREAD_URC	xgemmt_thread_URC
+#define	XGEMMT_THREAD_UCC	xgemmt_thread_UCC
+#define	XGEMMT_THREAD_LNN	xgemmt_thread_LNN
+#define	XGEMMT_THREAD_LTN	xgemmt_thread_LTN
+#define	XGEMMT_THREAD_LRN	xgemmt_thread_LRN
+#define	XGEMMT_THREAD_LCN	xgemmt_thread_LCN
+#define	XGEMMT_THREAD_LNT	xgemmt_thread_LNT
+#define	XGEMMT_THREAD_LTT	xgemmt_thread_LTT
+#define	XGEMMT_THREAD_LRT	xgemmt_thread_LRT
+#define	XGEMMT_THREAD_LCT	xgemmt_thread_LCT
+#define	XGEMMT_THREAD_LNR	xgemmt_thread_LNR
+#define	XGEMMT_THREAD_LTR	xgemmt_thread_LTR
+#define	XGEMMT_THREAD_LRR	xgemmt_thread_LRR
+#define	XGEMMT_THREAD_LCR	xgemmt_thread_LCR
+#define	XGEMMT_THREAD_LNC	xgemmt_thread_LNC
+#define	XGEMMT_THREAD_LTC	xgemmt_thread_LTC
+#define	XGEMMT_THREAD_LRC	xgemmt_thread_LRC
+#define	XGEMMT_THREAD_LCC	xgemmt_thread_LCC
+
 #define	XHERK_THREAD_UN		xherk_thread_UN
 #define	XHERK_THREAD_UT		xherk_thread_UT
 #define	XHERK_THREAD_LN		xherk_thread_LN
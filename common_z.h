@@ -512,6 +512,46 @@
 #define	ZSYRK_KERNEL_U		zsyrk_kernel_U
 #define	ZSYRK_KERNEL_L		zsyrk_kernel_L
 
+#define	ZGEMMT_UNN		zgemmt_UNN
+#define	ZGEMMT_UTN		zgemmt_UTN
+#define	ZGEMMT_URN		zgemmt_URN
+#define	ZGEMMT_UCN		zgemmt_UCN
+#define	ZGEMMT_UNT		zgemmt_UNT
+#define	ZGEMMT_UTT		zgemmt_UTT
+#define	ZGEMMT_URT		zgemmt_URT
+#define	ZGEMMT_UCT		zgemmt_UCT
+#define	ZGEMMT_UNR		zgemmt_UNR
+#define	ZGEMMT_UTR		zgemmt_UTR
+#define	ZGEMMT_URR		zgemmt_URR
+#define	ZGEMMT_UCR		zgemmt_UCR
+#define	ZGEMMT_UNC		zgemmt_UNC
+#define	ZGEMMT_UTC		zgemmt_UTC
+#define	ZGEMMT_URC		zgemmt_URC
+#define	ZGEMMT_UCC		zgemmt_UCC
+#define	ZGEMMT_LNN		zgemmt_LNN
+#define	ZGEMMT_LTN		zgemmt_LTN
+#define	ZGEMMT_LRN		zgemmt_LRN
+#define	ZGEMMT_LCN		zgemmt_LCN
+#define	ZGEMMT_LNT		zgemmt_LNT
+#define	ZGEMMT_LTT		zgemmt_LTT
+#define	ZGEMMT_LRT		zgemmt_LRT
+#define	ZGEMMT_LCT		zgemmt_LCT
+#define	ZGEMMT_LNR		zgemmt_LNR
+#define	ZGEMMT_LTR		zgemmt_LTR
+#define	ZGEMMT_LRR		zgemmt_LRR
+#define	ZGEMMT_LCR		zgemmt_LCR
+#define	ZGEMMT_LNC		zgemmt_LNC
+#define	ZGEMMT_LTC		zgemmt_LTC
+#define	ZGEMMT_LRC		zgemmt_LRC
+#define	ZGEMMT_LCC		zgemmt_LCC
+
+#define	ZGEMMT_KERNEL_UL	zgemmt_kernel_UL
+#define	ZGEMMT_KERNEL_UR	zgemmt_kernel_UR
+#define	ZGEMMT_KERNEL_UB	zgemmt_kernel_UB
+#define	ZGEMMT_KERNEL_LL	zgemmt_kernel_LL
+#define	ZGEMMT_KERNEL_LR	zgemmt_kernel_LR
+#define	ZGEMMT_KERNEL_LB	zgemmt_kernel_LB
+
 #define	ZHERK_UN		zherk_UN
 #define	ZHERK_LN		zherk_LN
 #define	ZHERK_UC		zherk_UC
@@ -600,6 +640,9 @@
 #define	ZTRSM_RCLU		ztrsm_RCLU
 #define	ZTRSM_RCLN		ztrsm_RCLN
 
+#define	ZTRSM_TASK		ztrsm_task
+#define	ZTRMM_TASK		ztrmm_task
+
 #define	ZGEMM_THREAD_NN		zgemm_thread_nn
 #define	ZGEMM_THREAD_CN		zgemm_thread_cn
 #define	ZGEMM_THREAD_TN		zgemm_thread_tn
@@ -636,6 +679,39 @@
 #define	ZSYRK_THREAD_LR		zsyrk_thread_LN
 #define	ZSYRK_THREAD_LC		zsyrk_thread_LT
 
+#define	ZGEMMT_THREAD_UNN	zgemmt_thread_UNN
+#define	ZGEMMT_THREAD_UTN	zgemmt_thread_UTN
+#define	ZGEMMT_THREAD_URN	zgemmt_thread_URN
+#define	ZGEMMT_THREAD_UCN	zgemmt_thread_UCN
+#define	ZGEMMT_THREAD_UNT	zgemmt_thread_UNT
+#define	ZGEMMT_THREAD_UTT	zgemmt_thread_UTT
+#define	ZGEMMT_THREAD_URT	zgemmt_thread_URT
+#define	ZGEMMT_THREAD_UCT	zgemmt_thread_UCT
+#define	ZGEMMT_THREAD_UNR	zgemmt_thread_UNR
+#define	ZGEMMT_THREAD_UTR	zgemmt_thread_UTR
+#define	ZGEMMT_THREAD_URR	zgemmt_thread_URR
+#define	ZGEMMT_THREAD_UCR	zgemmt_thread_UCR
+#define	ZGEMMT_THREAD_UNC	zgemmt_thread_UNC
+#define	ZGEMMT_THREAD_UTC	zgemmt_thread_UTC
+#define	ZGEMMT_THREAD_URC	zgemmt_thread_URC
+#define	ZGEMMT_THREAD_UCC	zgemmt_thread_UCC
+#define	ZGEMMT_THREAD_LNN	zgemmt_thread_LNN
+#define	ZGEMMT_THREAD_LTN	zgemmt_thread_LTN
+#define	ZGEMMT_THREAD_LRN	zgemmt_thread_LRN
+#define	ZGEMMT_THREAD_LCN	zgemmt_thread_LCN
+#define	ZGEMMT_THREAD_LNT	zgemmt_thread_LNT
+#define	ZGEMMT_THREAD_LTT	zgemmt_thread_LTT
+#define	ZGEMMT_THREAD_LRT	zgemmt_thread_LRT
+#define	ZGEMMT_THREAD_LCT	zgemmt_thread_LCT
+#define	ZGEMMT_THREAD_LNR	zgemmt_thread_LNR
+#define	ZGEMMT_THREAD_LTR	zgemmt_thread_LTR
+#define	ZGEMMT_THREAD_LRR	zgemmt_thread_LRR
+#define	ZGEMMT_THREAD_LCR	zgemmt_thread_LCR
+#define	ZGEMMT_THREAD_LNC	zgemmt_thread_LNC
+#define	ZGEMMT_THREAD_LTC	zgemmt_thread_LTC
+#define	ZGEMMT_THREAD_LRC	zgemmt_thread_LRC
+#define	ZGEMMT_THREAD_LCC	zgemmt_thread_LCC
+
 #define	ZHERK_THREAD_UN		zherk_thread_UN
 #define	ZHERK_THREAD_UT		zherk_thread_UT
 #define	ZHERK_THREAD_LN		zherk_thread_LN
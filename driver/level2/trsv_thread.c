@@ -0,0 +1,453 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Threaded triangular solve for full (trsv), packed (tpsv, PACKED)    */
+/* and banded (tbsv, BANDED) storage.                                 */
+/*                                                                    */
+/* The solution is cut into blocks of DTB_ENTRIES rows, handed out    */
+/* to the threads round robin in the order the substitution visits    */
+/* them. A thread owning a block keeps subtracting the contribution   */
+/* of whatever blocks have been solved so far, in one GEMV for full   */
+/* storage or column by column otherwise, then solves its diagonal    */
+/* block and publishes it by advancing a shared counter. Blocks can   */
+/* only finish in order, so the counter is all the threads need to    */
+/* wait on, and most of the update of a block is done while earlier   */
+/* blocks are still being solved.                                     */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifndef COMPLEX
+#ifndef TRANSA
+#define MYGEMV	GEMV_N
+#undef TRANS
+#else
+#define MYGEMV	GEMV_T
+#define TRANS
+#endif
+#define MYDOT	DOTU_K
+#define MYAXPY	AXPYU_K
+#else
+#if    TRANSA == 1
+#define MYGEMV	GEMV_N
+#undef TRANS
+#define MYDOT	DOTU_K
+#define MYAXPY	AXPYU_K
+#elif  TRANSA == 2
+#define MYGEMV	GEMV_T
+#define TRANS
+#define MYDOT	DOTU_K
+#define MYAXPY	AXPYU_K
+#elif  TRANSA == 3
+#define MYGEMV	GEMV_R
+#undef TRANS
+#define MYDOT	DOTC_K
+#define MYAXPY	AXPYC_K
+#else
+#define MYGEMV	GEMV_C
+#define TRANS
+#define MYDOT	DOTC_K
+#define MYAXPY	AXPYC_K
+#endif
+#endif
+
+/* Lower without transpose and upper with transpose run top down */
+#if (defined(LOWER) && !defined(TRANS)) || (!defined(LOWER) && defined(TRANS))
+#define FORWARD
+#endif
+
+#if !defined(PACKED) && !defined(BANDED)
+static const FLOAT dm1 = -1.;
+#endif
+
+/* Offset such that A(i, j) is a[(column(j) + i) * COMPSIZE] */
+static __inline BLASLONG column(BLASLONG j, BLASLONG n, BLASLONG k, BLASLONG lda){
+#if defined(PACKED)
+#ifndef LOWER
+  return j * (j + 1) / 2;
+#else
+  return j * (2 * n - j - 1) / 2;
+#endif
+#elif defined(BANDED)
+#ifndef LOWER
+  return j * lda + k - j;
+#else
+  return j * lda - j;
+#endif
+#else
+  return j * lda;
+#endif
+}
+
+/* First and last row stored in column j */
+static __inline BLASLONG first_row(BLASLONG j, BLASLONG k){
+#if defined(BANDED) && !defined(LOWER)
+  return MAX(j - k, 0);
+#elif defined(LOWER)
+  return j;
+#else
+  return 0;
+#endif
+}
+
+static __inline BLASLONG last_row(BLASLONG j, BLASLONG n, BLASLONG k){
+#if defined(BANDED) && defined(LOWER)
+  return MIN(j + k, n - 1);
+#elif defined(LOWER)
+  return n - 1;
+#else
+  return j;
+#endif
+}
+
+/* x[is:ie] -= op(A) restricted to the solved entries x[js:je] */
+static void update(FLOAT *a, BLASLONG lda, BLASLONG n, BLASLONG k, FLOAT *x,
+		   BLASLONG is, BLASLONG ie, BLASLONG js, BLASLONG je, FLOAT *buffer){
+
+#if defined(PACKED) || defined(BANDED)
+#ifndef TRANS
+  BLASLONG j, from, to;
+#else
+  BLASLONG i, from, to;
+#endif
+#ifdef TRANS
+#ifndef COMPLEX
+  FLOAT result;
+#else
+  OPENBLAS_COMPLEX_FLOAT result;
+#endif
+#endif
+#endif
+
+#if defined(BANDED)
+  /* Columns (or rows) further away than the bandwidth do not contribute */
+#ifdef FORWARD
+  if (js < is - k) js = is - k;
+#else
+  if (je > ie + k) je = ie + k;
+#endif
+#endif
+
+  if (js >= je) return;
+
+#if !defined(PACKED) && !defined(BANDED)
+
+#ifndef TRANS
+  MYGEMV(ie - is, je - js, 0, dm1,
+#ifdef COMPLEX
+	 ZERO,
+#endif
+	 a + (is + js * lda) * COMPSIZE, lda,
+	 x + js * COMPSIZE, 1,
+	 x + is * COMPSIZE, 1, buffer);
+#else
+  MYGEMV(je - js, ie - is, 0, dm1,
+#ifdef COMPLEX
+	 ZERO,
+#endif
+	 a + (js + is * lda) * COMPSIZE, lda,
+	 x + js * COMPSIZE, 1,
+	 x + is * COMPSIZE, 1, buffer);
+#endif
+
+#else
+
+#ifndef TRANS
+  for (j = js; j < je; j ++) {
+    from = MAX(is, first_row(j, k));
+    to   = MIN(ie, last_row(j, n, k) + 1);
+
+    if (from < to)
+      MYAXPY(to - from, 0, 0,
+	     -x[j * COMPSIZE + 0],
+#ifdef COMPLEX
+	     -x[j * COMPSIZE + 1],
+#endif
+	     a + (column(j, n, k, lda) + from) * COMPSIZE, 1,
+	     x + from * COMPSIZE, 1, NULL, 0);
+  }
+#else
+  for (i = is; i < ie; i ++) {
+    from = MAX(js, first_row(i, k));
+    to   = MIN(je, last_row(i, n, k) + 1);
+
+    if (from < to) {
+      result = MYDOT(to - from, a + (column(i, n, k, lda) + from) * COMPSIZE, 1,
+		     x + from * COMPSIZE, 1);
+#ifndef COMPLEX
+      x[i] -= result;
+#else
+      x[i * COMPSIZE + 0] -= CREAL(result);
+      x[i * COMPSIZE + 1] -= CIMAG(result);
+#endif
+    }
+  }
+#endif
+
+#endif
+}
+
+/* Substitution within the diagonal block x[is:ie] */
+static void solve(FLOAT *a, BLASLONG lda, BLASLONG n, BLASLONG k, FLOAT *x,
+		  BLASLONG is, BLASLONG ie){
+
+  BLASLONG i, l, from, to;
+  FLOAT *ap;
+#ifdef TRANS
+#ifndef COMPLEX
+  FLOAT result;
+#else
+  OPENBLAS_COMPLEX_FLOAT result;
+#endif
+#endif
+#if defined(COMPLEX) && !defined(UNIT)
+  FLOAT ar, ai, br, bi, ratio, den;
+#endif
+
+  for (l = 0; l < ie - is; l ++) {
+
+#ifdef FORWARD
+    i = is + l;
+#else
+    i = ie - 1 - l;
+#endif
+
+    ap = a + column(i, n, k, lda) * COMPSIZE;
+
+    /* Rows of column i inside the block that are already solved (TRANS) */
+    /* or still to be updated (no TRANS)                                  */
+#ifdef LOWER
+    from = i + 1;
+    to   = MIN(ie, last_row(i, n, k) + 1);
+#else
+    from = MAX(is, first_row(i, k));
+    to   = i;
+#endif
+
+#ifdef TRANS
+    if (from < to) {
+      result = MYDOT(to - from, ap + from * COMPSIZE, 1, x + from * COMPSIZE, 1);
+#ifndef COMPLEX
+      x[i] -= result;
+#else
+      x[i * COMPSIZE + 0] -= CREAL(result);
+      x[i * COMPSIZE + 1] -= CIMAG(result);
+#endif
+    }
+#endif
+
+#ifndef UNIT
+#ifndef COMPLEX
+    x[i] /= ap[i];
+#else
+    ar = ap[i * COMPSIZE + 0];
+    ai = ap[i * COMPSIZE + 1];
+
+    if (fabs(ar) >= fabs(ai)){
+      ratio = ai / ar;
+      den = 1./(ar * ( 1 + ratio * ratio));
+      ar =  den;
+#if TRANSA < 3
+      ai = -ratio * den;
+#else
+      ai =  ratio * den;
+#endif
+    } else {
+      ratio = ar / ai;
+      den = 1./(ai * ( 1 + ratio * ratio));
+      ar =  ratio * den;
+#if TRANSA < 3
+      ai = -den;
+#else
+      ai =  den;
+#endif
+    }
+
+    br = x[i * COMPSIZE + 0];
+    bi = x[i * COMPSIZE + 1];
+
+    x[i * COMPSIZE + 0] = ar*br - ai*bi;
+    x[i * COMPSIZE + 1] = ar*bi + ai*br;
+#endif
+#endif
+
+#ifndef TRANS
+    if (from < to)
+      MYAXPY(to - from, 0, 0,
+	     -x[i * COMPSIZE + 0],
+#ifdef COMPLEX
+	     -x[i * COMPSIZE + 1],
+#endif
+	     ap + from * COMPSIZE, 1, x + from * COMPSIZE, 1, NULL, 0);
+#endif
+  }
+}
+
+static int trsv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *dummy, FLOAT *buffer, BLASLONG pos){
+
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *x = (FLOAT *)args -> b;
+  BLASLONG n   = args -> m;
+  BLASLONG k   = args -> k;
+  BLASLONG lda = args -> lda;
+  volatile BLASLONG *solved = (volatile BLASLONG *)args -> common;
+
+  BLASLONG blocks = (n + DTB_ENTRIES - 1) / DTB_ENTRIES;
+  BLASLONG step, done, avail, is, ie;
+
+  for (step = *range_m; step < blocks; step += args -> nthreads) {
+
+#ifdef FORWARD
+    is = step * DTB_ENTRIES;
+    ie = MIN(is + DTB_ENTRIES, n);
+#else
+    ie = n - step * DTB_ENTRIES;
+    is = MAX(ie - DTB_ENTRIES, 0);
+#endif
+
+    /* Blocks are published in order, so the counter never passes ours */
+    done = 0;
+    while (done < step) {
+
+      while ((avail = *solved) == done) {YIELDING;};
+      MB;
+
+#ifdef FORWARD
+      update(a, lda, n, k, x, is, ie, done * DTB_ENTRIES, avail * DTB_ENTRIES, buffer);
+#else
+      update(a, lda, n, k, x, is, ie, n - avail * DTB_ENTRIES, n - done * DTB_ENTRIES, buffer);
+#endif
+
+      done = avail;
+    }
+
+    solve(a, lda, n, k, x, is, ie);
+
+    WMB;
+    *solved = step + 1;
+  }
+
+  return 0;
+}
+
+#if defined(PACKED)
+int CNAME(BLASLONG n, FLOAT *a, FLOAT *x, BLASLONG incx, FLOAT *buffer, int nthreads){
+#elif defined(BANDED)
+int CNAME(BLASLONG n, BLASLONG k, FLOAT *a, BLASLONG lda, FLOAT *x, BLASLONG incx, FLOAT *buffer, int nthreads){
+#else
+int CNAME(BLASLONG n, FLOAT *a, BLASLONG lda, FLOAT *x, BLASLONG incx, FLOAT *buffer, int nthreads){
+#endif
+
+  blas_arg_t args;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER];
+  volatile BLASLONG solved;
+
+  BLASLONG i, blocks, num_cpu;
+  FLOAT *B = x;
+#ifdef PACKED
+  BLASLONG lda = 0;
+#endif
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  int mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  int mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  int mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  int mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+
+  if (incx != 1) {
+    B = buffer;
+    buffer = (FLOAT *)(((BLASLONG)buffer + n * COMPSIZE * sizeof(FLOAT) + 4095) & ~4095);
+    COPY_K(n, x, incx, B, 1);
+  }
+
+  blocks  = (n + DTB_ENTRIES - 1) / DTB_ENTRIES;
+  num_cpu = MIN(nthreads, blocks);
+
+#ifdef BANDED
+  /* Only blocks within the bandwidth of each other can overlap */
+  if (num_cpu > k / DTB_ENTRIES + 1) num_cpu = k / DTB_ENTRIES + 1;
+#endif
+
+  solved = 0;
+
+  args.m = n;
+#ifdef BANDED
+  args.k = k;
+#else
+  args.k = 0;
+#endif
+  args.a = (void *)a;
+  args.b = (void *)B;
+  args.lda = lda;
+  args.common   = (void *)&solved;
+  args.nthreads = num_cpu;
+
+  for (i = 0; i < num_cpu; i ++) {
+    range[i] = i;
+
+    queue[i].mode    = mode;
+    queue[i].routine = trsv_kernel;
+    queue[i].args    = &args;
+    queue[i].range_m = &range[i];
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  queue[0].sb = buffer;
+  queue[num_cpu - 1].next = NULL;
+
+  exec_blas(num_cpu, queue);
+
+  if (incx != 1) {
+    COPY_K(n, B, 1, x, incx);
+  }
+
+  return 0;
+}
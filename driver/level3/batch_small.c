@@ -0,0 +1,561 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <math.h>
+#include "common.h"
+
+/* Batches of small problems (up to a few dozen rows). Every member is  */
+/* described by one blas_arg_t and runs to completion on one thread      */
+/* with the unblocked kernels below: the matrices fit in L1, so there is */
+/* nothing to gain from packing, and the per-call buffer allocation and  */
+/* thread decisions of the regular drivers are paid once per batch.      */
+
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define GETRF_SMALL		dgetrf_small
+#define POTRF_SMALL		dpotrf_small
+#define GETRS_SMALL		dgetrs_small
+#define TRSM_SMALL		dtrsm_small
+#define BATCH_SMALL_THREAD	dbatch_small_thread
+#define BATCH_MODE		(BLAS_DOUBLE | BLAS_REAL)
+#else
+#define GETRF_SMALL		sgetrf_small
+#define POTRF_SMALL		spotrf_small
+#define GETRS_SMALL		sgetrs_small
+#define TRSM_SMALL		strsm_small
+#define BATCH_SMALL_THREAD	sbatch_small_thread
+#define BATCH_MODE		(BLAS_SINGLE | BLAS_REAL)
+#endif
+#else
+#ifdef DOUBLE
+#define GETRF_SMALL		zgetrf_small
+#define POTRF_SMALL		zpotrf_small
+#define GETRS_SMALL		zgetrs_small
+#define TRSM_SMALL		ztrsm_small
+#define BATCH_SMALL_THREAD	zbatch_small_thread
+#define BATCH_MODE		(BLAS_DOUBLE | BLAS_COMPLEX)
+#else
+#define GETRF_SMALL		cgetrf_small
+#define POTRF_SMALL		cpotrf_small
+#define GETRS_SMALL		cgetrs_small
+#define TRSM_SMALL		ctrsm_small
+#define BATCH_SMALL_THREAD	cbatch_small_thread
+#define BATCH_MODE		(BLAS_SINGLE | BLAS_COMPLEX)
+#endif
+#endif
+
+/* Fewest cost units (m * n * k) worth handing to another thread */
+#define BATCH_SMALL_MIN_COST	65536.
+
+/* Per member overhead, in the same units, so that batches of tiny */
+/* members are still spread by count                               */
+#define BATCH_SMALL_OVERHEAD	64.
+
+#define ELEM(a, lda, i, j)	((a) + ((i) + (j) * (lda)) * COMPSIZE)
+
+#ifndef COMPLEX
+#define CABS1(x)	fabs((x)[0])
+#else
+#define CABS1(x)	(fabs((x)[0]) + fabs((x)[1]))
+#endif
+
+/* y -= s * x */
+static inline void axpy_small(BLASLONG n, FLOAT *s, FLOAT *x, FLOAT *y){
+  BLASLONG i;
+#ifndef COMPLEX
+  FLOAT sr = s[0];
+
+  for (i = 0; i < n; i++) y[i] -= sr * x[i];
+#else
+  FLOAT sr = s[0], si = s[1];
+
+  for (i = 0; i < n; i++) {
+    y[i * 2 + 0] -= sr * x[i * 2 + 0] - si * x[i * 2 + 1];
+    y[i * 2 + 1] -= sr * x[i * 2 + 1] + si * x[i * 2 + 0];
+  }
+#endif
+}
+
+/* x *= s */
+static inline void scal_small(BLASLONG n, FLOAT *s, FLOAT *x){
+  BLASLONG i;
+#ifndef COMPLEX
+  FLOAT sr = s[0];
+
+  for (i = 0; i < n; i++) x[i] *= sr;
+#else
+  FLOAT sr = s[0], si = s[1], xr, xi;
+
+  for (i = 0; i < n; i++) {
+    xr = x[i * 2 + 0];
+    xi = x[i * 2 + 1];
+    x[i * 2 + 0] = sr * xr - si * xi;
+    x[i * 2 + 1] = sr * xi + si * xr;
+  }
+#endif
+}
+
+/* r = sum x * y, with x conjugated if conj */
+static inline void dot_small(BLASLONG n, FLOAT *x, FLOAT *y, int conj, FLOAT *r){
+  BLASLONG i;
+#ifndef COMPLEX
+  FLOAT sum = 0.;
+
+  for (i = 0; i < n; i++) sum += x[i] * y[i];
+  r[0] = sum;
+#else
+  FLOAT rr = 0., ri = 0., ic = conj ? -1. : 1.;
+
+  for (i = 0; i < n; i++) {
+    rr += x[i * 2 + 0] * y[i * 2 + 0] - ic * x[i * 2 + 1] * y[i * 2 + 1];
+    ri += x[i * 2 + 0] * y[i * 2 + 1] + ic * x[i * 2 + 1] * y[i * 2 + 0];
+  }
+  r[0] = rr;
+  r[1] = ri;
+#endif
+}
+
+/* r = 1 / a, with a conjugated if conj */
+static inline void recip_small(FLOAT *a, int conj, FLOAT *r){
+#ifndef COMPLEX
+  r[0] = ONE / a[0];
+#else
+  FLOAT ar = a[0], ai = conj ? -a[1] : a[1], ratio, den;
+
+  if (fabs(ar) >= fabs(ai)) {
+    ratio = ai / ar;
+    den   = ONE / (ar * (ONE + ratio * ratio));
+    r[0]  =  den;
+    r[1]  = -ratio * den;
+  } else {
+    ratio = ar / ai;
+    den   = ONE / (ai * (ONE + ratio * ratio));
+    r[0]  =  ratio * den;
+    r[1]  = -den;
+  }
+#endif
+}
+
+/* Element (i, j) of op(A): A, A**T or A**H for trans 0, 1 or 2 */
+static inline void op_elem(FLOAT *a, BLASLONG lda, BLASLONG i, BLASLONG j, int trans, FLOAT *r){
+  FLOAT *p = trans ? ELEM(a, lda, j, i) : ELEM(a, lda, i, j);
+
+  r[0] = p[0];
+#ifdef COMPLEX
+  r[1] = (trans == 2) ? -p[1] : p[1];
+#endif
+}
+
+/* op(A) X = alpha B (left) or X op(A) = alpha B (right), B overwritten by X */
+static void trsm_small(int mode, BLASLONG m, BLASLONG n, FLOAT *alpha,
+		       FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb){
+
+  int lower = mode & BATCH_SMALL_LOWER;
+  int unit  = mode & BATCH_SMALL_UNIT;
+  int trans = (mode & BATCH_SMALL_TRANS) ? ((mode & BATCH_SMALL_CONJ) ? 2 : 1) : 0;
+  BLASLONG i, j, k;
+  FLOAT *x, s[2];
+
+  if (alpha[0] != ONE
+#ifdef COMPLEX
+      || alpha[1] != ZERO
+#endif
+      ) {
+    for (j = 0; j < n; j++) {
+      x = ELEM(b, ldb, 0, j);
+      if (alpha[0] == ZERO
+#ifdef COMPLEX
+	  && alpha[1] == ZERO
+#endif
+	  ) {
+	for (i = 0; i < m * COMPSIZE; i++) x[i] = ZERO;
+      } else {
+	scal_small(m, alpha, x);
+      }
+    }
+    if (alpha[0] == ZERO
+#ifdef COMPLEX
+	&& alpha[1] == ZERO
+#endif
+	) return;
+  }
+
+#ifdef COMPLEX
+  /* conj(A) X = B is A conj(X) = conj(B) */
+  if ((mode & BATCH_SMALL_CONJ) && !(mode & BATCH_SMALL_TRANS)) {
+    s[0] = ONE;
+    s[1] = ZERO;
+    for (j = 0; j < n; j++)
+      for (i = 0; i < m; i++) ELEM(b, ldb, i, j)[1] = -ELEM(b, ldb, i, j)[1];
+    trsm_small(mode & ~BATCH_SMALL_CONJ, m, n, s, a, lda, b, ldb);
+    for (j = 0; j < n; j++)
+      for (i = 0; i < m; i++) ELEM(b, ldb, i, j)[1] = -ELEM(b, ldb, i, j)[1];
+    return;
+  }
+#endif
+
+  if (!(mode & BATCH_SMALL_RSIDE)) {
+
+    /* Column by column of B */
+    for (j = 0; j < n; j++) {
+      x = ELEM(b, ldb, 0, j);
+
+      if (!trans) {
+	if (!lower) {
+	  for (k = m - 1; k >= 0; k--) {
+	    if (!unit) {
+	      recip_small(ELEM(a, lda, k, k), 0, s);
+	      scal_small(1, s, x + k * COMPSIZE);
+	    }
+	    axpy_small(k, x + k * COMPSIZE, ELEM(a, lda, 0, k), x);
+	  }
+	} else {
+	  for (k = 0; k < m; k++) {
+	    if (!unit) {
+	      recip_small(ELEM(a, lda, k, k), 0, s);
+	      scal_small(1, s, x + k * COMPSIZE);
+	    }
+	    axpy_small(m - k - 1, x + k * COMPSIZE, ELEM(a, lda, k + 1, k), x + (k + 1) * COMPSIZE);
+	  }
+	}
+      } else {
+	/* op(A) is lower for an upper A, rows of op(A) are columns of A */
+	if (!lower) {
+	  for (i = 0; i < m; i++) {
+	    dot_small(i, ELEM(a, lda, 0, i), x, trans == 2, s);
+	    x[i * COMPSIZE + 0] -= s[0];
+#ifdef COMPLEX
+	    x[i * COMPSIZE + 1] -= s[1];
+#endif
+	    if (!unit) {
+	      recip_small(ELEM(a, lda, i, i), trans == 2, s);
+	      scal_small(1, s, x + i * COMPSIZE);
+	    }
+	  }
+	} else {
+	  for (i = m - 1; i >= 0; i--) {
+	    dot_small(m - i - 1, ELEM(a, lda, i + 1, i), x + (i + 1) * COMPSIZE, trans == 2, s);
+	    x[i * COMPSIZE + 0] -= s[0];
+#ifdef COMPLEX
+	    x[i * COMPSIZE + 1] -= s[1];
+#endif
+	    if (!unit) {
+	      recip_small(ELEM(a, lda, i, i), trans == 2, s);
+	      scal_small(1, s, x + i * COMPSIZE);
+	    }
+	  }
+	}
+      }
+    }
+
+  } else {
+
+    /* Column j of X depends on the columns before it when op(A) is */
+    /* upper triangular, and on those after it otherwise            */
+    if ((trans == 0) == (lower == 0)) {
+      for (j = 0; j < n; j++) {
+	x = ELEM(b, ldb, 0, j);
+	for (k = 0; k < j; k++) {
+	  op_elem(a, lda, k, j, trans, s);
+	  axpy_small(m, s, ELEM(b, ldb, 0, k), x);
+	}
+	if (!unit) {
+	  recip_small(ELEM(a, lda, j, j), trans == 2, s);
+	  scal_small(m, s, x);
+	}
+      }
+    } else {
+      for (j = n - 1; j >= 0; j--) {
+	x = ELEM(b, ldb, 0, j);
+	for (k = j + 1; k < n; k++) {
+	  op_elem(a, lda, k, j, trans, s);
+	  axpy_small(m, s, ELEM(b, ldb, 0, k), x);
+	}
+	if (!unit) {
+	  recip_small(ELEM(a, lda, j, j), trans == 2, s);
+	  scal_small(m, s, x);
+	}
+      }
+    }
+  }
+}
+
+/* Row interchanges of ipiv applied to B, forward or backward */
+static void laswp_small(BLASLONG n, BLASLONG nrhs, blasint *ipiv, FLOAT *b, BLASLONG ldb, int backward){
+  BLASLONG i, j, k, p;
+  FLOAT t, *x;
+
+  for (k = 0; k < n; k++) {
+    i = backward ? n - 1 - k : k;
+    p = ipiv[i] - 1;
+    if (p == i) continue;
+
+    for (j = 0; j < nrhs; j++) {
+      x = ELEM(b, ldb, 0, j);
+      t = x[i * COMPSIZE + 0]; x[i * COMPSIZE + 0] = x[p * COMPSIZE + 0]; x[p * COMPSIZE + 0] = t;
+#ifdef COMPLEX
+      t = x[i * COMPSIZE + 1]; x[i * COMPSIZE + 1] = x[p * COMPSIZE + 1]; x[p * COMPSIZE + 1] = t;
+#endif
+    }
+  }
+}
+
+/* Right-looking LU with partial pivoting, as ?getf2 */
+blasint GETRF_SMALL(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid){
+
+  BLASLONG m = args -> m, n = args -> n, lda = args -> lda;
+  FLOAT *a = (FLOAT *)args -> a, *col, max, t, s[2];
+  blasint *ipiv = (blasint *)args -> c;
+  blasint info = 0;
+  BLASLONG i, j, k, jp;
+
+  for (j = 0; j < MIN(m, n); j++) {
+    col = ELEM(a, lda, 0, j);
+
+    jp  = j;
+    max = CABS1(col + j * COMPSIZE);
+    for (i = j + 1; i < m; i++) {
+      if (CABS1(col + i * COMPSIZE) > max) {
+	max = CABS1(col + i * COMPSIZE);
+	jp  = i;
+      }
+    }
+
+    ipiv[j] = jp + 1;
+
+    if (max != ZERO) {
+      if (jp != j) {
+	for (k = 0; k < n; k++) {
+	  t = ELEM(a, lda, j, k)[0]; ELEM(a, lda, j, k)[0] = ELEM(a, lda, jp, k)[0]; ELEM(a, lda, jp, k)[0] = t;
+#ifdef COMPLEX
+	  t = ELEM(a, lda, j, k)[1]; ELEM(a, lda, j, k)[1] = ELEM(a, lda, jp, k)[1]; ELEM(a, lda, jp, k)[1] = t;
+#endif
+	}
+      }
+      recip_small(col + j * COMPSIZE, 0, s);
+      scal_small(m - j - 1, s, col + (j + 1) * COMPSIZE);
+    } else if (!info) {
+      info = j + 1;
+    }
+
+    for (k = j + 1; k < n; k++)
+      axpy_small(m - j - 1, ELEM(a, lda, j, k), col + (j + 1) * COMPSIZE, ELEM(a, lda, j + 1, k));
+  }
+
+  return info;
+}
+
+/* Cholesky factor of the triangle selected by BATCH_SMALL_LOWER, as ?potf2 */
+blasint POTRF_SMALL(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid){
+
+  BLASLONG n = args -> n, lda = args -> lda;
+  FLOAT *a = (FLOAT *)args -> a, *col, *diag, d, s[2];
+  BLASLONG j, k;
+
+  for (j = 0; j < n; j++) {
+    col  = ELEM(a, lda, 0, j);
+    diag = ELEM(a, lda, j, j);
+
+    if (!(args -> routine_mode & BATCH_SMALL_LOWER)) {
+      /* U**H U: column j of U from the columns before it */
+      for (k = 0; k < j; k++) {
+	dot_small(k, ELEM(a, lda, 0, k), col, 1, s);
+	col[k * COMPSIZE + 0] -= s[0];
+#ifdef COMPLEX
+	col[k * COMPSIZE + 1] -= s[1];
+#endif
+	s[0] = ONE / ELEM(a, lda, k, k)[0];
+#ifdef COMPLEX
+	s[1] = ZERO;
+#endif
+	scal_small(1, s, col + k * COMPSIZE);
+      }
+      dot_small(j, col, col, 1, s);
+      d = diag[0] - s[0];
+    } else {
+      /* L L**H: row j of L is strided */
+      d = diag[0];
+      for (k = 0; k < j; k++) {
+	s[0] = ELEM(a, lda, j, k)[0];
+	d -= s[0] * s[0];
+#ifdef COMPLEX
+	s[1] = ELEM(a, lda, j, k)[1];
+	d -= s[1] * s[1];
+#endif
+      }
+    }
+
+    if (d <= ZERO || isnan(d)) {
+      diag[0] = d;
+      return j + 1;
+    }
+
+    d = sqrt(d);
+    diag[0] = d;
+#ifdef COMPLEX
+    diag[1] = ZERO;
+#endif
+
+    if (args -> routine_mode & BATCH_SMALL_LOWER) {
+      for (k = 0; k < j; k++) {
+	s[0] = ELEM(a, lda, j, k)[0];
+#ifdef COMPLEX
+	s[1] = -ELEM(a, lda, j, k)[1];
+#endif
+	axpy_small(n - j - 1, s, ELEM(a, lda, j + 1, k), ELEM(a, lda, j + 1, j));
+      }
+      s[0] = ONE / d;
+#ifdef COMPLEX
+      s[1] = ZERO;
+#endif
+      scal_small(n - j - 1, s, ELEM(a, lda, j + 1, j));
+    }
+  }
+
+  return 0;
+}
+
+/* Solve with the factors of GETRF_SMALL, op(A) given by the trans bits */
+blasint GETRS_SMALL(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid){
+
+  int trans = args -> routine_mode & (BATCH_SMALL_TRANS | BATCH_SMALL_CONJ);
+  FLOAT one[2] = {ONE, ZERO};
+
+  if (!trans) {
+    laswp_small(args -> m, args -> n, (blasint *)args -> c, (FLOAT *)args -> b, args -> ldb, 0);
+    trsm_small(BATCH_SMALL_LOWER | BATCH_SMALL_UNIT, args -> m, args -> n, one,
+	       (FLOAT *)args -> a, args -> lda, (FLOAT *)args -> b, args -> ldb);
+    trsm_small(0, args -> m, args -> n, one,
+	       (FLOAT *)args -> a, args -> lda, (FLOAT *)args -> b, args -> ldb);
+  } else {
+    trsm_small(trans, args -> m, args -> n, one,
+	       (FLOAT *)args -> a, args -> lda, (FLOAT *)args -> b, args -> ldb);
+    trsm_small(trans | BATCH_SMALL_LOWER | BATCH_SMALL_UNIT, args -> m, args -> n, one,
+	       (FLOAT *)args -> a, args -> lda, (FLOAT *)args -> b, args -> ldb);
+    laswp_small(args -> m, args -> n, (blasint *)args -> c, (FLOAT *)args -> b, args -> ldb, 1);
+  }
+
+  return 0;
+}
+
+blasint TRSM_SMALL(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid){
+
+  trsm_small(args -> routine_mode, args -> m, args -> n, (FLOAT *)args -> alpha,
+	     (FLOAT *)args -> a, args -> lda, (FLOAT *)args -> b, args -> ldb);
+
+  return 0;
+}
+
+/* Runs one member; its info goes where args -> d points, if anywhere */
+static void batch_member(blas_arg_t *args){
+  blasint (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = args -> routine;
+  blasint info;
+
+  info = routine(args, NULL, NULL, NULL, NULL, 0);
+
+  if (args -> d) *(blasint *)args -> d = info;
+}
+
+#ifdef SMP
+static double batch_cost(blas_arg_t *args){
+  return (double)args -> m * (double)args -> n * (double)MAX(args -> k, 1) + BATCH_SMALL_OVERHEAD;
+}
+
+static int batch_range(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid){
+  BLASLONG i;
+
+  for (i = range_m[0]; i < range_m[1]; i++) batch_member(&args[i]);
+
+  return 0;
+}
+#endif
+
+/* Members are split into contiguous runs of about equal cost, one per */
+/* thread, so there is no shared counter to contend on per member      */
+int BATCH_SMALL_THREAD(blas_arg_t *args_array, BLASLONG nums){
+
+  BLASLONG i;
+
+#ifdef SMP
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  double total = 0., part, sum;
+  BLASLONG nthreads, t;
+
+  if (nums <= 0) return 0;
+
+  nthreads = num_cpu_avail(3);
+
+  if (nthreads > 1) {
+    for (i = 0; i < nums; i++) total += batch_cost(&args_array[i]);
+
+    if (total < BATCH_SMALL_MIN_COST * (double)nthreads)
+      nthreads = (BLASLONG)(total / BATCH_SMALL_MIN_COST);
+    if (nthreads > nums) nthreads = nums;
+  }
+
+  if (nthreads > 1) {
+    part = total / (double)nthreads;
+    sum  = 0.;
+    t    = 1;
+
+    range[0] = 0;
+    for (i = 0; i < nums && t < nthreads; i++) {
+      sum += batch_cost(&args_array[i]);
+      while (t < nthreads && sum >= part * (double)t) range[t ++] = i + 1;
+    }
+    while (t <= nthreads) range[t ++] = nums;
+
+    for (i = 0; i < nthreads; i++) {
+      queue[i].mode    = BATCH_MODE;
+      queue[i].routine = batch_range;
+      queue[i].args    = args_array;
+      queue[i].range_m = &range[i];
+      queue[i].range_n = NULL;
+      queue[i].sa      = NULL;
+      queue[i].sb      = NULL;
+      queue[i].next    = &queue[i + 1];
+    }
+    queue[nthreads - 1].next = NULL;
+
+    exec_blas(nthreads, queue);
+
+    return 0;
+  }
+#endif
+
+  for (i = 0; i < nums; i++) batch_member(&args_array[i]);
+
+  return 0;
+}
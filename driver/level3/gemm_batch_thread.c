@@ -76,15 +76,84 @@ static int inner_small_matrix_thread(blas_arg_t *args, BLASLONG *range_m, BLASLO
 }
 #endif
 
+#ifdef SMP
+/* Dynamic scheduling for heterogeneous batches.                      */
+/* Every problem (or, for the large ones, a column slice of it) is a  */
+/* task; tasks are sorted by decreasing M*N*K and the worker threads  */
+/* pull the next one from a shared counter, so no thread waits for    */
+/* the slowest member of a fixed wave.                                */
+
+typedef struct {
+  blas_arg_t *args;
+  BLASLONG range_n[2];
+  double cost;
+  BLASLONG index;
+} batch_task_t;
+
+typedef struct {
+  batch_task_t *tasks;
+  BLASLONG num;
+  BLASLONG next;
+  volatile BLASULONG lock;
+} batch_sched_t;
+
+static int batch_task_compare(const void *p1, const void *p2){
+  const batch_task_t *t1 = (const batch_task_t *)p1;
+  const batch_task_t *t2 = (const batch_task_t *)p2;
+
+  if (t1 -> cost > t2 -> cost) return -1;
+  if (t1 -> cost < t2 -> cost) return  1;
+  if (t1 -> index < t2 -> index) return -1;
+  if (t1 -> index > t2 -> index) return  1;
+  if (t1 -> range_n[0] < t2 -> range_n[0]) return -1;
+  if (t1 -> range_n[0] > t2 -> range_n[0]) return  1;
+  return 0;
+}
+
+static int batch_worker(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IFLOAT *sb, BLASLONG mypos){
+  batch_sched_t *sched = (batch_sched_t *)args -> common;
+  batch_task_t *task;
+  int (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG);
+  BLASLONG current;
+
+  while (1) {
+    blas_lock(&sched -> lock);
+    current = sched -> next;
+    if (current < sched -> num) sched -> next = current + 1;
+    blas_unlock(&sched -> lock);
+
+    if (current >= sched -> num) break;
+
+    task = &sched -> tasks[current];
+
+#ifdef SMALL_MATRIX_OPT
+    if (task -> args -> routine_mode & BLAS_SMALL_OPT) {
+      inner_small_matrix_thread(task -> args, NULL, NULL, NULL, NULL, 0);
+      continue;
+    }
+#endif
+    routine = task -> args -> routine;
+    routine(task -> args, NULL, task -> range_n, sa, sb, 0);
+  }
+
+  return 0;
+}
+#endif
+
 int CNAME(blas_arg_t * args_array, BLASLONG nums){
   XFLOAT *buffer;
   XFLOAT *sa, *sb;
   int nthreads=1;
   int (*routine)(blas_arg_t *, void *, void *, XFLOAT *, XFLOAT *, BLASLONG);
-  int i=0, /*j,*/ current_nums;
+  int i=0;
 
 #ifdef SMP
-  blas_queue_t * queue=NULL;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  blas_arg_t   sched_args;
+  batch_sched_t sched;
+  batch_task_t *tasks;
+  double cost, total_cost, part_cost;
+  BLASLONG num_tasks, parts, width, n_from, j;
 #endif
   
   if(nums <=0 ) return 0;
@@ -116,41 +185,205 @@ int CNAME(blas_arg_t * args_array, BLASLONG nums){
   } else {
     //multi thread
 
-    queue=(blas_queue_t *)malloc((nums+1) * sizeof(blas_queue_t));
-    if(queue == NULL){
+    total_cost = 0.;
+    for(i=0; i<nums; i++){
+      total_cost += (double)args_array[i].m * (double)args_array[i].n * (double)MAX(args_array[i].k, 1);
+    }
+    part_cost = total_cost / (double)nthreads;
+
+    /* A member that alone exceeds the per-thread share is cut into at */
+    /* most nthreads column slices, so that it does not tail the batch */
+    tasks=(batch_task_t *)malloc(nums * nthreads * sizeof(batch_task_t));
+    if(tasks == NULL){
       openblas_warning(0, "memory alloc failed!\n");
+      blas_memory_free(buffer);
       return(1);
     }
+
+    num_tasks = 0;
     for(i=0; i<nums; i++){
-      queue[i].args=&args_array[i];
-      queue[i].range_m=NULL;
-      queue[i].range_n=NULL;
-      queue[i].sa=NULL;
-      queue[i].sb=NULL;
-      queue[i].next=&queue[i+1];
-
-      queue[i].mode=args_array[i].routine_mode;
-      queue[i].routine=args_array[i].routine;
-      
+      cost = (double)args_array[i].m * (double)args_array[i].n * (double)MAX(args_array[i].k, 1);
+
+      parts = 1;
 #ifdef SMALL_MATRIX_OPT
-      if((args_array[i].routine_mode & BLAS_SMALL_B0_OPT) || (args_array[i].routine_mode & BLAS_SMALL_OPT)){
-	queue[i].routine=inner_small_matrix_thread;
-      }
+      if(!(args_array[i].routine_mode & BLAS_SMALL_OPT))
 #endif
+      if(cost > part_cost){
+	parts = (BLASLONG)(cost / part_cost);
+	if((double)parts * part_cost < cost) parts ++;
+	if(parts > nthreads) parts = nthreads;
+	if(parts > args_array[i].n / GEMM_UNROLL_N) parts = args_array[i].n / GEMM_UNROLL_N;
+	if(parts < 1) parts = 1;
+      }
+
+      n_from = 0;
+      for(j=0; j<parts; j++){
+	width = ((args_array[i].n - n_from) + (parts - j) - 1) / (parts - j);
+	if(j < parts - 1) width = ((width + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+	if(width > args_array[i].n - n_from) width = args_array[i].n - n_from;
+
+	tasks[num_tasks].args = &args_array[i];
+	tasks[num_tasks].range_n[0] = n_from;
+	tasks[num_tasks].range_n[1] = n_from + width;
+	tasks[num_tasks].cost = cost * (double)width / (double)args_array[i].n;
+	tasks[num_tasks].index = i;
+	num_tasks ++;
+
+	n_from += width;
+	if(n_from >= args_array[i].n) break;
+      }
     }
-    
-    for(i=0; i<nums; i+=nthreads){
-      current_nums=((nums-i)>nthreads)? nthreads: (nums-i);
-
-      queue[i].sa=sa;
-      queue[i].sb=sb;
-      queue[i+current_nums-1].next=NULL;
-      
-      exec_blas(current_nums, &queue[i]);
+
+    qsort(tasks, num_tasks, sizeof(batch_task_t), batch_task_compare);
+
+    sched.tasks = tasks;
+    sched.num   = num_tasks;
+    sched.next  = 0;
+    sched.lock  = 0;
+
+    sched_args.common = (void *)&sched;
+
+    if(nthreads > num_tasks) nthreads = num_tasks;
+
+    for(i=0; i<nthreads; i++){
+      queue[i].mode    = args_array[0].routine_mode & (BLAS_PREC | BLAS_COMPLEX);
+      queue[i].routine = batch_worker;
+      queue[i].args    = &sched_args;
+      queue[i].range_m = NULL;
+      queue[i].range_n = NULL;
+      queue[i].sa      = NULL;
+      queue[i].sb      = NULL;
+      queue[i].next    = &queue[i + 1];
     }
-    free(queue);
+
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[nthreads - 1].next = NULL;
+
+    exec_blas(nthreads, queue);
+
+    free(tasks);
   }
 #endif
   blas_memory_free(buffer);
   return 0;
 }
+
+#ifndef BFLOAT16
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define GEMM_BATCH_STRIDED_THREAD dgemm_batch_strided_thread
+#else
+#define GEMM_BATCH_STRIDED_THREAD sgemm_batch_strided_thread
+#endif
+#else
+#ifdef DOUBLE
+#define GEMM_BATCH_STRIDED_THREAD zgemm_batch_strided_thread
+#else
+#define GEMM_BATCH_STRIDED_THREAD cgemm_batch_strided_thread
+#endif
+#endif
+
+/* Uniform batches. All entries share one argument block; entry i uses */
+/* its operands advanced by i strides, so nothing is set up per entry. */
+/* The entries are cut into equal contiguous runs, one per thread.     */
+
+typedef struct {
+  blas_arg_t *args;
+  BLASLONG stride_a, stride_b, stride_c;
+} batch_strided_t;
+
+static int strided_worker(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IFLOAT *sb, BLASLONG mypos){
+  batch_strided_t *strided = (batch_strided_t *)args -> a;
+  blas_arg_t local = *strided -> args;
+  int (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG) = local.routine;
+  BLASLONG i;
+
+  for (i = range_m[0]; i < range_m[1]; i++) {
+    local.a = (void *)((IFLOAT *)strided -> args -> a + i * strided -> stride_a * COMPSIZE);
+    local.b = (void *)((IFLOAT *)strided -> args -> b + i * strided -> stride_b * COMPSIZE);
+    local.c = (void *)((FLOAT  *)strided -> args -> c + i * strided -> stride_c * COMPSIZE);
+
+#ifdef SMALL_MATRIX_OPT
+    if (local.routine_mode & BLAS_SMALL_OPT) {
+      inner_small_matrix_thread(&local, NULL, NULL, NULL, NULL, 0);
+      continue;
+    }
+#endif
+    routine(&local, NULL, NULL, sa, sb, 0);
+  }
+
+  return 0;
+}
+
+/* args -> nthreads is the thread count the caller allows for the batch */
+int GEMM_BATCH_STRIDED_THREAD(blas_arg_t *args, BLASLONG stride_a, BLASLONG stride_b, BLASLONG stride_c, BLASLONG nums){
+  XFLOAT *buffer = NULL;
+  XFLOAT *sa = NULL, *sb = NULL;
+  batch_strided_t strided;
+  blas_arg_t sched_args;
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  BLASLONG nthreads = 1;
+#ifdef SMP
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG i;
+#endif
+
+  if (nums <= 0) return 0;
+
+#ifdef SMALL_MATRIX_OPT
+  if (!(args -> routine_mode & BLAS_SMALL_OPT)) {
+#endif
+    buffer = (XFLOAT *)blas_memory_alloc(0);
+    sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+    sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#ifdef SMALL_MATRIX_OPT
+  }
+#endif
+
+  strided.args     = args;
+  strided.stride_a = stride_a;
+  strided.stride_b = stride_b;
+  strided.stride_c = stride_c;
+
+  sched_args.a = (void *)&strided;
+
+#ifdef SMP
+  nthreads = args -> nthreads;
+  if (nthreads > nums) nthreads = nums;
+  if (nthreads < 1) nthreads = 1;
+#endif
+
+  range[0] = 0;
+  range[1] = nums;
+
+  if (nthreads == 1) {
+    strided_worker(&sched_args, range, NULL, sa, sb, 0);
+  }
+#ifdef SMP
+  else {
+    for (i = 0; i <= nthreads; i++) range[i] = i * nums / nthreads;
+
+    for (i = 0; i < nthreads; i++) {
+      queue[i].mode    = args -> routine_mode & (BLAS_PREC | BLAS_COMPLEX);
+      queue[i].routine = strided_worker;
+      queue[i].args    = &sched_args;
+      queue[i].range_m = &range[i];
+      queue[i].range_n = NULL;
+      queue[i].sa      = NULL;
+      queue[i].sb      = NULL;
+      queue[i].next    = &queue[i + 1];
+    }
+
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[nthreads - 1].next = NULL;
+
+    exec_blas(nthreads, queue);
+  }
+#endif
+
+  if (buffer) blas_memory_free(buffer);
+  return 0;
+}
+#endif
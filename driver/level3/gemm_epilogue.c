@@ -0,0 +1,108 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/*
+ * Epilogue of ?gemm_epilogue on one finished m x n block of C, whose top
+ * left element is C(i, j) of the whole matrix:
+ *
+ *   C := act(C + bias)
+ *
+ * with an optional bf16 copy of the result.  It runs from the level 3
+ * drivers right after the last k step of a block, while it is still in
+ * cache, so the caller does not need another pass over C.
+ */
+
+#include <math.h>
+#include "common.h"
+
+#ifdef DOUBLE
+#define ERF	erf
+#else
+#define ERF	erff
+#endif
+
+#define SQRT1_2	0.70710678118654752440
+
+static inline bfloat16 to_bf16(float f){
+
+  union { float f; unsigned int u; } x;
+
+  x.f = f;
+
+  /* keep NaN quiet, otherwise round to nearest even */
+  if ((x.u & 0x7fffffffU) > 0x7f800000U) return (bfloat16)((x.u >> 16) | 0x40);
+  x.u += 0x7fffU + ((x.u >> 16) & 1);
+
+  return (bfloat16)(x.u >> 16);
+}
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG i, BLASLONG j, FLOAT *c, BLASLONG ldc, gemm_epilogue_t *ep){
+
+  FLOAT *bias = (FLOAT *)ep -> bias_vector;
+  FLOAT lo = (FLOAT)ep -> lo, hi = (FLOAT)ep -> hi;
+  FLOAT v, b;
+  BLASLONG ii, jj;
+
+  for (jj = 0; jj < n; jj++) {
+
+    b = ZERO;
+    if (ep -> bias == GEMM_BIAS_COL) b = bias[j + jj];
+
+    for (ii = 0; ii < m; ii++) {
+      v = c[ii + jj * ldc] + b;
+      if (ep -> bias == GEMM_BIAS_ROW) v += bias[i + ii];
+
+      switch (ep -> act) {
+      case GEMM_ACT_RELU:
+	if (v < ZERO) v = ZERO;
+	break;
+      case GEMM_ACT_GELU:
+	v = (FLOAT)0.5 * v * (ONE + ERF(v * (FLOAT)SQRT1_2));
+	break;
+      case GEMM_ACT_CLAMP:
+	if (v < lo) v = lo;
+	if (v > hi) v = hi;
+	break;
+      }
+
+      c[ii + jj * ldc] = v;
+    }
+
+    if (ep -> bf16) {
+      bfloat16 *out = ep -> bf16 + i + (j + jj) * ep -> ldbf16;
+      for (ii = 0; ii < m; ii++) out[ii] = to_bf16((float)c[ii + jj * ldc]);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,350 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/*
+ * GEMM with pre-packed operands.
+ *
+ * A packed operand holds the output of GEMM_ITCOPY/INCOPY (for A) or
+ * GEMM_ONCOPY/OTCOPY (for B) for every k block, covering the full m (or n)
+ * extent, so that the level3 inner loop can hand panels straight to the
+ * kernel. Blocks follow the same min_l rule as level3.c. Block ls starts at
+ * ls * round_up(dim, unroll) elements and the panel for row (column) i,
+ * which must be a multiple of the unroll, starts i * min_l into the block.
+ *
+ * The multiply keeps its own js/ls/is loop rather than going through
+ * level3.c: the k blocks come from the buffer (its q may be another GEMM_Q
+ * than the current one) and a packed operand covers the whole of m or n,
+ * so only the operand that is not packed is copied and blocked by GEMM_P
+ * or GEMM_R.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifdef DOUBLE
+#define GEMM_PACK_SIZE	dgemm_pack_size
+#define GEMM_PACK_COPY	dgemm_pack_copy
+#define GEMM_PACK_CHECK	dgemm_pack_check
+#define PACK_MAGIC	0x4b4341504d454744UL	/* "DGEMPACK" */
+#define MODE		(BLAS_DOUBLE | BLAS_REAL)
+#else
+#define GEMM_PACK_SIZE	sgemm_pack_size
+#define GEMM_PACK_COPY	sgemm_pack_copy
+#define GEMM_PACK_CHECK	sgemm_pack_check
+#define PACK_MAGIC	0x4b4341504d454753UL	/* "SGEMPACK" */
+#define MODE		(BLAS_SINGLE | BLAS_REAL)
+#endif
+
+#define PACK_ALIGN	127
+
+typedef struct {
+  BLASULONG magic;
+  BLASLONG side, dim, k, q, unroll, offset;
+  FLOAT alpha;
+} pack_header_t;
+
+typedef struct {
+  blas_arg_t args;
+  int transa, transb;
+} packed_arg_t;
+
+static BLASLONG block_k(BLASLONG k, BLASLONG ls, BLASLONG q){
+
+  BLASLONG min_l = k - ls;
+
+  if (min_l >= q * 2) {
+    min_l = q;
+  } else if (min_l > q) {
+    min_l = ((min_l / 2 + GEMM_UNROLL_M - 1)/GEMM_UNROLL_M) * GEMM_UNROLL_M;
+  }
+
+  return min_l;
+}
+
+static BLASLONG pack_unroll(int side){
+  return (side == GEMM_PACK_B) ? GEMM_UNROLL_N : GEMM_UNROLL_M;
+}
+
+static BLASLONG pack_width(BLASLONG dim, BLASLONG unroll){
+  return ((dim + unroll - 1) / unroll) * unroll;
+}
+
+size_t GEMM_PACK_SIZE(int side, BLASLONG m, BLASLONG n, BLASLONG k){
+
+  BLASLONG dim = (side == GEMM_PACK_B) ? n : m;
+
+  return sizeof(pack_header_t) + PACK_ALIGN
+    + (size_t)pack_width(dim, pack_unroll(side)) * (size_t)k * sizeof(FLOAT);
+}
+
+int GEMM_PACK_COPY(blas_arg_t *args, int side, int trans, void *dest){
+
+  pack_header_t *header = (pack_header_t *)dest;
+  FLOAT *a = (FLOAT *)args -> a;
+  BLASLONG lda = args -> lda;
+  BLASLONG k = args -> k;
+  BLASLONG dim = (side == GEMM_PACK_B) ? args -> n : args -> m;
+  BLASLONG ls, min_l, width;
+  FLOAT *buffer;
+
+  header -> magic  = PACK_MAGIC;
+  header -> side   = side;
+  header -> dim    = dim;
+  header -> k      = k;
+  header -> q      = GEMM_Q;
+  header -> unroll = pack_unroll(side);
+  header -> offset = (((BLASULONG)dest + sizeof(pack_header_t) + PACK_ALIGN) & ~(BLASULONG)PACK_ALIGN) - (BLASULONG)dest;
+  header -> alpha  = *(FLOAT *)args -> alpha;
+
+  width  = pack_width(dim, header -> unroll);
+  buffer = (FLOAT *)((char *)dest + header -> offset);
+
+  for(ls = 0; ls < k; ls += min_l){
+    min_l = block_k(k, ls, header -> q);
+
+    if (side == GEMM_PACK_A) {
+      if (!trans) GEMM_ITCOPY(min_l, dim, a + ls * lda, lda, buffer + ls * width);
+      else        GEMM_INCOPY(min_l, dim, a + ls, lda, buffer + ls * width);
+    } else {
+      if (!trans) GEMM_ONCOPY(min_l, dim, a + ls, lda, buffer + ls * width);
+      else        GEMM_OTCOPY(min_l, dim, a + ls * lda, lda, buffer + ls * width);
+    }
+  }
+
+  return 0;
+}
+
+/* q is zero, or the q of the other packed operand of the same call, which
+   has to match as both are walked with the same k blocks. On success q is
+   set to the q of this buffer. */
+int GEMM_PACK_CHECK(void *packed, int side, BLASLONG dim, BLASLONG k, BLASLONG *q){
+
+  pack_header_t *header = (pack_header_t *)packed;
+
+  if (header -> magic != PACK_MAGIC) return -1;
+  if (header -> side  != side)       return -1;
+  if (header -> dim   != dim)        return -1;
+  if (header -> k     != k)          return -1;
+  if (header -> q     < 1)           return -1;
+  if (header -> unroll != pack_unroll(side)) return -1;
+  if (*q && header -> q != *q)       return -1;
+
+  *q = header -> q;
+
+  return 0;
+}
+
+static int inner_packed(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  packed_arg_t *parg = (packed_arg_t *)args;
+  int transa = parg -> transa;
+  int transb = parg -> transb;
+  BLASLONG k   = args -> k;
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *b = (FLOAT *)args -> b;
+  FLOAT *c = (FLOAT *)args -> c;
+  BLASLONG lda = args -> lda;
+  BLASLONG ldb = args -> ldb;
+  BLASLONG ldc = args -> ldc;
+  FLOAT *beta = (FLOAT *)args -> beta;
+  FLOAT alpha = *(FLOAT *)args -> alpha;
+  FLOAT *pa = NULL, *pb = NULL;
+  BLASLONG width_a = 0, width_b = 0, q = GEMM_Q, p = GEMM_P, r = GEMM_R;
+  BLASLONG m_from, m_to, n_from, n_to;
+  BLASLONG ls, is, js, jjs, min_l, min_i, min_j, min_jj;
+  FLOAT *aa, *bb;
+
+  m_from = 0;
+  m_to   = args -> m;
+  if (range_m) {
+    m_from = range_m[0];
+    m_to   = range_m[1];
+  }
+
+  n_from = 0;
+  n_to   = args -> n;
+  if (range_n) {
+    n_from = range_n[0];
+    n_to   = range_n[1];
+  }
+
+  if (beta && beta[0] != ONE) {
+    GEMM_BETA(m_to - m_from, n_to - n_from, 0, beta[0], NULL, 0, NULL, 0,
+	      c + m_from + n_from * ldc, ldc);
+  }
+
+  if (k == 0) return 0;
+
+  if (transa == GEMM_PACKED) {
+    pack_header_t *header = (pack_header_t *)a;
+    alpha  *= header -> alpha;
+    q       = header -> q;
+    width_a = pack_width(header -> dim, header -> unroll);
+    pa      = (FLOAT *)((char *)a + header -> offset);
+  }
+
+  if (transb == GEMM_PACKED) {
+    pack_header_t *header = (pack_header_t *)b;
+    alpha  *= header -> alpha;
+    q       = header -> q;
+    width_b = pack_width(header -> dim, header -> unroll);
+    pb      = (FLOAT *)((char *)b + header -> offset);
+  }
+
+  if (alpha == ZERO) return 0;
+
+  /* A buffer packed under a deeper GEMM_Q keeps its k blocks, so the
+     operand copied per call gets fewer rows (columns) to stay in sa (sb). */
+  if (q > GEMM_Q) {
+    p = ((GEMM_P * GEMM_Q / q) / GEMM_UNROLL_M) * GEMM_UNROLL_M;
+    r = ((GEMM_R * GEMM_Q / q) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+    if (p < GEMM_UNROLL_M) p = GEMM_UNROLL_M;
+    if (r < GEMM_UNROLL_N) r = GEMM_UNROLL_N;
+  }
+
+  for(js = n_from; js < n_to; js += min_j){
+    min_j = n_to - js;
+    if (!pb && min_j > r) min_j = r;
+
+    for(ls = 0; ls < k; ls += min_l){
+      min_l = block_k(k, ls, q);
+
+      /* B panels for columns js .. js + min_j */
+      if (pb) {
+	bb = pb + ls * width_b + js * min_l;
+      } else {
+	for(jjs = js; jjs < js + min_j; jjs += min_jj){
+	  min_jj = min_j + js - jjs;
+	  if (min_jj > GEMM_UNROLL_N * 3) min_jj = GEMM_UNROLL_N * 3;
+
+	  if (!transb) GEMM_ONCOPY(min_l, min_jj, b + ls + jjs * ldb, ldb, sb + min_l * (jjs - js));
+	  else         GEMM_OTCOPY(min_l, min_jj, b + jjs + ls * ldb, ldb, sb + min_l * (jjs - js));
+	}
+	bb = sb;
+      }
+
+      for(is = m_from; is < m_to; is += min_i){
+	min_i = m_to - is;
+
+	if (min_i >= p * 2) {
+	  min_i = p;
+	} else if (min_i > p) {
+	  min_i = ((min_i / 2 + GEMM_UNROLL_M - 1)/GEMM_UNROLL_M) * GEMM_UNROLL_M;
+	}
+
+	if (pa) {
+	  aa = pa + ls * width_a + is * min_l;
+	} else {
+	  if (!transa) GEMM_ITCOPY(min_l, min_i, a + is + ls * lda, lda, sa);
+	  else         GEMM_INCOPY(min_l, min_i, a + ls + is * lda, lda, sa);
+	  aa = sa;
+	}
+
+	GEMM_KERNEL_N(min_i, min_j, min_l, alpha, aa, bb, c + is + js * ldc, ldc);
+      }
+    }
+  }
+
+  return 0;
+}
+
+int CNAME(blas_arg_t *args, int transa, int transb, FLOAT *sa, FLOAT *sb){
+
+  packed_arg_t parg;
+
+#ifdef SMP
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  BLASLONG dim, unroll, width, num_cpu, nthreads, i;
+  int split_m;
+#endif
+
+  parg.args   = *args;
+  parg.transa = transa;
+  parg.transb = transb;
+
+#ifdef SMP
+  nthreads = args -> nthreads;
+
+  if (nthreads > 1) {
+
+    /* Split the dimension whose operand still has to be packed per call,
+       so every thread packs only its own share; panel boundaries stay on
+       the unroll grid of the packed operand. */
+    if (transa == GEMM_PACKED && transb != GEMM_PACKED) split_m = 0;
+    else if (transb == GEMM_PACKED && transa != GEMM_PACKED) split_m = 1;
+    else split_m = (args -> m >= args -> n);
+
+    dim    = split_m ? args -> m : args -> n;
+    unroll = split_m ? GEMM_UNROLL_M : GEMM_UNROLL_N;
+
+    range[0] = 0;
+    num_cpu  = 0;
+    i        = dim;
+
+    while (i > 0 && num_cpu < nthreads) {
+      width = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
+      width = ((width + unroll - 1) / unroll) * unroll;
+      if (width > i) width = i;
+      i -= width;
+
+      range[num_cpu + 1] = range[num_cpu] + width;
+
+      queue[num_cpu].mode    = MODE;
+      queue[num_cpu].routine = inner_packed;
+      queue[num_cpu].args    = &parg.args;
+      queue[num_cpu].range_m = split_m ? &range[num_cpu] : NULL;
+      queue[num_cpu].range_n = split_m ? NULL : &range[num_cpu];
+      queue[num_cpu].sa      = NULL;
+      queue[num_cpu].sb      = NULL;
+      queue[num_cpu].next    = &queue[num_cpu + 1];
+      num_cpu ++;
+    }
+
+    if (num_cpu > 1) {
+      queue[0].sa = sa;
+      queue[0].sb = sb;
+      queue[num_cpu - 1].next = NULL;
+
+      exec_blas(num_cpu, queue);
+      return 0;
+    }
+  }
+#endif
+
+  inner_packed(&parg.args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
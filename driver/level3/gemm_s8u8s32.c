@@ -0,0 +1,329 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/*
+ * int8 x uint8 -> int32 GEMM behind cblas_gemm_s8u8s32:
+ *
+ *   C := alpha * (op(A) + ao) * (op(B) + bo) + beta * C + co
+ *
+ * The kernels only form the raw products.  The offsets are folded in when a
+ * block of C is written back, using the row sums of A and column sums of B:
+ *
+ *   sum (a + ao)(b + bo) = sum ab + ao * sum b + bo * sum a + k * ao * bo
+ *
+ * Blocking follows level3.c, except that every block of C is accumulated
+ * over the whole of k in an int32 workspace, so that alpha, beta and the
+ * offsets are applied exactly once and in double precision.  When it fits,
+ * B is packed once for all of k per column block and shared by all row
+ * blocks.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "common.h"
+
+#define MODE		(BLAS_SINGLE | BLAS_REAL)
+
+/* part of the per thread buffer (BUFFER_SIZE long) the driver may use */
+#define I8_WORKSPACE	(BUFFER_SIZE / 2)
+#define I8_ALIGN	63
+
+#define I8_ROUND(x, u)	((((x) + (u) - 1) / (u)) * (u))
+
+typedef struct {
+  blas_arg_t args;
+  i8gemm_opt_t opt;
+} i8gemm_arg_t;
+
+static inline int32_t i8_saturate(double x){
+
+  x = rint(x);
+
+  if (x >=  2147483647.0) return 2147483647;
+  if (x <= -2147483648.0) return -2147483647 - 1;
+  if (x != x) return 0;
+
+  return (int32_t)x;
+}
+
+static void *i8_bump(char **ws, BLASLONG size){
+
+  void *p = *ws;
+
+  *ws = (char *)(((BLASULONG)*ws + size + I8_ALIGN) & ~(BLASULONG)I8_ALIGN);
+  return p;
+}
+
+static void row_sums(BLASLONG m, BLASLONG k, int8_t *a, BLASLONG lda, int trans, int32_t *sum){
+
+  BLASLONG i, l;
+  int32_t s;
+
+  if (!trans) {
+    for (i = 0; i < m; i++) sum[i] = 0;
+    for (l = 0; l < k; l++)
+      for (i = 0; i < m; i++) sum[i] += a[i + l * lda];
+  } else {
+    for (i = 0; i < m; i++) {
+      s = 0;
+      for (l = 0; l < k; l++) s += a[l + i * lda];
+      sum[i] = s;
+    }
+  }
+}
+
+static void col_sums(BLASLONG n, BLASLONG k, uint8_t *b, BLASLONG ldb, int trans, int32_t *sum){
+
+  BLASLONG j, l;
+  int32_t s;
+
+  if (!trans) {
+    for (j = 0; j < n; j++) {
+      s = 0;
+      for (l = 0; l < k; l++) s += b[l + j * ldb];
+      sum[j] = s;
+    }
+  } else {
+    for (j = 0; j < n; j++) sum[j] = 0;
+    for (l = 0; l < k; l++)
+      for (j = 0; j < n; j++) sum[j] += b[j + l * ldb];
+  }
+}
+
+static int inner_s8u8s32(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			 void *sa, void *sb, BLASLONG mypos){
+
+  i8gemm_opt_t *opt = &((i8gemm_arg_t *)args) -> opt;
+  int8_t  *a  = (int8_t  *)args -> a;
+  uint8_t *b  = (uint8_t *)args -> b;
+  int32_t *c  = (int32_t *)args -> c;
+  int32_t *co = (int32_t *)args -> d;
+  BLASLONG k   = args -> k;
+  BLASLONG lda = args -> lda;
+  BLASLONG ldb = args -> ldb;
+  BLASLONG c_rs = opt -> c_rs;
+  BLASLONG c_cs = opt -> c_cs;
+  double alpha = *(float *)args -> alpha;
+  double beta  = *(float *)args -> beta;
+  double ao = opt -> ao, bo = opt -> bo;
+  double kab = (double)k * ao * bo;
+  BLASLONG um = I8GEMM_UNROLL_M, un = I8GEMM_UNROLL_N, align = I8GEMM_ALIGN;
+  BLASLONG p  = I8_ROUND(I8GEMM_P, um);
+  BLASLONG q  = I8_ROUND(I8GEMM_Q, align);
+  BLASLONG kp = I8_ROUND(k, align);
+  BLASLONG m_from, m_to, n_from, n_to;
+  BLASLONG ls, is, js, ii, jj, min_l, min_i, min_j, wi, wj, r, kb, avail;
+  int resident;
+  char *ws = (char *)sa;
+  int8_t  *pa;
+  uint8_t *pb, *bb;
+  int32_t *ct, *rowsum, *colsum, *cc, *tt;
+  double cadd, csum, v;
+
+  m_from = 0;
+  m_to   = args -> m;
+  if (range_m) {
+    m_from = range_m[0];
+    m_to   = range_m[1];
+  }
+
+  n_from = 0;
+  n_to   = args -> n;
+  if (range_n) {
+    n_from = range_n[0];
+    n_to   = range_n[1];
+  }
+
+  /* Workspace: packed A block, then per column of the block of C its int32
+     accumulators, its column sum and its packed B (all of k if possible). */
+  pa     = (int8_t *)i8_bump(&ws, p * q);
+  rowsum = (int32_t *)i8_bump(&ws, p * sizeof(int32_t));
+  avail  = I8_WORKSPACE - (ws - (char *)sa) - 3 * (I8_ALIGN + 1);
+
+  resident = 1;
+  kb = kp;
+  r  = avail / (p * sizeof(int32_t) + sizeof(int32_t) + kb);
+  if (r < un) {
+    resident = 0;
+    kb = q;
+    r  = avail / (p * sizeof(int32_t) + sizeof(int32_t) + kb);
+  }
+  r = (r / un) * un;
+  if (r > I8_ROUND(I8GEMM_R, un)) r = I8_ROUND(I8GEMM_R, un);
+
+  ct     = (int32_t *)i8_bump(&ws, p * r * sizeof(int32_t));
+  colsum = (int32_t *)i8_bump(&ws, r * sizeof(int32_t));
+  pb     = (uint8_t *)i8_bump(&ws, kb * r);
+
+  cadd = 0.;
+  if (opt -> offsetc == I8GEMM_CO_FIX) cadd = co[0];
+
+  for(js = n_from; js < n_to; js += min_j){
+    min_j = n_to - js;
+    if (min_j > r) min_j = r;
+    wj = I8_ROUND(min_j, un);
+
+    if (opt -> ao) {
+      if (!opt -> transb) col_sums(min_j, k, b + js * ldb, ldb, 0, colsum);
+      else                col_sums(min_j, k, b + js,       ldb, 1, colsum);
+    }
+
+    if (resident) {
+      for(ls = 0; ls < k; ls += min_l){
+	min_l = k - ls;
+	if (min_l > q) min_l = q;
+
+	if (!opt -> transb) I8GEMM_ONCOPY(min_l, min_j, b + ls + js * ldb, ldb, pb + ls * wj);
+	else                I8GEMM_OTCOPY(min_l, min_j, b + js + ls * ldb, ldb, pb + ls * wj);
+      }
+    }
+
+    for(is = m_from; is < m_to; is += min_i){
+      min_i = m_to - is;
+      if (min_i >= p * 2) {
+	min_i = p;
+      } else if (min_i > p) {
+	min_i = I8_ROUND(min_i / 2, um);
+      }
+      wi = I8_ROUND(min_i, um);
+
+      if (opt -> bo) {
+	if (!opt -> transa) row_sums(min_i, k, a + is,       lda, 0, rowsum);
+	else                row_sums(min_i, k, a + is * lda, lda, 1, rowsum);
+      }
+
+      memset(ct, 0, wi * wj * sizeof(int32_t));
+
+      for(ls = 0; ls < k; ls += min_l){
+	min_l = k - ls;
+	if (min_l > q) min_l = q;
+
+	if (resident) {
+	  bb = pb + ls * wj;
+	} else {
+	  if (!opt -> transb) I8GEMM_ONCOPY(min_l, min_j, b + ls + js * ldb, ldb, pb);
+	  else                I8GEMM_OTCOPY(min_l, min_j, b + js + ls * ldb, ldb, pb);
+	  bb = pb;
+	}
+
+	if (!opt -> transa) I8GEMM_ITCOPY(min_l, min_i, a + is + ls * lda, lda, pa);
+	else                I8GEMM_INCOPY(min_l, min_i, a + ls + is * lda, lda, pa);
+
+	I8GEMM_KERNEL(min_i, min_j, I8_ROUND(min_l, align), pa, bb, ct, wi);
+      }
+
+      for (jj = 0; jj < min_j; jj++) {
+	cc = c + is * c_rs + (js + jj) * c_cs;
+	tt = ct + jj * wi;
+
+	csum = cadd;
+	if (opt -> offsetc == I8GEMM_CO_ROW) csum += co[js + jj];
+
+	for (ii = 0; ii < min_i; ii++) {
+	  v = tt[ii] + kab;
+	  if (opt -> ao) v += ao * colsum[jj];
+	  if (opt -> bo) v += bo * rowsum[ii];
+	  v = alpha * v + csum;
+	  if (opt -> offsetc == I8GEMM_CO_COL) v += co[is + ii];
+	  if (beta != 0.) v += beta * cc[ii * c_rs];
+	  cc[ii * c_rs] = i8_saturate(v);
+	}
+      }
+    }
+  }
+
+  return 0;
+}
+
+int CNAME(blas_arg_t *args, i8gemm_opt_t *opt, void *sa, void *sb){
+
+  i8gemm_arg_t iarg;
+
+#ifdef SMP
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  BLASLONG dim, unroll, width, num_cpu, nthreads, i;
+  int split_m;
+#endif
+
+  iarg.args = *args;
+  iarg.opt  = *opt;
+
+#ifdef SMP
+  nthreads = args -> nthreads;
+
+  if (nthreads > 1) {
+
+    /* every thread packs its own A and B blocks, so split the larger side */
+    split_m = (args -> m > args -> n);
+    dim     = split_m ? args -> m : args -> n;
+    unroll  = split_m ? I8GEMM_UNROLL_M : I8GEMM_UNROLL_N;
+
+    range[0] = 0;
+    num_cpu  = 0;
+    i        = dim;
+
+    while (i > 0 && num_cpu < nthreads) {
+      width = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
+      width = I8_ROUND(width, unroll);
+      if (width > i) width = i;
+      i -= width;
+
+      range[num_cpu + 1] = range[num_cpu] + width;
+
+      queue[num_cpu].mode    = MODE;
+      queue[num_cpu].routine = inner_s8u8s32;
+      queue[num_cpu].args    = &iarg.args;
+      queue[num_cpu].range_m = split_m ? &range[num_cpu] : NULL;
+      queue[num_cpu].range_n = split_m ? NULL : &range[num_cpu];
+      queue[num_cpu].sa      = NULL;
+      queue[num_cpu].sb      = NULL;
+      queue[num_cpu].next    = &queue[num_cpu + 1];
+      num_cpu ++;
+    }
+
+    if (num_cpu > 1) {
+      queue[0].sa = sa;
+      queue[0].sb = sb;
+      queue[num_cpu - 1].next = NULL;
+
+      exec_blas(num_cpu, queue);
+      return 0;
+    }
+  }
+#endif
+
+  inner_s8u8s32(&iarg.args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
@@ -0,0 +1,125 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* C := alpha * op(A) * op(B) + beta * C on the upper (or, with LOWER, the
+   lower) triangle of C only.  The blocking and thread partitioning are those
+   of syrk; op(B) takes the place of A**T in the packed panels and the
+   syrk kernel masks the diagonal blocks. */
+
+#include "common.h"
+
+#define GEMMT
+
+#if defined(NN) || defined(NT) || defined(NC) || defined(NR) || \
+    defined(RN) || defined(RT) || defined(RC) || defined(RR)
+#define ICOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) GEMM_ITCOPY(M, N, (FLOAT *)(A) + ((Y) + (X) * (LDA)) * COMPSIZE, LDA, BUFFER);
+#else
+#define ICOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) GEMM_INCOPY(M, N, (FLOAT *)(A) + ((X) + (Y) * (LDA)) * COMPSIZE, LDA, BUFFER);
+#endif
+
+#if defined(NN) || defined(TN) || defined(CN) || defined(RN) || \
+    defined(NR) || defined(TR) || defined(CR) || defined(RR)
+#define OCOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) GEMM_ONCOPY(M, N, (FLOAT *)(A) + ((X) + (Y) * (LDA)) * COMPSIZE, LDA, BUFFER);
+#else
+#define OCOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) GEMM_OTCOPY(M, N, (FLOAT *)(A) + ((Y) + (X) * (LDA)) * COMPSIZE, LDA, BUFFER);
+#endif
+
+#ifndef LOWER
+#if defined(NN) || defined(NT) || defined(TN) || defined(TT)
+#define KERNEL_FUNC	SYRK_KERNEL_U
+#elif defined(CN) || defined(CT) || defined(RN) || defined(RT)
+#define KERNEL_FUNC	GEMMT_KERNEL_UL
+#elif defined(NC) || defined(TC) || defined(NR) || defined(TR)
+#define KERNEL_FUNC	GEMMT_KERNEL_UR
+#else
+#define KERNEL_FUNC	GEMMT_KERNEL_UB
+#endif
+#else
+#if defined(NN) || defined(NT) || defined(TN) || defined(TT)
+#define KERNEL_FUNC	SYRK_KERNEL_L
+#elif defined(CN) || defined(CT) || defined(RN) || defined(RT)
+#define KERNEL_FUNC	GEMMT_KERNEL_LL
+#elif defined(NC) || defined(TC) || defined(NR) || defined(TR)
+#define KERNEL_FUNC	GEMMT_KERNEL_LR
+#else
+#define KERNEL_FUNC	GEMMT_KERNEL_LB
+#endif
+#endif
+
+#ifdef THREADED_LEVEL3
+#if   defined(NN)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## NN
+#elif defined(TN)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## TN
+#elif defined(RN)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## RN
+#elif defined(CN)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## CN
+#elif defined(NT)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## NT
+#elif defined(TT)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## TT
+#elif defined(RT)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## RT
+#elif defined(CT)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## CT
+#elif defined(NR)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## NR
+#elif defined(TR)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## TR
+#elif defined(RR)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## RR
+#elif defined(CR)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## CR
+#elif defined(NC)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## NC
+#elif defined(TC)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## TC
+#elif defined(RC)
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## RC
+#else
+#define GEMMT_LOCAL(UPLO)	GEMMT_ ## UPLO ## CC
+#endif
+
+#ifndef LOWER
+#define SYRK_LOCAL	GEMMT_LOCAL(U)
+#else
+#define SYRK_LOCAL	GEMMT_LOCAL(L)
+#endif
+#endif
+
+#define B	args -> b
+#define LDB	args -> ldb
+
+#include "syrk_k.c"
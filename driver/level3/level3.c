@@ -133,6 +133,16 @@
 #endif
 #endif
 
+#ifndef EPILOGUE_OPERATION
+#ifdef EPILOGUE
+/* bias and activation of ?gemm_epilogue on a finished block of C */
+#define EPILOGUE_OPERATION(M, N, C, LDC, X, Y) \
+	GEMM_EPILOGUE(M, N, X, Y, (FLOAT *)(C) + ((X) + (Y) * (LDC)) * COMPSIZE, LDC, (gemm_epilogue_t *)args -> d)
+#else
+#define EPILOGUE_OPERATION(M, N, C, LDC, X, Y) {}
+#endif
+#endif
+
 #ifndef A
 #define A	args -> a
 #endif
@@ -165,8 +175,9 @@
 #define START_RPCC()		rpcc_counter = rpcc()
 #define STOP_RPCC(COUNTER)	COUNTER  += rpcc() - rpcc_counter
 #else
-#define START_RPCC()
-#define STOP_RPCC(COUNTER)
+/* only sampled while run time profiling is on */
+#define START_RPCC()		if (profile) rpcc_counter = rpcc()
+#define STOP_RPCC(COUNTER)	if (profile) COUNTER  += rpcc() - rpcc_counter
 #endif
 
 int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
@@ -189,12 +200,14 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   xidouble xalpha;
 #endif
 
-#ifdef TIMING
-  unsigned long long rpcc_counter;
+  unsigned long long rpcc_counter = 0;
   unsigned long long innercost  = 0;
   unsigned long long outercost  = 0;
   unsigned long long kernelcost = 0;
+#ifdef TIMING
   double total;
+#else
+  int profile = gotoblas_profile;
 #endif
 
   k = K;
@@ -249,14 +262,20 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	}
   }
 
-  if ((k == 0) || (alpha == NULL)) return 0;
+  if ((k == 0) || (alpha == NULL)) {
+    EPILOGUE_OPERATION(m_to - m_from, n_to - n_from, c, ldc, m_from, n_from);
+    return 0;
+  }
 
 #if !defined(XDOUBLE) || !defined(QUAD_PRECISION)
   if ( alpha[0] == ZERO
 #ifdef COMPLEX
       && alpha[1] == ZERO
 #endif
-	 ) return 0; 
+	 ) {
+    EPILOGUE_OPERATION(m_to - m_from, n_to - n_from, c, ldc, m_from, n_from);
+    return 0;
+  }
 #else
   if (((alpha[0].x[0] | alpha[0].x[1]
 #ifdef COMPLEX
@@ -338,6 +357,8 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
       FUSED_KERNEL_OPERATION(min_i, min_j, min_l, alpha,
 			     sa, sb, b, ldb, c, ldc, m_from, js, ls);
 
+      if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_j, c, ldc, m_from, js);
+
 
 #else
       for(jjs = js; jjs < js + min_j; jjs += min_jj){
@@ -374,6 +395,9 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 #endif
 
 	STOP_RPCC(kernelcost);
+
+	/* the block is still in cache after its last k step */
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_jj, c, ldc, m_from, jjs);
       }
 #endif
 
@@ -403,6 +427,8 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
 	STOP_RPCC(kernelcost);
 
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_j, c, ldc, is, js);
+
       } /* end of is */
     } /* end of js */
   } /* end of ls */
@@ -417,6 +443,8 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	  (double)(m_to - m_from) * (double)(n_to - n_from) * (double)k / (double)kernelcost * 100. * (double)COMPSIZE / 2.,
 	  (double)(m_to - m_from) * (double)(n_to - n_from) * (double)k / total * 100. * (double)COMPSIZE / 2.);
 
+#else
+  if (profile) gotoblas_profile_level3(CHAR_CNAME, dummy == 0, innercost + outercost, kernelcost);
 #endif
 
   return 0;
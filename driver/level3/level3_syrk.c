@@ -86,6 +86,14 @@
 #define LDA	args -> lda
 #endif
 
+#ifndef B
+#define B	A
+#endif
+
+#ifndef LDB
+#define LDB	LDA
+#endif
+
 #ifndef LDC
 #define LDC	args -> ldc
 #endif
@@ -100,15 +108,20 @@
 
 int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG dummy) {
 
-  BLASLONG m_from, m_to, n_from, n_to, k, lda, ldc;
-  FLOAT *a, *c, *alpha, *beta;
+  BLASLONG m_from, m_to, n_from, n_to, k, lda, ldb, ldc;
+  FLOAT *a, *b, *c, *alpha, *beta;
 
   BLASLONG ls, is, js;
   BLASLONG min_l, min_i, min_j;
   BLASLONG jjs, min_jj;
   BLASLONG m_start, m_end;
 
+#ifndef GEMMT
   int shared = ((GEMM_UNROLL_M == GEMM_UNROLL_N) && !HAVE_EX_L2);
+#else
+  /* op(B) is a different matrix, so its packed panel cannot stand in for op(A) */
+  int shared = 0;
+#endif
 
   FLOAT *aa;
 
@@ -123,9 +136,11 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
   k = K;
 
   a = (FLOAT *)A;
+  b = (FLOAT *)B;
   c = (FLOAT *)C;
 
   lda = LDA;
+  ldb = LDB;
   ldc = LDC;
 
   alpha = (FLOAT *)args -> alpha;
@@ -222,7 +237,7 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
 
 	  START_RPCC();
 
-	  OCOPY_OPERATION(min_l, min_jj, a, lda, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
+	  OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
 
 	  STOP_RPCC(outercost);
 
@@ -281,7 +296,7 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
 
 	    START_RPCC();
 
-	    OCOPY_OPERATION(min_l, min_jj, a, lda, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
+	    OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
 
 	    STOP_RPCC(outercost);
 
@@ -339,7 +354,7 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
 
 	START_RPCC();
 
-	OCOPY_OPERATION(min_l, (shared? (min_i) : MIN(min_i, min_j + js - m_start)), a, lda, ls, m_start, aa);
+	OCOPY_OPERATION(min_l, (shared? (min_i) : MIN(min_i, min_j + js - m_start)), b, ldb, ls, m_start, aa);
 
 	STOP_RPCC(outercost);
 
@@ -355,7 +370,7 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
 
 	  START_RPCC();
 
-	  OCOPY_OPERATION(min_l, min_jj, a, lda, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
+	  OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
 
 	  STOP_RPCC(outercost);
 
@@ -392,7 +407,7 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
 
 	    START_RPCC();
 
-	    OCOPY_OPERATION(min_l, (shared? (min_i) : MIN(min_i, min_j - is + js)), a, lda, ls, is, aa);
+	    OCOPY_OPERATION(min_l, (shared? (min_i) : MIN(min_i, min_j - is + js)), b, ldb, ls, is, aa);
 
 	    STOP_RPCC(outercost);
 
@@ -440,7 +455,7 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
 
 	  START_RPCC();
 
-	  OCOPY_OPERATION(min_l, min_jj, a, lda, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
+	  OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
 
 	  STOP_RPCC(outercost);
 
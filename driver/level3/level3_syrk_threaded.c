@@ -105,6 +105,15 @@ _Atomic
 #ifndef LDA
 #define LDA	args -> lda
 #endif
+
+#ifndef B
+#define B	A
+#endif
+
+#ifndef LDB
+#define LDB	LDA
+#endif
+
 #ifndef C
 #define C	args -> c
 #endif
@@ -135,11 +144,11 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
   FLOAT *buffer[DIVIDE_RATE];
 
-  BLASLONG k, lda, ldc;
+  BLASLONG k, lda, ldb, ldc;
   BLASLONG m_from, m_to, n_from, n_to;
 
   FLOAT *alpha, *beta;
-  FLOAT *a, *c;
+  FLOAT *a, *b, *c;
   job_t *job = (job_t *)args -> common;
   BLASLONG xxx, bufferside;
 
@@ -168,9 +177,11 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   k = K;
 
   a = (FLOAT *)A;
+  b = (FLOAT *)B;
   c = (FLOAT *)C;
 
   lda = LDA;
+  ldb = LDB;
   ldc = LDC;
 
   alpha = (FLOAT *)args -> alpha;
@@ -284,7 +295,7 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
 	START_RPCC();
 
-	OCOPY_OPERATION(min_l, min_jj, a, lda, ls, jjs,
+	OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs,
 			buffer[bufferside] + min_l * (jjs - xxx) * COMPSIZE);
 
 	STOP_RPCC(copy_B);
@@ -313,7 +324,7 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
 	START_RPCC();
 
-	OCOPY_OPERATION(min_l, min_jj, a, lda, ls, jjs,
+	OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs,
 			buffer[bufferside] + min_l * (jjs - xxx) * COMPSIZE);
 
 	STOP_RPCC(copy_B);
@@ -91,6 +91,20 @@
 #endif
 #endif
 
+#ifdef EPILOGUE
+/* the serial fallback has to apply the epilogue too */
+#undef  GEMM_LOCAL
+#if   defined(NN)
+#define GEMM_LOCAL    GEMM_EPILOGUE_NN
+#elif defined(NT)
+#define GEMM_LOCAL    GEMM_EPILOGUE_NT
+#elif defined(TN)
+#define GEMM_LOCAL    GEMM_EPILOGUE_TN
+#elif defined(TT)
+#define GEMM_LOCAL    GEMM_EPILOGUE_TT
+#endif
+#endif
+
 typedef struct {
   volatile
    BLASLONG working[MAX_CPU_NUMBER][CACHE_LINE_SIZE * DIVIDE_RATE];
@@ -180,6 +194,15 @@ typedef struct {
 #endif
 #endif
 
+#ifndef EPILOGUE_OPERATION
+#ifdef EPILOGUE
+#define EPILOGUE_OPERATION(M, N, C, LDC, X, Y)                           \
+  GEMM_EPILOGUE(M, N, X, Y, (FLOAT *)(C) + ((X) + (Y) * (LDC)) * COMPSIZE, LDC, (gemm_epilogue_t *)args -> d)
+#else
+#define EPILOGUE_OPERATION(M, N, C, LDC, X, Y) {}
+#endif
+#endif
+
 #ifndef A
 #define A	args -> a
 #endif
@@ -208,12 +231,26 @@ typedef struct {
 #define K	args -> k
 #endif
 
+#ifndef COMPLEX
+#define MODEL_MODE	(BLAS_REAL | PREC_MODE)
+#else
+#define MODEL_MODE	(BLAS_COMPLEX | PREC_MODE)
+#endif
+#ifdef XDOUBLE
+#define PREC_MODE	BLAS_XDOUBLE
+#elif defined(DOUBLE)
+#define PREC_MODE	BLAS_DOUBLE
+#else
+#define PREC_MODE	BLAS_SINGLE
+#endif
+
 #ifdef TIMING
 #define START_RPCC()		rpcc_counter = rpcc()
 #define STOP_RPCC(COUNTER)	COUNTER  += rpcc() - rpcc_counter
 #else
-#define START_RPCC()
-#define STOP_RPCC(COUNTER)
+/* only sampled while run time profiling is on */
+#define START_RPCC()		if (profile) rpcc_counter = rpcc()
+#define STOP_RPCC(COUNTER)	if (profile) COUNTER  += rpcc() - rpcc_counter
 #endif
 
 static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IFLOAT *sb, BLASLONG mypos){
@@ -237,14 +274,16 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   BLASLONG i, current;
   BLASLONG l1stride;
 
-#ifdef TIMING
-  BLASULONG rpcc_counter;
+  BLASULONG rpcc_counter = 0;
   BLASULONG copy_A = 0;
   BLASULONG copy_B = 0;
   BLASULONG kernel = 0;
   BLASULONG waiting1 = 0;
   BLASULONG waiting2 = 0;
   BLASULONG waiting3 = 0;
+#ifndef TIMING
+  int profile = gotoblas_profile;
+#else
   BLASULONG waiting6[MAX_CPU_NUMBER];
   BLASULONG ops    = 0;
 
@@ -297,12 +336,16 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   }
 
   /* Return early if no more computation is needed */
-  if ((k == 0) || (alpha == NULL)) return 0;
-  if (alpha[0] == ZERO
+  if ((k == 0) || (alpha == NULL)
+      || (alpha[0] == ZERO
 #ifdef COMPLEX
-      && alpha[1] == ZERO
+	  && alpha[1] == ZERO
 #endif
-      ) return 0;
+	  )) {
+    EPILOGUE_OPERATION(m_to - m_from, range_n[(mypos_n + 1) * nthreads_m] - range_n[mypos_n * nthreads_m],
+		       c, ldc, m_from, range_n[mypos_n * nthreads_m]);
+    return 0;
+  }
 
   /* Initialize workspace for local region of B */
   div_n = (n_to - n_from + DIVIDE_RATE - 1) / DIVIDE_RATE;
@@ -368,6 +411,7 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
       /* Fused operation to copy region of B into workspace and apply kernel */
       FUSED_KERNEL_OPERATION(min_i, MIN(n_to, js + div_n) - js, min_l, alpha,
 			     sa, buffer[bufferside], b, ldb, c, ldc, m_from, js, ls);
+      if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(n_to, js + div_n) - js, c, ldc, m_from, js);
 
 #else
 
@@ -399,6 +443,9 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 			 c, ldc, m_from, jjs);
 	STOP_RPCC(kernel);
 
+	/* apply the epilogue while the block is still in cache */
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_jj, c, ldc, m_from, jjs);
+
 #ifdef TIMING
         ops += 2 * min_i * min_jj * min_l;
 #endif
@@ -439,6 +486,8 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 			   c, ldc, m_from, js);
           STOP_RPCC(kernel);
 
+	  if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(range_n[current + 1]  - js,  div_n), c, ldc, m_from, js);
+
 #ifdef TIMING
 	  ops += 2 * min_i * MIN(range_n[current + 1]  - js,  div_n) * min_l;
 #endif
@@ -482,6 +531,8 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 			   sa, (IFLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
 			   c, ldc, is, js);
           STOP_RPCC(kernel);
+
+	  if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), c, ldc, is, js);
           
 #ifdef TIMING
           ops += 2 * min_i * MIN(range_n[current + 1]  - js, div_n) * min_l;
@@ -526,6 +577,8 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	  (double)waiting3 /(double)total * 100.,
 	  (double)ops/(double)kernel / 4. * 100.);
   fprintf(stderr, "\n");
+#else
+  if (profile) gotoblas_profile_level3(CHAR_CNAME, mypos == 0, copy_A + copy_B, kernel);
 #endif
 
   return 0;
@@ -820,35 +873,12 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IF
     n = range_n[1] - range_n[0];
   }
 
-  /* Partitions in m should have at least switch_ratio rows */
-  if (m < 2 * switch_ratio) {
-    nthreads_m = 1;
-  } else {
-    nthreads_m = args -> nthreads;
-    while (m < nthreads_m * switch_ratio) {
-      nthreads_m = nthreads_m / 2;
-    }
-  }
-
-  /* Partitions in n should have at most switch_ratio * nthreads_m columns */
-  if (n < switch_ratio * nthreads_m) {
-    nthreads_n = 1;
-  } else {
-    nthreads_n = (n + switch_ratio * nthreads_m - 1) / (switch_ratio * nthreads_m);
-    if (nthreads_m * nthreads_n > args -> nthreads) {
-      nthreads_n = blas_quickdivide(args -> nthreads, nthreads_m);
-    }
-    /* The nthreads_m and nthreads_n are adjusted so that the submatrix       */
-    /* to be handled by each thread preferably becomes a square matrix        */
-    /* by minimizing an objective function 'n * nthreads_m + m * nthreads_n'. */
-    /* Objective function come from sum of partitions in m and n.             */
-    /* (n / nthreads_n) + (m / nthreads_m)                                    */
-    /* = (n * nthreads_m + m * nthreads_n) / (nthreads_n * nthreads_m)        */
-    while (nthreads_m % 2 == 0 && n * nthreads_m + m * nthreads_n > n * (nthreads_m / 2) + m * (nthreads_n * 2)) {
-      nthreads_m /= 2;
-      nthreads_n *= 2;
-    }
-  }
+  /* Partitions in m should have at least switch_ratio rows. The thread */
+  /* count model picks how the threads are divided between m and n.      */
+  nthreads_n = blas_level3_threads(BLAS_MODEL_GEMM, MODEL_MODE, m, n, K,
+				   MAX(GEMM_UNROLL_M, switch_ratio), GEMM_UNROLL_N, GEMM_Q,
+				   args -> nthreads, &nthreads_m);
+  nthreads_n /= nthreads_m;
 
   /* Execute serial or parallel computation */
   if (nthreads_m * nthreads_n <= 1) {
@@ -0,0 +1,361 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* TRSM and TRMM with the triangular dimension divided between threads.
+
+   Dividing only the right hand sides, as gemm_thread_n/m do, leaves most
+   threads idle when there are few of them. Here the triangular dimension
+   is cut into blocks that are dealt out to the threads in turn; the right
+   hand sides stay whole. A block is updated with GEMM from the blocks
+   before it and then solved (or multiplied) with its diagonal block by
+   the single threaded driver.
+
+   TRSM: a block needs the solution of every block before it. Each block
+   has a flag that is raised once it is solved; a thread applies the
+   solved blocks to its own as they come in and solves it as soon as the
+   last one has arrived, so diagonal solves and updates run as a pipeline.
+
+   TRMM: a block needs the original contents of the blocks before it, which
+   their own threads overwrite. Those are read from a copy of B taken
+   before the threads start, and the blocks do not wait for each other. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifdef HAVE_C11
+#define	atomic_load_long(p)		__atomic_load_n(p, __ATOMIC_RELAXED)
+#define	atomic_store_long(p, v)		__atomic_store_n(p, v, __ATOMIC_RELAXED)
+#else
+#define	atomic_load_long(p)		(BLASLONG)(*(volatile BLASLONG*)(p))
+#define	atomic_store_long(p, v)		(*(volatile BLASLONG *)(p)) = (v)
+#endif
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 8
+#endif
+
+/* Blocks per thread, so that the threads keep busy along the triangle */
+#ifndef DIVIDE_RATE
+#define DIVIDE_RATE 4
+#endif
+
+#ifndef TRMM
+static FLOAT dm1[] = {-1., 0.};
+#endif
+
+typedef struct {
+  int (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+  BLASLONG side, trans, forward;
+  BLASLONG nthreads, blocks, size, length;
+  FLOAT *x;
+  BLASLONG ldx;
+  volatile BLASLONG *flag;
+} job_t;
+
+/* The single threaded drivers, in the order of the interface */
+static int (*solve[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+#ifndef TRMM
+  TRSM_LNUU, TRSM_LNUN, TRSM_LNLU, TRSM_LNLN,
+  TRSM_LTUU, TRSM_LTUN, TRSM_LTLU, TRSM_LTLN,
+  TRSM_LRUU, TRSM_LRUN, TRSM_LRLU, TRSM_LRLN,
+  TRSM_LCUU, TRSM_LCUN, TRSM_LCLU, TRSM_LCLN,
+  TRSM_RNUU, TRSM_RNUN, TRSM_RNLU, TRSM_RNLN,
+  TRSM_RTUU, TRSM_RTUN, TRSM_RTLU, TRSM_RTLN,
+  TRSM_RRUU, TRSM_RRUN, TRSM_RRLU, TRSM_RRLN,
+  TRSM_RCUU, TRSM_RCUN, TRSM_RCLU, TRSM_RCLN,
+#else
+  TRMM_LNUU, TRMM_LNUN, TRMM_LNLU, TRMM_LNLN,
+  TRMM_LTUU, TRMM_LTUN, TRMM_LTLU, TRMM_LTLN,
+  TRMM_LRUU, TRMM_LRUN, TRMM_LRLU, TRMM_LRLN,
+  TRMM_LCUU, TRMM_LCUN, TRMM_LCLU, TRMM_LCLN,
+  TRMM_RNUU, TRMM_RNUN, TRMM_RNLU, TRMM_RNLN,
+  TRMM_RTUU, TRMM_RTUN, TRMM_RTLU, TRMM_RTLN,
+  TRMM_RRUU, TRMM_RRUN, TRMM_RRLU, TRMM_RRLN,
+  TRMM_RCUU, TRMM_RCUN, TRMM_RCLU, TRMM_RCLN,
+#endif
+};
+
+/* op(A) * X on the left, X * op(A) on the right */
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GEMM_NN, GEMM_TN, GEMM_RN, GEMM_CN,
+  GEMM_NN, GEMM_NT, GEMM_NR, GEMM_NC,
+};
+
+/* Rows (or columns) of B held by blocks from .. to - 1, in solving order */
+static void block_range(job_t *job, BLASLONG from, BLASLONG to, BLASLONG *start, BLASLONG *length) {
+
+  BLASLONG end;
+
+  if (job -> forward) {
+    *start = from * job -> size;
+    end    = to   * job -> size;
+  } else {
+    *start = (job -> blocks - to)   * job -> size;
+    end    = (job -> blocks - from) * job -> size;
+  }
+
+  if (end > job -> length) end = job -> length;
+
+  *length = end - *start;
+}
+
+/* B(block p) += alpha * op(A)(p, q) * X(blocks q .. r - 1), or the same
+   from the right */
+static void update(blas_arg_t *args, job_t *job, BLASLONG p, BLASLONG q, BLASLONG r,
+		   FLOAT *alpha, FLOAT *beta, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t newarg;
+  BLASLONG is, min_i, ls, min_l, row, col;
+
+  block_range(job, p, p + 1, &is, &min_i);
+  block_range(job, q, r,     &ls, &min_l);
+
+  /* the block of op(A) is (p, q) on the left and (q, p) on the right */
+  row = (job -> side) ? ls : is;
+  col = (job -> side) ? is : ls;
+
+  if (job -> trans & 1) {
+    BLASLONG temp = row;
+    row = col;
+    col = temp;
+  }
+
+  newarg.k     = min_l;
+  newarg.ldc   = args -> ldb;
+  newarg.alpha = alpha;
+  newarg.beta  = beta;
+
+  if (!job -> side) {
+    newarg.m   = min_i;
+    newarg.n   = args -> n;
+    newarg.a   = (FLOAT *)args -> a + (row + col * args -> lda) * COMPSIZE;
+    newarg.lda = args -> lda;
+    newarg.b   = job -> x + ls * COMPSIZE;
+    newarg.ldb = job -> ldx;
+    newarg.c   = (FLOAT *)args -> b + is * COMPSIZE;
+  } else {
+    newarg.m   = args -> m;
+    newarg.n   = min_i;
+    newarg.a   = job -> x + ls * job -> ldx * COMPSIZE;
+    newarg.lda = job -> ldx;
+    newarg.b   = (FLOAT *)args -> a + (row + col * args -> lda) * COMPSIZE;
+    newarg.ldb = args -> lda;
+    newarg.c   = (FLOAT *)args -> b + is * args -> ldb * COMPSIZE;
+  }
+
+  (gemm[(job -> side << 2) | job -> trans])(&newarg, NULL, NULL, sa, sb, 0);
+}
+
+/* The diagonal block of block p */
+static void diagonal(blas_arg_t *args, job_t *job, BLASLONG p, FLOAT *beta, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t newarg;
+  BLASLONG is, min_i;
+
+  block_range(job, p, p + 1, &is, &min_i);
+
+  newarg.a    = (FLOAT *)args -> a + (is + is * args -> lda) * COMPSIZE;
+  newarg.lda  = args -> lda;
+  newarg.ldb  = args -> ldb;
+  newarg.beta = beta;
+
+  if (!job -> side) {
+    newarg.m = min_i;
+    newarg.n = args -> n;
+    newarg.b = (FLOAT *)args -> b + is * COMPSIZE;
+  } else {
+    newarg.m = args -> m;
+    newarg.n = min_i;
+    newarg.b = (FLOAT *)args -> b + is * args -> ldb * COMPSIZE;
+  }
+
+  (job -> routine)(&newarg, NULL, NULL, sa, sb, 0);
+}
+
+static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  job_t *job = (job_t *)args -> common;
+  FLOAT *alpha = (FLOAT *)args -> beta;
+  BLASLONG p;
+#ifndef TRMM
+  BLASLONG q, r;
+#endif
+
+  for (p = mypos; p < job -> blocks; p += job -> nthreads) {
+
+#ifndef TRMM
+    /* apply the solved blocks in runs, scaling by alpha with the first */
+    for (q = 0; q < p; q = r) {
+
+      while (atomic_load_long(&job -> flag[q * CACHE_LINE_SIZE]) == 0) {YIELDING;};
+
+      for (r = q + 1; r < p; r ++)
+	if (atomic_load_long(&job -> flag[r * CACHE_LINE_SIZE]) == 0) break;
+
+      MB;
+
+      update(args, job, p, q, r, dm1, (q == 0) ? alpha : NULL, sa, sb);
+    }
+
+    diagonal(args, job, p, (p == 0) ? alpha : NULL, sa, sb);
+
+    WMB;
+    atomic_store_long(&job -> flag[p * CACHE_LINE_SIZE], 1);
+#else
+    diagonal(args, job, p, alpha, sa, sb);
+
+    if (p > 0) update(args, job, p, 0, p, alpha, NULL, sa, sb);
+#endif
+  }
+
+  return 0;
+}
+
+/* kind is (side << 4) | (trans << 2) | (uplo << 1) | unit, as in the
+   interface; the threads to use are in args -> nthreads */
+int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG kind) {
+
+  blas_arg_t newarg;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  job_t job;
+  FLOAT *alpha = (FLOAT *)args -> beta;
+  BLASLONG i, nthreads;
+  void *work;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  int mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  int mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  int mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  int mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+
+  job.side  = (kind >> 4) & 1;
+  job.trans = (kind >> 2) & 3;
+
+  /* lower op(A) on the left, upper op(A) on the right, starts at the top */
+  job.forward = ((kind >> 1) & 1) ^ job.side ^ (job.trans & 1);
+
+  job.routine = solve[kind];
+  job.length  = (job.side) ? args -> n : args -> m;
+
+#ifndef COMPLEX
+  if (alpha[0] == ZERO) {
+    GEMM_BETA(args -> m, args -> n, 0, ZERO, NULL, 0, NULL, 0, args -> b, args -> ldb);
+#else
+  if ((alpha[0] == ZERO) && (alpha[1] == ZERO)) {
+    GEMM_BETA(args -> m, args -> n, 0, ZERO, ZERO, NULL, 0, NULL, 0, args -> b, args -> ldb);
+#endif
+    return 0;
+  }
+
+  nthreads = args -> nthreads;
+
+  job.size = (job.length + nthreads * DIVIDE_RATE - 1) / (nthreads * DIVIDE_RATE);
+  job.size = (job.size + GEMM_UNROLL_MN - 1) / GEMM_UNROLL_MN * GEMM_UNROLL_MN;
+  if (job.size > GEMM_Q) job.size = GEMM_Q;
+
+  job.blocks = (job.length + job.size - 1) / job.size;
+
+  if (nthreads > job.blocks) nthreads = job.blocks;
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+  job.nthreads = nthreads;
+
+#ifndef TRMM
+  work = malloc(job.blocks * CACHE_LINE_SIZE * sizeof(BLASLONG));
+#else
+  work = malloc(args -> m * args -> n * COMPSIZE * sizeof(FLOAT));
+#endif
+
+  if (work == NULL) {
+    (job.routine)(args, NULL, NULL, sa, sb, 0);
+    return 0;
+  }
+
+#ifndef TRMM
+  job.flag = (volatile BLASLONG *)work;
+  job.x    = (FLOAT *)args -> b;
+  job.ldx  = args -> ldb;
+
+  for (i = 0; i < job.blocks; i ++) job.flag[i * CACHE_LINE_SIZE] = 0;
+#else
+  job.flag = NULL;
+  job.x    = (FLOAT *)work;
+  job.ldx  = args -> m;
+
+  for (i = 0; i < args -> n; i ++)
+    COPY_K(args -> m, (FLOAT *)args -> b + i * args -> ldb * COMPSIZE, 1, job.x + i * job.ldx * COMPSIZE, 1);
+#endif
+
+  newarg.a      = args -> a;
+  newarg.b      = args -> b;
+  newarg.lda    = args -> lda;
+  newarg.ldb    = args -> ldb;
+  newarg.m      = args -> m;
+  newarg.n      = args -> n;
+  newarg.beta   = args -> beta;
+  newarg.common = (void *)&job;
+
+  for (i = 0; i < nthreads; i ++) {
+    queue[i].mode    = mode;
+    queue[i].routine = inner_thread;
+    queue[i].args    = &newarg;
+    queue[i].range_m = NULL;
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[nthreads - 1].next = NULL;
+
+  exec_blas(nthreads, queue);
+
+  free(work);
+
+  return 0;
+}
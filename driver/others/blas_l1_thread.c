@@ -235,3 +235,68 @@ int blas_level1_thread_with_return_value(int mode, BLASLONG m, BLASLONG n, BLASL
 
   return 0;
 }
+
+/* Threaded reduction over a vector pair. The n elements are cut into   */
+/* at most nthreads contiguous pieces of at least L1_REDUCE_WIDTH       */
+/* elements; piece i calls function(args, range, NULL, NULL, NULL, pos) */
+/* with args->a and args->b at its first element of x and y, args->m    */
+/* its length, args->n its offset into the vectors and args->c the      */
+/* 16-byte slot i of result for its partial value. The number of pieces */
+/* is returned; the caller combines the slots in that order, so the     */
+/* result depends only on n and nthreads, not on thread timing.         */
+
+int blas_level1_reduce(int mode, BLASLONG n,
+		       void *x, BLASLONG incx,
+		       void *y, BLASLONG incy,
+		       void *result, int (*function)(void), int nthreads){
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  blas_arg_t   args [MAX_CPU_NUMBER];
+  BLASLONG     range[MAX_CPU_NUMBER + 1];
+
+  BLASLONG width;
+  int num_cpu, calc_type;
+
+  calc_type = (mode & BLAS_PREC) + ((mode & BLAS_COMPLEX) != 0);
+
+  if (nthreads > n / L1_REDUCE_WIDTH) nthreads = n / L1_REDUCE_WIDTH;
+  if (nthreads < 1) nthreads = 1;
+
+  /* Piece boundaries are kept on 64 elements so vector kernels see aligned starts */
+  width = ((n + nthreads - 1) / nthreads + 63) & ~63;
+
+  num_cpu  = 0;
+  range[0] = 0;
+
+  while (range[num_cpu] < n) {
+
+    range[num_cpu + 1] = range[num_cpu] + width;
+    if (range[num_cpu + 1] > n) range[num_cpu + 1] = n;
+
+    blas_queue_init(&queue[num_cpu]);
+
+    args[num_cpu].m   = range[num_cpu + 1] - range[num_cpu];
+    args[num_cpu].n   = range[num_cpu];
+    args[num_cpu].a   = (void *)((char *)x + ((range[num_cpu] * incx) << calc_type));
+    args[num_cpu].b   = (void *)((char *)y + ((range[num_cpu] * incy) << calc_type));
+    args[num_cpu].c   = (void *)((char *)result + num_cpu * sizeof(double) * 2);
+    args[num_cpu].lda = incx;
+    args[num_cpu].ldb = incy;
+
+    queue[num_cpu].mode    = mode;
+    queue[num_cpu].routine = function;
+    queue[num_cpu].args    = &args[num_cpu];
+    queue[num_cpu].range_m = &range[num_cpu];
+    queue[num_cpu].next    = &queue[num_cpu + 1];
+
+    num_cpu ++;
+  }
+
+  if (num_cpu) {
+    queue[num_cpu - 1].next = NULL;
+
+    exec_blas(num_cpu, queue);
+  }
+
+  return num_cpu;
+}
@@ -0,0 +1,267 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/*
+ * Thread count model for the level 3 drivers.
+ *
+ * The time of a call on nthreads_m x nthreads_n threads is estimated, in
+ * cycles, as the sum of
+ *
+ *   - the kernel time of the slowest thread, whose share of C is rounded
+ *     up to whole register blocks so that skinny shapes are not credited
+ *     with work their padding does not do,
+ *   - the time that thread spends packing A and B (threads of the same
+ *     column share the packed panel of B in the threaded driver),
+ *   - streaming its whole panel of B through the kernel, which bounds
+ *     threads that only own a few rows of C,
+ *   - one synchronisation with every other thread per GEMM_Q block of k,
+ *     when the threads share panels,
+ *   - reading the panels of B that were packed on another NUMA node, when
+ *     a column of threads spans nodes (the threads of a call are numbered
+ *     node by node, so columns that fit in a node pack their own copy),
+ *   - waking and joining the extra threads.
+ *
+ * The thread count and the split of the threads between m and n that
+ * minimise this estimate are used. The cost of waking threads is measured
+ * by the first threaded call where rpcc() counts core cycles.
+ */
+
+#include <stdio.h>
+#include "common.h"
+
+/* Double precision flops per cycle of one core in the GEMM kernels */
+#ifndef MODEL_DFLOPS
+#if defined(HAVE_AVX512VL)
+#define MODEL_DFLOPS	32.
+#elif defined(HAVE_FMA3) || defined(HAVE_AVX2)
+#define MODEL_DFLOPS	16.
+#elif defined(HAVE_AVX) || defined(ARCH_ARM64) || defined(ARCH_POWER)
+#define MODEL_DFLOPS	8.
+#else
+#define MODEL_DFLOPS	4.
+#endif
+#endif
+
+/* Cycles to copy one element into a packed buffer */
+#define MODEL_PACK	1.
+/* Cycles for the kernel to stream one packed element of B from cache */
+#define MODEL_STREAM	.5
+/* Cycles one thread spends on each synchronisation with another one */
+#define MODEL_SYNC	200.
+/* Extra cycles for the kernel to stream one packed element from another node */
+#define MODEL_REMOTE	2.
+/* Cycles to wake and join one extra thread, until measured */
+#define MODEL_DISPATCH	10000.
+
+/* The OpenMP server keeps the default */
+#if (defined(ARCH_X86) || defined(ARCH_X86_64)) && !defined(USE_OPENMP)
+#define MODEL_CALIBRATE
+#endif
+
+static double model_dispatch = MODEL_DISPATCH;
+
+#ifdef MODEL_CALIBRATE
+static volatile BLASULONG model_lock = 0;
+static volatile int model_calibrated = 0;	/* 1 while measuring, 2 once done */
+
+static int model_nop(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		     FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+  return 0;
+}
+
+/* Time a round trip of empty jobs through the thread server. The first */
+/* threaded call measures it before it starts its own work; model_lock  */
+/* only picks that caller, and meanwhile the others use the default.    */
+static void model_calibrate(int nthreads) {
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  unsigned long long start, best = 0;
+  double dispatch;
+  int i, loop, claimed;
+
+  blas_lock(&model_lock);
+  claimed = (model_calibrated == 0);
+  if (claimed) model_calibrated = 1;
+  blas_unlock(&model_lock);
+
+  if (!claimed) return;
+
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+
+  for (loop = 0; loop < 4; loop ++) {
+
+    for (i = 0; i < nthreads; i ++) {
+      queue[i].mode    = BLAS_DOUBLE | BLAS_REAL;
+      queue[i].routine = (void *)model_nop;
+      queue[i].args    = NULL;
+      queue[i].range_m = NULL;
+      queue[i].range_n = NULL;
+      /* non NULL work areas, so that no buffers are allocated */
+      queue[i].sa      = queue;
+      queue[i].sb      = queue;
+      queue[i].next    = &queue[i + 1];
+    }
+    queue[nthreads - 1].next = NULL;
+
+    start = rpcc();
+    exec_blas(nthreads, queue);
+    start = rpcc() - start;
+
+    /* the first round may still be starting threads */
+    if (loop > 0 && (best == 0 || start < best)) best = start;
+  }
+
+  dispatch = (double)best / (double)(nthreads - 1);
+
+  if (dispatch < MODEL_DISPATCH / 20.) dispatch = MODEL_DISPATCH / 20.;
+  if (dispatch > MODEL_DISPATCH * 20.) dispatch = MODEL_DISPATCH * 20.;
+
+  model_dispatch = dispatch;
+  WMB;
+  model_calibrated = 2;
+}
+#endif
+
+static double model_cost(int shape, int mode, BLASLONG m, BLASLONG n, BLASLONG k,
+			 BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q,
+			 BLASLONG nthreads_m, BLASLONG nthreads_n, BLASLONG per_node) {
+
+  double width_m, width_n, flops, rate, pack, cost;
+  BLASLONG nthreads = nthreads_m * nthreads_n;
+  BLASLONG first, last, local, fewest;
+
+  width_m = (double)(((m + nthreads_m - 1) / nthreads_m + unroll_m - 1) / unroll_m * unroll_m);
+  width_n = (double)(((n + nthreads_n - 1) / nthreads_n + unroll_n - 1) / unroll_n * unroll_n);
+
+  rate = MODEL_DFLOPS;
+  if ((mode & BLAS_PREC) == BLAS_SINGLE || (mode & BLAS_PREC) == BLAS_BFLOAT16) rate *= 2.;
+  if ((mode & BLAS_PREC) == BLAS_XDOUBLE) rate /= 8.;
+
+  flops = 2. * width_m * width_n * (double)k;
+  if (mode & BLAS_COMPLEX) flops *= 4.;
+  if (shape & BLAS_MODEL_TRIANGULAR) flops *= .5;
+
+  if (shape & BLAS_MODEL_SHARED) {
+    pack = width_m * (double)k + width_n * (double)k / (double)nthreads_m;
+  } else {
+    pack = width_m * (double)k + width_n * (double)k;
+  }
+  if (mode & BLAS_COMPLEX) pack *= 2.;
+
+  cost = flops / rate + pack * MODEL_PACK + model_dispatch * (double)(nthreads - 1)
+    + width_n * (double)k * ((mode & BLAS_COMPLEX) ? 2. : 1.) * MODEL_STREAM;
+
+  if (shape & BLAS_MODEL_SHARED)
+    cost += (double)((k + q - 1) / q) * MODEL_SYNC * (double)(nthreads - 1);
+
+  /* The server hands a team out node by node, starting on the caller's  */
+  /* node, so threads p and p+1 share a node unless p+1 is a multiple of  */
+  /* per_node.                                                            */
+  /* The thread with the fewest column mates on its node reads the rest  */
+  /* of the column's panels remotely.                                     */
+  if ((shape & BLAS_MODEL_SHARED) && (per_node > 0) && (nthreads > per_node) && (nthreads_m > 1)) {
+    fewest = nthreads_m;
+    for (first = 0; first < nthreads; first += nthreads_m) {
+      for (last = first; last < first + nthreads_m; last += local) {
+	local = MIN(per_node - last % per_node, first + nthreads_m - last);
+	if (local < fewest) fewest = local;
+      }
+    }
+    cost += width_n * (double)k * ((mode & BLAS_COMPLEX) ? 2. : 1.) * MODEL_REMOTE
+      * (double)(nthreads_m - fewest) / (double)nthreads_m;
+  }
+
+  return cost;
+}
+
+int blas_level3_threads(int shape, int mode, BLASLONG m, BLASLONG n, BLASLONG k,
+			BLASLONG unroll_m, BLASLONG unroll_n, BLASLONG q,
+			int nthreads, BLASLONG *nthreads_m) {
+
+  BLASLONG i, t, next, best_m, best_n, max_m, max_n;
+  BLASLONG per_node = 0;
+  double cost, best;
+
+  if (unroll_m < 1) unroll_m = 1;
+  if (unroll_n < 1) unroll_n = 1;
+  if (q < 1) q = 1;
+
+  max_m = (shape & BLAS_MODEL_SPLIT_M) ? (m + unroll_m - 1) / unroll_m : 1;
+  max_n = (shape & BLAS_MODEL_SPLIT_N) ? (n + unroll_n - 1) / unroll_n : 1;
+
+  if (nthreads > max_m * max_n) nthreads = max_m * max_n;
+
+#ifdef MODEL_CALIBRATE
+  /* not from a job on a server thread, while the other workers are busy with the same call */
+  if (nthreads > 1 && !model_calibrated
+#ifndef OS_WINDOWS
+      && !blas_in_parallel
+#endif
+      ) model_calibrate(nthreads);
+#endif
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+  /* threads per node, when the thread server spreads them evenly */
+  if (get_num_nodes() > 1 && get_node_equal()) per_node = blas_cpu_number / get_num_nodes();
+#endif
+
+  best_m = 1;
+  best_n = 1;
+  best   = model_cost(shape, mode, m, n, k, unroll_m, unroll_n, q, 1, 1, per_node);
+
+  for (t = 2; t <= nthreads; t ++) {
+
+    /* every extra thread costs at least its dispatch */
+    if (model_dispatch * (double)(t - 1) >= best) break;
+
+    /* rows of threads: the power of two divisors of t, and t itself */
+    for (i = 1; i <= t; i = next) {
+
+      next = ((t % (i * 2)) == 0) ? i * 2 : ((i == t) ? t + 1 : t);
+
+      if (i > max_m || t / i > max_n) continue;
+
+      cost = model_cost(shape, mode, m, n, k, unroll_m, unroll_n, q, i, t / i, per_node);
+
+      if (cost < best) {
+	best   = cost;
+	best_m = i;
+	best_n = t / i;
+      }
+    }
+  }
+
+  if (nthreads_m) *nthreads_m = best_m;
+
+  return (int)(best_m * best_n);
+}
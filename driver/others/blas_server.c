@@ -94,6 +94,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 extern unsigned int openblas_thread_timeout(void);
+extern int openblas_buffer_idle_timeout_env(void);
 
 #ifdef SMP_SERVER
 
@@ -117,6 +118,17 @@ int blas_omp_threads_local = 1;
 
 static void * blas_thread_buffer[MAX_CPU_NUMBER];
 
+/* Set on the worker threads, and on a caller while it runs its own  */
+/* share of a job. num_cpu_avail() reports a single thread there, so */
+/* a kernel that threads internally does not queue a nested job and  */
+/* wait for a team that is busy with the enclosing one.              */
+__thread int blas_in_parallel = 0;
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+/* Node the pages of each worker buffer have been moved to, -1 if none */
+static int blas_thread_buffer_node[MAX_CPU_NUMBER];
+#endif
+
 /* Local Variables */
 #if   defined(USE_PTHREAD_LOCK)
 static pthread_mutex_t  server_lock    = PTHREAD_MUTEX_INITIALIZER;
@@ -163,6 +175,9 @@ static thread_status_t thread_status[MAX_CPU_NUMBER] __attribute__((aligned(ATTR
 
 static unsigned int thread_timeout = (1U << (THREAD_TIMEOUT));
 
+/* Seconds a sleeping thread keeps its buffer, 0 for as long as it lives */
+static int buffer_idle_timeout = 0;
+
 #ifdef MONITOR
 
 /* Monitor is a function to see thread's status for every second. */
@@ -194,6 +209,7 @@ BLASLONG	exit_time[MAX_CPU_NUMBER];
 
 //Prototypes
 static void exec_threads(int , blas_queue_t *, int);
+static __inline int claim_thread_slot(BLASLONG);
 static void adjust_thread_buffers();
 
 static void legacy_exec(void *func, int mode, blas_arg_t *args, void *sb){
@@ -382,6 +398,7 @@ static void* blas_thread_server(void *arg){
   BLASLONG  cpu = (BLASLONG)arg;
   unsigned int last_tick;
   blas_queue_t	*queue;
+  struct timespec deadline;
 
 blas_queue_t *tscq;
 
@@ -396,6 +413,8 @@ blas_queue_t *tscq;
     thread_status[cpu].node = gotoblas_set_affinity(-1);
 #endif
 
+  blas_in_parallel = 1;
+
 #ifdef MONITOR
   main_status[cpu] = MAIN_ENTER;
 #endif
@@ -434,6 +453,17 @@ blas_queue_t *tscq;
 	      main_status[cpu] = MAIN_SLEEPING;
 #endif
 
+	      if (buffer_idle_timeout && blas_thread_buffer[cpu]) {
+		/* The buffer goes back once the thread has slept for the timeout */
+		/* and is fetched again by exec_threads for the next job.         */
+		deadline.tv_sec  = time(NULL) + buffer_idle_timeout;
+		deadline.tv_nsec = 0;
+		if (pthread_cond_timedwait(&thread_status[cpu].wakeup, &thread_status[cpu].lock, &deadline) == ETIMEDOUT &&
+		    thread_status[cpu].status == THREAD_STATUS_SLEEP && !atomic_load_queue(&thread_status[cpu].queue)) {
+		  blas_memory_discard(blas_thread_buffer[cpu]);
+		  blas_thread_buffer[cpu] = NULL;
+		}
+	      } else
 	      pthread_cond_wait(&thread_status[cpu].wakeup, &thread_status[cpu].lock);
 	    }
 	    pthread_mutex_unlock(&thread_status[cpu].lock);
@@ -463,6 +493,14 @@ blas_queue_t *tscq;
     exec_threads(cpu, queue, 0);
   }
 
+    /* Streams that found the pool busy are taken by the first worker to be
+       done, which keeps its slot claimed meanwhile */
+    MB;
+    if (blas_stream_pending && claim_thread_slot(cpu)) {
+      blas_stream_resume();
+      atomic_store_queue(&thread_status[cpu].queue, (blas_queue_t *)0);
+    }
+
 #ifdef MONITOR
       main_status[cpu] = MAIN_DONE;
 #endif
@@ -576,6 +614,8 @@ int blas_thread_init(void){
       thread_timeout = (1 << thread_timeout_env);
     }
 
+    buffer_idle_timeout = openblas_buffer_idle_timeout_env();
+
     for(i = 0; i < blas_num_threads - 1; i++){
 
       atomic_store_queue(&thread_status[i].queue, (blas_queue_t *)0);
@@ -631,7 +671,124 @@ int blas_thread_init(void){
      exec_blas       ... returns after jobs are finished.
 */
 
+/*
+   Callers do not serialize on a global lock while queuing jobs. Each
+   call claims a team of idle workers by atomically switching their
+   queue slot from 0 to 1 (the "busy" marker that the workers ignore),
+   and only then publishes its jobs. The jobs of a team may wait on
+   each other, so a team is only started once all of its workers are
+   claimed. A call that can not get its whole team in one pass gives
+   back what it holds and queues on exec_queue_lock; the holder of the
+   lock keeps every slot it claims until its team is complete. Only
+   that one caller holds part of the pool at a time, so callers can
+   neither deadlock nor keep taking slots away from each other.
+*/
+
 static BLASULONG exec_queue_lock = 0;
+static BLASLONG  exec_queue_hint = 0;
+
+#ifdef HAVE_C11
+#define	atomic_load_hint(p)		__atomic_load_n(p, __ATOMIC_RELAXED)
+#define	atomic_store_hint(p, v)		__atomic_store_n(p, v, __ATOMIC_RELAXED)
+#else
+#define	atomic_load_hint(p)		(*(volatile BLASLONG *)(p))
+#define	atomic_store_hint(p, v)		(*(volatile BLASLONG *)(p) = (v))
+#endif
+
+static __inline int claim_thread_slot(BLASLONG i){
+  blas_queue_t *expected = (blas_queue_t *)0;
+
+#ifdef HAVE_C11
+  return __atomic_compare_exchange_n(&thread_status[i].queue, &expected, (blas_queue_t *)1,
+				     0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+#else
+  return __sync_bool_compare_and_swap(&thread_status[i].queue, expected, (blas_queue_t *)1);
+#endif
+}
+
+/* One pass over the pool; adds the idle workers it can claim to team */
+static BLASLONG claim_idle_slots(BLASLONG num, int node, BLASLONG start,
+				 BLASLONG *team, BLASLONG claimed){
+
+  BLASLONG workers = blas_num_threads - 1;
+  BLASLONG i, j;
+  int pass, passes = 1;
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+  if (node >= 0) passes = 2;
+#endif
+
+  /* With node mapping, workers on the caller's node are tried first */
+  for (pass = 0; pass < passes && claimed < num; pass ++) {
+    for (j = 0; j < workers && claimed < num; j ++) {
+      i = start + j;
+      if (i >= workers) i -= workers;
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+      if (passes == 2 && ((thread_status[i].node == node) != (pass == 0))) continue;
+#endif
+
+      if (atomic_load_queue(&thread_status[i].queue)) continue;
+
+      if (claim_thread_slot(i)) team[claimed ++] = i;
+    }
+  }
+
+  return claimed;
+}
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+/* The level 3 model (blas_l3_model.c) takes queue position p to run on */
+/* node p / per_node, the caller being position 0. Whatever order the   */
+/* slots were claimed in, hand them out node by node, the caller's      */
+/* node first.                                                          */
+static void sort_team_by_node(BLASLONG num, int home, BLASLONG *team){
+
+  BLASLONG i, j, t;
+  int key;
+
+#define TEAM_NODE_KEY(slot) ((thread_status[slot].node == home) ? -1 : thread_status[slot].node)
+
+  for (i = 1; i < num; i ++) {
+    t   = team[i];
+    key = TEAM_NODE_KEY(t);
+    for (j = i; j > 0 && TEAM_NODE_KEY(team[j - 1]) > key; j --) team[j] = team[j - 1];
+    team[j] = t;
+  }
+
+#undef TEAM_NODE_KEY
+}
+#endif
+
+static BLASLONG claim_thread_team(BLASLONG num, int node, BLASLONG *team){
+
+  BLASLONG workers = blas_num_threads - 1;
+  BLASLONG j, start, claimed;
+
+  start   = atomic_load_hint(&exec_queue_hint);
+  if (start >= workers) start = 0;
+
+  claimed = claim_idle_slots(num, node, start, team, 0);
+
+  if (claimed < num) {
+
+    for (j = 0; j < claimed; j ++) atomic_store_queue(&thread_status[team[j]].queue, (blas_queue_t *)0);
+
+    blas_lock(&exec_queue_lock);
+
+    claimed = 0;
+    while ((claimed = claim_idle_slots(num, node, start, team, claimed)) < num) YIELDING;
+
+    blas_unlock(&exec_queue_lock);
+  }
+
+  /* Spread the next caller's search over the rest of the pool */
+  start += num;
+  if (start >= workers) start -= workers;
+  atomic_store_hint(&exec_queue_hint, start);
+
+  return claimed;
+}
 
 int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
 
@@ -639,12 +796,13 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
   // Handle lazy re-init of the thread-pool after a POSIX fork
   if (unlikely(blas_server_avail == 0)) blas_thread_init();
 #endif
-  BLASLONG i = 0;
+  BLASLONG i, num, slot, workers;
+  BLASLONG team[MAX_CPU_NUMBER];
   blas_queue_t *current = queue;
-  blas_queue_t *tsiq,*tspq;
+  blas_queue_t *tspq, *next;
+  int node = -1;
 #if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
-  int node  = get_node();
-  int nodes = get_num_nodes();
+  int this_node = get_node();
 #endif
 
 #ifdef SMP_DEBUG
@@ -652,106 +810,149 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
   fprintf(STDERR, "Exec_blas_async is called. Position = %d\n", pos);
 #endif
 
-  blas_lock(&exec_queue_lock);
+  workers = blas_num_threads - 1;
 
     while (queue) {
-      queue -> position  = pos;
+
+      /* A team can not be larger than the pool; longer lists are queued */
+      /* in pool-sized pieces as workers become free again.                */
+      num = 0;
+      for (next = queue; next && num < workers; next = next -> next) num ++;
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+      node = (queue -> mode & BLAS_NODE) ? this_node : -1;
+#endif
+
+      claim_thread_team(num, node, team);
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+      if (get_num_nodes() > 1) sort_team_by_node(num, this_node, team);
+#endif
+
+      current = queue;
+
+      for (i = 0; i < num; i ++) {
+	queue -> position  = pos;
 
 #ifdef CONSISTENT_FPCSR
 #ifdef __aarch64__
-      __asm__ __volatile__ ("mrs %0, fpcr" : "=r" (queue -> sse_mode));
+	__asm__ __volatile__ ("mrs %0, fpcr" : "=r" (queue -> sse_mode));
 #else
-      __asm__ __volatile__ ("fnstcw %0"  : "=m" (queue -> x87_mode));
-      __asm__ __volatile__ ("stmxcsr %0" : "=m" (queue -> sse_mode));
+	__asm__ __volatile__ ("fnstcw %0"  : "=m" (queue -> x87_mode));
+	__asm__ __volatile__ ("stmxcsr %0" : "=m" (queue -> sse_mode));
 #endif
 #endif
 
-#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+	queue -> assigned = team[i];
+	MB;
 
-      /* Node Mapping Mode */
+	atomic_store_queue(&thread_status[team[i]].queue, queue);
 
-      if (queue -> mode & BLAS_NODE) {
+	queue = queue -> next;
+	pos ++;
+#ifdef SMP_DEBUG
+	exec_count ++;
+#endif
+      }
 
-	do {
-      
-	  while((thread_status[i].node != node || atomic_load_queue(&thread_status[i].queue)) && (i < blas_num_threads - 1)) i ++;
+      /* Wake up the members of this team that went to sleep */
+      for (i = 0; i < num; i ++) {
 
-	  if (i < blas_num_threads - 1) break;
+	slot = current -> assigned;
 
-	  i ++;
-	  if (i >= blas_num_threads - 1) {
-	    i = 0;
-	    node ++;
-	    if (node >= nodes) node = 0;
-	  }
+	tspq = atomic_load_queue(&thread_status[slot].queue);
 
-	} while (1);
+	if ((BLASULONG)tspq > 1) {
+	  pthread_mutex_lock  (&thread_status[slot].lock);
 
-      } else {
-	tsiq = atomic_load_queue(&thread_status[i].queue);
-	while(tsiq) {
-	  i ++;
-	  if (i >= blas_num_threads - 1) i = 0;
-	  tsiq = atomic_load_queue(&thread_status[i].queue);
-	}
-      }
-#else
-      tsiq = atomic_load_queue(&thread_status[i].queue);
-      while(tsiq) {
-	i ++;
-	if (i >= blas_num_threads - 1) i = 0;
-        tsiq = atomic_load_queue(&thread_status[i].queue);
-      }
+	  if (thread_status[slot].status == THREAD_STATUS_SLEEP) {
+
+#ifdef MONITOR
+	    num_suspend ++;
 #endif
 
-      queue -> assigned = i;
-      MB;
+	    thread_status[slot].status = THREAD_STATUS_WAKEUP;
+	    pthread_cond_signal(&thread_status[slot].wakeup);
+	  }
+
+	  pthread_mutex_unlock(&thread_status[slot].lock);
+	}
 
-      atomic_store_queue(&thread_status[i].queue, queue);
+	current = current -> next;
+      }
+    }
 
-      queue = queue -> next;
-      pos ++;
 #ifdef SMP_DEBUG
-      exec_count ++;
+    fprintf(STDERR, "Done(Number of threads = %2ld).\n", exec_count);
 #endif
 
-    }
+  return 0;
+}
 
-    blas_unlock(&exec_queue_lock);
+/* Hands a single job to a worker that is idle right now. Returns 0,  */
+/* with nothing queued, when all of them are busy instead of waiting. */
+int exec_blas_async_try(BLASLONG pos, blas_queue_t *queue){
 
-#ifdef SMP_DEBUG
-    fprintf(STDERR, "Done(Number of threads = %2ld).\n", exec_count);
+#ifdef SMP_SERVER
+  // Handle lazy re-init of the thread-pool after a POSIX fork
+  if (unlikely(blas_server_avail == 0)) blas_thread_init();
 #endif
+  BLASLONG i, j, start, slot, workers;
+  blas_queue_t *tspq;
 
-    while (current) {
+  workers = blas_num_threads - 1;
+  start   = atomic_load_hint(&exec_queue_hint);
+  slot    = -1;
 
-      pos = current -> assigned;
+  if (start >= workers) start = 0;
 
-      tspq = atomic_load_queue(&thread_status[pos].queue);
+  for (j = 0; j < workers; j ++) {
+    i = start + j;
+    if (i >= workers) i -= workers;
 
-      if ((BLASULONG)tspq > 1) {
-	pthread_mutex_lock  (&thread_status[pos].lock);
+    if (atomic_load_queue(&thread_status[i].queue)) continue;
 
-	if (thread_status[pos].status == THREAD_STATUS_SLEEP) {
+    if (claim_thread_slot(i)) {
+      slot = i;
+      break;
+    }
+  }
 
+  if (slot < 0) return 0;
 
-#ifdef MONITOR
-	  num_suspend ++;
+  atomic_store_hint(&exec_queue_hint, (slot + 1 < workers) ? slot + 1 : 0);
+
+  queue -> position = pos;
+
+#ifdef CONSISTENT_FPCSR
+#ifdef __aarch64__
+  __asm__ __volatile__ ("mrs %0, fpcr" : "=r" (queue -> sse_mode));
+#else
+  __asm__ __volatile__ ("fnstcw %0"  : "=m" (queue -> x87_mode));
+  __asm__ __volatile__ ("stmxcsr %0" : "=m" (queue -> sse_mode));
+#endif
 #endif
 
-	  if (thread_status[pos].status == THREAD_STATUS_SLEEP) {
-	    thread_status[pos].status = THREAD_STATUS_WAKEUP;
-	    pthread_cond_signal(&thread_status[pos].wakeup);
-	  }
+  queue -> assigned = slot;
+  MB;
 
-	}
-	  pthread_mutex_unlock(&thread_status[pos].lock);
-      }
+  /* The job may be finished, and its entry released, from here on */
+  atomic_store_queue(&thread_status[slot].queue, queue);
+
+  tspq = atomic_load_queue(&thread_status[slot].queue);
+
+  if ((BLASULONG)tspq > 1) {
+    pthread_mutex_lock  (&thread_status[slot].lock);
 
-      current = current -> next;
+    if (thread_status[slot].status == THREAD_STATUS_SLEEP) {
+      thread_status[slot].status = THREAD_STATUS_WAKEUP;
+      pthread_cond_signal(&thread_status[slot].wakeup);
     }
 
-  return 0;
+    pthread_mutex_unlock(&thread_status[slot].lock);
+  }
+
+  return 1;
 }
 
 int exec_blas_async_wait(BLASLONG num, blas_queue_t *queue){
@@ -788,6 +989,7 @@ int exec_blas(BLASLONG num, blas_queue_t *queue){
   if (unlikely(blas_server_avail == 0)) blas_thread_init();
 #endif
   int (*routine)(blas_arg_t *, void *, void *, double *, double *, BLASLONG);
+  int in_parallel;
 
 #ifdef TIMING_DEBUG
   BLASULONG start, stop;
@@ -831,6 +1033,9 @@ if (openblas_threads_callback_) {
 
   routine = (int (*)(blas_arg_t *, void *, void *, double *, double *, BLASLONG))queue -> routine;
 
+  in_parallel = blas_in_parallel;
+  if (num > 1) blas_in_parallel = 1;
+
   if (queue -> mode & BLAS_LEGACY) {
     legacy_exec(routine, queue -> mode, queue -> args, queue -> sb);
   } else
@@ -841,6 +1046,8 @@ if (openblas_threads_callback_) {
       (routine)(queue -> args, queue -> range_m, queue -> range_n,
 		queue -> sa, queue -> sb, 0);
 
+  blas_in_parallel = in_parallel;
+
 #ifdef TIMING_DEBUG
   stop = rpcc();
 #endif
@@ -984,12 +1191,15 @@ int BLASFUNC(blas_thread_shutdown)(void){
 
   LOCK_COMMAND(&server_lock);
 
-  //Free buffers allocated for threads
+  //Free buffers allocated for threads; a sleeping thread may drop
+  //its buffer by itself, which it does under its lock
   for(i=0; i<MAX_CPU_NUMBER; i++){
+    if (blas_server_avail && i < blas_num_threads - 1) pthread_mutex_lock(&thread_status[i].lock);
     if(blas_thread_buffer[i]!=NULL){
       blas_memory_free(blas_thread_buffer[i]);
       blas_thread_buffer[i]=NULL;
     }
+    if (blas_server_avail && i < blas_num_threads - 1) pthread_mutex_unlock(&thread_status[i].lock);
   }
 
   if (blas_server_avail) {
@@ -1028,6 +1238,44 @@ int BLASFUNC(blas_thread_shutdown)(void){
   return 0;
 }
 
+/* Called by openblas_trim_memory(): the threads that are asleep give */
+/* their buffer back and fetch a new one when they are woken for work. */
+int blas_thread_buffer_trim(void){
+
+  int i, count = 0;
+
+  if (!blas_server_avail) return 0;
+
+  LOCK_COMMAND(&server_lock);
+
+  for (i = 0; i < blas_num_threads - 1; i++) {
+
+    pthread_mutex_lock  (&thread_status[i].lock);
+
+    if (thread_status[i].status == THREAD_STATUS_SLEEP &&
+	!atomic_load_queue(&thread_status[i].queue) && blas_thread_buffer[i]) {
+      blas_memory_free(blas_thread_buffer[i]);
+      blas_thread_buffer[i] = NULL;
+      count ++;
+    }
+
+    pthread_mutex_unlock(&thread_status[i].lock);
+  }
+
+  /* No thread has been started for the rest yet */
+  for (; i < MAX_CPU_NUMBER; i++) {
+    if (blas_thread_buffer[i]) {
+      blas_memory_free(blas_thread_buffer[i]);
+      blas_thread_buffer[i] = NULL;
+      count ++;
+    }
+  }
+
+  UNLOCK_COMMAND(&server_lock);
+
+  return count;
+}
+
 static void adjust_thread_buffers() {
 
   int i=0;
@@ -1036,6 +1284,9 @@ static void adjust_thread_buffers() {
   for(i=0; i < blas_cpu_number; i++){
     if(blas_thread_buffer[i] == NULL){
       blas_thread_buffer[i] = blas_memory_alloc(2);
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+      blas_thread_buffer_node[i] = -1;
+#endif
     }
   }
   for(; i < MAX_CPU_NUMBER; i++){
@@ -1046,6 +1297,36 @@ static void adjust_thread_buffers() {
   }
 }
 
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+/* The work buffers are kept from call to call, and a buffer handed out */
+/* by the memory pool may have been touched on another node before.     */
+/* Its pages are moved to the node of the worker that owns it, so that   */
+/* the panels the worker packs there are local to it and to the threads */
+/* of its node that read them.                                           */
+static void home_thread_buffer(int cpu) {
+
+  unsigned long nodemask[4];
+  BLASULONG start, end;
+  int node = thread_status[cpu].node;
+
+  if (get_num_nodes() <= 1) return;
+  if (node < 0 || node >= (int)(sizeof(nodemask) * 8)) return;
+  if (blas_thread_buffer_node[cpu] == node) return;
+
+  nodemask[0] = nodemask[1] = nodemask[2] = nodemask[3] = 0UL;
+  nodemask[node / (sizeof(unsigned long) * 8)] = 1UL << (node % (sizeof(unsigned long) * 8));
+
+  start = ((BLASULONG)blas_thread_buffer[cpu] + PAGESIZE - 1) & ~(BLASULONG)(PAGESIZE - 1);
+  end   = ((BLASULONG)blas_thread_buffer[cpu] + blas_buffer_size()) & ~(BLASULONG)(PAGESIZE - 1);
+
+  /* a failure only costs locality */
+  if (end > start)
+    my_mbind((void *)start, end - start, MPOL_PREFERRED, nodemask, sizeof(nodemask) * 8, MPOL_MF_MOVE);
+
+  blas_thread_buffer_node[cpu] = node;
+}
+#endif
+
 static void exec_threads(int cpu, blas_queue_t *queue, int buf_index) {
 
   int (*routine)(blas_arg_t *, void *, void *, void *, void *, BLASLONG) = (int (*)(blas_arg_t *, void *, void *, void *, void *, BLASLONG))queue -> routine;
@@ -1079,8 +1360,15 @@ fprintf(STDERR, "Server[%2ld] Calculation started.  Mode = 0x%03x M = %3ld N=%3l
 if (buffer == NULL) {
 	blas_thread_buffer[cpu] = blas_memory_alloc(2);
 	buffer = blas_thread_buffer[cpu];
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+	blas_thread_buffer_node[cpu] = -1;
+#endif
 }      
 
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
+      home_thread_buffer(cpu);
+#endif
+
 	
 //For LOONGARCH64, applying an offset to the buffer is essential
 //for minimizing cache conflicts and optimizing performance.
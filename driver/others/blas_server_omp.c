@@ -176,6 +176,12 @@ int BLASFUNC(blas_thread_shutdown)(void){
   return 0;
 }
 
+/* The buffers of the OpenMP threads stay mapped, as the memory table */
+/* of this build does not release buffers before shutdown either.     */
+int blas_thread_buffer_trim(void){
+  return 0;
+}
+
 static void legacy_exec(void *func, int mode, blas_arg_t *args, void *sb){
 
       if (!(mode & BLAS_COMPLEX)){
@@ -539,6 +539,11 @@ int BLASFUNC(blas_thread_shutdown)(void){
   return 0;
 }
 
+/* The worker threads keep the buffer they take at start-up until shutdown */
+int blas_thread_buffer_trim(void){
+  return 0;
+}
+
 void goto_set_num_threads(int num_threads)
 {
 	long i;
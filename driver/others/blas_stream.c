@@ -0,0 +1,795 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdlib.h>
+#include "common.h"
+#ifndef CBLAS
+#include "cblas.h"
+#endif
+
+/* Stream-ordered asynchronous calls.
+
+   Each stream is a FIFO of calls. A stream with work and nothing
+   blocking it sits on the ready list, and any thread that takes it
+   from there runs its calls one after the other until the stream is
+   empty or reaches a wait on an event that has not completed yet;
+   it is then parked on the blocked list until the record it waits for
+   is reached. Runners never sleep, so a stream is always progressed by
+   someone: idle workers of the thread server are handed drain jobs
+   when work becomes ready, work that found the whole pool busy is
+   picked up by the next worker to finish its job, and callers waiting
+   in a synchronize help with whatever is ready in the meantime. The
+   submitting thread only runs calls itself when there is no pool at
+   all (one thread), as nobody else ever would. Calls taken by a worker run
+   on that worker alone, so independent streams are spread across the
+   pool instead of each call splitting the pool among its threads.
+
+   An event is recorded by placing a marker in a stream. Each record
+   gets its own refcounted mark, so a wait always refers to the record
+   that was the latest when the wait was enqueued, even if the event
+   is recorded again later on.
+
+   Without the pthreads server (OpenMP, Windows and single threaded
+   builds) calls run when they are enqueued and events complete at
+   once, which keeps the ordering guarantees trivially. */
+
+#if defined(SMP_SERVER) && !defined(USE_OPENMP) && !defined(OS_WINDOWS)
+#define STREAM_ASYNC
+#include <pthread.h>
+#endif
+
+enum { STREAM_GEMM, STREAM_TRSM, STREAM_AXPY, STREAM_RECORD, STREAM_WAIT };
+
+/* Precisions, in the order of the s/d/c/z entry points */
+enum { STREAM_S, STREAM_D, STREAM_C, STREAM_Z };
+
+/* Stream states */
+enum { STREAM_IDLE, STREAM_READY, STREAM_RUNNING, STREAM_BLOCKED };
+
+typedef struct {
+  int done;
+  int refs;
+} stream_mark_t;
+
+typedef struct stream_op {
+  struct stream_op *next;
+  int kind, prec;
+  char side, uplo, transa, transb, diag;
+  blasint m, n, k, lda, ldb, ldc;
+  union { float s[2]; double d[2]; } alpha, beta;
+  void *a, *b, *c;
+  stream_mark_t *mark;
+} stream_op_t;
+
+struct openblas_stream_s {
+  stream_op_t *head, *tail;
+  int state;
+  struct openblas_stream_s *link;
+};
+
+struct openblas_event_s {
+  stream_mark_t *mark;
+};
+
+static void stream_exec(stream_op_t *op){
+
+  switch (op -> kind) {
+
+  case STREAM_GEMM :
+    switch (op -> prec) {
+#ifdef BUILD_SINGLE
+    case STREAM_S :
+      BLASFUNC(sgemm)(&op -> transa, &op -> transb, &op -> m, &op -> n, &op -> k, op -> alpha.s,
+		      op -> a, &op -> lda, op -> b, &op -> ldb, op -> beta.s, op -> c, &op -> ldc);
+      break;
+#endif
+#ifdef BUILD_DOUBLE
+    case STREAM_D :
+      BLASFUNC(dgemm)(&op -> transa, &op -> transb, &op -> m, &op -> n, &op -> k, op -> alpha.d,
+		      op -> a, &op -> lda, op -> b, &op -> ldb, op -> beta.d, op -> c, &op -> ldc);
+      break;
+#endif
+#ifdef BUILD_COMPLEX
+    case STREAM_C :
+      BLASFUNC(cgemm)(&op -> transa, &op -> transb, &op -> m, &op -> n, &op -> k, op -> alpha.s,
+		      op -> a, &op -> lda, op -> b, &op -> ldb, op -> beta.s, op -> c, &op -> ldc);
+      break;
+#endif
+#ifdef BUILD_COMPLEX16
+    case STREAM_Z :
+      BLASFUNC(zgemm)(&op -> transa, &op -> transb, &op -> m, &op -> n, &op -> k, op -> alpha.d,
+		      op -> a, &op -> lda, op -> b, &op -> ldb, op -> beta.d, op -> c, &op -> ldc);
+      break;
+#endif
+    }
+    break;
+
+  case STREAM_TRSM :
+    switch (op -> prec) {
+#ifdef BUILD_SINGLE
+    case STREAM_S :
+      BLASFUNC(strsm)(&op -> side, &op -> uplo, &op -> transa, &op -> diag, &op -> m, &op -> n,
+		      op -> alpha.s, op -> a, &op -> lda, op -> b, &op -> ldb);
+      break;
+#endif
+#ifdef BUILD_DOUBLE
+    case STREAM_D :
+      BLASFUNC(dtrsm)(&op -> side, &op -> uplo, &op -> transa, &op -> diag, &op -> m, &op -> n,
+		      op -> alpha.d, op -> a, &op -> lda, op -> b, &op -> ldb);
+      break;
+#endif
+#ifdef BUILD_COMPLEX
+    case STREAM_C :
+      BLASFUNC(ctrsm)(&op -> side, &op -> uplo, &op -> transa, &op -> diag, &op -> m, &op -> n,
+		      op -> alpha.s, op -> a, &op -> lda, op -> b, &op -> ldb);
+      break;
+#endif
+#ifdef BUILD_COMPLEX16
+    case STREAM_Z :
+      BLASFUNC(ztrsm)(&op -> side, &op -> uplo, &op -> transa, &op -> diag, &op -> m, &op -> n,
+		      op -> alpha.d, op -> a, &op -> lda, op -> b, &op -> ldb);
+      break;
+#endif
+    }
+    break;
+
+  case STREAM_AXPY :
+    /* n, incx and incy are kept in m, lda and ldb */
+    switch (op -> prec) {
+#ifdef BUILD_SINGLE
+    case STREAM_S :
+      BLASFUNC(saxpy)(&op -> m, op -> alpha.s, op -> a, &op -> lda, op -> b, &op -> ldb);
+      break;
+#endif
+#ifdef BUILD_DOUBLE
+    case STREAM_D :
+      BLASFUNC(daxpy)(&op -> m, op -> alpha.d, op -> a, &op -> lda, op -> b, &op -> ldb);
+      break;
+#endif
+#ifdef BUILD_COMPLEX
+    case STREAM_C :
+      BLASFUNC(caxpy)(&op -> m, op -> alpha.s, op -> a, &op -> lda, op -> b, &op -> ldb);
+      break;
+#endif
+#ifdef BUILD_COMPLEX16
+    case STREAM_Z :
+      BLASFUNC(zaxpy)(&op -> m, op -> alpha.d, op -> a, &op -> lda, op -> b, &op -> ldb);
+      break;
+#endif
+    }
+    break;
+  }
+}
+
+#ifdef STREAM_ASYNC
+
+static pthread_mutex_t stream_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  stream_cond = PTHREAD_COND_INITIALIZER;
+
+static openblas_stream_t stream_ready_head = NULL, stream_ready_tail = NULL;
+static openblas_stream_t stream_blocked = NULL;
+
+/* Drain jobs handed to workers and not started yet */
+static int stream_starting = 0;
+
+/* Set while ready work may have found no idle worker; checked by the
+   workers of the thread server after each job */
+volatile int blas_stream_pending = 0;
+
+static void stream_mark_release(stream_mark_t *mark){
+  if (-- mark -> refs == 0) free(mark);
+}
+
+static void stream_push_ready(openblas_stream_t stream){
+  stream -> state = STREAM_READY;
+  stream -> link  = NULL;
+  if (stream_ready_tail) stream_ready_tail -> link = stream; else stream_ready_head = stream;
+  stream_ready_tail = stream;
+}
+
+static openblas_stream_t stream_pop_ready(void){
+  openblas_stream_t stream = stream_ready_head;
+
+  if (stream) {
+    stream_ready_head = stream -> link;
+    if (stream_ready_head == NULL) stream_ready_tail = NULL;
+    stream -> state = STREAM_RUNNING;
+  }
+  return stream;
+}
+
+/* Moves the streams whose wait has been satisfied back to the ready list */
+static void stream_unblock(void){
+  openblas_stream_t *prev = &stream_blocked, stream, next;
+
+  while ((stream = *prev)) {
+    next = stream -> link;
+    if (stream -> head -> mark -> done) {
+      *prev = next;
+      stream_push_ready(stream);
+    } else {
+      prev = &stream -> link;
+    }
+  }
+}
+
+/* Runs a stream until it is empty or blocked. Called and returns with the lock held. */
+static void stream_run(openblas_stream_t stream){
+  stream_op_t *op;
+
+  while ((op = stream -> head)) {
+
+    if (op -> kind == STREAM_WAIT) {
+      if (!op -> mark -> done) {
+	stream -> state = STREAM_BLOCKED;
+	stream -> link  = stream_blocked;
+	stream_blocked  = stream;
+	return;
+      }
+    } else if (op -> kind == STREAM_RECORD) {
+      op -> mark -> done = 1;
+      stream_unblock();
+      pthread_cond_broadcast(&stream_cond);
+    } else {
+      pthread_mutex_unlock(&stream_lock);
+      stream_exec(op);
+      pthread_mutex_lock(&stream_lock);
+    }
+
+    stream -> head = op -> next;
+    if (stream -> head == NULL) stream -> tail = NULL;
+    if (op -> mark) stream_mark_release(op -> mark);
+    free(op);
+  }
+
+  stream -> state = STREAM_IDLE;
+  pthread_cond_broadcast(&stream_cond);
+}
+
+static void stream_dispatch(void);
+
+/* Drain job run by a worker; the queue entry is its own argument */
+static void stream_drain(void *arg){
+  openblas_stream_t stream;
+
+  free(arg);
+
+  pthread_mutex_lock(&stream_lock);
+  stream_starting --;
+
+  while ((stream = stream_pop_ready())) {
+    stream_run(stream);
+    /* Streams released by this one are offered to other idle workers */
+    stream_dispatch();
+  }
+
+  pthread_mutex_unlock(&stream_lock);
+}
+
+/* Hands ready streams to idle workers, one drain job each. Lock held. */
+static void stream_dispatch(void){
+  openblas_stream_t stream;
+  blas_queue_t *queue;
+  int ready = 0;
+
+  for (stream = stream_ready_head; stream; stream = stream -> link) ready ++;
+
+  while (ready > stream_starting) {
+
+    queue = (blas_queue_t *)malloc(sizeof(blas_queue_t));
+    if (queue == NULL) break;
+
+    blas_queue_init(queue);
+    queue -> mode    = BLAS_PTHREAD;
+    queue -> routine = (void *)stream_drain;
+    queue -> args    = (void *)queue;
+
+    if (!exec_blas_async_try(0, queue)) {
+      free(queue);
+      break;
+    }
+
+    stream_starting ++;
+  }
+}
+
+/* Runs ready streams on the calling thread, one call per thread like the workers do */
+static void stream_help(openblas_stream_t stream){
+  int in_parallel = blas_in_parallel;
+
+  blas_in_parallel = 1;
+  stream_run(stream);
+  blas_in_parallel = in_parallel;
+}
+
+/* Makes sure ready work is owned by someone before the caller leaves. Lock held. */
+static void stream_settle(void){
+  openblas_stream_t stream;
+
+  if (stream_ready_head == NULL) return;
+
+  /* Raised before the pool is tried, so a worker that is still busy now
+     either gets a drain job or sees the flag once it is done */
+  blas_stream_pending = 1;
+  MB;
+
+  stream_dispatch();
+
+  /* With no pool at all nobody else would ever run it */
+  if (blas_num_threads <= 1)
+    while ((stream = stream_pop_ready())) stream_run(stream);
+}
+
+/* Called by a worker of the thread server between jobs, with its slot
+   claimed, when ready work may have found the pool busy */
+void blas_stream_resume(void){
+  openblas_stream_t stream;
+
+  pthread_mutex_lock(&stream_lock);
+
+  blas_stream_pending = 0;
+
+  while ((stream = stream_pop_ready())) {
+    stream_run(stream);
+    stream_dispatch();
+  }
+
+  pthread_mutex_unlock(&stream_lock);
+}
+
+static void stream_submit(openblas_stream_t stream, stream_op_t *op){
+
+  op -> next = NULL;
+
+  pthread_mutex_lock(&stream_lock);
+
+  if (stream -> tail) stream -> tail -> next = op; else stream -> head = op;
+  stream -> tail = op;
+
+  if (stream -> state == STREAM_IDLE) {
+    stream_push_ready(stream);
+    stream_settle();
+  }
+
+  pthread_mutex_unlock(&stream_lock);
+}
+
+/* Waits for a record to be reached, running ready streams meanwhile. Lock held. */
+static void stream_wait_for(stream_mark_t *mark){
+  openblas_stream_t stream;
+
+  while (!mark -> done) {
+    if ((stream = stream_pop_ready())) {
+      stream_help(stream);
+      continue;
+    }
+    pthread_cond_wait(&stream_cond, &stream_lock);
+  }
+
+  stream_settle();
+}
+
+#else
+
+static void stream_mark_release(stream_mark_t *mark){
+  if (-- mark -> refs == 0) free(mark);
+}
+
+static void stream_submit(openblas_stream_t stream, stream_op_t *op){
+
+  if (op -> kind == STREAM_RECORD) op -> mark -> done = 1;
+  else if (op -> kind != STREAM_WAIT) stream_exec(op);
+
+  if (op -> mark) stream_mark_release(op -> mark);
+  free(op);
+}
+
+#endif
+
+openblas_stream_t openblas_stream_create(void){
+  openblas_stream_t stream = (openblas_stream_t)calloc(1, sizeof(struct openblas_stream_s));
+
+  if (stream) stream -> state = STREAM_IDLE;
+  return stream;
+}
+
+void openblas_stream_synchronize(openblas_stream_t stream){
+#ifdef STREAM_ASYNC
+  openblas_stream_t *prev, ready;
+
+  if (stream == NULL) return;
+
+  pthread_mutex_lock(&stream_lock);
+
+  while (stream -> state != STREAM_IDLE) {
+
+    if (stream -> state == STREAM_READY) {
+      /* Nobody owns it yet, so run it here */
+      ready = NULL;
+      for (prev = &stream_ready_head; *prev != stream; prev = &(*prev) -> link) ready = *prev;
+      *prev = stream -> link;
+      if (stream_ready_tail == stream) stream_ready_tail = ready;
+      stream -> state = STREAM_RUNNING;
+      stream_help(stream);
+    } else if ((ready = stream_pop_ready())) {
+      stream_help(ready);
+    } else {
+      pthread_cond_wait(&stream_cond, &stream_lock);
+    }
+  }
+
+  stream_settle();
+
+  pthread_mutex_unlock(&stream_lock);
+#endif
+}
+
+void openblas_stream_destroy(openblas_stream_t stream){
+  if (stream == NULL) return;
+  openblas_stream_synchronize(stream);
+  free(stream);
+}
+
+openblas_event_t openblas_event_create(void){
+  return (openblas_event_t)calloc(1, sizeof(struct openblas_event_s));
+}
+
+/* Replaces the record the event refers to */
+static void stream_event_set(openblas_event_t event, stream_mark_t *mark){
+#ifdef STREAM_ASYNC
+  pthread_mutex_lock(&stream_lock);
+#endif
+  if (event -> mark) stream_mark_release(event -> mark);
+  event -> mark = mark;
+#ifdef STREAM_ASYNC
+  pthread_mutex_unlock(&stream_lock);
+#endif
+}
+
+void openblas_event_destroy(openblas_event_t event){
+  if (event == NULL) return;
+  stream_event_set(event, NULL);
+  free(event);
+}
+
+void openblas_event_record(openblas_event_t event, openblas_stream_t stream){
+  stream_mark_t *mark;
+  stream_op_t *op = NULL;
+
+  if (event == NULL) return;
+
+  mark = (stream_mark_t *)malloc(sizeof(stream_mark_t));
+  if (stream && mark) op = (stream_op_t *)calloc(1, sizeof(stream_op_t));
+
+  if (op == NULL) {
+    /* Recorded in place: complete once the stream has drained */
+    openblas_stream_synchronize(stream);
+    if (mark) {
+      mark -> done = 1;
+      mark -> refs = 1;
+    }
+    stream_event_set(event, mark);
+    return;
+  }
+
+  mark -> done = 0;
+  mark -> refs = 2;
+  op -> kind = STREAM_RECORD;
+  op -> mark = mark;
+
+  stream_event_set(event, mark);
+  stream_submit(stream, op);
+}
+
+void openblas_stream_wait_event(openblas_stream_t stream, openblas_event_t event){
+  stream_op_t *op;
+
+  if (event == NULL) return;
+
+  op = stream ? (stream_op_t *)calloc(1, sizeof(stream_op_t)) : NULL;
+
+  if (op == NULL) {
+    openblas_event_synchronize(event);
+    return;
+  }
+
+  op -> kind = STREAM_WAIT;
+
+#ifdef STREAM_ASYNC
+  pthread_mutex_lock(&stream_lock);
+#endif
+  /* An event that was never recorded, or has completed, does not hold the stream */
+  if (event -> mark && !event -> mark -> done) {
+    op -> mark = event -> mark;
+    op -> mark -> refs ++;
+  }
+#ifdef STREAM_ASYNC
+  pthread_mutex_unlock(&stream_lock);
+#endif
+
+  if (op -> mark) stream_submit(stream, op); else free(op);
+}
+
+void openblas_event_synchronize(openblas_event_t event){
+#ifdef STREAM_ASYNC
+  stream_mark_t *mark;
+
+  if (event == NULL) return;
+
+  pthread_mutex_lock(&stream_lock);
+
+  if ((mark = event -> mark)) {
+    mark -> refs ++;
+    stream_wait_for(mark);
+    stream_mark_release(mark);
+  }
+
+  pthread_mutex_unlock(&stream_lock);
+#endif
+}
+
+int openblas_event_query(openblas_event_t event){
+  int done = 1;
+
+  if (event == NULL) return 1;
+
+#ifdef STREAM_ASYNC
+  pthread_mutex_lock(&stream_lock);
+#endif
+  if (event -> mark) done = event -> mark -> done;
+#ifdef STREAM_ASYNC
+  pthread_mutex_unlock(&stream_lock);
+#endif
+
+  return done;
+}
+
+/* Queues a copy of the call. Without a stream, or without memory for */
+/* the copy, the call runs in place once the stream has drained.       */
+static void stream_post(openblas_stream_t stream, stream_op_t *call){
+  stream_op_t *op = NULL;
+
+  if (stream) op = (stream_op_t *)malloc(sizeof(stream_op_t));
+
+  if (op == NULL) {
+    openblas_stream_synchronize(stream);
+    stream_exec(call);
+    return;
+  }
+
+  *op = *call;
+  stream_submit(stream, op);
+}
+
+static char stream_trans(enum CBLAS_TRANSPOSE trans){
+  switch (trans) {
+  case CblasNoTrans     : return 'N';
+  case CblasTrans       : return 'T';
+  case CblasConjTrans   : return 'C';
+  case CblasConjNoTrans : return 'R';
+  }
+  return '?';
+}
+
+/* Column major form of a gemm; row major swaps the operands */
+static void stream_gemm(stream_op_t *op, int prec, enum CBLAS_ORDER order,
+			enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+			blasint m, blasint n, blasint k,
+			const void *a, blasint lda, const void *b, blasint ldb, void *c, blasint ldc){
+
+  op -> kind = STREAM_GEMM;
+  op -> prec = prec;
+  op -> mark = NULL;
+  op -> k    = k;
+  op -> c    = c;
+  op -> ldc  = ldc;
+
+  if (order == CblasRowMajor) {
+    op -> transa = stream_trans(transb);
+    op -> transb = stream_trans(transa);
+    op -> m = n;  op -> n = m;
+    op -> a = (void *)b;  op -> lda = ldb;
+    op -> b = (void *)a;  op -> ldb = lda;
+  } else {
+    op -> transa = stream_trans(transa);
+    op -> transb = stream_trans(transb);
+    op -> m = m;  op -> n = n;
+    op -> a = (void *)a;  op -> lda = lda;
+    op -> b = (void *)b;  op -> ldb = ldb;
+  }
+}
+
+/* Row major is the transposed problem, with sides and triangles swapped */
+static void stream_trsm(stream_op_t *op, int prec, enum CBLAS_ORDER order,
+			enum CBLAS_SIDE side, enum CBLAS_UPLO uplo, enum CBLAS_TRANSPOSE trans,
+			enum CBLAS_DIAG diag, blasint m, blasint n,
+			const void *a, blasint lda, void *b, blasint ldb){
+  int swap = (order == CblasRowMajor);
+
+  op -> kind = STREAM_TRSM;
+  op -> prec = prec;
+  op -> mark = NULL;
+
+  op -> side = '?';
+  if (side == CblasLeft)  op -> side = swap ? 'R' : 'L';
+  if (side == CblasRight) op -> side = swap ? 'L' : 'R';
+
+  op -> uplo = '?';
+  if (uplo == CblasUpper) op -> uplo = swap ? 'L' : 'U';
+  if (uplo == CblasLower) op -> uplo = swap ? 'U' : 'L';
+
+  op -> diag = '?';
+  if (diag == CblasUnit)    op -> diag = 'U';
+  if (diag == CblasNonUnit) op -> diag = 'N';
+
+  op -> transa = stream_trans(trans);
+  op -> m = swap ? n : m;
+  op -> n = swap ? m : n;
+  op -> a = (void *)a;  op -> lda = lda;
+  op -> b = b;          op -> ldb = ldb;
+}
+
+static void stream_axpy(stream_op_t *op, int prec, blasint n,
+			const void *x, blasint incx, void *y, blasint incy){
+
+  op -> kind = STREAM_AXPY;
+  op -> prec = prec;
+  op -> mark = NULL;
+  op -> m = n;
+  op -> a = (void *)x;  op -> lda = incx;
+  op -> b = y;          op -> ldb = incy;
+}
+
+void openblas_stream_sgemm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint M, blasint N, blasint K, float alpha, const float *A, blasint lda, const float *B, blasint ldb,
+			   float beta, float *C, blasint ldc){
+  stream_op_t op;
+
+  stream_gemm(&op, STREAM_S, Order, TransA, TransB, M, N, K, A, lda, B, ldb, C, ldc);
+  op.alpha.s[0] = alpha;
+  op.beta.s[0]  = beta;
+  stream_post(stream, &op);
+}
+
+void openblas_stream_dgemm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint M, blasint N, blasint K, double alpha, const double *A, blasint lda, const double *B, blasint ldb,
+			   double beta, double *C, blasint ldc){
+  stream_op_t op;
+
+  stream_gemm(&op, STREAM_D, Order, TransA, TransB, M, N, K, A, lda, B, ldb, C, ldc);
+  op.alpha.d[0] = alpha;
+  op.beta.d[0]  = beta;
+  stream_post(stream, &op);
+}
+
+void openblas_stream_cgemm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint M, blasint N, blasint K, const void *alpha, const void *A, blasint lda, const void *B, blasint ldb,
+			   const void *beta, void *C, blasint ldc){
+  stream_op_t op;
+
+  stream_gemm(&op, STREAM_C, Order, TransA, TransB, M, N, K, A, lda, B, ldb, C, ldc);
+  op.alpha.s[0] = ((const float *)alpha)[0];
+  op.alpha.s[1] = ((const float *)alpha)[1];
+  op.beta.s[0]  = ((const float *)beta)[0];
+  op.beta.s[1]  = ((const float *)beta)[1];
+  stream_post(stream, &op);
+}
+
+void openblas_stream_zgemm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint M, blasint N, blasint K, const void *alpha, const void *A, blasint lda, const void *B, blasint ldb,
+			   const void *beta, void *C, blasint ldc){
+  stream_op_t op;
+
+  stream_gemm(&op, STREAM_Z, Order, TransA, TransB, M, N, K, A, lda, B, ldb, C, ldc);
+  op.alpha.d[0] = ((const double *)alpha)[0];
+  op.alpha.d[1] = ((const double *)alpha)[1];
+  op.beta.d[0]  = ((const double *)beta)[0];
+  op.beta.d[1]  = ((const double *)beta)[1];
+  stream_post(stream, &op);
+}
+
+void openblas_stream_strsm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_DIAG Diag, blasint M, blasint N,
+			   float alpha, const float *A, blasint lda, float *B, blasint ldb){
+  stream_op_t op;
+
+  stream_trsm(&op, STREAM_S, Order, Side, Uplo, TransA, Diag, M, N, A, lda, B, ldb);
+  op.alpha.s[0] = alpha;
+  stream_post(stream, &op);
+}
+
+void openblas_stream_dtrsm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_DIAG Diag, blasint M, blasint N,
+			   double alpha, const double *A, blasint lda, double *B, blasint ldb){
+  stream_op_t op;
+
+  stream_trsm(&op, STREAM_D, Order, Side, Uplo, TransA, Diag, M, N, A, lda, B, ldb);
+  op.alpha.d[0] = alpha;
+  stream_post(stream, &op);
+}
+
+void openblas_stream_ctrsm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_DIAG Diag, blasint M, blasint N,
+			   const void *alpha, const void *A, blasint lda, void *B, blasint ldb){
+  stream_op_t op;
+
+  stream_trsm(&op, STREAM_C, Order, Side, Uplo, TransA, Diag, M, N, A, lda, B, ldb);
+  op.alpha.s[0] = ((const float *)alpha)[0];
+  op.alpha.s[1] = ((const float *)alpha)[1];
+  stream_post(stream, &op);
+}
+
+void openblas_stream_ztrsm(openblas_stream_t stream, enum CBLAS_ORDER Order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_DIAG Diag, blasint M, blasint N,
+			   const void *alpha, const void *A, blasint lda, void *B, blasint ldb){
+  stream_op_t op;
+
+  stream_trsm(&op, STREAM_Z, Order, Side, Uplo, TransA, Diag, M, N, A, lda, B, ldb);
+  op.alpha.d[0] = ((const double *)alpha)[0];
+  op.alpha.d[1] = ((const double *)alpha)[1];
+  stream_post(stream, &op);
+}
+
+void openblas_stream_saxpy(openblas_stream_t stream, blasint n, float alpha, const float *x, blasint incx, float *y, blasint incy){
+  stream_op_t op;
+
+  stream_axpy(&op, STREAM_S, n, x, incx, y, incy);
+  op.alpha.s[0] = alpha;
+  stream_post(stream, &op);
+}
+
+void openblas_stream_daxpy(openblas_stream_t stream, blasint n, double alpha, const double *x, blasint incx, double *y, blasint incy){
+  stream_op_t op;
+
+  stream_axpy(&op, STREAM_D, n, x, incx, y, incy);
+  op.alpha.d[0] = alpha;
+  stream_post(stream, &op);
+}
+
+void openblas_stream_caxpy(openblas_stream_t stream, blasint n, const void *alpha, const void *x, blasint incx, void *y, blasint incy){
+  stream_op_t op;
+
+  stream_axpy(&op, STREAM_C, n, x, incx, y, incy);
+  op.alpha.s[0] = ((const float *)alpha)[0];
+  op.alpha.s[1] = ((const float *)alpha)[1];
+  stream_post(stream, &op);
+}
+
+void openblas_stream_zaxpy(openblas_stream_t stream, blasint n, const void *alpha, const void *x, blasint incx, void *y, blasint incy){
+  stream_op_t op;
+
+  stream_axpy(&op, STREAM_Z, n, x, incx, y, incy);
+  op.alpha.d[0] = ((const double *)alpha)[0];
+  op.alpha.d[1] = ((const double *)alpha)[1];
+  stream_post(stream, &op);
+}
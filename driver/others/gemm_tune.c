@@ -0,0 +1,540 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Run-time tuning of the GEMM blocking factors.
+
+   openblas_gemm_tune() times the level 3 driver of each precision for a
+   few P/Q/R around the current values and keeps the fastest, then does
+   the same for switch_ratio with the threaded driver. The result can be
+   stored in a profile, a text file with one line per core and routine
+
+     Haswell dgemm 512 256 13824
+     Haswell switch_ratio 4
+
+   so that one file can serve a fleet of different machines; each process
+   only applies the lines naming its own core. OPENBLAS_GEMM_PROFILE=<file>
+   loads a profile at startup, and with OPENBLAS_GEMM_TUNE=1 a core that
+   is missing from it is tuned and added. The timing takes seconds, so it
+   is not done at startup but by the first call that asks for a packing
+   buffer (gotoblas_gemm_tune_deferred); until it is done every other
+   caller waits for it there, so that no call ever runs with the blocking
+   half changed.
+
+   The drivers read P/Q/R from gotoblas_t while they run, so the blocking
+   must not change under a call in flight. openblas_gemm_tune() and
+   openblas_gemm_load_profile() therefore may only be called while no
+   other BLAS or LAPACK call is running in the process.
+
+   Only DYNAMIC_ARCH builds keep the blocking factors in a writable table
+   (gotoblas_t); elsewhere they are compile time constants and the calls
+   below return -1. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common.h"
+
+extern int openblas_gemm_tune_env(void);
+extern void openblas_warning(int verbose, const char * msg);
+
+#ifdef DYNAMIC_ARCH
+
+extern char *gotoblas_corename(void);
+
+#define TUNE_LINE	256
+#define TUNE_KEEP	256	/* lines for other cores kept on rewrite */
+#define TUNE_RUNS	3
+#define TUNE_GAIN	0.98	/* a candidate must be 2% faster to win */
+
+/* tune_entry_t.mode; BLAS_SINGLE and friends only exist in SMP builds */
+#define TUNE_SINGLE	0
+#define TUNE_DOUBLE	1
+#define TUNE_REAL	0
+#define TUNE_COMPLEX	2
+
+typedef int (*tune_driver_t)(blas_arg_t *, BLASLONG *, BLASLONG *, void *, void *, BLASLONG);
+
+typedef struct {
+  const char *name;
+  int *p, *q, *r;
+  BLASLONG unroll_m, unroll_n;
+  BLASLONG max_p, max_q, max_r;
+  int mode;			/* TUNE_SINGLE/TUNE_DOUBLE | TUNE_REAL/TUNE_COMPLEX */
+  BLASLONG size;		/* bytes per element */
+  BLASLONG order;		/* m = n = k of the timed problem */
+  tune_driver_t driver;
+#ifdef SMP
+  tune_driver_t thread_driver;
+#endif
+} tune_entry_t;
+
+#ifdef SMP
+#define TUNE_THREAD_DRIVER(prec) t[num].thread_driver = (tune_driver_t)prec##gemm_thread_nn;
+#else
+#define TUNE_THREAD_DRIVER(prec)
+#endif
+
+#define TUNE_ENTRY(prec, type, compsize, n, prec_mode) \
+  t[num].name     = #prec "gemm"; \
+  t[num].p        = &gotoblas -> prec##gemm_p; \
+  t[num].q        = &gotoblas -> prec##gemm_q; \
+  t[num].r        = &gotoblas -> prec##gemm_r; \
+  t[num].unroll_m = gotoblas -> prec##gemm_unroll_m; \
+  t[num].unroll_n = gotoblas -> prec##gemm_unroll_n; \
+  t[num].mode     = (prec_mode); \
+  t[num].size     = (compsize) * sizeof(type); \
+  t[num].order    = (n); \
+  t[num].driver   = (tune_driver_t)prec##gemm_nn; \
+  TUNE_THREAD_DRIVER(prec) \
+  num ++;
+
+/* Blocking the kernels were built for. Some keep K sized scratch space on
+   the stack (dgemm_kernel_4x8_haswell.S has room for 256), so nothing may
+   grow beyond these. */
+static int tune_limit[4][3];
+static int tune_limit_saved = 0;
+
+static int tune_entries(tune_entry_t *t) {
+
+  int num = 0, i;
+
+#if (BUILD_DOUBLE == 1)
+  TUNE_ENTRY(d, double, 1, 768, TUNE_DOUBLE | TUNE_REAL);
+#endif
+#if (BUILD_SINGLE == 1)
+  TUNE_ENTRY(s, float,  1, 1024, TUNE_SINGLE | TUNE_REAL);
+#endif
+#if (BUILD_COMPLEX16 == 1)
+  TUNE_ENTRY(z, double, 2, 384, TUNE_DOUBLE | TUNE_COMPLEX);
+#endif
+#if (BUILD_COMPLEX == 1)
+  TUNE_ENTRY(c, float,  2, 512, TUNE_SINGLE | TUNE_COMPLEX);
+#endif
+
+  for (i = 0; i < num; i++) {
+    if (!tune_limit_saved) {
+      tune_limit[i][0] = *t[i].p;
+      tune_limit[i][1] = *t[i].q;
+      tune_limit[i][2] = *t[i].r;
+    }
+    t[i].max_p = tune_limit[i][0];
+    t[i].max_q = tune_limit[i][1];
+    t[i].max_r = tune_limit[i][2];
+  }
+  tune_limit_saved = 1;
+
+  return num;
+}
+
+/* Largest R whose Q x R panel of B still fits behind the P x Q block of A */
+static BLASLONG tune_max_r(tune_entry_t *t, BLASLONG p, BLASLONG q) {
+
+  BLASLONG used, r;
+
+  used = ((p * q * t -> size + GEMM_ALIGN) & ~GEMM_ALIGN) + GEMM_OFFSET_A + GEMM_OFFSET_B;
+  if (used >= blas_buffer_size()) return 0;
+
+  r = (blas_buffer_size() - used) / (q * t -> size);
+  return r - r % t -> unroll_n;
+}
+
+/* The LAPACK drivers carve a MAX(P, Q) wide block out of the R panel */
+static int tune_valid(tune_entry_t *t, BLASLONG p, BLASLONG q, BLASLONG r) {
+
+  if (p < t -> unroll_m || p % t -> unroll_m || p > t -> max_p) return 0;
+  if (q < 8 || q > t -> max_q || r > t -> max_r) return 0;
+  if (r < 2 * MAX(p, q)) return 0;
+
+  return r <= tune_max_r(t, p, q);
+}
+
+static BLASULONG tune_time(tune_entry_t *t, tune_driver_t driver, BLASLONG m, BLASLONG n, BLASLONG k,
+			   void *a, void *b, void *c, char *buffer, BLASLONG nthreads) {
+
+  blas_arg_t args;
+  double alpha_d[2] = {1., 0.}, beta_d[2] = {0., 0.};
+  float  alpha_s[2] = {1., 0.}, beta_s[2] = {0., 0.};
+  void *sa, *sb;
+  BLASULONG start, elapsed, best = ~(BLASULONG)0;
+  int i;
+
+  memset(&args, 0, sizeof(args));
+  args.m = m;
+  args.n = n;
+  args.k = k;
+  args.a = a;
+  args.b = b;
+  args.c = c;
+  args.lda = m;
+  args.ldb = k;
+  args.ldc = m;
+
+  if (!(t -> mode & TUNE_DOUBLE)) {
+    args.alpha = (void *)alpha_s;
+    args.beta  = (void *)beta_s;
+  } else {
+    args.alpha = (void *)alpha_d;
+    args.beta  = (void *)beta_d;
+  }
+
+#ifdef SMP
+  args.nthreads = nthreads;
+  args.common   = NULL;
+#endif
+
+  sa = (void *)(buffer + GEMM_OFFSET_A);
+  sb = (void *)(((BLASLONG)sa + (((*t -> p) * (*t -> q) * t -> size + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+  /* the first call only brings the operands into memory */
+  for (i = 0; i <= TUNE_RUNS; i++) {
+    start = rpcc();
+    driver(&args, NULL, NULL, sa, sb, 0);
+    elapsed = rpcc() - start;
+    if (i > 0 && elapsed < best) best = elapsed;
+  }
+
+  return best;
+}
+
+/* Times P/Q/R and keeps them if they beat *best; restores the old values otherwise */
+static void tune_try(tune_entry_t *t, BLASLONG p, BLASLONG q, BLASLONG r, BLASLONG m, BLASLONG n, BLASLONG k,
+		     void *a, void *b, void *c, char *buffer, BLASULONG *best) {
+
+  int old_p = *t -> p, old_q = *t -> q, old_r = *t -> r;
+  BLASULONG elapsed;
+
+  if ((p == old_p && q == old_q && r == old_r) || !tune_valid(t, p, q, r)) return;
+
+  *t -> p = p;
+  *t -> q = q;
+  *t -> r = r;
+
+  elapsed = tune_time(t, t -> driver, m, n, k, a, b, c, buffer, 1);
+
+  if ((double)elapsed < (double)*best * TUNE_GAIN) {
+    *best = elapsed;
+  } else {
+    *t -> p = old_p;
+    *t -> q = old_q;
+    *t -> r = old_r;
+  }
+}
+
+static void tune_gemm(tune_entry_t *t, void *a, void *b, void *c, char *buffer) {
+
+  static const int scale[] = {2, 3, 4};	/* in quarters of the built-in value */
+  BLASLONG n = t -> order, p, q, r, p0, q0, w;
+  BLASULONG best;
+  void *ra, *rb, *rc;
+  char message[128];
+  int i;
+
+  best = tune_time(t, t -> driver, n, n, n, a, b, c, buffer, 1);
+
+  /* Q first, as it sizes both packed blocks; R shrinks if it no longer fits */
+  for (i = 0; i < 3; i++) {
+    q = (t -> max_q * scale[i] / 4 + 7) & ~7;
+    r = MIN(*t -> r, tune_max_r(t, *t -> p, q));
+    tune_try(t, *t -> p, q, r, n, n, n, a, b, c, buffer, &best);
+  }
+
+  for (i = 0; i < 3; i++) {
+    p = (t -> max_p * scale[i] / 4 + t -> unroll_m - 1) / t -> unroll_m * t -> unroll_m;
+    r = MIN(*t -> r, tune_max_r(t, p, *t -> q));
+    tune_try(t, p, *t -> q, r, n, n, n, a, b, c, buffer, &best);
+  }
+
+  /* R only matters once B is wider than it, so time one row panel of C
+     of width w against R of w / 4 and w / 2 */
+  p0 = *t -> p;
+  q0 = *t -> q;
+  w  = MIN(*t -> r, 4096);
+  ra = calloc(p0 * q0 + q0 * w + p0 * w, t -> size);
+  if (ra) {
+    rb = (char *)ra + p0 * q0 * t -> size;
+    rc = (char *)rb + q0 * w * t -> size;
+    best = tune_time(t, t -> driver, p0, w, q0, ra, rb, rc, buffer, 1);
+    for (i = 1; i <= 2; i++) {
+      r = (w * i / 4) / t -> unroll_n * t -> unroll_n;
+      tune_try(t, p0, q0, r, p0, w, q0, ra, rb, rc, buffer, &best);
+    }
+    free(ra);
+  }
+
+  sprintf(message, "OpenBLAS : %s P = %d, Q = %d, R = %d\n", t -> name, *t -> p, *t -> q, *t -> r);
+  openblas_warning(2, message);
+}
+
+#ifdef SMP
+/* switch_ratio bounds how thin the partitions of the threaded drivers get */
+static void tune_switch_ratio(tune_entry_t *t, void *a, void *b, void *c, char *buffer) {
+
+  static const int ratio[] = {2, 4, 8, 16, 32};
+  BLASLONG nthreads = blas_cpu_number, n;
+  BLASULONG elapsed, best;
+  int i, old = gotoblas -> switch_ratio, found = old;
+  char message[64];
+
+  if (nthreads < 2) return;
+
+  n = MIN(32 * nthreads, t -> order);
+
+  best = tune_time(t, t -> thread_driver, n, n, t -> order, a, b, c, buffer, nthreads);
+
+  for (i = 0; i < 5; i++) {
+    if (ratio[i] == old) continue;
+    gotoblas -> switch_ratio = ratio[i];
+    elapsed = tune_time(t, t -> thread_driver, n, n, t -> order, a, b, c, buffer, nthreads);
+    if ((double)elapsed < (double)best * TUNE_GAIN) {
+      best  = elapsed;
+      found = ratio[i];
+    }
+  }
+
+  gotoblas -> switch_ratio = found;
+
+  sprintf(message, "OpenBLAS : switch_ratio = %d\n", found);
+  openblas_warning(2, message);
+}
+#endif
+
+static int tune_write(const char *path, tune_entry_t *t, int num) {
+
+  char *keep, line[TUNE_LINE], core[32], *tmp;
+  const char *name = gotoblas_corename();
+  int kept = 0, i, ret = 0;
+  FILE *fp;
+
+  keep = (char *)malloc(TUNE_KEEP * TUNE_LINE + strlen(path) + 8);
+  if (keep == NULL) return -1;
+  tmp = keep + TUNE_KEEP * TUNE_LINE;
+
+  /* lines for other cores are carried over */
+  fp = fopen(path, "r");
+  if (fp) {
+    while (kept < TUNE_KEEP && fgets(line, sizeof(line), fp)) {
+      if (sscanf(line, "%31s", core) != 1 || core[0] == '#' || !strcmp(core, name)) continue;
+      strcpy(keep + kept * TUNE_LINE, line);
+      kept ++;
+    }
+    fclose(fp);
+  }
+
+  sprintf(tmp, "%s.tmp", path);
+
+  fp = fopen(tmp, "w");
+  if (fp == NULL) {
+    free(keep);
+    return -1;
+  }
+
+  fprintf(fp, "# OpenBLAS GEMM blocking profile: core routine P Q R\n");
+  for (i = 0; i < kept; i++) fputs(keep + i * TUNE_LINE, fp);
+  for (i = 0; i < num; i++) fprintf(fp, "%s %s %d %d %d\n", name, t[i].name, *t[i].p, *t[i].q, *t[i].r);
+  fprintf(fp, "%s switch_ratio %d\n", name, gotoblas -> switch_ratio);
+
+  if (fclose(fp)) ret = -1;
+
+  /* rename() does not replace an existing file on Windows */
+  if (ret == 0 && rename(tmp, path)) {
+    remove(path);
+    if (rename(tmp, path)) ret = -1;
+  }
+  if (ret) remove(tmp);
+
+  free(keep);
+  return ret;
+}
+
+static volatile BLASULONG tune_lock = 0;
+
+volatile int gotoblas_gemm_tune_pending = 0;
+
+static char *tune_path = NULL;
+
+static int tune_run(const char *path) {
+
+  tune_entry_t t[4];
+  void *a, *b, *c;
+  char *buffer;
+  BLASLONG len;
+  int num, i;
+
+  num = tune_entries(t);
+  if (num == 0) return -1;
+
+  len = t[0].order * t[0].order * t[0].size;
+  for (i = 1; i < num; i++) len = MAX(len, t[i].order * t[i].order * t[i].size);
+
+  a = calloc(3, len);
+  if (a == NULL) return -1;
+  b = (char *)a + len;
+  c = (char *)b + len;
+
+  /* as the server threads do, so that blas_memory_alloc() does not
+     send it back to gotoblas_gemm_tune_deferred() */
+  buffer = (char *)blas_memory_alloc(2);
+
+  for (i = 0; i < num; i++) tune_gemm(&t[i], a, b, c, buffer);
+
+#ifdef SMP
+  tune_switch_ratio(&t[0], a, b, c, buffer);
+#endif
+
+  blas_memory_free(buffer);
+  free(a);
+
+  if (path == NULL) return 0;
+
+  return tune_write(path, t, num);
+}
+
+static int tune_load(const char *path) {
+
+  tune_entry_t t[4];
+  const char *name = gotoblas_corename();
+  char line[TUNE_LINE], core[32], routine[32], message[128];
+  long p, q, r;
+  int num, i, args, applied = 0;
+  FILE *fp;
+
+  if (path == NULL) return -1;
+
+  fp = fopen(path, "r");
+  if (fp == NULL) return -1;
+
+  num = tune_entries(t);
+
+  while (fgets(line, sizeof(line), fp)) {
+    args = sscanf(line, "%31s %31s %ld %ld %ld", core, routine, &p, &q, &r);
+    if (args < 3 || strcmp(core, name)) continue;
+
+    if (!strcmp(routine, "switch_ratio")) {
+      if (p > 0) {
+	gotoblas -> switch_ratio = p;
+	applied ++;
+      }
+      continue;
+    }
+
+    for (i = 0; i < num; i++) {
+      if (strcmp(routine, t[i].name)) continue;
+      if (args == 5 && tune_valid(&t[i], p, q, r)) {
+	*t[i].p = p;
+	*t[i].q = q;
+	*t[i].r = r;
+	applied ++;
+      } else {
+	snprintf(message, sizeof(message), "OpenBLAS : ignoring %s blocking %ld %ld %ld from %s\n", routine, p, q, r, path);
+	openblas_warning(1, message);
+      }
+    }
+  }
+
+  fclose(fp);
+  return applied;
+}
+
+/* An explicit call replaces the tuning OPENBLAS_GEMM_TUNE asked for */
+int openblas_gemm_tune(const char *path) {
+
+  int ret;
+
+  blas_lock(&tune_lock);
+  ret = tune_run(path);
+  gotoblas_gemm_tune_pending = 0;
+  blas_unlock(&tune_lock);
+
+  return ret;
+}
+
+int openblas_gemm_load_profile(const char *path) {
+
+  int ret;
+
+  blas_lock(&tune_lock);
+  ret = tune_load(path);
+  if (ret > 0) gotoblas_gemm_tune_pending = 0;
+  blas_unlock(&tune_lock);
+
+  return ret;
+}
+
+void gotoblas_gemm_tune_init(void) {
+
+  char *path = getenv("OPENBLAS_GEMM_PROFILE");
+
+  if (path && *path == '\0') path = NULL;
+
+  if (path && tune_load(path) > 0) return;
+
+  if (openblas_gemm_tune_env()) {
+    tune_path = path;
+    gotoblas_gemm_tune_pending = 1;
+  }
+}
+
+/* Runs the tuning that OPENBLAS_GEMM_TUNE asked for. The flag is set
+   before any call can take a buffer, so nothing else is running when the
+   first caller gets here, and the others wait on tune_lock. */
+void gotoblas_gemm_tune_deferred(void) {
+
+  blas_lock(&tune_lock);
+
+  if (gotoblas_gemm_tune_pending) {
+    if (tune_run(tune_path)) openblas_warning(1, "OpenBLAS : could not store the GEMM profile\n");
+    WMB;
+    gotoblas_gemm_tune_pending = 0;
+  }
+
+  blas_unlock(&tune_lock);
+}
+
+#else
+
+int openblas_gemm_tune(const char *path) {
+  return -1;
+}
+
+int openblas_gemm_load_profile(const char *path) {
+  return -1;
+}
+
+void gotoblas_gemm_tune_init(void) {
+
+  if (getenv("OPENBLAS_GEMM_PROFILE") || openblas_gemm_tune_env())
+    openblas_warning(1, "OpenBLAS : GEMM blocking is fixed at build time without DYNAMIC_ARCH, profile ignored\n");
+}
+
+#endif
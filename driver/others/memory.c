@@ -122,6 +122,291 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #warning BUFFER_SIZE is too small for P, Q, and R of ZGEMM - large calculations may crash !
 #endif
 
+/* Run-time configuration of the buffers. OPENBLAS_BUFFER_BACKEND picks */
+/* plain mmap, transparent huge pages or MAP_HUGETLB, OPENBLAS_BUFFER_SIZE */
+/* (in MiB) enlarges every buffer and OPENBLAS_NUM_BUFFERS bounds the pool. */
+/* The size never drops below BUFFER_SIZE, which the level 2 drivers rely */
+/* on, and is fixed on first use so that the GEMM_R values derived from it */
+/* always fit the buffers handed out.                                      */
+
+#include "cblas.h"
+
+#if defined(OS_LINUX)
+#include <sys/mman.h>
+#endif
+
+extern int openblas_verbose(void);
+extern int openblas_buffer_backend_env(void);
+extern int openblas_buffer_size_env(void);
+extern int openblas_num_buffers_env(void);
+
+#ifdef __64BIT__
+#define MAX_BUFFER_MB 65536
+#else
+#define MAX_BUFFER_MB 1024
+#endif
+
+static BLASLONG buffer_size    = 0;
+static int      buffer_backend = -1;
+
+BLASLONG blas_buffer_size(void) {
+
+  BLASLONG size;
+
+  if (likely(buffer_size)) return buffer_size;
+
+  size = MIN(openblas_buffer_size_env(), MAX_BUFFER_MB);
+  size <<= 20;
+  if (size < BUFFER_SIZE) size = BUFFER_SIZE;
+
+  buffer_size = size;
+  return size;
+}
+
+int openblas_get_buffer_backend(void) {
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+  if (buffer_backend < 0) buffer_backend = openblas_buffer_backend_env();
+  return buffer_backend;
+#else
+  return OPENBLAS_BUFFER_MMAP;
+#endif
+}
+
+int openblas_set_buffer_backend(int backend) {
+  if (backend < OPENBLAS_BUFFER_MMAP || backend > OPENBLAS_BUFFER_HUGETLB) return -1;
+#if !defined(OS_LINUX) || !defined(MADV_HUGEPAGE)
+  if (backend != OPENBLAS_BUFFER_MMAP) return -1;
+#endif
+  buffer_backend = backend;
+  return 0;
+}
+
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+
+#define HUGE_LENGTH(size) (((BLASULONG)(size) + HUGE_PAGESIZE - 1) & ~(BLASULONG)(HUGE_PAGESIZE - 1))
+
+/* Maps a buffer of size bytes backed by huge pages, rounded up to whole */
+/* huge pages. MAP_HUGETLB needs pages reserved by the administrator, so */
+/* it falls back to transparent huge pages when the pool is exhausted.   */
+static void *map_huge_pages(BLASULONG size) {
+
+  static int warned = 0;
+  void *map_address;
+  BLASULONG length = HUGE_LENGTH(size);
+  BLASULONG start, aligned;
+
+#ifdef MAP_HUGETLB
+  if (openblas_get_buffer_backend() == OPENBLAS_BUFFER_HUGETLB) {
+    map_address = mmap(NULL, length, MMAP_ACCESS, MMAP_POLICY | MAP_HUGETLB, -1, 0);
+    if (map_address != (void *)-1) return map_address;
+
+    if (!warned && openblas_verbose() > 0) {
+      fprintf(stderr, "OpenBLAS : MAP_HUGETLB failed, falling back to transparent huge pages.\n");
+      warned = 1;
+    }
+  }
+#endif
+
+  /* Over-allocate by one huge page so the buffer can start on a boundary */
+  map_address = mmap(NULL, length + HUGE_PAGESIZE, MMAP_ACCESS, MMAP_POLICY, -1, 0);
+  if (map_address == (void *)-1) return map_address;
+
+  start   = (BLASULONG)map_address;
+  aligned = (start + HUGE_PAGESIZE - 1) & ~(BLASULONG)(HUGE_PAGESIZE - 1);
+
+  if (aligned > start) munmap(map_address, aligned - start);
+  munmap((void *)(aligned + length), start + HUGE_PAGESIZE - aligned);
+
+  madvise((void *)aligned, length, MADV_HUGEPAGE);
+
+  return (void *)aligned;
+}
+#endif
+
+/* Size-classed pool for buffers that are smaller than a whole BUFFER */
+/* (blas_memory_alloc_size). The classes double from 64 KiB upwards,   */
+/* a class grows by one block whenever all of its blocks are in use   */
+/* and blocks that have stayed unused are unmapped again by the idle   */
+/* sweep or openblas_trim_memory().                                    */
+/* Each block starts with a POOL_HEADER-byte tag in front of the       */
+/* buffer handed out, so blas_memory_free recognizes pool blocks       */
+/* without taking pool_lock. The tag has the size of struct alloc_t    */
+/* and its magic overlays alloc_t.used, which is only ever 0 or 1.     */
+
+#if !defined(OS_WINDOWS) || defined(OS_CYGWIN_NT)
+#define BUFFER_POOL
+#endif
+
+extern int openblas_buffer_idle_timeout_env(void);
+
+/* OPENBLAS_BUFFER_IDLE_TIMEOUT, read once when the memory is set up */
+static BLASULONG buffer_idle_timeout = 0;
+
+#ifdef BUFFER_POOL
+
+#define POOL_MIN_SHIFT 16
+#define POOL_CLASSES   10
+#define POOL_HEADER    64
+#define POOL_MAGIC     0x6c6f6f70
+
+struct pool_block {
+  void *addr;
+  BLASULONG length;
+  BLASULONG idle;
+  volatile int used;
+  struct pool_block *next;
+};
+
+struct pool_tag {
+  int magic;
+  struct pool_block *block;
+};
+
+static struct pool_block *pool[POOL_CLASSES];
+/* Read without the lock by blas_memory_free to skip the pool lookup */
+static volatile int pool_blocks = 0;
+
+#if   defined(USE_PTHREAD_LOCK)
+static pthread_mutex_t    pool_lock = PTHREAD_MUTEX_INITIALIZER;
+#elif defined(USE_PTHREAD_SPINLOCK)
+static pthread_spinlock_t pool_lock = 0;
+#else
+static BLASULONG  pool_lock = 0UL;
+#endif
+
+static void *pool_alloc(BLASULONG size) {
+
+  int cls = 0;
+  BLASULONG length;
+  struct pool_block *block;
+
+  while ((cls < POOL_CLASSES) && (((BLASULONG)1 << (POOL_MIN_SHIFT + cls)) < size + POOL_HEADER)) cls ++;
+  if (cls >= POOL_CLASSES) return NULL;
+
+  LOCK_COMMAND(&pool_lock);
+  for (block = pool[cls]; block; block = block -> next) {
+    if (!block -> used) {
+      block -> used = 1;
+      UNLOCK_COMMAND(&pool_lock);
+      return (char *)block -> addr + POOL_HEADER;
+    }
+  }
+  UNLOCK_COMMAND(&pool_lock);
+
+  block = (struct pool_block *)malloc(sizeof(struct pool_block));
+  if (block == NULL) return NULL;
+
+  length = (BLASULONG)1 << (POOL_MIN_SHIFT + cls);
+
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+  if (length >= HUGE_PAGESIZE && openblas_get_buffer_backend() != OPENBLAS_BUFFER_MMAP) {
+    block -> addr = map_huge_pages(length);
+    length = HUGE_LENGTH(length);
+  } else
+#endif
+  block -> addr = mmap(NULL, length, MMAP_ACCESS, MMAP_POLICY, -1, 0);
+
+  if (block -> addr == (void *)-1) {
+    free(block);
+    return NULL;
+  }
+
+  block -> length = length;
+  block -> used   = 1;
+
+  ((struct pool_tag *)block -> addr) -> magic = POOL_MAGIC;
+  ((struct pool_tag *)block -> addr) -> block = block;
+
+  LOCK_COMMAND(&pool_lock);
+  block -> next = pool[cls];
+  pool[cls] = block;
+  pool_blocks ++;
+  UNLOCK_COMMAND(&pool_lock);
+
+  return (char *)block -> addr + POOL_HEADER;
+}
+
+/* Returns 0 if buffer does not come from the pool. Only the owner of */
+/* a block releases it, and pool_alloc and pool_trim only take blocks */
+/* whose used flag is clear, so no lock is needed here.               */
+static int pool_free(void *buffer) {
+
+  struct pool_tag *tag = (struct pool_tag *)((char *)buffer - POOL_HEADER);
+  struct pool_block *block;
+
+  if (tag -> magic != POOL_MAGIC) return 0;
+
+  block = tag -> block;
+
+  if (buffer_idle_timeout) block -> idle = (BLASULONG)time(NULL);
+  WMB;
+  block -> used = 0;
+
+  return 1;
+}
+
+/* Unmaps the blocks that have been unused since cutoff, or all unused */
+/* blocks for a cutoff of 0, and returns the number of bytes released. */
+static size_t pool_trim(BLASULONG cutoff) {
+
+  int cls;
+  size_t bytes = 0;
+  struct pool_block *block, **link, *released = NULL;
+
+  if (!pool_blocks) return 0;
+
+  LOCK_COMMAND(&pool_lock);
+  for (cls = 0; cls < POOL_CLASSES; cls ++) {
+    link = &pool[cls];
+    while ((block = *link) != NULL) {
+      if (!block -> used && (!cutoff || block -> idle <= cutoff)) {
+        *link = block -> next;
+        block -> next = released;
+        released = block;
+        pool_blocks --;
+      } else {
+        link = &block -> next;
+      }
+    }
+  }
+  UNLOCK_COMMAND(&pool_lock);
+
+  while ((block = released) != NULL) {
+    released = block -> next;
+    munmap(block -> addr, block -> length);
+    bytes += block -> length;
+    free(block);
+  }
+
+  return bytes;
+}
+
+#else
+
+static void *pool_alloc(BLASULONG size) { return NULL; }
+static int pool_free(void *buffer) { return 0; }
+static size_t pool_trim(BLASULONG cutoff) { return 0; }
+
+#endif
+
+static size_t trim_table(BLASULONG cutoff);
+
+static BLASULONG last_sweep = 0;
+
+/* Releases what has been idle for OPENBLAS_BUFFER_IDLE_TIMEOUT seconds. */
+/* Runs from blas_memory_free, at most once per timeout.                 */
+static void idle_sweep(void) {
+
+  BLASULONG timeout = buffer_idle_timeout;
+  BLASULONG now = (BLASULONG)time(NULL);
+
+  if (now - last_sweep < timeout) return;
+  last_sweep = now;
+
+  trim_table(now - timeout);
+  pool_trim(now - timeout);
+}
+
 #if defined(COMPILE_TLS)
 
 #include <errno.h>
@@ -534,8 +819,12 @@ struct alloc_t {
   int attr;
   /* Function that can properly release this memory */
   void (*release_func)(struct alloc_t *);
+  /* Slot of the owning thread's table that holds this allocation */
+  int position;
+  /* Time of the last release, kept while an idle timeout is set */
+  BLASULONG idle;
   /* Pad to 64-byte alignment */
-  char pad[64 - 2 * sizeof(int) - sizeof(void(*))];
+  char pad[64 - 3 * sizeof(int) - sizeof(void(*)) - sizeof(BLASULONG)];
 };
 
 /* Convenience macros for storing release funcs */
@@ -556,7 +845,9 @@ struct alloc_t {
    memory, we store an alloc_t followed by the actual buffer memory. This means
    that each allocation always has its associated alloc_t, without the need
    for an auxiliary tracking structure. */
-static const int allocation_block_size = BUFFER_SIZE + sizeof(struct alloc_t);
+static __inline BLASULONG allocation_block_size(void) {
+  return blas_buffer_size() + sizeof(struct alloc_t);
+}
 
 #if defined(SMP)
 #  if defined(OS_WINDOWS)
@@ -591,8 +882,21 @@ static pthread_spinlock_t key_lock = 0;
 static BLASULONG  key_lock = 0UL;
 #endif
 
+/* The table pointer and the slot most likely to be free are cached in  */
+/* compiler-supported thread-local storage where available, so that the */
+/* common case of a thread reusing its own buffer needs neither the     */
+/* key_lock nor a scan of the table.                                    */
+#if defined(SMP) && defined(__GNUC__) && !defined(OS_WINDOWS) && !defined(OS_ANDROID)
+#define HAVE_MEMORY_TABLE_CACHE
+static __thread struct alloc_t ** cached_memory_table = NULL;
+static __thread int cached_free_position = 0;
+#endif
+
 /* Returns a pointer to the start of the per-thread memory allocation data */
 static __inline struct alloc_t ** get_memory_table(void) {
+#ifdef HAVE_MEMORY_TABLE_CACHE
+  if (likely(cached_memory_table != NULL)) return cached_memory_table;
+#endif
 #if defined(SMP)
 LOCK_COMMAND(&key_lock);
 lsk=local_storage_key;
@@ -630,6 +934,9 @@ UNLOCK_COMMAND(&key_lock);
 #  endif /* defined(OS_WINDOWS) */
 #endif /* defined(SMP) */
   }
+#ifdef HAVE_MEMORY_TABLE_CACHE
+  cached_memory_table = local_memory_table;
+#endif
   return local_memory_table;
 }
 
@@ -637,7 +944,7 @@ UNLOCK_COMMAND(&key_lock);
 
 static void alloc_mmap_free(struct alloc_t *alloc_info){
 
-  if (munmap(alloc_info, allocation_block_size)) {
+  if (munmap(alloc_info, allocation_block_size())) {
     printf("OpenBLAS : munmap failed\n");
   }
 }
@@ -651,18 +958,18 @@ static void *alloc_mmap(void *address){
 
   if (address){
     map_address = mmap(address,
-                       allocation_block_size,
+                       allocation_block_size(),
                        MMAP_ACCESS, MMAP_POLICY | MAP_FIXED, -1, 0);
   } else {
     map_address = mmap(address,
-                       allocation_block_size,
+                       allocation_block_size(),
                        MMAP_ACCESS, MMAP_POLICY, -1, 0);
   }
 
   STORE_RELEASE_FUNC(map_address, alloc_mmap_free);
 
 #ifdef OS_LINUX
-  my_mbind(map_address, allocation_block_size, MPOL_PREFERRED, NULL, 0, 0);
+  my_mbind(map_address, allocation_block_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
   return map_address;
@@ -715,25 +1022,25 @@ static void *alloc_mmap(void *address){
 
   if (address){
     /* Just give up use advanced operation */
-    map_address = mmap(address, allocation_block_size, MMAP_ACCESS, MMAP_POLICY | MAP_FIXED, -1, 0);
+    map_address = mmap(address, allocation_block_size(), MMAP_ACCESS, MMAP_POLICY | MAP_FIXED, -1, 0);
 
 #ifdef OS_LINUX
-    my_mbind(map_address, allocation_block_size, MPOL_PREFERRED, NULL, 0, 0);
+    my_mbind(map_address, allocation_block_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
   } else {
 #if defined(OS_LINUX) && !defined(NO_WARMUP)
     if (hot_alloc == 0) {
-      map_address = mmap(NULL, allocation_block_size, MMAP_ACCESS, MMAP_POLICY, -1, 0);
+      map_address = mmap(NULL, allocation_block_size(), MMAP_ACCESS, MMAP_POLICY, -1, 0);
 
 #ifdef OS_LINUX
-      my_mbind(map_address, allocation_block_size, MPOL_PREFERRED, NULL, 0, 0);
+      my_mbind(map_address, allocation_block_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
     } else {
 #endif
 
-      map_address = mmap(NULL, allocation_block_size * SCALING,
+      map_address = mmap(NULL, allocation_block_size() * SCALING,
                          MMAP_ACCESS, MMAP_POLICY, -1, 0);
 
       if (map_address != (void *)-1) {
@@ -741,7 +1048,7 @@ static void *alloc_mmap(void *address){
 #ifdef OS_LINUX
 #ifdef DEBUG
         int ret=0;
-        ret=my_mbind(map_address, allocation_block_size * SCALING, MPOL_PREFERRED, NULL, 0, 0);
+        ret=my_mbind(map_address, allocation_block_size() * SCALING, MPOL_PREFERRED, NULL, 0, 0);
         if(ret==-1){
                 int errsv=errno;
                 perror("OpenBLAS alloc_mmap:");
@@ -749,7 +1056,7 @@ static void *alloc_mmap(void *address){
         }
 
 #else
-        my_mbind(map_address, allocation_block_size * SCALING, MPOL_PREFERRED, NULL, 0, 0);
+        my_mbind(map_address, allocation_block_size() * SCALING, MPOL_PREFERRED, NULL, 0, 0);
 #endif
 #endif
 
@@ -757,7 +1064,7 @@ static void *alloc_mmap(void *address){
         allocsize = DGEMM_P * DGEMM_Q * sizeof(double);
 
         start   = (BLASULONG)map_address;
-        current = (SCALING - 1) * allocation_block_size;
+        current = (SCALING - 1) * allocation_block_size();
         original = current;
 
         while(current > 0 && current <= original) {
@@ -773,7 +1080,7 @@ static void *alloc_mmap(void *address){
         best = (BLASULONG)-1;
         best_address = map_address;
 
-        while ((start + allocsize  < (BLASULONG)map_address + (SCALING - 1) * allocation_block_size)) {
+        while ((start + allocsize  < (BLASULONG)map_address + (SCALING - 1) * allocation_block_size())) {
 
           current = run_bench(start, allocsize);
 
@@ -789,7 +1096,7 @@ static void *alloc_mmap(void *address){
       if ((BLASULONG)best_address > (BLASULONG)map_address)
         munmap(map_address,  (BLASULONG)best_address - (BLASULONG)map_address);
 
-      munmap((void *)((BLASULONG)best_address + allocation_block_size), (SCALING - 1) * allocation_block_size + (BLASULONG)map_address - (BLASULONG)best_address);
+      munmap((void *)((BLASULONG)best_address + allocation_block_size()), (SCALING - 1) * allocation_block_size() + (BLASULONG)map_address - (BLASULONG)best_address);
 
       map_address = best_address;
 
@@ -809,6 +1116,32 @@ static void *alloc_mmap(void *address){
 
 #endif
 
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+
+static void alloc_mmap_huge_free(struct alloc_t *alloc_info){
+
+  if (munmap(alloc_info, HUGE_LENGTH(allocation_block_size()))) {
+    printf("OpenBLAS : munmap failed\n");
+  }
+}
+
+/* Only taken when a huge page backend was selected, plain mmap otherwise */
+static void *alloc_mmap_huge(void *address){
+  void *map_address;
+
+  if (address || openblas_get_buffer_backend() == OPENBLAS_BUFFER_MMAP) return (void *)-1;
+
+  map_address = map_huge_pages(allocation_block_size());
+
+  STORE_RELEASE_FUNC(map_address, alloc_mmap_huge_free);
+
+  if (map_address != (void *)-1)
+    my_mbind(map_address, HUGE_LENGTH(allocation_block_size()), MPOL_PREFERRED, NULL, 0, 0);
+
+  return map_address;
+}
+#endif
+
 #endif
 
 
@@ -824,7 +1157,7 @@ static void *alloc_malloc(void *address){
 
   void *map_address;
 
-  map_address = (void *)malloc(allocation_block_size + FIXED_PAGESIZE);
+  map_address = (void *)malloc(allocation_block_size() + FIXED_PAGESIZE);
 
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
@@ -854,7 +1187,7 @@ static void alloc_qalloc_free(struct alloc_t *alloc_info){
 static void *alloc_qalloc(void *address){
   void *map_address;
 
-  map_address = (void *)qalloc(QCOMMS | QFAST, allocation_block_size + FIXED_PAGESIZE);
+  map_address = (void *)qalloc(QCOMMS | QFAST, allocation_block_size() + FIXED_PAGESIZE);
 
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
@@ -877,7 +1210,7 @@ static void *alloc_windows(void *address){
   void *map_address;
 
   map_address  = VirtualAlloc(address,
-                              allocation_block_size,
+                              allocation_block_size(),
                               MEM_RESERVE | MEM_COMMIT,
                               PAGE_READWRITE);
 
@@ -898,7 +1231,7 @@ static void *alloc_windows(void *address){
 static void alloc_devicedirver_free(struct alloc_t *alloc_info){
 
   int attr = alloc_info -> attr;
-  if (munmap(address, allocation_block_size)) {
+  if (munmap(address, allocation_block_size())) {
     printf("OpenBLAS : Bugphysarea unmap failed.\n");
   }
 
@@ -919,7 +1252,7 @@ static void *alloc_devicedirver(void *address){
 
   }
 
-  map_address = mmap(address, allocation_block_size,
+  map_address = mmap(address, allocation_block_size(),
                      PROT_READ | PROT_WRITE,
                      MAP_FILE | MAP_SHARED,
                      fd, 0);
@@ -944,14 +1277,14 @@ static void *alloc_shm(void *address){
   void *map_address;
   int shmid;
 
-  shmid = shmget(IPC_PRIVATE, allocation_block_size,IPC_CREAT | 0600);
+  shmid = shmget(IPC_PRIVATE, allocation_block_size(),IPC_CREAT | 0600);
 
   map_address = (void *)shmat(shmid, address, 0);
 
   if (map_address != (void *)-1){
 
 #ifdef OS_LINUX
-    my_mbind(map_address, allocation_block_size, MPOL_PREFERRED, NULL, 0, 0);
+    my_mbind(map_address, allocation_block_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
     shmctl(shmid, IPC_RMID, 0);
@@ -978,7 +1311,7 @@ static void alloc_hugetlb_free(struct alloc_t *alloc_info){
 
 #ifdef __sun__
 
-  munmap(alloc_info, allocation_block_size);
+  munmap(alloc_info, allocation_block_size());
 
 #endif
 
@@ -997,7 +1330,7 @@ static void *alloc_hugetlb(void *address){
 #if defined(OS_LINUX) || defined(OS_AIX)
   int shmid;
 
-  shmid = shmget(IPC_PRIVATE, allocation_block_size,
+  shmid = shmget(IPC_PRIVATE, allocation_block_size(),
 #ifdef OS_LINUX
                  SHM_HUGETLB |
 #endif
@@ -1010,7 +1343,7 @@ static void *alloc_hugetlb(void *address){
     map_address = (void *)shmat(shmid, address, SHM_RND);
 
 #ifdef OS_LINUX
-    my_mbind(map_address, allocation_block_size, MPOL_PREFERRED, NULL, 0, 0);
+    my_mbind(map_address, allocation_block_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
     if (map_address != (void *)-1){
@@ -1027,7 +1360,7 @@ static void *alloc_hugetlb(void *address){
   mha.mha_pagesize = HUGE_PAGESIZE;
   memcntl(NULL, 0, MC_HAT_ADVISE, (char *)&mha, 0, 0);
 
-  map_address = (BLASULONG)memalign(HUGE_PAGESIZE, allocation_block_size);
+  map_address = (BLASULONG)memalign(HUGE_PAGESIZE, allocation_block_size());
 #endif
 
 #ifdef OS_WINDOWS
@@ -1051,7 +1384,7 @@ static void *alloc_hugetlb(void *address){
   }
 
   map_address  = (void *)VirtualAlloc(address,
-                                      allocation_block_size,
+                                      allocation_block_size(),
                                       MEM_LARGE_PAGES | MEM_RESERVE | MEM_COMMIT,
                                       PAGE_READWRITE);
 
@@ -1078,7 +1411,7 @@ static int hugetlb_pid = 0;
 static void alloc_hugetlbfile_free(struct alloc_t *alloc_info){
 
   int attr = alloc_info -> attr;
-  if (munmap(alloc_info, allocation_block_size)) {
+  if (munmap(alloc_info, allocation_block_size())) {
     printf("OpenBLAS : HugeTLBfs unmap failed.\n");
   }
 
@@ -1103,7 +1436,7 @@ static void *alloc_hugetlbfile(void *address){
 
   unlink(filename);
 
-  map_address = mmap(address, allocation_block_size,
+  map_address = mmap(address, allocation_block_size(),
                      PROT_READ | PROT_WRITE,
                      MAP_SHARED,
                      fd, 0);
@@ -1144,6 +1477,14 @@ static void blas_memory_cleanup(void* ptr){
         table[pos] = (void *)0;
       }
     }
+#ifdef HAVE_MEMORY_TABLE_CACHE
+    /* Also run as the key destructor at thread exit, where a later call */
+    /* (from another TLS destructor) must not find the freed table.      */
+    if (cached_memory_table == table) {
+      cached_memory_table = NULL;
+      cached_free_position = 0;
+    }
+#endif
     free(table);
   }
 }
@@ -1174,6 +1515,9 @@ void *blas_memory_alloc(int procpos){
 #if ((defined ALLOC_HUGETLB) && (defined OS_LINUX  || defined OS_AIX  || defined __sun__  || defined OS_WINDOWS))
     alloc_hugetlb,
 #endif
+#if defined(ALLOC_MMAP) && defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    alloc_mmap_huge,
+#endif
 #ifdef ALLOC_MMAP
     alloc_mmap,
 #endif
@@ -1192,7 +1536,14 @@ void *blas_memory_alloc(int procpos){
   struct alloc_t * alloc_info;
   struct alloc_t ** alloc_table;
 
-#if defined(SMP) && !defined(USE_OPENMP)
+#ifdef DYNAMIC_ARCH
+  /* OPENBLAS_GEMM_TUNE changes the blocking before the first caller packs
+     anything; the server threads (procpos 2) are left out, as the tuning
+     runs the threaded driver itself */
+  if (procpos < 2 && gotoblas_gemm_tune_pending) gotoblas_gemm_tune_deferred();
+#endif
+
+#if defined(SMP) && !defined(USE_OPENMP) && !defined(HAVE_C11)
 int mi;
 LOCK_COMMAND(&alloc_lock);
 mi=memory_initialized;
@@ -1208,6 +1559,7 @@ UNLOCK_COMMAND(&alloc_lock);
     if (!memory_initialized) {
 #endif
       blas_memory_init();
+      buffer_idle_timeout = openblas_buffer_idle_timeout_env();
 #ifdef DYNAMIC_ARCH
       gotoblas_dynamic_init();
 #endif
@@ -1238,8 +1590,14 @@ UNLOCK_COMMAND(&alloc_lock);
   printf("Alloc Start ...\n");
 #endif
 
-  position = 0;
   alloc_table = get_memory_table();
+
+#ifdef HAVE_MEMORY_TABLE_CACHE
+  position = cached_free_position;
+  if (!alloc_table[position] || !alloc_table[position]->used) goto allocation;
+#endif
+
+  position = 0;
   do {
       if (!alloc_table[position] || !alloc_table[position]->used) goto allocation;
     position ++;
@@ -1295,7 +1653,7 @@ UNLOCK_COMMAND(&alloc_lock);
 #endif
       if (((BLASLONG) map_address) == -1) base_address = 0UL;
 
-      if (base_address) base_address += allocation_block_size + FIXED_PAGESIZE;
+      if (base_address) base_address += allocation_block_size() + FIXED_PAGESIZE;
 
     } while ((BLASLONG)map_address == -1);
 
@@ -1311,6 +1669,11 @@ UNLOCK_COMMAND(&alloc_lock);
 #endif
 
   alloc_info->used = 1;
+  alloc_info->position = position;
+
+#ifdef HAVE_MEMORY_TABLE_CACHE
+  if (position + 1 < NUM_BUFFERS) cached_free_position = position + 1;
+#endif
 
   return (void *)(((char *)alloc_info) + sizeof(struct alloc_t));
 
@@ -1330,19 +1693,32 @@ void blas_memory_free(void *buffer){
   int position;
   struct alloc_t ** alloc_table;
 #endif
+  struct alloc_t *alloc_info;
+
+  if (pool_free(buffer)) return;
+
   /* Since we passed an offset pointer to the caller, get back to the actual allocation */
-  struct alloc_t *alloc_info = (void *)(((char *)buffer) - sizeof(struct alloc_t));
+  alloc_info = (void *)(((char *)buffer) - sizeof(struct alloc_t));
 
 #ifdef DEBUG
   printf("Unmapped Start : %p ...\n", alloc_info);
 #endif
 
+  if (buffer_idle_timeout) alloc_info->idle = (BLASULONG)time(NULL);
+
   alloc_info->used = 0;
 
+#ifdef HAVE_MEMORY_TABLE_CACHE
+  /* Only a hint: a buffer freed by another thread belongs to another table */
+  cached_free_position = alloc_info->position;
+#endif
+
 #ifdef DEBUG
   printf("Unmap Succeeded.\n\n");
 #endif
 
+  if (buffer_idle_timeout) idle_sweep();
+
   return;
 
 #ifdef DEBUG
@@ -1356,9 +1732,86 @@ void blas_memory_free(void *buffer){
   return;
 }
 
+/* Unmaps the buffers of the calling thread's table that have not been */
+/* used since cutoff, or all of its unused buffers for a cutoff of 0.  */
+/* Only the owner hands out the slots of a table, so the tables of the */
+/* other threads are left to them.                                     */
+static size_t trim_table(BLASULONG cutoff) {
+
+  int position;
+  size_t bytes = 0;
+  struct alloc_t *alloc_info;
+  struct alloc_t ** alloc_table;
+
+  if (!LIKELY_ONE(memory_initialized)) return 0;
+
+  alloc_table = get_memory_table();
+
+  for (position = 0; position < NUM_BUFFERS; position ++) {
+    alloc_info = alloc_table[position];
+    if (!alloc_info || alloc_info->used) continue;
+    if (cutoff && alloc_info->idle > cutoff) continue;
+
+    alloc_table[position] = (void *)0;
+    alloc_info->release_func(alloc_info);
+    bytes += allocation_block_size();
+  }
+
+  return bytes;
+}
+
+/* Frees a buffer and unmaps it right away if it belongs to the calling */
+/* thread; the server threads drop their buffer this way when idle.     */
+void blas_memory_discard(void *buffer){
+
+  struct alloc_t *alloc_info;
+  struct alloc_t ** alloc_table;
+
+  if (pool_free(buffer)) return;
+
+  alloc_info  = (void *)(((char *)buffer) - sizeof(struct alloc_t));
+  alloc_table = get_memory_table();
+
+  if (alloc_table[alloc_info->position] != alloc_info) {
+    blas_memory_free(buffer);
+    return;
+  }
+
+  alloc_table[alloc_info->position] = (void *)0;
+  alloc_info->release_func(alloc_info);
+}
+
+/* Returns a buffer of at least size bytes. Requests up to half a BUFFER */
+/* are served from the size-classed pool, anything else (or size 0)      */
+/* takes a full buffer from the table.                                   */
+void *blas_memory_alloc_size(int procpos, BLASLONG size){
+
+  void *buffer;
+
+  if (LIKELY_ONE(memory_initialized) && size > 0 && size <= blas_buffer_size() / 2) {
+    buffer = pool_alloc(size);
+    if (buffer != NULL) return buffer;
+  }
+
+  return blas_memory_alloc(procpos);
+}
+
+size_t openblas_trim_memory(void){
+
+  size_t bytes;
+
+#ifdef SMP
+  blas_thread_buffer_trim();
+#endif
+
+  bytes = trim_table(0);
+
+  return bytes + pool_trim(0);
+}
+
 void *blas_memory_alloc_nolock(int unused) {
   void *map_address;
-  map_address = (void *)malloc(BUFFER_SIZE + FIXED_PAGESIZE);
+  map_address = (void *)malloc(blas_buffer_size() + FIXED_PAGESIZE);
   return map_address;
 }
 
@@ -1369,6 +1822,15 @@ void blas_memory_free_nolock(void * map_address) {
 #ifdef SMP
 void blas_thread_memory_cleanup(void) {
     blas_memory_cleanup((void*)get_memory_table());
+#if   defined(OS_WINDOWS)
+    TlsSetValue(local_storage_key, NULL);
+#else
+    pthread_setspecific(local_storage_key, NULL);
+#endif
+#ifdef HAVE_MEMORY_TABLE_CACHE
+    cached_memory_table = NULL;
+    cached_free_position = 0;
+#endif
 }
 #endif
 
@@ -1384,6 +1846,8 @@ void blas_shutdown(void){
 #endif
     blas_thread_memory_cleanup();
 
+  pool_trim(0);
+
 #ifdef SEEK_ADDRESS
   base_address      = 0UL;
 #else
@@ -1413,7 +1877,7 @@ static void _touch_memory(blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n,
   size_t size;
   BLASULONG buffer;
 
-  size   = allocation_block_size - PAGESIZE;
+  size   = allocation_block_size() - PAGESIZE;
   buffer = (BLASULONG)sa + GEMM_OFFSET_A;
 
 #if defined(OS_LINUX) && !defined(NO_WARMUP)
@@ -1434,7 +1898,7 @@ static void _touch_memory(blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n,
   UNLOCK_COMMAND(&init_lock);
 #endif
 
-  size = MIN((allocation_block_size - PAGESIZE), L2_SIZE);
+  size = MIN((allocation_block_size() - PAGESIZE), L2_SIZE);
   buffer = (BLASULONG)sa + GEMM_OFFSET_A;
 
   while (size > 0) {
@@ -1551,9 +2015,8 @@ void CONSTRUCTOR gotoblas_init(void) {
 #endif
 #endif
 
-#ifdef FUNCTION_PROFILE
    gotoblas_profile_init();
-#endif
+   gotoblas_gemm_tune_init();
 
    gotoblas_initialized = 1;
 
@@ -1581,9 +2044,7 @@ void DESTRUCTOR gotoblas_quit(void) {
    moncontrol (0);
 #endif
 
-#ifdef FUNCTION_PROFILE
    gotoblas_profile_quit();
-#endif
 
 #if defined(SMP) && defined(OS_LINUX) && !defined(NO_AFFINITY)
    gotoblas_affinity_quit();
@@ -2121,7 +2582,7 @@ static void alloc_mmap_free(struct release_t *release){
 
 if (!release->address) return;
 
-  if (munmap(release -> address, BUFFER_SIZE)) {
+  if (munmap(release -> address, blas_buffer_size())) {
       int errsv=errno;
        perror("OpenBLAS : munmap failed:");
        printf("error code=%d,\trelease->address=%p\n",errsv,release->address);
@@ -2137,11 +2598,11 @@ static void *alloc_mmap(void *address){
 
   if (address){
     map_address = mmap(address,
-                       BUFFER_SIZE,
+                       blas_buffer_size(),
                        MMAP_ACCESS, MMAP_POLICY | MAP_FIXED, -1, 0);
   } else {
     map_address = mmap(address,
-                       BUFFER_SIZE,
+                       blas_buffer_size(),
                        MMAP_ACCESS, MMAP_POLICY, -1, 0);
   }
 
@@ -2169,7 +2630,7 @@ static void *alloc_mmap(void *address){
   }
 
 #ifdef OS_LINUX
-  my_mbind(map_address, BUFFER_SIZE, MPOL_PREFERRED, NULL, 0, 0);
+  my_mbind(map_address, blas_buffer_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
   return map_address;
@@ -2222,25 +2683,25 @@ static void *alloc_mmap(void *address){
 
   if (address){
     /* Just give up use advanced operation */
-    map_address = mmap(address, BUFFER_SIZE, MMAP_ACCESS, MMAP_POLICY | MAP_FIXED, -1, 0);
+    map_address = mmap(address, blas_buffer_size(), MMAP_ACCESS, MMAP_POLICY | MAP_FIXED, -1, 0);
 
 #ifdef OS_LINUX
-    my_mbind(map_address, BUFFER_SIZE, MPOL_PREFERRED, NULL, 0, 0);
+    my_mbind(map_address, blas_buffer_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
   } else {
 #if defined(OS_LINUX) && !defined(NO_WARMUP)
     if (hot_alloc == 0) {
-      map_address = mmap(NULL, BUFFER_SIZE, MMAP_ACCESS, MMAP_POLICY, -1, 0);
+      map_address = mmap(NULL, blas_buffer_size(), MMAP_ACCESS, MMAP_POLICY, -1, 0);
 
 #ifdef OS_LINUX
-      my_mbind(map_address, BUFFER_SIZE, MPOL_PREFERRED, NULL, 0, 0);
+      my_mbind(map_address, blas_buffer_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
     } else {
 #endif
 
-      map_address = mmap(NULL, BUFFER_SIZE * SCALING,
+      map_address = mmap(NULL, blas_buffer_size() * SCALING,
                          MMAP_ACCESS, MMAP_POLICY, -1, 0);
 
       if (map_address != (void *)-1) {
@@ -2248,7 +2709,7 @@ static void *alloc_mmap(void *address){
 #ifdef OS_LINUX
 #ifdef DEBUG
         int ret=0;
-        ret=my_mbind(map_address, BUFFER_SIZE * SCALING, MPOL_PREFERRED, NULL, 0, 0);
+        ret=my_mbind(map_address, blas_buffer_size() * SCALING, MPOL_PREFERRED, NULL, 0, 0);
         if(ret==-1){
                 int errsv=errno;
                 perror("OpenBLAS alloc_mmap:");
@@ -2256,7 +2717,7 @@ static void *alloc_mmap(void *address){
         }
 
 #else
-        my_mbind(map_address, BUFFER_SIZE * SCALING, MPOL_PREFERRED, NULL, 0, 0);
+        my_mbind(map_address, blas_buffer_size() * SCALING, MPOL_PREFERRED, NULL, 0, 0);
 #endif
 #endif
 
@@ -2270,7 +2731,7 @@ static void *alloc_mmap(void *address){
 	allocsize = SGEMM_P * SGEMM_Q * sizeof(double);
 #endif
 	start   = (BLASULONG)map_address;
-	current = (SCALING - 1) * BUFFER_SIZE;
+	current = (SCALING - 1) * blas_buffer_size();
 
         while(current > 0) {
           *(BLASLONG *)start = (BLASLONG)start + PAGESIZE;
@@ -2285,7 +2746,7 @@ static void *alloc_mmap(void *address){
         best = (BLASULONG)-1;
         best_address = map_address;
 
-        while ((start + allocsize  < (BLASULONG)map_address + (SCALING - 1) * BUFFER_SIZE)) {
+        while ((start + allocsize  < (BLASULONG)map_address + (SCALING - 1) * blas_buffer_size())) {
 
           current = run_bench(start, allocsize);
 
@@ -2301,7 +2762,7 @@ static void *alloc_mmap(void *address){
       if ((BLASULONG)best_address > (BLASULONG)map_address)
         munmap(map_address,  (BLASULONG)best_address - (BLASULONG)map_address);
 
-      munmap((void *)((BLASULONG)best_address + BUFFER_SIZE), (SCALING - 1) * BUFFER_SIZE + (BLASULONG)map_address - (BLASULONG)best_address);
+      munmap((void *)((BLASULONG)best_address + blas_buffer_size()), (SCALING - 1) * blas_buffer_size() + (BLASULONG)map_address - (BLASULONG)best_address);
 
       map_address = best_address;
 
@@ -2336,6 +2797,46 @@ static void *alloc_mmap(void *address){
 
 #endif
 
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+
+static void alloc_mmap_huge_free(struct release_t *release){
+
+  if (munmap(release -> address, HUGE_LENGTH(blas_buffer_size()))) {
+    printf("OpenBLAS : munmap failed\n");
+  }
+}
+
+/* Only taken when a huge page backend was selected, plain mmap otherwise */
+static void *alloc_mmap_huge(void *address){
+  void *map_address;
+
+  if (address || openblas_get_buffer_backend() == OPENBLAS_BUFFER_MMAP) return (void *)-1;
+
+  map_address = map_huge_pages(blas_buffer_size());
+
+  if (map_address != (void *)-1) {
+    my_mbind(map_address, HUGE_LENGTH(blas_buffer_size()), MPOL_PREFERRED, NULL, 0, 0);
+
+#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
+    LOCK_COMMAND(&alloc_lock);
+#endif
+    if (likely(release_pos < NUM_BUFFERS)) {
+    release_info[release_pos].address = map_address;
+    release_info[release_pos].func    = alloc_mmap_huge_free;
+    } else {
+    new_release_info[release_pos-NUM_BUFFERS].address = map_address;
+    new_release_info[release_pos-NUM_BUFFERS].func    = alloc_mmap_huge_free;
+    }
+    release_pos ++;
+#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
+    UNLOCK_COMMAND(&alloc_lock);
+#endif
+  }
+
+  return map_address;
+}
+#endif
+
 #endif
 
 
@@ -2351,7 +2852,7 @@ static void *alloc_malloc(void *address){
 
   void *map_address;
 
-  map_address = (void *)malloc(BUFFER_SIZE + FIXED_PAGESIZE);
+  map_address = (void *)malloc(blas_buffer_size() + FIXED_PAGESIZE);
 
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
@@ -2390,7 +2891,7 @@ static void alloc_qalloc_free(struct release_t *release){
 static void *alloc_qalloc(void *address){
   void *map_address;
 
-  map_address = (void *)qalloc(QCOMMS | QFAST, BUFFER_SIZE + FIXED_PAGESIZE);
+  map_address = (void *)qalloc(QCOMMS | QFAST, blas_buffer_size() + FIXED_PAGESIZE);
 
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
@@ -2422,7 +2923,7 @@ static void *alloc_windows(void *address){
   void *map_address;
 
   map_address  = VirtualAlloc(address,
-                              BUFFER_SIZE,
+                              blas_buffer_size(),
                               MEM_RESERVE | MEM_COMMIT,
                               PAGE_READWRITE);
 
@@ -2451,7 +2952,7 @@ static void *alloc_windows(void *address){
 
 static void alloc_devicedirver_free(struct release_t *release){
 
-  if (munmap(release -> address, BUFFER_SIZE)) {
+  if (munmap(release -> address, blas_buffer_size())) {
     printf("OpenBLAS : Bugphysarea unmap failed.\n");
   }
 
@@ -2472,7 +2973,7 @@ static void *alloc_devicedirver(void *address){
 
   }
 
-  map_address = mmap(address, BUFFER_SIZE,
+  map_address = mmap(address, blas_buffer_size(),
                      PROT_READ | PROT_WRITE,
                      MAP_FILE | MAP_SHARED,
                      fd, 0);
@@ -2510,14 +3011,14 @@ static void *alloc_shm(void *address){
 #ifdef DEBUG
  fprintf(stderr,"alloc_shm got called\n");
 #endif
-  shmid = shmget(IPC_PRIVATE, BUFFER_SIZE,IPC_CREAT | 0600);
+  shmid = shmget(IPC_PRIVATE, blas_buffer_size(),IPC_CREAT | 0600);
 
   map_address = (void *)shmat(shmid, address, 0);
 
   if (map_address != (void *)-1){
 
 #ifdef OS_LINUX
-    my_mbind(map_address, BUFFER_SIZE, MPOL_PREFERRED, NULL, 0, 0);
+    my_mbind(map_address, blas_buffer_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
     shmctl(shmid, IPC_RMID, 0);
@@ -2550,7 +3051,7 @@ static void alloc_hugetlb_free(struct release_t *release){
 
 #ifdef __sun__
 
-  munmap(release -> address, BUFFER_SIZE);
+  munmap(release -> address, blas_buffer_size());
 
 #endif
 
@@ -2573,7 +3074,7 @@ fprintf(stderr,"alloc_hugetlb got called\n");
 #if defined(OS_LINUX) || defined(OS_AIX)
   int shmid;
 
-  shmid = shmget(IPC_PRIVATE, BUFFER_SIZE,
+  shmid = shmget(IPC_PRIVATE, blas_buffer_size(),
 #ifdef OS_LINUX
                  SHM_HUGETLB |
 #endif
@@ -2586,7 +3087,7 @@ fprintf(stderr,"alloc_hugetlb got called\n");
     map_address = (void *)shmat(shmid, address, SHM_RND);
 
 #ifdef OS_LINUX
-    my_mbind(map_address, BUFFER_SIZE, MPOL_PREFERRED, NULL, 0, 0);
+    my_mbind(map_address, blas_buffer_size(), MPOL_PREFERRED, NULL, 0, 0);
 #endif
 
     if (map_address != (void *)-1){
@@ -2603,7 +3104,7 @@ fprintf(stderr,"alloc_hugetlb got called\n");
   mha.mha_pagesize = HUGE_PAGESIZE;
   memcntl(NULL, 0, MC_HAT_ADVISE, (char *)&mha, 0, 0);
 
-  map_address = (BLASULONG)memalign(HUGE_PAGESIZE, BUFFER_SIZE);
+  map_address = (BLASULONG)memalign(HUGE_PAGESIZE, blas_buffer_size());
 #endif
 
 #ifdef OS_WINDOWS
@@ -2627,7 +3128,7 @@ fprintf(stderr,"alloc_hugetlb got called\n");
   }
 
   map_address  = (void *)VirtualAlloc(address,
-                                      BUFFER_SIZE,
+                                      blas_buffer_size(),
                                       MEM_LARGE_PAGES | MEM_RESERVE | MEM_COMMIT,
                                       PAGE_READWRITE);
 
@@ -2660,7 +3161,7 @@ static int hugetlb_pid = 0;
 
 static void alloc_hugetlbfile_free(struct release_t *release){
 
-  if (munmap(release -> address, BUFFER_SIZE)) {
+  if (munmap(release -> address, blas_buffer_size())) {
     printf("OpenBLAS : HugeTLBfs unmap failed.\n");
   }
 
@@ -2685,7 +3186,7 @@ static void *alloc_hugetlbfile(void *address){
 
   unlink(filename);
 
-  map_address = mmap(address, BUFFER_SIZE,
+  map_address = mmap(address, blas_buffer_size(),
                      PROT_READ | PROT_WRITE,
                      MAP_SHARED,
                      fd, 0);
@@ -2714,21 +3215,6 @@ static BLASULONG base_address      = 0UL;
 static BLASULONG base_address      = BASE_ADDRESS;
 #endif
 
-static volatile struct {
-  BLASULONG lock;
-  void *addr;
-#if defined(WHEREAMI) && !defined(USE_OPENMP)
-  int   pos;
-#endif
-  int used;
-#ifndef __64BIT__
-  char dummy[48];
-#else
-  char dummy[40];
-#endif
-
-} memory[NUM_BUFFERS];
-
 struct newmemstruct 
 {
   BLASULONG lock;
@@ -2737,17 +3223,25 @@ struct newmemstruct
   int   pos;
 #endif
   int used;
+  /* Time of the last release, kept while an idle timeout is set */
+  BLASULONG idle;
 #ifndef __64BIT__
-  char dummy[48];
+  char dummy[44];
 #else
-  char dummy[40];
+  char dummy[32];
 #endif
 
 };
+
+static volatile struct newmemstruct memory[NUM_BUFFERS];
 static volatile struct newmemstruct *newmemory;
 
 static volatile int memory_initialized = 0;
 static int memory_overflowed = 0;
+/* Slots of memory[] handed out and size of the overflow area, both */
+/* taken from OPENBLAS_NUM_BUFFERS when it is set                    */
+static int num_buffers = NUM_BUFFERS;
+static int new_buffers = NEW_BUFFERS;
 /*       Memory allocation routine           */
 /* procpos ... indicates where it comes from */
 /*                0 : Level 3 functions      */
@@ -2775,6 +3269,9 @@ void *blas_memory_alloc(int procpos){
 #if ((defined ALLOC_HUGETLB) && (defined OS_LINUX  || defined OS_AIX  || defined __sun__  || defined OS_WINDOWS))
     alloc_hugetlb,
 #endif
+#if defined(ALLOC_MMAP) && defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    alloc_mmap_huge,
+#endif
 #ifdef ALLOC_MMAP
     alloc_mmap,
 #endif
@@ -2791,6 +3288,13 @@ void *blas_memory_alloc(int procpos){
   };
   void *(**func)(void *address);
 
+#ifdef DYNAMIC_ARCH
+  /* OPENBLAS_GEMM_TUNE changes the blocking before the first caller packs
+     anything; the server threads (procpos 2) are left out, as the tuning
+     runs the threaded driver itself */
+  if (procpos < 2 && gotoblas_gemm_tune_pending) gotoblas_gemm_tune_deferred();
+#endif
+
   if (!memory_initialized) {
 #if defined(SMP) && !defined(USE_OPENMP)
     LOCK_COMMAND(&alloc_lock);
@@ -2824,6 +3328,18 @@ void *blas_memory_alloc(int procpos){
 #endif
 #endif
 
+    if (openblas_num_buffers_env() > 0) {
+      /* Each thread holds a buffer while the caller keeps its own */
+      i = MAX(openblas_num_buffers_env(), 2);
+#ifdef SMP
+      i = MAX(i, 2 * blas_cpu_number);
+#endif
+      num_buffers = MIN(i, NUM_BUFFERS);
+      new_buffers = MAX(i - NUM_BUFFERS, 0);
+    }
+
+    buffer_idle_timeout = openblas_buffer_idle_timeout_env();
+
     memory_initialized = 1;
     WMB;
 #if defined(SMP) && !defined(USE_OPENMP)
@@ -2884,7 +3400,9 @@ void *blas_memory_alloc(int procpos){
 #endif
     position ++;
 
-  } while (position < NUM_BUFFERS);
+  } while (position < num_buffers);
+
+  position = NUM_BUFFERS;
 
   if (memory_overflowed) {
 
@@ -2902,7 +3420,7 @@ void *blas_memory_alloc(int procpos){
 #endif
       position ++;
 
-    } while (position < NEW_BUFFERS + NUM_BUFFERS);
+    } while (position < new_buffers + NUM_BUFFERS);
   }
 #if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
   UNLOCK_COMMAND(&alloc_lock);
@@ -2975,7 +3493,7 @@ void *blas_memory_alloc(int procpos){
 #endif
       if (((BLASLONG) map_address) == -1) base_address = 0UL;
 
-      if (base_address) base_address += BUFFER_SIZE + FIXED_PAGESIZE;
+      if (base_address) base_address += blas_buffer_size() + FIXED_PAGESIZE;
 
     } while ((BLASLONG)map_address == -1);
 
@@ -3028,15 +3546,17 @@ void *blas_memory_alloc(int procpos){
 #if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
   LOCK_COMMAND(&alloc_lock);
 #endif
- if (memory_overflowed) goto terminate;
+ if (memory_overflowed || new_buffers == 0) goto terminate;
+ if (openblas_num_buffers_env() == 0) {
   fprintf(stderr,"OpenBLAS warning: precompiled NUM_THREADS exceeded, adding auxiliary array for thread metadata.\n");
   fprintf(stderr,"To avoid this warning, please rebuild your copy of OpenBLAS with a larger NUM_THREADS setting\n");
   fprintf(stderr,"or set the environment variable OPENBLAS_NUM_THREADS to %d or lower\n", MAX_CPU_NUMBER);
+ }
   memory_overflowed=1;
   MB;
-  new_release_info = (struct release_t*) malloc(NEW_BUFFERS * sizeof(struct release_t));
-  newmemory = (struct newmemstruct*) malloc(NEW_BUFFERS * sizeof(struct newmemstruct));
-  for (i = 0; i < NEW_BUFFERS; i++) {
+  new_release_info = (struct release_t*) malloc(new_buffers * sizeof(struct release_t));
+  newmemory = (struct newmemstruct*) malloc(new_buffers * sizeof(struct newmemstruct));
+  for (i = 0; i < new_buffers; i++) {
   newmemory[i].addr   = (void *)0;
 #if defined(WHEREAMI) && !defined(USE_OPENMP)
   newmemory[i].pos    = -1;
@@ -3104,7 +3624,7 @@ allocation2:
 #endif
       if (((BLASLONG) map_address) == -1) base_address = 0UL;
 
-      if (base_address) base_address += BUFFER_SIZE + FIXED_PAGESIZE;
+      if (base_address) base_address += blas_buffer_size() + FIXED_PAGESIZE;
 
     } while ((BLASLONG)map_address == -1);
 
@@ -3136,7 +3656,8 @@ terminate:
   printf("with a larger NUM_THREADS value or set the environment variable OPENBLAS_NUM_THREADS to\n");
   printf("a sufficiently small number. This error typically occurs when the software that relies on\n");
   printf("OpenBLAS calls BLAS functions from many threads in parallel, or when your computer has more\n");
-  printf("cpu cores than what OpenBLAS was configured to handle.\n"); 
+  printf("cpu cores than what OpenBLAS was configured to handle. OPENBLAS_NUM_BUFFERS can also\n");
+  printf("raise the number of buffers at run time.\n"); 
   return NULL;
 }
 
@@ -3162,11 +3683,12 @@ void blas_memory_free(void *free_area){
   printf("  Position : %d\n", position);
 #endif
   if (unlikely(memory_overflowed && position >= NUM_BUFFERS)) {
-    while ((position < NUM_BUFFERS+NEW_BUFFERS) && (newmemory[position-NUM_BUFFERS].addr != free_area))
+    while ((position < NUM_BUFFERS+new_buffers) && (newmemory[position-NUM_BUFFERS].addr != free_area))
       position++;
   // arm: ensure all writes are finished before other thread takes this memory
   WMB;
-if (position - NUM_BUFFERS >= NEW_BUFFERS) goto error;
+if (position - NUM_BUFFERS >= new_buffers) goto error;
+  if (buffer_idle_timeout) newmemory[position-NUM_BUFFERS].idle = (BLASULONG)time(NULL);
   newmemory[position-NUM_BUFFERS].used = 0;
 #if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
   UNLOCK_COMMAND(&alloc_lock);
@@ -3175,11 +3697,13 @@ if (position - NUM_BUFFERS >= NEW_BUFFERS) goto error;
 #ifdef DEBUG
   printf("Unmap from overflow area succeeded.\n\n");
 #endif
+  if (buffer_idle_timeout) idle_sweep();
   return;
 } else {
   // arm: ensure all writes are finished before other thread takes this memory
   WMB;
 
+  if (buffer_idle_timeout) memory[position].idle = (BLASULONG)time(NULL);
   memory[position].used = 0;
 #if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
   UNLOCK_COMMAND(&alloc_lock);
@@ -3189,24 +3713,135 @@ if (position - NUM_BUFFERS >= NEW_BUFFERS) goto error;
   printf("Unmap Succeeded.\n\n");
 #endif
 
+  if (buffer_idle_timeout) idle_sweep();
   return;
 }
  error:
+#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
+  UNLOCK_COMMAND(&alloc_lock);
+#endif
+  /* Not a table buffer; the tag in front is only read for these */
+  if (pool_free(free_area)) return;
+
   printf("BLAS : Bad memory unallocation! : %4d  %p\n", position,  free_area);
 
 #ifdef DEBUG
   for (position = 0; position < NUM_BUFFERS; position++)
     printf("%4ld  %p : %d\n", position, memory[position].addr, memory[position].used);
 #endif
-#if (defined(SMP) || defined(USE_LOCKING)) && !defined(USE_OPENMP)
+  return;
+}
+
+#if !defined(USE_OPENMP)
+
+#define RELEASE_INFO(pos) ((pos) < NUM_BUFFERS ? &release_info[pos] : &new_release_info[(pos) - NUM_BUFFERS])
+
+/* Unmaps the buffer of an unused slot, whose release entry is replaced */
+/* by the last one. Called with alloc_lock held.                         */
+static size_t release_slot(volatile struct newmemstruct *slot) {
+
+  int pos;
+  struct release_t *release;
+
+  for (pos = 0; pos < release_pos; pos ++)
+    if (RELEASE_INFO(pos) -> address == slot -> addr) break;
+
+  if (pos >= release_pos) return 0;
+
+  release = RELEASE_INFO(pos);
+  release -> func(release);
+
+  release_pos --;
+  *release = *RELEASE_INFO(release_pos);
+
+  slot -> addr = (void *)0;
+
+  return blas_buffer_size();
+}
+#endif
+
+/* Unmaps the slots that have not been used since cutoff, or all unused  */
+/* slots for a cutoff of 0. The OpenMP build updates the release entries */
+/* without alloc_lock, so its table keeps what it has mapped.            */
+static size_t trim_table(BLASULONG cutoff) {
+
+  size_t bytes = 0;
+#if !defined(USE_OPENMP)
+  int position;
+  volatile struct newmemstruct *slot;
+
+  if (!memory_initialized) return 0;
+
+  LOCK_COMMAND(&alloc_lock);
+  for (position = 0; position < NUM_BUFFERS + (memory_overflowed ? new_buffers : 0); position ++) {
+    slot = (position < NUM_BUFFERS) ? &memory[position] : &newmemory[position - NUM_BUFFERS];
+    if (slot -> used || !slot -> addr) continue;
+    if (cutoff && slot -> idle > cutoff) continue;
+
+    bytes += release_slot(slot);
+  }
   UNLOCK_COMMAND(&alloc_lock);
 #endif
-  return;
+
+  return bytes;
+}
+
+/* Frees a buffer and unmaps it right away; the server threads drop */
+/* their buffer this way when they have been idle.                  */
+void blas_memory_discard(void *free_area){
+
+#if !defined(USE_OPENMP)
+  int position;
+  volatile struct newmemstruct *slot;
+
+  LOCK_COMMAND(&alloc_lock);
+  for (position = 0; position < NUM_BUFFERS + (memory_overflowed ? new_buffers : 0); position ++) {
+    slot = (position < NUM_BUFFERS) ? &memory[position] : &newmemory[position - NUM_BUFFERS];
+    if (slot -> addr == free_area) {
+      WMB;
+      slot -> used = 0;
+      release_slot(slot);
+      UNLOCK_COMMAND(&alloc_lock);
+      return;
+    }
+  }
+  UNLOCK_COMMAND(&alloc_lock);
+#endif
+
+  blas_memory_free(free_area);
+}
+
+/* Returns a buffer of at least size bytes. Requests up to half a BUFFER */
+/* are served from the size-classed pool, anything else (or size 0)      */
+/* takes a full buffer from the table.                                   */
+void *blas_memory_alloc_size(int procpos, BLASLONG size){
+
+  void *buffer;
+
+  if (memory_initialized && size > 0 && size <= blas_buffer_size() / 2) {
+    buffer = pool_alloc(size);
+    if (buffer != NULL) return buffer;
+  }
+
+  return blas_memory_alloc(procpos);
+}
+
+size_t openblas_trim_memory(void){
+
+  size_t bytes;
+
+#ifdef SMP
+  blas_thread_buffer_trim();
+#endif
+
+  bytes = trim_table(0);
+
+  return bytes + pool_trim(0);
 }
 
 void *blas_memory_alloc_nolock(int unused) {
   void *map_address;
-  map_address = (void *)malloc(BUFFER_SIZE + FIXED_PAGESIZE);
+  map_address = (void *)malloc(blas_buffer_size() + FIXED_PAGESIZE);
   return map_address;
 }
 
@@ -3246,7 +3881,7 @@ void blas_shutdown(void){
     memory[pos].lock   = 0;
   }
   if (memory_overflowed) {
-    for (pos = 0; pos < NEW_BUFFERS; pos ++){
+    for (pos = 0; pos < new_buffers; pos ++){
       newmemory[pos].addr   = (void *)0;
       newmemory[pos].used   = 0;
 #if defined(WHEREAMI) && !defined(USE_OPENMP)
@@ -3261,6 +3896,8 @@ void blas_shutdown(void){
 
   UNLOCK_COMMAND(&alloc_lock);
 
+  pool_trim(0);
+
   return;
 }
 
@@ -3284,7 +3921,7 @@ static void _touch_memory(blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n,
   size_t size;
   BLASULONG buffer;
 
-  size   = BUFFER_SIZE - PAGESIZE;
+  size   = blas_buffer_size() - PAGESIZE;
   buffer = (BLASULONG)sa + GEMM_OFFSET_A;
 
 #if defined(OS_LINUX) && !defined(NO_WARMUP)
@@ -3305,7 +3942,7 @@ static void _touch_memory(blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n,
   UNLOCK_COMMAND(&init_lock);
 #endif
 
-  size = MIN((BUFFER_SIZE - PAGESIZE), L2_SIZE);
+  size = MIN((blas_buffer_size() - PAGESIZE), L2_SIZE);
   buffer = (BLASULONG)sa + GEMM_OFFSET_A;
 
   while (size > 0) {
@@ -3422,9 +4059,8 @@ void CONSTRUCTOR gotoblas_init(void) {
 #endif
 #endif
 
-#ifdef FUNCTION_PROFILE
    gotoblas_profile_init();
-#endif
+   gotoblas_gemm_tune_init();
 
    gotoblas_initialized = 1;
 
@@ -3444,9 +4080,7 @@ void DESTRUCTOR gotoblas_quit(void) {
    moncontrol (0);
 #endif
 
-#ifdef FUNCTION_PROFILE
    gotoblas_profile_quit();
-#endif
 
 #if defined(SMP) && defined(OS_LINUX) && !defined(NO_AFFINITY)
    gotoblas_affinity_quit();
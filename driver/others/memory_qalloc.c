@@ -83,6 +83,31 @@ void blas_memory_free(void *free_area){
   return;
 }
 
+void *blas_memory_alloc_size(int numproc, BLASLONG size){
+  return blas_memory_alloc(numproc);
+}
+
+void blas_memory_discard(void *free_area){
+  return;
+}
+
+size_t openblas_trim_memory(void){
+  return 0;
+}
+
+BLASLONG blas_buffer_size(void) {
+  return BUFFER_SIZE;
+}
+
+/* Only the plain allocation above is available */
+int openblas_get_buffer_backend(void) {
+  return 0;
+}
+
+int openblas_set_buffer_backend(int backend) {
+  return backend == 0 ? 0 : -1;
+}
+
 
 
 extern void openblas_warning(int verbose, const char * msg);
@@ -40,6 +40,13 @@ static int openblas_env_openblas_num_threads=0;
 static int openblas_env_goto_num_threads=0;
 static int openblas_env_omp_num_threads=0;
 static int openblas_env_omp_adaptive=0;
+static int openblas_env_profile=0;
+static int openblas_env_gemm_tune=0;
+static int openblas_env_buffer_backend=0;
+static int openblas_env_buffer_size=0;
+static int openblas_env_num_buffers=0;
+static int openblas_env_buffer_idle_timeout=0;
+static int openblas_env_lookahead=-1;
 
 int openblas_verbose(void) { return openblas_env_verbose;}
 unsigned int openblas_thread_timeout(void) { return openblas_env_thread_timeout;}
@@ -48,6 +55,13 @@ int openblas_num_threads_env(void) { return openblas_env_openblas_num_threads;}
 int openblas_goto_num_threads_env(void) { return openblas_env_goto_num_threads;}
 int openblas_omp_num_threads_env(void) { return openblas_env_omp_num_threads;}
 int openblas_omp_adaptive_env(void) { return openblas_env_omp_adaptive;}
+int openblas_profile_env(void) { return openblas_env_profile;}
+int openblas_gemm_tune_env(void) { return openblas_env_gemm_tune;}
+int openblas_buffer_backend_env(void) { return openblas_env_buffer_backend;}
+int openblas_buffer_size_env(void) { return openblas_env_buffer_size;}
+int openblas_num_buffers_env(void) { return openblas_env_num_buffers;}
+int openblas_buffer_idle_timeout_env(void) { return openblas_env_buffer_idle_timeout;}
+int openblas_lookahead_env(void) { return openblas_env_lookahead;}
 
 void openblas_read_env(void) {
   int ret=0;
@@ -92,6 +106,49 @@ void openblas_read_env(void) {
   if(ret<0) ret=0;
   openblas_env_omp_adaptive=ret;
 
+  ret=0;
+  if (readenv(p,"OPENBLAS_PROFILE")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_profile=ret;
+
+  ret=0;
+  if (readenv(p,"OPENBLAS_GEMM_TUNE")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_gemm_tune=ret;
+
+  /* mmap, thp or hugetlb, see OPENBLAS_BUFFER_* in cblas.h */
+  ret=0;
+  if (readenv(p,"OPENBLAS_BUFFER_BACKEND")) {
+    if (!strcmp(p,"thp")) ret = 1;
+    else if (!strcmp(p,"hugetlb")) ret = 2;
+    else ret = atoi(p);
+  }
+  if(ret<0 || ret>2) ret=0;
+  openblas_env_buffer_backend=ret;
+
+  /* in MiB */
+  ret=0;
+  if (readenv(p,"OPENBLAS_BUFFER_SIZE")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_buffer_size=ret;
+
+  ret=0;
+  if (readenv(p,"OPENBLAS_NUM_BUFFERS")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_num_buffers=ret;
+
+  /* in seconds, 0 keeps idle buffers until openblas_trim_memory() */
+  ret=0;
+  if (readenv(p,"OPENBLAS_BUFFER_IDLE_TIMEOUT")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_buffer_idle_timeout=ret;
+
+  /* -1 leaves the default depth of the parallel getrf and potrf */
+  ret=-1;
+  if (readenv(p,"OPENBLAS_LOOKAHEAD")) ret = atoi(p);
+  if(ret<0) ret=-1;
+  openblas_env_lookahead=ret;
+
 }
 
 
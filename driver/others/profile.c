@@ -36,105 +36,216 @@
 /* or implied, of The University of Texas at Austin.                 */
 /*********************************************************************/
 
+#include <string.h>
 #include "common.h"
-#include <signal.h>
-#include <strings.h>
-#define USE_FUNCTABLE
-#include "../../interface/functable.h"
+#ifndef CBLAS
+#include "cblas.h"
+#endif
 
-func_profile_t function_profile_table[MAX_PROF_TABLE];
+/* Routines are keyed by the address of their CHAR_CNAME string, which is
+   unique per object, so lookups never compare strings. */
+#define MAX_PROF_TABLE	1024
 
-int gotoblas_profile = 1;
+int gotoblas_profile = 0;
 
-static struct sigaction sa, ig;
+static openblas_profile_entry function_profile_table[MAX_PROF_TABLE];
+static int function_profile_entries = 0;
+static volatile BLASULONG profile_lock = 0;
 
-void gotoblas_profile_quit(void) {
+static openblas_profile_callback profile_callback = NULL;
+static void *profile_callback_data = NULL;
 
-  int i;
-  unsigned long long calls, fops, cycles, tcycles, area;
+/* set when profiling was requested by the environment or at build time */
+static int profile_report = 0;
+
+extern int openblas_profile_env(void);
 
-  sigaction(SIGPROF, &ig, NULL);
+static openblas_profile_entry *profile_lookup(const char *name) {
 
-  calls   = 0;
-  fops    = 0;
-  cycles  = 0;
-  tcycles = 0;
-  area    = 0;
+  BLASULONG i, slot;
+  openblas_profile_entry *entry;
+
+  slot = ((BLASULONG)name >> 3) & (MAX_PROF_TABLE - 1);
 
   for (i = 0; i < MAX_PROF_TABLE; i ++) {
-    if (function_profile_table[i].calls) {
-      calls   += function_profile_table[i].calls;
-      cycles  += function_profile_table[i].cycles;
-      tcycles += function_profile_table[i].tcycles;
-      area    += function_profile_table[i].area;
-      fops    += function_profile_table[i].fops;
+    entry = &function_profile_table[(slot + i) & (MAX_PROF_TABLE - 1)];
+
+    if (entry -> name == name) return entry;
+
+    if (entry -> name == NULL) {
+      entry -> name = name;
+      function_profile_entries ++;
+      return entry;
     }
   }
 
-  if (cycles > 0) {
+  return NULL;
+}
+
+void gotoblas_profile_record(const char *name, int path, int nthreads,
+			     unsigned long long cycles, double flops, double bytes) {
 
-    fprintf(stderr, "\n\t====== BLAS Profiling Result =======\n\n");
-    fprintf(stderr, "  Function      No. of Calls   Time Consumption   Efficiency  Bytes/cycle  Wall Time(Cycles)\n");
+  openblas_profile_entry *entry;
+  openblas_profile_callback callback;
+  openblas_profile_event event;
+  void *data;
 
-    for (i = 0; i < MAX_PROF_TABLE; i ++) {
-      if (function_profile_table[i].calls) {
-#ifndef OS_WINDOWS
-	fprintf(stderr, "%-12s  : %10Ld        %8.2f%%      %10.3f%%  %8.2f   %Ld\n",
-#else
-	fprintf(stderr, "%-12s  : %10lld        %8.2f%%      %10.3f%%  %8.2f   %lld\n",
-#endif
-		func_table[i],
-		function_profile_table[i].calls,
-		(double)function_profile_table[i].cycles  / (double)cycles * 100.,
-		(double)function_profile_table[i].fops    / (double)function_profile_table[i].tcycles * 100.,
-			(double)function_profile_table[i].area    / (double)function_profile_table[i].cycles,
-			function_profile_table[i].cycles
-		);
-      }
-    }
+  blas_lock(&profile_lock);
 
-    fprintf(stderr, " --------------------------------------------------------------------\n");
+  entry = profile_lookup(name);
 
-#ifndef OS_WINDOWS
-	fprintf(stderr, "%-12s  : %10Ld                       %10.3f%%  %8.2f\n",
-#else
-	fprintf(stderr, "%-12s  : %10lld                       %10.3f%%  %8.2f\n",
-#endif
-		"Total",
-		 calls,
-		(double)fops    / (double)tcycles * 100.,
-		(double)area    / (double)cycles);
+  if (entry) {
+    entry -> calls ++;
+    entry -> cycles += cycles;
+    entry -> thread_sum += nthreads;
+    entry -> flops  += flops;
+    entry -> bytes  += bytes;
+
+    if (path & OPENBLAS_PROFILE_SMALL_KERNEL) entry -> small_kernel_calls ++;
+    if (path & OPENBLAS_PROFILE_GEMV_FORWARD) entry -> gemv_forward_calls ++;
+    if (path & OPENBLAS_PROFILE_THREADED)     entry -> threaded_calls ++;
+    if (path & OPENBLAS_PROFILE_PACKED)       entry -> packed_calls ++;
+  }
+
+  callback = profile_callback;
+  data     = profile_callback_data;
+
+  blas_unlock(&profile_lock);
+
+  if (callback) {
+    event.name     = name;
+    event.path     = path;
+    event.nthreads = nthreads;
+    event.cycles   = cycles;
+    event.flops    = flops;
+    event.bytes    = bytes;
+
+    callback(&event, data);
+  }
+}
+
+/* Every thread of a driver call adds its cycles, only the first one counts the call */
+void gotoblas_profile_level3(const char *name, int first, unsigned long long pack_cycles,
+			     unsigned long long kernel_cycles) {
+
+  openblas_profile_entry *entry;
+
+  blas_lock(&profile_lock);
+
+  entry = profile_lookup(name);
+
+  if (entry) {
+    if (first) entry -> calls ++;
+    entry -> cycles        += pack_cycles + kernel_cycles;
+    entry -> pack_cycles   += pack_cycles;
+    entry -> kernel_cycles += kernel_cycles;
   }
 
-  sigaction(SIGPROF, &sa, NULL);
+  blas_unlock(&profile_lock);
+}
+
+void openblas_profile_enable(int enable) {
+  gotoblas_profile = (enable != 0);
+  MB;
+}
+
+int openblas_profile_enabled(void) {
+  return gotoblas_profile;
 }
 
-void gotoblas_profile_clear(void) {
+void openblas_profile_reset(void) {
+
+  blas_lock(&profile_lock);
+
+  memset(function_profile_table, 0, sizeof(function_profile_table));
+  function_profile_entries = 0;
+
+  blas_unlock(&profile_lock);
+}
+
+int openblas_profile_snapshot(openblas_profile_entry *entries, int max_entries) {
+
+  int i, num = 0, total;
+
+  blas_lock(&profile_lock);
+
+  for (i = 0; i < MAX_PROF_TABLE && num < max_entries; i ++) {
+    if (function_profile_table[i].name) entries[num ++] = function_profile_table[i];
+  }
+
+  total = function_profile_entries;
+
+  blas_unlock(&profile_lock);
+
+  return total;
+}
+
+void openblas_profile_set_callback(openblas_profile_callback callback, void *data) {
+
+  blas_lock(&profile_lock);
+
+  profile_callback      = callback;
+  profile_callback_data = data;
+
+  blas_unlock(&profile_lock);
+}
+
+void gotoblas_profile_quit(void) {
 
   int i;
+  unsigned long long calls, cycles;
+  double flops;
+  openblas_profile_entry *entry;
+
+  if (!profile_report) return;
+
+  calls  = 0;
+  cycles = 0;
+  flops  = 0.;
 
   for (i = 0; i < MAX_PROF_TABLE; i ++) {
-    function_profile_table[i].calls  = 0;
-    function_profile_table[i].cycles = 0;
-    function_profile_table[i].tcycles = 0;
-    function_profile_table[i].area = 0;
-    function_profile_table[i].fops = 0;
+    entry = &function_profile_table[i];
+    if (entry -> name && entry -> pack_cycles + entry -> kernel_cycles == 0) {
+      calls  += entry -> calls;
+      cycles += entry -> cycles;
+      flops  += entry -> flops;
+    }
   }
 
-}
+  if (cycles == 0) return;
 
-void gotoblas_profile_init(void) {
+  fprintf(stderr, "\n\t====== BLAS Profiling Result =======\n\n");
+  fprintf(stderr, "  Function        No. of Calls   Time Consumption  Flops/cycle  Bytes/cycle  Threaded  Small  Gemv  Pack Time\n");
 
-  gotoblas_profile_clear();
+  for (i = 0; i < MAX_PROF_TABLE; i ++) {
+    entry = &function_profile_table[i];
+    if (!entry -> name || !entry -> cycles) continue;
+
+    if (entry -> pack_cycles + entry -> kernel_cycles == 0) {
+      fprintf(stderr, "%-16s: %12llu        %8.2f%%     %10.3f   %10.3f  %8llu %6llu %5llu\n",
+	      entry -> name, entry -> calls,
+	      (double)entry -> cycles / (double)cycles * 100.,
+	      entry -> flops / (double)entry -> cycles,
+	      entry -> bytes / (double)entry -> cycles,
+	      entry -> threaded_calls, entry -> small_kernel_calls, entry -> gemv_forward_calls);
+    } else {
+      fprintf(stderr, "%-16s: %12llu                                                                       %8.2f%%\n",
+	      entry -> name, entry -> calls,
+	      (double)entry -> pack_cycles / (double)entry -> cycles * 100.);
+    }
+  }
 
-  bzero(&sa, sizeof(struct sigaction));
-  sa.sa_handler = (void *)gotoblas_profile_quit;
-  sa.sa_flags  = SA_NODEFER | SA_RESETHAND;
+  fprintf(stderr, " ----------------------------------------------------------------------------------------------------------\n");
+  fprintf(stderr, "%-16s: %12llu                     %10.3f\n", "Total", calls, flops / (double)cycles);
+}
 
-  bzero(&ig, sizeof(struct sigaction));
-  ig.sa_handler = SIG_IGN;
-  ig.sa_flags |= SA_NODEFER | SA_RESETHAND;
+void gotoblas_profile_init(void) {
 
-  sigaction(SIGPROF, &sa, NULL);
+#ifdef FUNCTION_PROFILE
+  profile_report = 1;
+#else
+  profile_report = openblas_profile_env();
+#endif
 
+  if (profile_report) openblas_profile_enable(1);
 }
@@ -52,11 +52,12 @@
 
 @blasobjs = (lsame, xerbla);
 @bfblasobjs = (sbgemm, sbgemv, sbdot, sbstobf16, sbdtobf16, sbf16tos, dbf16tod);
+@hfblasobjs = (shgemm, shgemv, shstohf16, shf16tos);
 @cblasobjsc = (
     cblas_caxpy, cblas_ccopy, cblas_cdotc, cblas_cdotu, cblas_cgbmv, cblas_cgemm, cblas_cgemv,
     cblas_cgerc, cblas_cgeru, cblas_chbmv, cblas_chemm, cblas_chemv, cblas_cher2, cblas_cher2k,
     cblas_cher, cblas_cherk,  cblas_chpmv, cblas_chpr2, cblas_chpr, cblas_cscal, cblas_caxpby,
-    cblas_csscal, cblas_cswap, cblas_csymm, cblas_csyr2k, cblas_csyrk, cblas_ctbmv, cblas_cgeadd,
+    cblas_csscal, cblas_cswap, cblas_csymm, cblas_csyr2k, cblas_csyrk, cblas_ctbmv, cblas_cgeadd, cblas_ctrsm_batch, cblas_cgemm_batch_strided,
     cblas_ctbsv, cblas_ctpmv, cblas_ctpsv, cblas_ctrmm, cblas_ctrmv, cblas_ctrsm, cblas_ctrsv, 
     cblas_scnrm2, cblas_scasum,
     cblas_icamax, cblas_icamin, cblas_icmin, cblas_icmax, cblas_scsum,cblas_cimatcopy,cblas_comatcopy
@@ -67,9 +68,9 @@
     cblas_drot, cblas_drotg, cblas_drotm, cblas_drotmg, cblas_dsbmv, cblas_dscal, cblas_dsdot,
     cblas_dspmv, cblas_dspr2, cblas_dspr, cblas_dswap, cblas_dsymm, cblas_dsymv, cblas_dsyr2,
     cblas_dsyr2k, cblas_dsyr, cblas_dsyrk, cblas_dtbmv, cblas_dtbsv, cblas_dtpmv, cblas_dtpsv,
-    cblas_dtrmm, cblas_dtrmv, cblas_dtrsm, cblas_dtrsv, cblas_daxpby, cblas_dgeadd,
+    cblas_dtrmm, cblas_dtrmv, cblas_dtrsm, cblas_dtrsv, cblas_daxpby, cblas_dgeadd, cblas_dtrsm_batch, cblas_dgemm_batch_strided,
     cblas_idamax, cblas_idamin, cblas_idmin, cblas_idmax, cblas_dsum,cblas_dimatcopy,cblas_domatcopy
-    cblas_dgemmt);
+    cblas_dgemmt, cblas_dgemm_epilogue);
     
 @cblasobjss = (
     cblas_sasum, cblas_saxpy, cblas_saxpby,
@@ -78,9 +79,9 @@
     cblas_srotm, cblas_srotmg, cblas_ssbmv, cblas_sscal, cblas_sspmv, cblas_sspr2, cblas_sspr,
     cblas_sswap, cblas_ssymm, cblas_ssymv, cblas_ssyr2, cblas_ssyr2k, cblas_ssyr, cblas_ssyrk,
     cblas_stbmv, cblas_stbsv, cblas_stpmv, cblas_stpsv, cblas_strmm, cblas_strmv, cblas_strsm,
-    cblas_strsv, cblas_sgeadd,
+    cblas_strsv, cblas_sgeadd, cblas_strsm_batch, cblas_sgemm_batch_strided,
     cblas_isamax, cblas_isamin, cblas_ismin, cblas_ismax, cblas_ssum,cblas_simatcopy,cblas_somatcopy
-    cblas_sgemmt);
+    cblas_sgemmt, cblas_gemm_s8u8s32, cblas_sgemm_epilogue);
 @cblasobjsz = (
     cblas_dzasum, cblas_dznrm2, cblas_zaxpy, cblas_zcopy, cblas_zdotc, cblas_zdotu, cblas_zdscal,
     cblas_zgbmv, cblas_zgemm, cblas_zgemv, cblas_zgerc, cblas_zgeru, cblas_zhbmv, cblas_zhemm,
@@ -88,13 +89,14 @@
     cblas_zhpr, cblas_zscal, cblas_zswap, cblas_zsymm, cblas_zsyr2k, cblas_zsyrk,
     cblas_ztbmv, cblas_ztbsv, cblas_ztpmv, cblas_ztpsv, cblas_ztrmm, cblas_ztrmv, cblas_ztrsm,
     cblas_ztrsv, cblas_cdotc_sub, cblas_cdotu_sub, cblas_zdotc_sub, cblas_zdotu_sub,
-    cblas_zaxpby, cblas_zgeadd,
+    cblas_zaxpby, cblas_zgeadd, cblas_ztrsm_batch, cblas_zgemm_batch_strided,
     cblas_izamax, cblas_izamin, cblas_izmin, cblas_izmax, cblas_dzsum,cblas_zimatcopy,cblas_zomatcopy
     cblas_zgemmt);
 
 @cblasobjs = (  cblas_xerbla );
 
 @bfcblasobjs = (cblas_sbgemm, cblas_sbgemv, cblas_sbdot, cblas_sbstobf16, cblas_sbdtobf16, cblas_sbf16tos, cblas_dbf16tod);
+@hfcblasobjs = (cblas_shgemm, cblas_shgemv, cblas_shstohf16, cblas_shf16tos);
 
 @exblasobjs = (
     qamax,qamin,qasum,qaxpy,qcabs1,qcopy,qdot,qgbmv,qgemm,
@@ -146,6 +148,37 @@
     goto_set_num_threads,
     openblas_get_config,
     openblas_get_corename,
+    openblas_profile_enable,
+    openblas_profile_enabled,
+    openblas_profile_reset,
+    openblas_profile_snapshot,
+    openblas_profile_set_callback,
+    openblas_gemm_tune,
+    openblas_gemm_load_profile,
+    openblas_get_buffer_backend,
+    openblas_set_buffer_backend,
+    openblas_trim_memory,
+    openblas_stream_create,
+    openblas_stream_destroy,
+    openblas_stream_synchronize,
+    openblas_stream_wait_event,
+    openblas_event_create,
+    openblas_event_destroy,
+    openblas_event_record,
+    openblas_event_synchronize,
+    openblas_event_query,
+    openblas_stream_sgemm,
+    openblas_stream_dgemm,
+    openblas_stream_cgemm,
+    openblas_stream_zgemm,
+    openblas_stream_strsm,
+    openblas_stream_dtrsm,
+    openblas_stream_ctrsm,
+    openblas_stream_ztrsm,
+    openblas_stream_saxpy,
+    openblas_stream_daxpy,
+    openblas_stream_caxpy,
+    openblas_stream_zaxpy,
 );
 
 @misc_underscore_objs = (
@@ -154,6 +187,9 @@
 @lapackobjss = (
     # These routines are provided by OpenBLAS.
     sgesv, 
+    sgetrf_batch,
+    sgetrs_batch,
+    spotrf_batch,
     sgetf2,
     sgetrf,
     slaswp,
@@ -165,10 +201,15 @@
     strti2,
     strtri,
     spotri,
+    sgeqrf,
+    sormqr,
 );
 
 @lapackobjsd = (
  dgesv,  
+ dgetrf_batch,
+ dgetrs_batch,
+ dpotrf_batch,
  dgetf2, 
  dgetrf, 
  dlaswp, 
@@ -180,10 +221,15 @@
  dtrti2, 
  dtrtri, 
  dpotri, 
+ dgeqrf,
+ dormqr,
 );
 
 @lapackobjsc = (
 cgesv,  
+cgetrf_batch,
+cgetrs_batch,
+cpotrf_batch,
 cgetf2, 
 cgetrf, 
 claswp, 
@@ -195,10 +241,15 @@ cpotrf,
 ctrti2, 
 ctrtri, 
 cpotri, 
+cgeqrf,
+cunmqr,
 );
 
 @lapackobjsz = (
 zgesv,
+zgetrf_batch,
+zgetrs_batch,
+zpotrf_batch,
 zgetf2,
 zgetrf,
 zlaswp,
@@ -210,6 +261,8 @@ zpotrf,
 ztrti2,
 ztrtri,
 zpotri,
+zgeqrf,
+zunmqr,
 );
 
 
@@ -274,13 +327,13 @@ zpotri,
 @lapackobjs2s = (
     # SLASRC  -- Single precision real LAPACK routines
     # already provided by @lapackobjs:
-    #     sgesv, sgetf2, slaswp, slauu2, slauum, spotf2, spotri, strti2, strtri
+    #     sgesv, sgetf2, slaswp, slauu2, slauum, spotf2, spotri, strti2, strtri, sgeqrf, sormqr
     sgbbrd, sgbcon, sgbequ, sgbrfs, sgbsv,
     sgbsvx, sgbtf2, sgbtrf, sgbtrs, sgebak, sgebal, sgebd2,
     sgebrd, sgecon, sgeequ, sgees,  sgeesx, sgeev,  sgeevx,
     sgehd2, sgehrd, sgelq2, sgelqf,
     sgels,  sgelsd, sgelss, sgelsy, sgeql2, sgeqlf,
-    sgeqp3, sgeqr2, sgeqr2p, sgeqrf, sgeqrfp, sgerfs,
+    sgeqp3, sgeqr2, sgeqr2p, sgeqrfp, sgerfs,
     sgerq2, sgerqf, sgesc2, sgesdd, sgesvd, sgesvx,
     sgetc2, sgetri,
     sggbak, sggbal, sgges,  sggesx, sggev,  sggevx,
@@ -303,7 +356,7 @@ zpotri,
     sopgtr, sopmtr, sorg2l, sorg2r,
     sorgbr, sorghr, sorgl2, sorglq, sorgql, sorgqr, sorgr2,
     sorgrq, sorgtr, sorm2l, sorm2r,
-    sormbr, sormhr, sorml2, sormlq, sormql, sormqr, sormr2,
+    sormbr, sormhr, sorml2, sormlq, sormql, sormr2,
     sormr3, sormrq, sormrz, sormtr, spbcon, spbequ, spbrfs,
     spbstf, spbsv,  spbsvx,
     spbtf2, spbtrf, spbtrs, spocon, spoequ, sporfs, sposv,
@@ -350,13 +403,13 @@ zpotri,
     # CLASRC  -- Single precision complex LAPACK routines
     # already provided by @blasobjs:
     # already provided by @lapackobjs:
-    #     cgesv, cgetf2, claswp, clauu2, clauum, cpotf2, cpotri, ctrti2, ctrtri
+    #     cgesv, cgetf2, claswp, clauu2, clauum, cpotf2, cpotri, ctrti2, ctrtri, cgeqrf, cunmqr
     cbdsqr, cgbbrd, cgbcon, cgbequ, cgbrfs, cgbsv,  cgbsvx,
     cgbtf2, cgbtrf, cgbtrs, cgebak, cgebal, cgebd2, cgebrd,
     cgecon, cgeequ, cgees,  cgeesx, cgeev,  cgeevx,
     cgehd2, cgehrd, cgelq2, cgelqf,
     cgels,  cgelsd, cgelss, cgelsy, cgeql2, cgeqlf, cgeqp3,
-    cgeqr2, cgeqr2p, cgeqrf, cgeqrfp, cgerfs,
+    cgeqr2, cgeqr2p, cgeqrfp, cgerfs,
     cgerq2, cgerqf, cgesc2, cgesdd, cgesvd,
     cgesvx, cgetc2, cgetri,
     cggbak, cggbal, cgges,  cggesx, cggev,  cggevx, cggglm,
@@ -405,7 +458,7 @@ zpotri,
     ctrsyl, ctrtrs, ctzrzf, cung2l, cung2r,
     cungbr, cunghr, cungl2, cunglq, cungql, cungqr, cungr2,
     cungrq, cungtr, cunm2l, cunm2r, cunmbr, cunmhr, cunml2,
-    cunmlq, cunmql, cunmqr, cunmr2, cunmr3, cunmrq, cunmrz,
+    cunmlq, cunmql, cunmr2, cunmr3, cunmrq, cunmrz,
     cunmtr, cupgtr, cupmtr, icmax1, scsum1, cstemr,
     chfrk, ctfttp, clanhf, cpftrf, cpftri, cpftrs, ctfsm, ctftri,
     ctfttr, ctpttf, ctpttr, ctrttf, ctrttp,
@@ -429,13 +482,13 @@ zpotri,
     # DLASRC  -- Double precision real LAPACK routines
     # already provided by @lapackobjs:
     #     dgesv, dgetf2, dgetrs, dlaswp, dlauu2, dlauum, dpotf2, dpotrf, dpotri,
-    #     dtrti2, dtrtri
+    #     dtrti2, dtrtri, dgeqrf, dormqr
     dgbbrd, dgbcon, dgbequ, dgbrfs, dgbsv,
     dgbsvx, dgbtf2, dgbtrf, dgbtrs, dgebak, dgebal, dgebd2,
     dgebrd, dgecon, dgeequ, dgees,  dgeesx, dgeev,  dgeevx,
     dgehd2, dgehrd, dgelq2, dgelqf,
     dgels,  dgelsd, dgelss, dgelsy, dgeql2, dgeqlf,
-    dgeqp3, dgeqr2, dgeqr2p, dgeqrf, dgeqrfp, dgerfs,
+    dgeqp3, dgeqr2, dgeqr2p, dgeqrfp, dgerfs,
     dgerq2, dgerqf, dgesc2, dgesdd, dgesvd, dgesvx,
     dgetc2, dgetri,
     dggbak, dggbal, dgges,  dggesx, dggev,  dggevx,
@@ -458,7 +511,7 @@ zpotri,
     dopgtr, dopmtr, dorg2l, dorg2r,
     dorgbr, dorghr, dorgl2, dorglq, dorgql, dorgqr, dorgr2,
     dorgrq, dorgtr, dorm2l, dorm2r,
-    dormbr, dormhr, dorml2, dormlq, dormql, dormqr, dormr2,
+    dormbr, dormhr, dorml2, dormlq, dormql, dormr2,
     dormr3, dormrq, dormrz, dormtr, dpbcon, dpbequ, dpbrfs,
     dpbstf, dpbsv,  dpbsvx,
     dpbtf2, dpbtrf, dpbtrs, dpocon, dpoequ, dporfs, dposv,
@@ -496,13 +549,13 @@ zpotri,
     # already provided by @blasobjs:
     # already provided by @lapackobjs:
     #     zgesv, zgetrs, zgetf2, zlaswp, zlauu2, zlauum, zpotf2, zpotrf, zpotri,
-    #     ztrti2, ztrtri
+    #     ztrti2, ztrtri, zgeqrf, zunmqr
     zbdsqr, zgbbrd, zgbcon, zgbequ, zgbrfs, zgbsv,  zgbsvx,
     zgbtf2, zgbtrf, zgbtrs, zgebak, zgebal, zgebd2, zgebrd,
     zgecon, zgeequ, zgees,  zgeesx, zgeev,  zgeevx,
     zgehd2, zgehrd, zgelq2, zgelqf,
     zgels,  zgelsd, zgelss, zgelsy, zgeql2, zgeqlf, zgeqp3,
-    zgeqr2, zgeqr2p, zgeqrf, zgeqrfp, zgerfs, zgerq2, zgerqf,
+    zgeqr2, zgeqr2p, zgeqrfp, zgerfs, zgerq2, zgerqf,
     zgesc2, zgesdd, zgesvd, zgesvx, zgetc2,
     zgetri,
     zggbak, zggbal, zgges,  zggesx, zggev,  zggevx, zggglm,
@@ -554,7 +607,7 @@ zpotri,
     ztrsyl, ztrtrs, ztzrzf, zung2l,
     zung2r, zungbr, zunghr, zungl2, zunglq, zungql, zungqr, zungr2,
     zungrq, zungtr, zunm2l, zunm2r, zunmbr, zunmhr, zunml2,
-    zunmlq, zunmql, zunmqr, zunmr2, zunmr3, zunmrq, zunmrz,
+    zunmlq, zunmql, zunmr2, zunmr3, zunmrq, zunmrz,
     zunmtr, zupgtr,
     zupmtr, izmax1, dzsum1, zstemr,
     zcgesv, zcposv, zlag2c, clag2z, zlat2c,
@@ -3651,6 +3704,10 @@ if ($ARGV[12] == 1) {
 	@blasobjs = (@blasobjs, @bfblasobjs);
 	@cblasobjs = (@cblasobjs, @bfcblasobjs);
 }
+if ($ARGV[17] == 1) {
+	@blasobjs = (@blasobjs, @hfblasobjs);
+	@cblasobjs = (@cblasobjs, @hfcblasobjs);
+}
 if ($ARGV[13] == 1) {
 	@blasobjs = (@blasobjs, @blasobjss);
 	@cblasobjs = (@cblasobjs, @cblasobjss);
@@ -42,6 +42,42 @@
 #include "functable.h"
 #endif
 
+#if defined(SMP) && !defined(XDOUBLE)
+static int asum_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		       FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  *(FLOAT *)args -> c = ASUM_K(args -> m, (FLOAT *)args -> a, args -> lda);
+
+  return 0;
+}
+
+static FLOAT asum_parallel(BLASLONG n, FLOAT *x, BLASLONG incx, int nthreads){
+
+  FLOAT result[MAX_CPU_NUMBER * 2 * sizeof(double) / sizeof(FLOAT)];
+  FLOAT sum;
+  int i, pieces, mode;
+
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE;
+#else
+  mode  =  BLAS_SINGLE;
+#endif
+#ifdef COMPLEX
+  mode |=  BLAS_COMPLEX;
+#else
+  mode |=  BLAS_REAL;
+#endif
+
+  pieces = blas_level1_reduce(mode, n, x, incx, NULL, 0, result,
+			      (int (*)(void))asum_thread, nthreads);
+
+  sum = ZERO;
+  for (i = 0; i < pieces; i ++) sum += result[i * 2 * sizeof(double) / sizeof(FLOAT)];
+
+  return sum;
+}
+#endif
+
 #ifndef CBLAS
 
 FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
@@ -49,6 +85,9 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
   BLASLONG n    = *N;
   BLASLONG incx = *INCX;
   FLOATRET ret;
+#if defined(SMP) && !defined(XDOUBLE)
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -58,6 +97,14 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
 
   FUNCTION_PROFILE_START();
 
+#if defined(SMP) && !defined(XDOUBLE)
+  nthreads = num_cpu_avail(1);
+
+  if (incx > 0 && nthreads > 1 && n >= 2 * L1_REDUCE_WIDTH) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    ret = (FLOATRET)asum_parallel(n, x, incx, nthreads);
+  } else
+#endif
   ret = (FLOATRET)ASUM_K(n, x, incx);
 
   FUNCTION_PROFILE_END(COMPSIZE, n, n);
@@ -76,6 +123,9 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx){
 #endif
 
   FLOAT ret;
+#if defined(SMP) && !defined(XDOUBLE)
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -85,6 +135,14 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx){
 
   FUNCTION_PROFILE_START();
 
+#if defined(SMP) && !defined(XDOUBLE)
+  nthreads = num_cpu_avail(1);
+
+  if (incx > 0 && nthreads > 1 && n >= 2 * L1_REDUCE_WIDTH) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    ret = asum_parallel(n, x, incx, nthreads);
+  } else
+#endif
   ret = ASUM_K(n, x, incx);
 
   FUNCTION_PROFILE_END(COMPSIZE, n, n);
@@ -98,6 +98,7 @@ void CNAME(blasint n, FLOAT alpha, FLOAT *x, blasint incx, FLOAT *y, blasint inc
   else
 	  nthreads = num_cpu_avail(1);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
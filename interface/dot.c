@@ -42,6 +42,39 @@
 #include "functable.h"
 #endif
 
+#if defined(SMP) && !defined(XDOUBLE)
+static int dot_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		      FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  *(FLOAT *)args -> c = DOTU_K(args -> m, (FLOAT *)args -> a, args -> lda,
+			       (FLOAT *)args -> b, args -> ldb);
+
+  return 0;
+}
+
+static FLOAT dot_parallel(BLASLONG n, FLOAT *x, BLASLONG incx,
+			  FLOAT *y, BLASLONG incy, int nthreads){
+
+  FLOAT result[MAX_CPU_NUMBER * 2 * sizeof(double) / sizeof(FLOAT)];
+  FLOAT dot;
+  int i, pieces, mode;
+
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+
+  pieces = blas_level1_reduce(mode, n, x, incx, y, incy, result,
+			      (int (*)(void))dot_thread, nthreads);
+
+  dot = ZERO;
+  for (i = 0; i < pieces; i ++) dot += result[i * 2 * sizeof(double) / sizeof(FLOAT)];
+
+  return dot;
+}
+#endif
+
 #ifndef CBLAS
 
 FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX, FLOAT *y, blasint *INCY){
@@ -50,6 +83,9 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX, FLOAT *y, blasint *INCY){
   BLASLONG incx = *INCX;
   BLASLONG incy = *INCY;
   FLOATRET ret;
+#if defined(SMP) && !defined(XDOUBLE)
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -62,6 +98,14 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX, FLOAT *y, blasint *INCY){
   if (incx < 0) x -= (n - 1) * incx;
   if (incy < 0) y -= (n - 1) * incy;
 
+#if defined(SMP) && !defined(XDOUBLE)
+  nthreads = num_cpu_avail(1);
+
+  if (incx != 0 && incy != 0 && nthreads > 1 && n >= 2 * L1_REDUCE_WIDTH) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    ret = (FLOATRET)dot_parallel(n, x, incx, y, incy, nthreads);
+  } else
+#endif
   ret = (FLOATRET)DOTU_K(n, x, incx, y, incy);
 
   FUNCTION_PROFILE_END(1, 2 * n, 2 * n);
@@ -76,6 +120,9 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX, FLOAT *y, blasint *INCY){
 FLOAT CNAME(blasint n, FLOAT *x, blasint incx, FLOAT *y, blasint incy){
 
   FLOAT ret;
+#if defined(SMP) && !defined(XDOUBLE)
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -88,6 +135,14 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx, FLOAT *y, blasint incy){
   if (incx < 0) x -= (n - 1) * incx;
   if (incy < 0) y -= (n - 1) * incy;
 
+#if defined(SMP) && !defined(XDOUBLE)
+  nthreads = num_cpu_avail(1);
+
+  if (incx != 0 && incy != 0 && nthreads > 1 && n >= 2 * L1_REDUCE_WIDTH) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    ret = dot_parallel(n, x, incx, y, incy, nthreads);
+  } else
+#endif
   ret = DOTU_K(n, x, incx, y, incy);
 
   FUNCTION_PROFILE_END(1, 2 * n, 2 * n);
@@ -48,6 +48,23 @@
 #define ERROR_NAME "SGEADD "
 #endif
 
+#ifdef SMP
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+/* C := alpha*A + beta*C for the columns range_n */
+static int geadd_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+  BLASLONG n_from = range_n[0], n_to = range_n[1];
+
+  GEADD_K(args -> m, n_to - n_from, *(FLOAT *)args -> alpha,
+	  (FLOAT *)args -> a + n_from * args -> lda, args -> lda, *(FLOAT *)args -> beta,
+	  (FLOAT *)args -> c + n_from * args -> ldc, args -> ldc);
+  return 0;
+}
+#endif
+
 #ifndef CBLAS
 
 void NAME(blasint *M, blasint *N, FLOAT *ALPHA, FLOAT *a, blasint *LDA,
@@ -62,6 +79,10 @@ void NAME(blasint *M, blasint *N, FLOAT *ALPHA, FLOAT *a, blasint *LDA,
   FLOAT beta  = *BETA;
 
   blasint info;
+#ifdef SMP
+  blas_arg_t args;
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -92,6 +113,10 @@ void CNAME(enum CBLAS_ORDER order,
 	   FLOAT  *c, blasint ldc){ */
 
   blasint info, t;
+#ifdef SMP
+  blas_arg_t args;
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -136,6 +161,30 @@ void CNAME(enum CBLAS_ORDER order,
   FUNCTION_PROFILE_START();
 
 
+#ifdef SMP
+  if ( 1L * m * n < 65536L * GEMM_MULTITHREAD_THRESHOLD )
+    nthreads = 1;
+  else
+    nthreads = num_cpu_avail(2);
+
+  if (nthreads > 1) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    args.m = m;
+    args.n = n;
+    args.a = (void *)a;
+    args.c = (void *)c;
+    args.lda = lda;
+    args.ldc = ldc;
+    args.alpha = (void *)&alpha;
+    args.beta  = (void *)&beta;
+#ifdef DOUBLE
+    gemm_thread_n(BLAS_DOUBLE | BLAS_REAL, &args, NULL, NULL, geadd_thread, NULL, NULL, nthreads);
+#else
+    gemm_thread_n(BLAS_SINGLE | BLAS_REAL, &args, NULL, NULL, geadd_thread, NULL, NULL, nthreads);
+#endif
+  } else
+#endif
+
   GEADD_K(m,n,alpha, a, lda, beta, c, ldc); 
 
 
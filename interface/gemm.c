@@ -56,6 +56,9 @@
 #elif defined(BFLOAT16)
 #define ERROR_NAME "SBGEMM "
 #define GEMV BLASFUNC(sbgemv)
+#elif defined(HFLOAT16)
+#define ERROR_NAME "SHGEMM "
+#define GEMV BLASFUNC(shgemv)
 #else
 #define ERROR_NAME "SGEMM "
 #define GEMV BLASFUNC(sgemv)
@@ -111,7 +114,7 @@ static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, B
 #endif
 };
 
-#if defined(SMALL_MATRIX_OPT) && !defined(GEMM3M) && !defined(XDOUBLE)
+#if defined(SMALL_MATRIX_OPT) && !defined(GEMM3M) && !defined(XDOUBLE) && !defined(HFLOAT16)
 #define USE_SMALL_MATRIX_OPT 1
 #else
 #define USE_SMALL_MATRIX_OPT 0
@@ -195,10 +198,10 @@ void NAME(char *TRANSA, char *TRANSB,
   char transA, transB;
   IFLOAT *buffer;
   IFLOAT *sa, *sb;
+  BLASLONG buffer_size, sa_size;
 
 #ifdef SMP
   double MNK;
-#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
 #ifndef COMPLEX
 #ifdef XDOUBLE
   int mode  =  BLAS_XDOUBLE | BLAS_REAL;
@@ -217,7 +220,6 @@ void NAME(char *TRANSA, char *TRANSB,
 #endif
 #endif
 #endif
-#endif
 
 #if defined(SMP) && !defined(NO_AFFINITY) && !defined(USE_SIMPLE_THREADED_LEVEL3)
   int nodes;
@@ -319,10 +321,10 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
   XFLOAT *buffer;
   XFLOAT *sa, *sb;
+  BLASLONG buffer_size, sa_size;
 
 #ifdef SMP
   double MNK;
-#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
 #ifndef COMPLEX
 #ifdef XDOUBLE
   int mode  =  BLAS_XDOUBLE | BLAS_REAL;
@@ -341,7 +343,6 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 #endif
 #endif
 #endif
-#endif
 
 #if defined(SMP) && !defined(NO_AFFINITY) && !defined(USE_SIMPLE_THREADED_LEVEL3)
   int nodes;
@@ -349,7 +350,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
   PRINT_DEBUG_CNAME;
 
-#if !defined(COMPLEX) && !defined(DOUBLE) && !defined(BFLOAT16) && defined(USE_SGEMM_KERNEL_DIRECT)
+#if !defined(COMPLEX) && !defined(DOUBLE) && !defined(BFLOAT16) && !defined(HFLOAT16) && defined(USE_SGEMM_KERNEL_DIRECT)
 #ifdef DYNAMIC_ARCH
  if (support_avx512() )
 #endif  
@@ -499,6 +500,8 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 	 args.m, args.n, args.k, args.lda, args.ldb, args.ldc);
 #endif
 
+  FUNCTION_PROFILE_START();
+
 #if defined(GEMM_GEMV_FORWARD) && !defined(GEMM3M) && !defined(COMPLEX) && (!defined(BFLOAT16) || defined(GEMM_GEMV_FORWARD_BF16))
 #if defined(ARCH_ARM64)
   // The gemv kernels in arm64/{gemv_n.S,gemv_n_sve.c,gemv_t.S,gemv_t_sve.c}
@@ -531,6 +534,8 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
       bool is_efficient_gemv = have_tuned_gemv || ((NT == 'N') || (NT == 'T' && inc_x == 1));
       if (is_efficient_gemv) {
         GEMV(&NT, &m, &n, args.alpha, args.a, &lda, args.b, &inc_x, args.beta, args.c, &inc_y);
+        FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_GEMV_FORWARD, 1);
+        FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
         return;
       }
     }
@@ -554,6 +559,8 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
       bool is_efficient_gemv = have_tuned_gemv || ((NT == 'N' && inc_y == 1) || (NT == 'T' && inc_x == 1));
       if (is_efficient_gemv) {
         GEMV(&NT, &m, &n, args.alpha, args.b, &ldb, args.a, &inc_x, args.beta, args.c, &inc_y);
+        FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_GEMV_FORWARD, 1);
+        FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
         return;
       }
     }
@@ -562,8 +569,6 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
   IDEBUG_START;
 
-  FUNCTION_PROFILE_START();
-
 #if USE_SMALL_MATRIX_OPT
 #if !defined(COMPLEX)
   if(GEMM_SMALL_MATRIX_PERMIT(transa, transb, args.m, args.n, args.k, *(FLOAT *)(args.alpha), *(FLOAT *)(args.beta))){
@@ -572,6 +577,8 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 	  }else{
 		(GEMM_SMALL_KERNEL((transb << 2) | transa))(args.m, args.n, args.k, args.a, args.lda, *(FLOAT *)(args.alpha), args.b, args.ldb, *(FLOAT *)(args.beta), args.c, args.ldc);
 	  }
+	  FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_SMALL_KERNEL, 1);
+	  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
 	  return;
   }
 #else
@@ -581,21 +588,16 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 	  }else{
 		(ZGEMM_SMALL_KERNEL((transb << 2) | transa))(args.m, args.n, args.k, args.a, args.lda, alpha[0], alpha[1], args.b, args.ldb, beta[0], beta[1], args.c, args.ldc);
 	  }
+	  FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_SMALL_KERNEL, 1);
+	  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
 	  return;
   }
 #endif
 #endif
 
-  buffer = (XFLOAT *)blas_memory_alloc(0);
-
-//For LOONGARCH64, applying an offset to the buffer is essential
-//for minimizing cache conflicts and optimizing performance.
-#if defined(ARCH_LOONGARCH64) && !defined(NO_AFFINITY)
-  sa = (XFLOAT *)((BLASLONG)buffer + (WhereAmI() & 0xf) * GEMM_OFFSET_A);
-#else
-  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+#ifdef DYNAMIC_ARCH
+  if (gotoblas_gemm_tune_pending) gotoblas_gemm_tune_deferred();
 #endif
-  sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
 
 #ifdef SMP
 #if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
@@ -608,12 +610,48 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 	args.nthreads = 1;
   else {
 	args.nthreads = num_cpu_avail(3);
-	if (MNK/args.nthreads < SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD)
-		args.nthreads = MNK/(SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD);
+	if (args.nthreads > 1)
+	  args.nthreads = blas_level3_threads(BLAS_MODEL_GEMM, mode, args.m, args.n, args.k,
+					      GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, args.nthreads, NULL);
   }
 
   args.common = NULL;
+#endif
+
+  sa_size = (GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN;
+  buffer_size = 0;
 
+#if !defined(GEMM3M) && !defined(BFLOAT16) && !defined(HFLOAT16)
+  /* A single thread packs at most a GEMM_P x GEMM_Q block of A and a */
+  /* GEMM_Q x GEMM_R panel of B, so a small problem only asks for the */
+  /* part of the buffer it will touch. The threaded drivers size the */
+  /* blocks from the whole buffer.                                    */
+#ifdef SMP
+  if (args.nthreads == 1)
+#endif
+  {
+    BLASLONG min_k = MIN(args.k, GEMM_Q) + GEMM_UNROLL_M;
+
+    sa_size = ((MIN(args.m, GEMM_P) + GEMM_UNROLL_M - 1) / GEMM_UNROLL_M) * GEMM_UNROLL_M * min_k * COMPSIZE * SIZE;
+    sa_size = (sa_size + GEMM_ALIGN) & ~GEMM_ALIGN;
+
+    buffer_size = GEMM_OFFSET_A * 16 + sa_size + GEMM_OFFSET_B + PAGESIZE
+      + ((MIN(args.n, GEMM_R) + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N * min_k * COMPSIZE * SIZE;
+  }
+#endif
+
+  buffer = (XFLOAT *)blas_memory_alloc_size(0, buffer_size);
+
+//For LOONGARCH64, applying an offset to the buffer is essential
+//for minimizing cache conflicts and optimizing performance.
+#if defined(ARCH_LOONGARCH64) && !defined(NO_AFFINITY)
+  sa = (XFLOAT *)((BLASLONG)buffer + (WhereAmI() & 0xf) * GEMM_OFFSET_A);
+#else
+  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+#endif
+  sb = (XFLOAT *)(((BLASLONG)sa + sa_size) + GEMM_OFFSET_B);
+
+#ifdef SMP
  if (args.nthreads == 1) {
 #endif
 
@@ -623,6 +661,8 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
   } else {
 
+    FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_THREADED, args.nthreads);
+
 #ifndef USE_SIMPLE_THREADED_LEVEL3
 
 #ifndef NO_AFFINITY
@@ -0,0 +1,298 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifndef COMPLEX
+#define SMP_THRESHOLD_MIN 65536.0
+#ifdef DOUBLE
+#define ERROR_NAME "DGEMM_BATCH_STRIDED "
+#define CBLAS_GEMM cblas_dgemm
+#define GEMM_BATCH_STRIDED_THREAD dgemm_batch_strided_thread
+#else
+#define ERROR_NAME "SGEMM_BATCH_STRIDED "
+#define CBLAS_GEMM cblas_sgemm
+#define GEMM_BATCH_STRIDED_THREAD sgemm_batch_strided_thread
+#endif
+#else
+#define SMP_THRESHOLD_MIN 8192.0
+#ifdef DOUBLE
+#define ERROR_NAME "ZGEMM_BATCH_STRIDED "
+#define CBLAS_GEMM cblas_zgemm
+#define GEMM_BATCH_STRIDED_THREAD zgemm_batch_strided_thread
+#else
+#define ERROR_NAME "CGEMM_BATCH_STRIDED "
+#define CBLAS_GEMM cblas_cgemm
+#define GEMM_BATCH_STRIDED_THREAD cgemm_batch_strided_thread
+#endif
+#endif
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG) = {
+  GEMM_NN, GEMM_TN, GEMM_RN, GEMM_CN,
+  GEMM_NT, GEMM_TT, GEMM_RT, GEMM_CT,
+  GEMM_NR, GEMM_TR, GEMM_RR, GEMM_CR,
+  GEMM_NC, GEMM_TC, GEMM_RC, GEMM_CC,
+};
+
+#ifdef SMALL_MATRIX_OPT
+#ifndef DYNAMIC_ARCH
+#define SMALL_KERNEL_ADDR(table, idx) ((void *)(table[idx]))
+#else
+#define SMALL_KERNEL_ADDR(table, idx) ((void *)(*(uintptr_t *)((char *)gotoblas + (size_t)(table[idx]))))
+#endif
+
+#ifndef COMPLEX
+static size_t gemm_small_kernel[] = {
+	GEMM_SMALL_KERNEL_NN, GEMM_SMALL_KERNEL_TN, 0, 0,
+	GEMM_SMALL_KERNEL_NT, GEMM_SMALL_KERNEL_TT, 0, 0,
+};
+
+static size_t gemm_small_kernel_b0[] = {
+	GEMM_SMALL_KERNEL_B0_NN, GEMM_SMALL_KERNEL_B0_TN, 0, 0,
+	GEMM_SMALL_KERNEL_B0_NT, GEMM_SMALL_KERNEL_B0_TT, 0, 0,
+};
+#else
+static size_t gemm_small_kernel[] = {
+	GEMM_SMALL_KERNEL_NN, GEMM_SMALL_KERNEL_TN, GEMM_SMALL_KERNEL_RN, GEMM_SMALL_KERNEL_CN,
+	GEMM_SMALL_KERNEL_NT, GEMM_SMALL_KERNEL_TT, GEMM_SMALL_KERNEL_RT, GEMM_SMALL_KERNEL_CT,
+	GEMM_SMALL_KERNEL_NR, GEMM_SMALL_KERNEL_TR, GEMM_SMALL_KERNEL_RR, GEMM_SMALL_KERNEL_CR,
+	GEMM_SMALL_KERNEL_NC, GEMM_SMALL_KERNEL_TC, GEMM_SMALL_KERNEL_RC, GEMM_SMALL_KERNEL_CC,
+};
+
+static size_t gemm_small_kernel_b0[] = {
+	GEMM_SMALL_KERNEL_B0_NN, GEMM_SMALL_KERNEL_B0_TN, GEMM_SMALL_KERNEL_B0_RN, GEMM_SMALL_KERNEL_B0_CN,
+	GEMM_SMALL_KERNEL_B0_NT, GEMM_SMALL_KERNEL_B0_TT, GEMM_SMALL_KERNEL_B0_RT, GEMM_SMALL_KERNEL_B0_CT,
+	GEMM_SMALL_KERNEL_B0_NR, GEMM_SMALL_KERNEL_B0_TR, GEMM_SMALL_KERNEL_B0_RR, GEMM_SMALL_KERNEL_B0_CR,
+	GEMM_SMALL_KERNEL_B0_NC, GEMM_SMALL_KERNEL_B0_TC, GEMM_SMALL_KERNEL_B0_RC, GEMM_SMALL_KERNEL_B0_CC,
+};
+#endif
+#endif
+
+static int trans_flag(enum CBLAS_TRANSPOSE trans){
+  if (trans == CblasNoTrans)     return 0;
+  if (trans == CblasTrans)       return 1;
+#ifndef COMPLEX
+  if (trans == CblasConjNoTrans) return 0;
+  if (trans == CblasConjTrans)   return 1;
+#else
+  if (trans == CblasConjNoTrans) return 2;
+  if (trans == CblasConjTrans)   return 3;
+#endif
+  return -1;
+}
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   blasint m, blasint n, blasint k,
+#ifndef COMPLEX
+	   FLOAT alpha,
+	   FLOAT *a, blasint lda, blasint stridea,
+	   FLOAT *b, blasint ldb, blasint strideb,
+	   FLOAT beta,
+	   FLOAT *c, blasint ldc, blasint stridec, blasint batch_size) {
+#else
+	   void *valpha,
+	   void *va, blasint lda, blasint stridea,
+	   void *vb, blasint ldb, blasint strideb,
+	   void *vbeta,
+	   void *vc, blasint ldc, blasint stridec, blasint batch_size) {
+
+  FLOAT *alpha = (FLOAT *)valpha;
+  FLOAT *beta  = (FLOAT *)vbeta;
+  FLOAT *a = (FLOAT *)va;
+  FLOAT *b = (FLOAT *)vb;
+  FLOAT *c = (FLOAT *)vc;
+#endif
+
+  blas_arg_t args;
+  enum CBLAS_TRANSPOSE op_a, op_b;
+  int transa, transb;
+  BLASLONG nrowa, nrowb, stride_a, stride_b, stride_c;
+  blasint info;
+
+#ifdef SMP
+  double MNK;
+  BLASLONG i;
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+#ifndef COMPLEX
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+#else
+  args.alpha = (void *)alpha;
+  args.beta  = (void *)beta;
+#endif
+
+  /* Row major C = op(A) op(B) is column major C**T = op(B)**T op(A)**T */
+  op_a = TransA;
+  op_b = TransB;
+  stride_a = stridea;
+  stride_b = strideb;
+
+  if (order == CblasColMajor) {
+    args.m = m;
+    args.n = n;
+    args.a = (void *)a;
+    args.b = (void *)b;
+    args.lda = lda;
+    args.ldb = ldb;
+  } else if (order == CblasRowMajor) {
+    args.m = n;
+    args.n = m;
+    args.a = (void *)b;
+    args.b = (void *)a;
+    args.lda = ldb;
+    args.ldb = lda;
+    op_a = TransB;
+    op_b = TransA;
+    stride_a = strideb;
+    stride_b = stridea;
+  } else {
+    info = 1;
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  args.k   = k;
+  args.c   = (void *)c;
+  args.ldc = ldc;
+  stride_c = stridec;
+
+  transa = trans_flag(op_a);
+  transb = trans_flag(op_b);
+
+  /* A and B are checked as the caller passed them, so that info is the */
+  /* position of the argument in the call for either order             */
+  nrowa = (order == CblasColMajor) ? m : k;
+  if (trans_flag(TransA) & 1) nrowa = (order == CblasColMajor) ? k : m;
+  nrowb = (order == CblasColMajor) ? k : n;
+  if (trans_flag(TransB) & 1) nrowb = (order == CblasColMajor) ? n : k;
+
+  info = -1;
+
+  /* C entries may only overlap when there is a single one */
+  if (batch_size < 0)                       info = 18;
+  if (batch_size > 1 &&
+      stride_c < args.ldc * args.n)         info = 17;
+  if (args.ldc < args.m)                    info = 16;
+  if (strideb < 0)                          info = 13;
+  if (ldb < nrowb)                          info = 12;
+  if (stridea < 0)                          info = 10;
+  if (lda < nrowa)                          info =  9;
+  if (k < 0)                                info =  6;
+  if (n < 0)                                info =  5;
+  if (m < 0)                                info =  4;
+  if (trans_flag(TransB) < 0)               info =  3;
+  if (trans_flag(TransA) < 0)               info =  2;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (args.m == 0 || args.n == 0 || batch_size == 0) return;
+
+  /* A shared A and back to back B and C make the batch one GEMM with */
+  /* batch_size * n columns: A is packed once for all of the entries   */
+  if (stride_a == 0 && !(transb & 1) &&
+      stride_b == args.ldb * args.n && stride_c == args.ldc * args.n &&
+      (BLASLONG)(blasint)(args.n * batch_size) == args.n * batch_size) {
+    CBLAS_GEMM(CblasColMajor, op_a, op_b, args.m, args.n * batch_size, args.k,
+	       alpha, args.a, args.lda, args.b, args.ldb, beta, args.c, args.ldc);
+    return;
+  }
+
+#ifdef SMP
+  MNK = (double)args.m * (double)args.n * (double)args.k;
+
+  args.nthreads = 1;
+  if (MNK * (double)batch_size > SMP_THRESHOLD_MIN * (double)GEMM_MULTITHREAD_THRESHOLD)
+    args.nthreads = num_cpu_avail(3);
+
+  /* Too few entries to keep every thread busy: let each GEMM thread */
+  if (args.nthreads > batch_size && MNK > SMP_THRESHOLD_MIN * (double)GEMM_MULTITHREAD_THRESHOLD) {
+    for (i = 0; i < batch_size; i++)
+      CBLAS_GEMM(CblasColMajor, op_a, op_b, args.m, args.n, args.k, alpha,
+		 (FLOAT *)args.a + i * stride_a * COMPSIZE, args.lda,
+		 (FLOAT *)args.b + i * stride_b * COMPSIZE, args.ldb, beta,
+		 (FLOAT *)args.c + i * stride_c * COMPSIZE, args.ldc);
+    return;
+  }
+#endif
+
+  args.routine = (void *)gemm[(transb << 2) | transa];
+  args.routine_mode = 0;
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef DOUBLE
+  args.routine_mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+  args.routine_mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+#else
+#ifdef DOUBLE
+  args.routine_mode = BLAS_DOUBLE | BLAS_COMPLEX;
+#else
+  args.routine_mode = BLAS_SINGLE | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+#ifdef SMALL_MATRIX_OPT
+#ifndef COMPLEX
+  if (GEMM_SMALL_MATRIX_PERMIT(transa, transb, args.m, args.n, args.k, alpha, beta)) {
+    if (beta == ZERO) {
+#else
+  if (GEMM_SMALL_MATRIX_PERMIT(transa, transb, args.m, args.n, args.k, alpha[0], alpha[1], beta[0], beta[1])) {
+    if (beta[0] == ZERO && beta[1] == ZERO) {
+#endif
+      args.routine_mode |= BLAS_SMALL_B0_OPT;
+      args.routine = SMALL_KERNEL_ADDR(gemm_small_kernel_b0, (transb << 2) | transa);
+    } else {
+      args.routine_mode |= BLAS_SMALL_OPT;
+      args.routine = SMALL_KERNEL_ADDR(gemm_small_kernel, (transb << 2) | transa);
+    }
+  }
+#endif
+
+  GEMM_BATCH_STRIDED_THREAD(&args, stride_a, stride_b, stride_c, batch_size);
+}
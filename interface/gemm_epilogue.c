@@ -0,0 +1,222 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/*
+ * cblas_?gemm_epilogue: GEMM followed by a bias add, an activation and an
+ * optional conversion of the result to bf16.  The level 3 drivers apply the
+ * epilogue to each block of C right after its last k step, while the block
+ * is still in cache.  Row major callers are mapped onto column major by
+ * swapping A and B, which also swaps row and column bias.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifdef DOUBLE
+#define ERROR_NAME "DGEMM_EPILOGUE "
+#else
+#define ERROR_NAME "SGEMM_EPILOGUE "
+#endif
+
+#define SMP_THRESHOLD_MIN 65536.0
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GEMM_EPILOGUE_NN, GEMM_EPILOGUE_TN, GEMM_EPILOGUE_NT, GEMM_EPILOGUE_TT,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  GEMM_EPILOGUE_THREAD_NN, GEMM_EPILOGUE_THREAD_TN, GEMM_EPILOGUE_THREAD_NT, GEMM_EPILOGUE_THREAD_TT,
+#endif
+};
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   blasint M, blasint N, blasint K,
+	   FLOAT alpha, FLOAT *a, blasint lda, FLOAT *b, blasint ldb,
+	   FLOAT beta, FLOAT *c, blasint ldc, openblas_gemm_epilogue *epilogue){
+
+  blas_arg_t args;
+  gemm_epilogue_t ep;
+  int transa = -1, transb = -1;
+  blasint nrowa, nrowb, info = -1;
+  FLOAT *buffer;
+  FLOAT *sa, *sb;
+
+#ifdef SMP
+  double MNK;
+#ifdef DOUBLE
+  int mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  if (order == CblasColMajor) {
+    args.m = M;
+    args.n = N;
+    args.a = (void *)a;
+    args.b = (void *)b;
+    args.lda = lda;
+    args.ldb = ldb;
+
+    if (TransA == CblasNoTrans || TransA == CblasConjNoTrans) transa = 0;
+    if (TransA == CblasTrans   || TransA == CblasConjTrans)   transa = 1;
+    if (TransB == CblasNoTrans || TransB == CblasConjNoTrans) transb = 0;
+    if (TransB == CblasTrans   || TransB == CblasConjTrans)   transb = 1;
+  } else {
+    args.m = N;
+    args.n = M;
+    args.a = (void *)b;
+    args.b = (void *)a;
+    args.lda = ldb;
+    args.ldb = lda;
+
+    if (TransB == CblasNoTrans || TransB == CblasConjNoTrans) transa = 0;
+    if (TransB == CblasTrans   || TransB == CblasConjTrans)   transa = 1;
+    if (TransA == CblasNoTrans || TransA == CblasConjNoTrans) transb = 0;
+    if (TransA == CblasTrans   || TransA == CblasConjTrans)   transb = 1;
+  }
+
+  args.k = K;
+  args.c = (void *)c;
+  args.ldc = ldc;
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+  args.d = (void *)&ep;
+
+  nrowa = args.m;
+  if (transa == 1) nrowa = args.k;
+  nrowb = args.k;
+  if (transb == 1) nrowb = args.n;
+
+  if (epilogue == NULL) {
+    info = 15;
+  } else {
+    ep.bias = -1;
+    if (epilogue -> bias == OpenblasBiasNone) ep.bias = GEMM_BIAS_NONE;
+    if (epilogue -> bias == OpenblasBiasRow)  ep.bias = (order == CblasColMajor) ? GEMM_BIAS_ROW : GEMM_BIAS_COL;
+    if (epilogue -> bias == OpenblasBiasCol)  ep.bias = (order == CblasColMajor) ? GEMM_BIAS_COL : GEMM_BIAS_ROW;
+
+    ep.act = -1;
+    if (epilogue -> activation == OpenblasActNone)  ep.act = GEMM_ACT_NONE;
+    if (epilogue -> activation == OpenblasActReLU)  ep.act = GEMM_ACT_RELU;
+    if (epilogue -> activation == OpenblasActGELU)  ep.act = GEMM_ACT_GELU;
+    if (epilogue -> activation == OpenblasActClamp) ep.act = GEMM_ACT_CLAMP;
+
+    ep.bias_vector = (void *)epilogue -> bias_vector;
+    ep.lo     = epilogue -> clamp_min;
+    ep.hi     = epilogue -> clamp_max;
+    ep.bf16   = epilogue -> bf16_out;
+    ep.ldbf16 = epilogue -> ld_bf16;
+
+    if ((ep.bias < 0) || (ep.act < 0)
+	|| ((ep.bias != GEMM_BIAS_NONE) && (ep.bias_vector == NULL))
+	|| ((ep.act == GEMM_ACT_CLAMP) && !(ep.lo <= ep.hi))
+	|| ((ep.bf16 != NULL) && (ep.ldbf16 < MAX(1, args.m)))) info = 15;
+  }
+
+  if (ldc < MAX(1, args.m)) info = 14;
+  if (args.ldb < MAX(1, nrowb)) info = (order == CblasColMajor) ? 11 : 9;
+  if (args.lda < MAX(1, nrowa)) info = (order == CblasColMajor) ? 9 : 11;
+  if (K < 0) info = 6;
+  if (N < 0) info = 5;
+  if (M < 0) info = 4;
+  if (order == CblasColMajor) {
+    if (transb < 0) info = 3;
+    if (transa < 0) info = 2;
+  } else {
+    if (transa < 0) info = 3;
+    if (transb < 0) info = 2;
+  }
+  if (order != CblasColMajor && order != CblasRowMajor) info = 1;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = (FLOAT *)blas_memory_alloc(0);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  mode |= (transa << BLAS_TRANSA_SHIFT);
+  mode |= (transb << BLAS_TRANSB_SHIFT);
+
+  MNK = (double) args.m * (double) args.n * (double) args.k;
+  if ( MNK <= (SMP_THRESHOLD_MIN  * (double) GEMM_MULTITHREAD_THRESHOLD)  )
+	args.nthreads = 1;
+  else {
+	args.nthreads = num_cpu_avail(3);
+	if (args.nthreads > 1)
+	  args.nthreads = blas_level3_threads(BLAS_MODEL_GEMM, mode, args.m, args.n, args.k,
+					      GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, args.nthreads, NULL);
+  }
+
+  args.common = NULL;
+
+  if (args.nthreads == 1) {
+#endif
+
+    (gemm[(transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+
+    FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_THREADED, args.nthreads);
+
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+    (gemm[4 | (transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+#else
+    GEMM_THREAD(mode, &args, NULL, NULL, gemm[(transb << 1) | transa], sa, sb, args.nthreads);
+#endif
+  }
+#endif
+
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
+
+  IDEBUG_END;
+}
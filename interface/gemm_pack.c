@@ -0,0 +1,313 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/*
+ * cblas_?gemm_pack_get_size (PACK_SIZE), cblas_?gemm_pack (default) and
+ * cblas_?gemm_compute (COMPUTE).
+ *
+ * An operand is packed once into the layout the GEMM kernels consume and can
+ * then be reused by any number of ?gemm_compute calls with the same k. Row
+ * major callers are mapped onto column major by swapping the roles of A and
+ * B, so a row major "A" is stored as the column major "B" operand.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#ifdef DOUBLE
+#define GEMM_PACK_SIZE	dgemm_pack_size
+#define GEMM_PACK_COPY	dgemm_pack_copy
+#define GEMM_PACK_CHECK	dgemm_pack_check
+#define GEMM_PACKED_DRIVER	dgemm_packed
+#ifdef PACK_SIZE
+#define ERROR_NAME "DGEMM_PACK_GET_SIZE "
+#elif defined(COMPUTE)
+#define ERROR_NAME "DGEMM_COMPUTE "
+#else
+#define ERROR_NAME "DGEMM_PACK "
+#endif
+#else
+#define GEMM_PACK_SIZE	sgemm_pack_size
+#define GEMM_PACK_COPY	sgemm_pack_copy
+#define GEMM_PACK_CHECK	sgemm_pack_check
+#define GEMM_PACKED_DRIVER	sgemm_packed
+#ifdef PACK_SIZE
+#define ERROR_NAME "SGEMM_PACK_GET_SIZE "
+#elif defined(COMPUTE)
+#define ERROR_NAME "SGEMM_COMPUTE "
+#else
+#define ERROR_NAME "SGEMM_PACK "
+#endif
+#endif
+
+#ifdef PACK_SIZE
+
+size_t CNAME(enum CBLAS_IDENTIFIER Identifier, blasint M, blasint N, blasint K){
+
+  blasint dim, info = -1;
+  int side = -1;
+  size_t size_a, size_b;
+
+  PRINT_DEBUG_CNAME;
+
+  if (Identifier == CblasAMatrix) side = GEMM_PACK_A;
+  if (Identifier == CblasBMatrix) side = GEMM_PACK_B;
+
+  if (K < 0)    info = 4;
+  if (N < 0)    info = 3;
+  if (M < 0)    info = 2;
+  if (side < 0) info = 1;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return 0;
+  }
+
+  dim = (side == GEMM_PACK_A) ? M : N;
+
+  /* A row major operand is packed in the other role, so reserve room for
+     whichever unroll is wider. */
+  size_a = GEMM_PACK_SIZE(GEMM_PACK_A, dim, dim, K);
+  size_b = GEMM_PACK_SIZE(GEMM_PACK_B, dim, dim, K);
+
+  return MAX(size_a, size_b);
+}
+
+#elif !defined(COMPUTE)
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_IDENTIFIER Identifier, enum CBLAS_TRANSPOSE Trans,
+	   blasint M, blasint N, blasint K, FLOAT alpha, FLOAT *src, blasint ld, FLOAT *dest){
+
+  blas_arg_t args;
+  int side = -1, trans = -1;
+  blasint nrow, info = -1;
+
+  PRINT_DEBUG_CNAME;
+
+  if (Trans == CblasNoTrans)     trans = 0;
+  if (Trans == CblasTrans)       trans = 1;
+  if (Trans == CblasConjNoTrans) trans = 0;
+  if (Trans == CblasConjTrans)   trans = 1;
+
+  if (Identifier == CblasAMatrix) side = GEMM_PACK_A;
+  if (Identifier == CblasBMatrix) side = GEMM_PACK_B;
+
+  args.m = M;
+  args.n = N;
+  args.k = K;
+  args.a = (void *)src;
+  args.lda = ld;
+  args.alpha = (void *)&alpha;
+
+  /* rows of the matrix as it is stored */
+  if (side == GEMM_PACK_A) nrow = (trans == 0) ? M : K;
+  else                     nrow = (trans == 0) ? K : N;
+
+  if (order == CblasRowMajor) {
+    /* A row major operand is the transpose of the column major one, and
+       takes the other role in C^T = B^T * A^T */
+    if (side == GEMM_PACK_A) nrow = (trans == 0) ? K : M;
+    else                     nrow = (trans == 0) ? N : K;
+
+    if (side == GEMM_PACK_A) {
+      side   = GEMM_PACK_B;
+      args.n = M;
+    } else if (side == GEMM_PACK_B) {
+      side   = GEMM_PACK_A;
+      args.m = N;
+    }
+  }
+
+  if (ld < MAX(1, nrow)) info = 9;
+  if (K < 0)             info = 6;
+  if (N < 0)             info = 5;
+  if (M < 0)             info = 4;
+  if (trans < 0)         info = 3;
+  if (side < 0)          info = 2;
+  if (order != CblasColMajor && order != CblasRowMajor) info = 1;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  GEMM_PACK_COPY(&args, side, trans, dest);
+
+  FUNCTION_PROFILE_END(1, args.m * args.k + args.k * args.n, 0);
+
+  IDEBUG_END;
+}
+
+#else
+
+void CNAME(enum CBLAS_ORDER order, blasint TransA, blasint TransB,
+	   blasint M, blasint N, blasint K,
+	   FLOAT *a, blasint lda, FLOAT *b, blasint ldb,
+	   FLOAT beta, FLOAT *c, blasint ldc){
+
+  blas_arg_t args;
+  int transa = -1, transb = -1;
+  blasint nrowa, nrowb, info = -1;
+  BLASLONG q = 0;
+  FLOAT one = ONE;
+  FLOAT *buffer;
+  FLOAT *sa, *sb;
+
+#ifdef SMP
+  int shape;
+#ifdef DOUBLE
+  int mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+  int mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  if (order == CblasColMajor) {
+    args.m = M;
+    args.n = N;
+    args.a = (void *)a;
+    args.b = (void *)b;
+    args.lda = lda;
+    args.ldb = ldb;
+
+    if (TransA == CblasNoTrans || TransA == CblasConjNoTrans) transa = 0;
+    if (TransA == CblasTrans   || TransA == CblasConjTrans)   transa = 1;
+    if (TransA == CblasPacked) transa = GEMM_PACKED;
+    if (TransB == CblasNoTrans || TransB == CblasConjNoTrans) transb = 0;
+    if (TransB == CblasTrans   || TransB == CblasConjTrans)   transb = 1;
+    if (TransB == CblasPacked) transb = GEMM_PACKED;
+  } else {
+    args.m = N;
+    args.n = M;
+    args.a = (void *)b;
+    args.b = (void *)a;
+    args.lda = ldb;
+    args.ldb = lda;
+
+    if (TransB == CblasNoTrans || TransB == CblasConjNoTrans) transa = 0;
+    if (TransB == CblasTrans   || TransB == CblasConjTrans)   transa = 1;
+    if (TransB == CblasPacked) transa = GEMM_PACKED;
+    if (TransA == CblasNoTrans || TransA == CblasConjNoTrans) transb = 0;
+    if (TransA == CblasTrans   || TransA == CblasConjTrans)   transb = 1;
+    if (TransA == CblasPacked) transb = GEMM_PACKED;
+  }
+
+  args.k = K;
+  args.c = (void *)c;
+  args.ldc = ldc;
+  args.alpha = (void *)&one;
+  args.beta  = (void *)&beta;
+
+  nrowa = args.m;
+  if (transa == 1) nrowa = args.k;
+  nrowb = args.k;
+  if (transb == 1) nrowb = args.n;
+
+  if (ldc < MAX(1, args.m)) info = 13;
+
+  if (transb == GEMM_PACKED) {
+    if (GEMM_PACK_CHECK(args.b, GEMM_PACK_B, args.n, args.k, &q)) info = (order == CblasColMajor) ? 9 : 7;
+  } else {
+    if (args.ldb < MAX(1, nrowb)) info = (order == CblasColMajor) ? 10 : 8;
+  }
+
+  if (transa == GEMM_PACKED) {
+    if (GEMM_PACK_CHECK(args.a, GEMM_PACK_A, args.m, args.k, &q)) info = (order == CblasColMajor) ? 7 : 9;
+  } else {
+    if (args.lda < MAX(1, nrowa)) info = (order == CblasColMajor) ? 8 : 10;
+  }
+
+  if (K < 0) info = 6;
+  if (N < 0) info = 5;
+  if (M < 0) info = 4;
+  if (order == CblasColMajor) {
+    if (transb < 0) info = 3;
+    if (transa < 0) info = 2;
+  } else {
+    if (transa < 0) info = 3;
+    if (transb < 0) info = 2;
+  }
+  if (order != CblasColMajor && order != CblasRowMajor) info = 1;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = (FLOAT *)blas_memory_alloc(0);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  /* the packed driver divides only the dimension of the operand that is
+     packed per call, and its threads do not share panels */
+  if (transa == GEMM_PACKED && transb != GEMM_PACKED) shape = BLAS_MODEL_SPLIT_N;
+  else if (transb == GEMM_PACKED && transa != GEMM_PACKED) shape = BLAS_MODEL_SPLIT_M;
+  else shape = (args.m >= args.n) ? BLAS_MODEL_SPLIT_M : BLAS_MODEL_SPLIT_N;
+
+  args.nthreads = num_cpu_avail(3);
+  if (args.nthreads > 1)
+    args.nthreads = blas_level3_threads(shape, mode, args.m, args.n, args.k,
+					GEMM_UNROLL_M, GEMM_UNROLL_N, q ? q : GEMM_Q, args.nthreads, NULL);
+
+  args.common = NULL;
+
+  FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_PACKED | (args.nthreads > 1 ? OPENBLAS_PROFILE_THREADED : 0), args.nthreads);
+#else
+  FUNCTION_PROFILE_PATH(OPENBLAS_PROFILE_PACKED, 1);
+#endif
+
+  GEMM_PACKED_DRIVER(&args, transa, transb, sa, sb);
+
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
+
+  IDEBUG_END;
+}
+
+#endif
@@ -0,0 +1,199 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+/*
+ * cblas_gemm_s8u8s32: C := alpha * (op(A) + ao) * (op(B) + bo) + beta * C + co
+ *
+ * A is signed and B unsigned 8 bit, products are accumulated in int32 and
+ * the scaled result is rounded to nearest and saturated to int32.  co holds
+ * one value (CblasFixOffset), one per row (CblasColOffset) or one per column
+ * (CblasRowOffset) of C.  Row major C is handled by storage strides, so op(A)
+ * keeps the role of the left operand in both orders.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+#define ERROR_NAME "GEMM_S8U8S32 "
+
+#define SMP_THRESHOLD_MIN 65536.0
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+#if defined(__linux__) && defined(__x86_64__) && (defined(DYNAMIC_ARCH) || defined(SAPPHIRERAPIDS))
+#define XFEATURE_XTILEDATA 18
+#define ARCH_REQ_XCOMP_PERM 0x1023
+static int openblas_amxtile_permission = 0;
+static int init_amxtile_permission() {
+  long status =
+      syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA);
+  if (status != 0) {
+    fprintf(stderr, "XTILEDATA permission not granted in your device(Linux, "
+                    "Intel Sapphire Rapids), skip gemm_s8u8s32 calculation\n");
+    return -1;
+  }
+  openblas_amxtile_permission = 1;
+  return 0;
+}
+#endif
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   enum CBLAS_OFFSET OffsetC, blasint M, blasint N, blasint K, float alpha,
+	   int8_t *a, blasint lda, int8_t ao, uint8_t *b, blasint ldb,
+	   int8_t bo, float beta, int32_t *c, blasint ldc, int32_t *co){
+
+  blas_arg_t args;
+  i8gemm_opt_t opt;
+  int transa = -1, transb = -1, offsetc = -1;
+  blasint nrowa, nrowb, nrowc, info = -1;
+  void *buffer;
+  void *sa, *sb;
+
+#ifdef SMP
+  double MNK;
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  if (TransA == CblasNoTrans || TransA == CblasConjNoTrans) transa = 0;
+  if (TransA == CblasTrans   || TransA == CblasConjTrans)   transa = 1;
+  if (TransB == CblasNoTrans || TransB == CblasConjNoTrans) transb = 0;
+  if (TransB == CblasTrans   || TransB == CblasConjTrans)   transb = 1;
+
+  if (OffsetC == CblasFixOffset) offsetc = I8GEMM_CO_FIX;
+  if (OffsetC == CblasColOffset) offsetc = I8GEMM_CO_COL;
+  if (OffsetC == CblasRowOffset) offsetc = I8GEMM_CO_ROW;
+
+  args.m = M;
+  args.n = N;
+  args.k = K;
+  args.a = (void *)a;
+  args.b = (void *)b;
+  args.c = (void *)c;
+  args.d = (void *)co;
+  args.lda = lda;
+  args.ldb = ldb;
+  args.ldc = ldc;
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+
+  /* a row major matrix is the column major transpose */
+  if (order == CblasRowMajor) {
+    if (transa >= 0) transa ^= 1;
+    if (transb >= 0) transb ^= 1;
+    opt.c_rs = ldc;
+    opt.c_cs = 1;
+  } else {
+    opt.c_rs = 1;
+    opt.c_cs = ldc;
+  }
+
+  nrowa = (transa == 1) ? K : M;
+  nrowb = (transb == 1) ? N : K;
+  nrowc = (order == CblasRowMajor) ? N : M;
+
+  if (ldc < MAX(1, nrowc)) info = 17;
+  if (ldb < MAX(1, nrowb)) info = 13;
+  if (lda < MAX(1, nrowa)) info = 10;
+  if (K < 0)        info = 7;
+  if (N < 0)        info = 6;
+  if (M < 0)        info = 5;
+  if (offsetc < 0)  info = 4;
+  if (transb < 0)   info = 3;
+  if (transa < 0)   info = 2;
+  if (order != CblasColMajor && order != CblasRowMajor) info = 1;
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+#if defined(__linux__) && defined(__x86_64__)
+#if defined(DYNAMIC_ARCH)
+  if (gotoblas->need_amxtile_permission &&
+      openblas_amxtile_permission == 0 && init_amxtile_permission() == -1) {
+    return;
+  }
+#endif
+#if !defined(DYNAMIC_ARCH) && defined(SAPPHIRERAPIDS)
+  if (openblas_amxtile_permission == 0 && init_amxtile_permission() == -1) {
+    return;
+  }
+#endif
+#endif
+
+  opt.transa  = transa;
+  opt.transb  = transb;
+  opt.offsetc = offsetc;
+  opt.ao = ao;
+  opt.bo = bo;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = blas_memory_alloc(0);
+
+  sa = (void *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = NULL;
+
+#ifdef SMP
+  MNK = (double) args.m * (double) args.n * (double) args.k;
+  if ( MNK <= (SMP_THRESHOLD_MIN  * (double) GEMM_MULTITHREAD_THRESHOLD)  )
+	args.nthreads = 1;
+  else {
+	args.nthreads = num_cpu_avail(3);
+	if (MNK/args.nthreads < SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD)
+		args.nthreads = MNK/(SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD);
+  }
+
+  args.common = NULL;
+
+  FUNCTION_PROFILE_PATH(args.nthreads > 1 ? OPENBLAS_PROFILE_THREADED : 0, args.nthreads);
+#else
+  FUNCTION_PROFILE_PATH(0, 1);
+#endif
+
+  gemm_s8u8s32(&args, &opt, sa, sb);
+
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
+
+  IDEBUG_END;
+}
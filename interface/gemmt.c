@@ -42,8 +42,6 @@
 #define ERROR_NAME "QGEMMT "
 #elif defined(DOUBLE)
 #define ERROR_NAME "DGEMMT "
-#elif defined(BFLOAT16)
-#define ERROR_NAME "SBGEMMT "
 #else
 #define ERROR_NAME "SGEMMT "
 #endif
@@ -62,6 +60,43 @@
 #define GEMM_MULTITHREAD_THRESHOLD 4
 #endif
 
+/* Indexed by (uplo << 2 * TRANS_SHIFT) | (transb << TRANS_SHIFT) | transa */
+#ifndef COMPLEX
+#define TRANS_SHIFT 1
+#else
+#define TRANS_SHIFT 2
+#endif
+
+static int (*gemmt[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+#ifndef COMPLEX
+  GEMMT_UNN, GEMMT_UTN, GEMMT_UNT, GEMMT_UTT,
+  GEMMT_LNN, GEMMT_LTN, GEMMT_LNT, GEMMT_LTT,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  GEMMT_THREAD_UNN, GEMMT_THREAD_UTN, GEMMT_THREAD_UNT, GEMMT_THREAD_UTT,
+  GEMMT_THREAD_LNN, GEMMT_THREAD_LTN, GEMMT_THREAD_LNT, GEMMT_THREAD_LTT,
+#endif
+#else
+  GEMMT_UNN, GEMMT_UTN, GEMMT_URN, GEMMT_UCN,
+  GEMMT_UNT, GEMMT_UTT, GEMMT_URT, GEMMT_UCT,
+  GEMMT_UNR, GEMMT_UTR, GEMMT_URR, GEMMT_UCR,
+  GEMMT_UNC, GEMMT_UTC, GEMMT_URC, GEMMT_UCC,
+  GEMMT_LNN, GEMMT_LTN, GEMMT_LRN, GEMMT_LCN,
+  GEMMT_LNT, GEMMT_LTT, GEMMT_LRT, GEMMT_LCT,
+  GEMMT_LNR, GEMMT_LTR, GEMMT_LRR, GEMMT_LCR,
+  GEMMT_LNC, GEMMT_LTC, GEMMT_LRC, GEMMT_LCC,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  GEMMT_THREAD_UNN, GEMMT_THREAD_UTN, GEMMT_THREAD_URN, GEMMT_THREAD_UCN,
+  GEMMT_THREAD_UNT, GEMMT_THREAD_UTT, GEMMT_THREAD_URT, GEMMT_THREAD_UCT,
+  GEMMT_THREAD_UNR, GEMMT_THREAD_UTR, GEMMT_THREAD_URR, GEMMT_THREAD_UCR,
+  GEMMT_THREAD_UNC, GEMMT_THREAD_UTC, GEMMT_THREAD_URC, GEMMT_THREAD_UCC,
+  GEMMT_THREAD_LNN, GEMMT_THREAD_LTN, GEMMT_THREAD_LRN, GEMMT_THREAD_LCN,
+  GEMMT_THREAD_LNT, GEMMT_THREAD_LTT, GEMMT_THREAD_LRT, GEMMT_THREAD_LCT,
+  GEMMT_THREAD_LNR, GEMMT_THREAD_LTR, GEMMT_THREAD_LRR, GEMMT_THREAD_LCR,
+  GEMMT_THREAD_LNC, GEMMT_THREAD_LTC, GEMMT_THREAD_LRC, GEMMT_THREAD_LCC,
+#endif
+#endif
+};
+
 #ifndef CBLAS
 
 void NAME(char *UPLO, char *TRANSA, char *TRANSB,
@@ -71,6 +106,7 @@ void NAME(char *UPLO, char *TRANSA, char *TRANSB,
 	  IFLOAT * b, blasint * ldB, FLOAT * Beta, FLOAT * c, blasint * ldC)
 {
 
+	blas_arg_t args;
 	blasint m, k;
 	blasint lda, ldb, ldc;
 	int transa, transb, uplo;
@@ -78,35 +114,12 @@ void NAME(char *UPLO, char *TRANSA, char *TRANSB,
 
 	char transA, transB, Uplo;
 	blasint nrowa, nrowb;
-#if defined(COMPLEX)
-	blasint ncolb;
-#endif
-	IFLOAT *buffer;
-	IFLOAT *aa, *bb;
-	FLOAT *cc;
-#if defined(COMPLEX)
-	FLOAT alpha_r, alpha_i, beta_r, beta_i;
-#else
-	FLOAT alpha, beta;
-#endif
 
 	PRINT_DEBUG_NAME;
 
 	m = *M;
 	k = *K;
 
-#if defined(COMPLEX)
-	FLOAT *alpha = Alpha;
-	alpha_r = *(Alpha + 0);
-	alpha_i = *(Alpha + 1);
-
-	beta_r = *(Beta + 0);
-	beta_i = *(Beta + 1);
-#else
-	alpha = *Alpha;
-	beta = *Beta;
-#endif
-
 	lda = *ldA;
 	ldb = *ldB;
 	ldc = *ldC;
@@ -162,15 +175,7 @@ void NAME(char *UPLO, char *TRANSA, char *TRANSB,
 	nrowa = m;
 	if (transa & 1) nrowa = k;
 	nrowb = k;
-#if defined(COMPLEX)
-	ncolb = m;
-#endif
-	if (transb & 1) {
-		nrowb = m;
-#if defined(COMPLEX)
-		ncolb = k;
-#endif
-	}
+	if (transb & 1) nrowb = m;
 
 	info = 0;
 
@@ -195,6 +200,9 @@ void NAME(char *UPLO, char *TRANSA, char *TRANSB,
 		BLASFUNC(xerbla) (ERROR_NAME, &info, sizeof(ERROR_NAME));
 		return;
 	}
+
+	args.alpha = (void *)Alpha;
+	args.beta  = (void *)Beta;
 #else
 
 void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
@@ -216,16 +224,11 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 	FLOAT *B = (FLOAT *) vb;
 	FLOAT *c = (FLOAT *) vc;
 #endif
-	FLOAT *aa, *bb, *cc;
-
+	blas_arg_t args;
 	int transa, transb, uplo;
 	blasint info;
 	blasint lda, ldb;
 	FLOAT *a, *b;
-#if defined(COMPLEX)
-	blasint nrowb, ncolb;
-#endif
-	XFLOAT *buffer;
 
 	PRINT_DEBUG_CNAME;
 
@@ -276,22 +279,11 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
 		info = -1;
 
-		blasint nrowa;
-#if !defined(COMPLEX)
-		blasint nrowb;
-#endif
+		blasint nrowa, nrowb;
 		nrowa = m;
 		if (transa & 1) nrowa = k;
 		nrowb = k;
-#if defined(COMPLEX)
-		ncolb = m;
-#endif
-		if (transb & 1) {
-			nrowb = m;
-#if defined(COMPLEX)
-			ncolb = k;
-#endif
-		}
+		if (transb & 1) nrowb = m;
 
 		if (ldc < MAX(1, m))
 			info = 13;
@@ -355,23 +347,11 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
 		info = -1;
 
-		blasint ncola; 
-#if !defined(COMPLEX)
-		blasint ncolb;
-#endif
+		blasint ncola, ncolb;
 		ncola = m;
 		if (transa & 1) ncola = k;
 		ncolb = k;
-#if defined(COMPLEX)
-		nrowb = m;
-#endif
-
-		if (transb & 1) {
-#if defined(COMPLEX)
-			nrowb = k;
-#endif
-			ncolb = m;
-		}
+		if (transb & 1) ncolb = m;
 
 		if (ldc < MAX(1,m))
 			info = 13;
@@ -395,274 +375,106 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 		BLASFUNC(xerbla) (ERROR_NAME, &info, sizeof(ERROR_NAME));
 		return;
 	}
-#if defined(COMPLEX)
-	FLOAT alpha_r = *(alpha + 0);
-	FLOAT alpha_i = *(alpha + 1);
-
-	FLOAT beta_r = *(beta + 0);
-	FLOAT beta_i = *(beta + 1);
-#endif
 
+#ifndef COMPLEX
+	args.alpha = (void *)&alpha;
+	args.beta  = (void *)&beta;
+#else
+	args.alpha = (void *)alpha;
+	args.beta  = (void *)beta;
 #endif
-	int buffer_size;
-	blasint l;
-	blasint i, j;
 
-#ifdef SMP
-	int nthreads;
 #endif
-
-#if defined(COMPLEX)
+	FLOAT *buffer;
+	FLOAT *sa, *sb;
+	int idx;
 
 #ifdef SMP
-	static int (*gemv_thread[]) (BLASLONG, BLASLONG, FLOAT *, FLOAT *,
-				     BLASLONG, FLOAT *, BLASLONG, FLOAT *,
-				     BLASLONG, FLOAT *, int) = {
+	double NNK;
+#ifndef COMPLEX
 #ifdef XDOUBLE
-		xgemv_thread_n, xgemv_thread_t, xgemv_thread_r, xgemv_thread_c,
-		    xgemv_thread_o, xgemv_thread_u, xgemv_thread_s,
-		    xgemv_thread_d,
-#elif defined DOUBLE
-		zgemv_thread_n, zgemv_thread_t, zgemv_thread_r, zgemv_thread_c,
-		    zgemv_thread_o, zgemv_thread_u, zgemv_thread_s,
-		    zgemv_thread_d,
+	int mode = BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+	int mode = BLAS_DOUBLE | BLAS_REAL;
 #else
-		cgemv_thread_n, cgemv_thread_t, cgemv_thread_r, cgemv_thread_c,
-		    cgemv_thread_o, cgemv_thread_u, cgemv_thread_s,
-		    cgemv_thread_d,
-#endif
-	};
+	int mode = BLAS_SINGLE | BLAS_REAL;
 #endif
-
-	int (*gemv[]) (BLASLONG, BLASLONG, BLASLONG, FLOAT, FLOAT, FLOAT *,
-		       BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG,
-		       FLOAT *) = {
-	GEMV_N, GEMV_T, GEMV_R, GEMV_C, GEMV_O, GEMV_U, GEMV_S, GEMV_D,};
-
 #else
-
-#ifdef SMP
-	static int (*gemv_thread[]) (BLASLONG, BLASLONG, FLOAT, FLOAT *,
-				     BLASLONG, FLOAT *, BLASLONG, FLOAT *,
-				     BLASLONG, FLOAT *, int) = {
 #ifdef XDOUBLE
-		qgemv_thread_n, qgemv_thread_t,
-#elif defined DOUBLE
-		dgemv_thread_n, dgemv_thread_t,
+	int mode = BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+	int mode = BLAS_DOUBLE | BLAS_COMPLEX;
 #else
-		sgemv_thread_n, sgemv_thread_t,
+	int mode = BLAS_SINGLE | BLAS_COMPLEX;
 #endif
-	};
 #endif
-	int (*gemv[]) (BLASLONG, BLASLONG, BLASLONG, FLOAT, FLOAT *, BLASLONG,
-		       FLOAT *, BLASLONG, FLOAT *, BLASLONG, FLOAT *) = {
-	GEMV_N, GEMV_T,};
-
 #endif
 
 	if (m == 0)
 		return;
 
-	IDEBUG_START;
-
-#if defined(COMPLEX)
-	if (transb > 1){
-#ifndef CBLAS
-		IMATCOPY_K_CNC(nrowb, ncolb, (FLOAT)(1.0), (FLOAT)(0.0), b, ldb);
-#else
-		if (order == CblasColMajor)
-			IMATCOPY_K_CNC(nrowb, ncolb, (FLOAT)(1.0), (FLOAT)(0.0), b, ldb);
-		if (order == CblasRowMajor)
-			IMATCOPY_K_RNC(nrowb, ncolb, (FLOAT)(1.0), (FLOAT)(0.0), b, ldb);
-#endif
-	}
-#endif
+	args.m = m;
+	args.n = m;
+	args.k = k;
 
-	const blasint incb = ((transb & 1) == 0) ? 1 : ldb;
-
-	if (uplo == 1) {
-		for (i = 0; i < m; i++) {
-			j = m - i;
-
-			l = j;
-#if defined(COMPLEX)
-			aa = a + i * 2;
-			bb = b + i * ldb * 2;
-			if (transa & 1) {
-				aa = a + lda * i * 2;
-			}
-			if (transb & 1)
-				bb = b + i * 2;
-			cc = c + i * 2 * ldc + i * 2;
-#else
-			aa = a + i;
-			bb = b + i * ldb;
-			if (transa & 1) {
-				aa = a + lda * i;
-			}
-			if (transb & 1)
-				bb = b + i;
-			cc = c + i * ldc + i;
-#endif
+	args.a = (void *)a;
+	args.b = (void *)b;
+	args.c = (void *)c;
 
-#if defined(COMPLEX)
-			if (beta_r != ONE || beta_i != ZERO)
-				SCAL_K(l, 0, 0, beta_r, beta_i, cc, 1, NULL, 0,
-				       NULL, 0);
+	args.lda = lda;
+	args.ldb = ldb;
+	args.ldc = ldc;
 
-			if (alpha_r == ZERO && alpha_i == ZERO)
-				continue;
-#else
-			if (beta != ONE)
-				SCAL_K(l, 0, 0, beta, cc, 1, NULL, 0, NULL, 0);
+	idx = (uplo << (2 * TRANS_SHIFT)) | (transb << TRANS_SHIFT) | transa;
 
-			if (alpha == ZERO)
-				continue;
-#endif
+	IDEBUG_START;
 
-			IDEBUG_START;
+	buffer = (FLOAT *)blas_memory_alloc(0);
 
-			buffer_size = 2 * (j + k) + 128 / sizeof(FLOAT);
-#ifdef WINDOWS_ABI
-			buffer_size += 160 / sizeof(FLOAT);
-#endif
-			// for alignment
-			buffer_size = (buffer_size + 3) & ~3;
-			STACK_ALLOC(buffer_size, IFLOAT, buffer);
+	sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+	sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
 
 #ifdef SMP
-
-			if (1L * j * k < 2304L * GEMM_MULTITHREAD_THRESHOLD)
-				nthreads = 1;
-			else
-				nthreads = num_cpu_avail(2);
-
-			if (nthreads == 1) {
+#ifdef USE_SIMPLE_THREADED_LEVEL3
+	mode |= (transa << BLAS_TRANSA_SHIFT);
+	mode |= (transb << BLAS_TRANSB_SHIFT);
+	mode |= (uplo << BLAS_UPLO_SHIFT);
 #endif
 
-#if defined(COMPLEX)
-				if (!(transa & 1))
-				(gemv[(int)transa]) (j, k, 0, alpha_r, alpha_i,
-						     aa, lda, bb, incb, cc, 1,
-						     buffer);
-				else
-				(gemv[(int)transa]) (k, j, 0, alpha_r, alpha_i,
-						     aa, lda, bb, incb, cc, 1,
-						     buffer);
-#else
-				if (!(transa & 1))
-				(gemv[(int)transa]) (j, k, 0, alpha, aa, lda,
-						     bb, incb, cc, 1, buffer);
-				else
-				(gemv[(int)transa]) (k, j, 0, alpha, aa, lda,
-						     bb, incb, cc, 1, buffer);
-#endif
-#ifdef SMP
-			} else {
-				if (!(transa & 1))
-				(gemv_thread[(int)transa]) (j, k, alpha, aa,
-							    lda, bb, incb, cc,
-							    1, buffer,
-							    nthreads);
-				else
-				(gemv_thread[(int)transa]) (k, j, alpha, aa,
-							    lda, bb, incb, cc,
-							    1, buffer,
-							    nthreads);
-
-			}
-#endif
+	args.common = NULL;
 
-			STACK_FREE(buffer);
-		}
+	NNK = (double)(args.n + 1) * (double)args.n * (double)args.k;
+	if (NNK <= (SMP_THRESHOLD_MIN * GEMM_MULTITHREAD_THRESHOLD)) {
+		args.nthreads = 1;
 	} else {
+		args.nthreads = num_cpu_avail(3);
+		if (args.nthreads > 1)
+			args.nthreads = blas_level3_threads(BLAS_MODEL_SYRK, mode, args.n, args.n, args.k,
+							    GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, args.nthreads, NULL);
+	}
 
-		for (i = 0; i < m; i++) {
-			j = i + 1;
-
-			l = j;
-#if defined COMPLEX
-			bb = b + i * ldb * 2;
-			if (transb & 1) {
-				bb = b + i * 2;
-			}
-			cc = c + i * 2 * ldc;
-#else
-			bb = b + i * ldb;
-			if (transb & 1) {
-				bb = b + i;
-			}
-			cc = c + i * ldc;
-#endif
-
-#if defined(COMPLEX)
-			if (beta_r != ONE || beta_i != ZERO)
-				SCAL_K(l, 0, 0, beta_r, beta_i, cc, 1, NULL, 0,
-				       NULL, 0);
-
-			if (alpha_r == ZERO && alpha_i == ZERO)
-				continue;
-#else
-			if (beta != ONE)
-				SCAL_K(l, 0, 0, beta, cc, 1, NULL, 0, NULL, 0);
-
-			if (alpha == ZERO)
-				continue;
+	if (args.nthreads == 1) {
 #endif
-			IDEBUG_START;
 
-			buffer_size = 2 * (j + k) + 128 / sizeof(FLOAT);
-#ifdef WINDOWS_ABI
-			buffer_size += 160 / sizeof(FLOAT);
-#endif
-			// for alignment
-			buffer_size = (buffer_size + 3) & ~3;
-			STACK_ALLOC(buffer_size, IFLOAT, buffer);
+		(gemmt[idx])(&args, NULL, NULL, sa, sb, 0);
 
 #ifdef SMP
+	} else {
 
-			if (1L * j * k < 2304L * GEMM_MULTITHREAD_THRESHOLD)
-				nthreads = 1;
-			else
-				nthreads = num_cpu_avail(2);
+#ifndef USE_SIMPLE_THREADED_LEVEL3
 
-			if (nthreads == 1) {
-#endif
+		(gemmt[(2 << (2 * TRANS_SHIFT)) | idx])(&args, NULL, NULL, sa, sb, 0);
 
-#if defined(COMPLEX)
-				if (!(transa & 1))
-				(gemv[(int)transa]) (j, k, 0, alpha_r, alpha_i,
-						     a, lda, bb, incb, cc, 1,
-						     buffer);
-				else
-				(gemv[(int)transa]) (k, j, 0, alpha_r, alpha_i,
-						     a, lda, bb, incb, cc, 1,
-						     buffer);
 #else
-				if (!(transa & 1))
-				(gemv[(int)transa]) (j, k, 0, alpha, a, lda, bb,
-						     incb, cc, 1, buffer);
-				else
-				(gemv[(int)transa]) (k, j, 0, alpha, a, lda, bb,
-						     incb, cc, 1, buffer);
-#endif
 
-#ifdef SMP
-			} else {
-				if (!(transa & 1))
-				(gemv_thread[(int)transa]) (j, k, alpha, a, lda,
-							    bb, incb, cc, 1,
-							    buffer, nthreads);
-				else
-				(gemv_thread[(int)transa]) (k, j, alpha, a, lda,
-							    bb, incb, cc, 1,
-							    buffer, nthreads);
-			}
+		syrk_thread(mode, &args, NULL, NULL, gemmt[idx], sa, sb, args.nthreads);
+
 #endif
 
-			STACK_FREE(buffer);
-		}
 	}
+#endif
+
+	blas_memory_free(buffer);
 
 	IDEBUG_END;
 
@@ -185,6 +185,7 @@ void CNAME(enum CBLAS_ORDER order,
   else
     nthreads = 1;
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
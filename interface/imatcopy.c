@@ -51,8 +51,176 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #undef malloc
 #undef free
 
-/* Enables the New IMATCOPY code with inplace operation if lda == ldb   */
-#define NEW_IMATCOPY
+/* Tiles of the square in-place transpose */
+#define MATCOPY_TILE 64
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+/*
+   Everything works on the column major view of the matrix, a row major
+   matrix being the column major matrix of its transpose.
+
+   A layout change without transpose moves the columns towards their new
+   place in an order that never overwrites a value that is still to be
+   read. A square transpose with lda == ldb swaps pairs of tiles across
+   the diagonal. Neither needs a copy of the matrix.
+
+   Any other transpose goes through a scratch copy of the matrix: the
+   transpose is written there in tiles, then copied back to leading
+   dimension ldb. Both passes are split between threads. Following the
+   cycles of the permutation in place would save the copy, but it is
+   serial and touches one element per cache line.
+*/
+
+/* A := alpha*A for the columns range_n, with lda == ldb */
+static int imatcopy_n(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	BLASLONG n_from = 0, n_to = args -> n;
+
+	if (range_n) {
+		n_from = range_n[0];
+		n_to   = range_n[1];
+	}
+
+	IMATCOPY_K_CN(args -> m, n_to - n_from, *(FLOAT *)args -> alpha,
+		      (FLOAT *)args -> a + n_from * args -> lda, args -> lda);
+	return 0;
+}
+
+/* Transposes the tile column j of the square matrix and swaps its tiles */
+/* above the diagonal with the ones of tile row j.                        */
+static void imatcopy_t_tiles(BLASLONG n, FLOAT alpha, FLOAT *a, BLASLONG lda, BLASLONG js)
+{
+	BLASLONG is, i, j, min_i, min_j;
+	FLOAT *x, *y, t;
+
+	min_j = MIN(n - js, MATCOPY_TILE);
+
+	IMATCOPY_K_CT(min_j, min_j, alpha, a + js + js * lda, lda);
+
+	for (is = 0; is < js; is += MATCOPY_TILE) {
+		min_i = MIN(js - is, MATCOPY_TILE);
+		x = a + is + js * lda;
+		y = a + js + is * lda;
+		for (j = 0; j < min_j; j++) {
+			for (i = 0; i < min_i; i++) {
+				t = x[i + j * lda];
+				x[i + j * lda] = alpha * y[j + i * lda];
+				y[j + i * lda] = alpha * t;
+			}
+		}
+	}
+}
+
+/* A := alpha*A**T for the pairs of tile columns range_n. Column j is    */
+/* paired with the last but j, so that every pair has the same work.     */
+static int imatcopy_t(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	BLASLONG n = args -> m, tiles = (n + MATCOPY_TILE - 1) / MATCOPY_TILE;
+	BLASLONG n_from = 0, n_to = args -> n, j;
+
+	if (range_n) {
+		n_from = range_n[0];
+		n_to   = range_n[1];
+	}
+
+	for (j = n_from; j < n_to; j++) {
+		imatcopy_t_tiles(n, *(FLOAT *)args -> alpha, (FLOAT *)args -> a, args -> lda, j * MATCOPY_TILE);
+		if (tiles - 1 - j != j)
+			imatcopy_t_tiles(n, *(FLOAT *)args -> alpha, (FLOAT *)args -> a, args -> lda, (tiles - 1 - j) * MATCOPY_TILE);
+	}
+	return 0;
+}
+
+/* Moves a rows x cols matrix from leading dimension lda to ldb, scaled */
+static void imatcopy_move(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda, BLASLONG ldb)
+{
+	BLASLONG i, j;
+	FLOAT *src, *dst;
+
+	if (ldb <= lda) {
+		for (j = 0; j < cols; j++) {
+			src = a + j * lda;
+			dst = a + j * ldb;
+			for (i = 0; i < rows; i++) dst[i] = alpha * src[i];
+		}
+	} else {
+		for (j = cols - 1; j >= 0; j--) {
+			src = a + j * lda;
+			dst = a + j * ldb;
+			for (i = rows - 1; i >= 0; i--) dst[i] = alpha * src[i];
+		}
+	}
+}
+
+/* B := alpha*A**T for the columns range_n of A, in tiles */
+static int imatcopy_tt(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	BLASLONG n_from = 0, n_to = args -> n;
+	BLASLONG m = args -> m, lda = args -> lda, ldb = args -> ldb;
+	BLASLONG is, js, min_i, min_j;
+	FLOAT *a = (FLOAT *)args -> a;
+	FLOAT *b = (FLOAT *)args -> b;
+
+	if (range_n) {
+		n_from = range_n[0];
+		n_to   = range_n[1];
+	}
+
+	for (js = n_from; js < n_to; js += MATCOPY_TILE) {
+		min_j = MIN(n_to - js, MATCOPY_TILE);
+		for (is = 0; is < m; is += MATCOPY_TILE) {
+			min_i = MIN(m - is, MATCOPY_TILE);
+			OMATCOPY_K_CT(min_i, min_j, *(FLOAT *)args -> alpha,
+				      a + is + js * lda, lda, b + js + is * ldb, ldb);
+		}
+	}
+	return 0;
+}
+
+/* B := A for the columns range_n of A */
+static int imatcopy_back(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	BLASLONG n_from = 0, n_to = args -> n;
+
+	if (range_n) {
+		n_from = range_n[0];
+		n_to   = range_n[1];
+	}
+
+	OMATCOPY_K_CN(args -> m, n_to - n_from, ONE,
+		      (FLOAT *)args -> a + n_from * args -> lda, args -> lda,
+		      (FLOAT *)args -> b + n_from * args -> ldb, args -> ldb);
+	return 0;
+}
+
+/* Runs routine over the columns of args, on several threads for a large */
+/* matrix of size elements.                                               */
+static void imatcopy_run(blas_arg_t *args, int (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG), BLASLONG size)
+{
+#ifdef SMP
+	int nthreads, mode;
+
+	if ( size < 65536L * GEMM_MULTITHREAD_THRESHOLD )
+		nthreads = 1;
+	else
+		nthreads = num_cpu_avail(2);
+
+	if (nthreads > 1) {
+#ifdef DOUBLE
+		mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+		mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+		gemm_thread_n(mode, args, NULL, NULL, routine, NULL, NULL, nthreads);
+		return;
+	}
+#endif
+
+	routine(args, NULL, NULL, NULL, NULL, 0);
+}
 
 #ifndef CBLAS
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, blasint *ldb)
@@ -61,8 +229,10 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
-	FLOAT *b;
-	size_t msize;
+	BLASLONG m, n, t, i, j;
+	blas_arg_t args;
+	int (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+	FLOAT one = ONE, *b;
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -81,8 +251,10 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 {
 	int order=-1,trans=-1;
 	blasint info = -1;
-	FLOAT *b;
-	size_t msize;
+	BLASLONG m, n, t, i, j;
+	blas_arg_t args;
+	int (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+	FLOAT one = ONE, *b;
 	blasint *lda, *ldb, *rows, *cols; 
 	FLOAT *alpha; 
 
@@ -123,79 +295,80 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 
 	if ((*rows == 0) || (*cols == 0)) return;
 
-#ifdef NEW_IMATCOPY
-    if ( *lda == *ldb ) {
-        if ( order == BlasColMajor )
-        {
-            if ( trans == BlasNoTrans )
-            {
-                IMATCOPY_K_CN(*rows, *cols, *alpha, a, *lda );
-                return;
-            }
-            else if ( *rows == *cols )
-            {
-                IMATCOPY_K_CT(*rows, *cols, *alpha, a, *lda );
-                return;
-            }
-        }
-        else
-        {
-            if ( trans == BlasNoTrans )
-            {
-                IMATCOPY_K_RN(*rows, *cols, *alpha, a, *lda );
-                return;
-            }
-            else if ( *rows == *cols )
-            {
-                IMATCOPY_K_RT(*rows, *cols, *alpha, a, *lda );
-                return;
-            }
-        }
-    }
-#endif
-
-	if ( *rows >  *cols )
-            msize = (size_t)(*rows) * (*ldb)  * sizeof(FLOAT);
-    else
-            msize = (size_t)(*cols) * (*ldb)  * sizeof(FLOAT);
+	/* the column major view */
+	if ( order == BlasColMajor )
+	{
+		m = *rows;
+		n = *cols;
+	}
+	else
+	{
+		m = *cols;
+		n = *rows;
+	}
 
-	b = malloc(msize);
-	if ( b == NULL )
+	if ( *alpha == ZERO )
 	{
-		printf("Memory alloc failed in imatcopy\n");
-		exit(1);
+		if ( trans == BlasTrans ) { t = m; m = n; n = t; }
+		for (j = 0; j < n; j++)
+			for (i = 0; i < m; i++) a[i + j * *ldb] = ZERO;
+		return;
 	}
 
-	if ( order == BlasColMajor )
+	args.m = m;
+	args.n = n;
+	args.a = (void *)a;
+	args.lda = *lda;
+	args.alpha = (void *)alpha;
+	routine = NULL;
+
+	if ( trans == BlasNoTrans )
 	{
-		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_CN(*rows, *cols, *alpha, a, *lda, b, *rows );
-			OMATCOPY_K_CN(*rows, *cols, (FLOAT) 1.0 , b, *rows, a, *ldb );
-		}
-		else
+		if ( *lda != *ldb )
 		{
-			OMATCOPY_K_CT(*rows, *cols, *alpha, a, *lda, b, *cols );
-			OMATCOPY_K_CN(*cols, *rows, (FLOAT) 1.0, b, *cols, a, *ldb );
+			imatcopy_move(m, n, *alpha, a, *lda, *ldb);
+			return;
 		}
+		routine = imatcopy_n;
 	}
-	else
+	else if ( m == n && *lda == *ldb )
 	{
-		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_RN(*rows, *cols, *alpha, a, *lda, b, *cols );
-			OMATCOPY_K_RN(*rows, *cols, (FLOAT) 1.0, b, *cols, a, *ldb );
-		}
-		else
+		/* pairs of tile columns */
+		args.n = ((m + MATCOPY_TILE - 1) / MATCOPY_TILE + 1) / 2;
+		routine = imatcopy_t;
+	}
+
+	if ( routine == NULL )
+	{
+		b = malloc((size_t)m * (size_t)n * sizeof(FLOAT));
+		if ( b == NULL )
 		{
-			OMATCOPY_K_RT(*rows, *cols, *alpha, a, *lda, b, *rows );
-			OMATCOPY_K_RN(*cols, *rows, (FLOAT) 1.0, b, *rows, a, *ldb );
+			printf("Memory alloc failed in imatcopy\n");
+			exit(1);
 		}
+
+		/* the n x m transpose, with leading dimension n */
+		args.b = (void *)b;
+		args.ldb = n;
+		imatcopy_run(&args, imatcopy_tt, m * n);
+
+		args.m = n;
+		args.n = m;
+		args.a = (void *)b;
+		args.lda = n;
+		args.b = (void *)a;
+		args.ldb = *ldb;
+		args.alpha = (void *)&one;
+		imatcopy_run(&args, imatcopy_back, m * n);
+
+		free(b);
+		return;
 	}
 
-	free(b);
+	imatcopy_run(&args, routine, m * n);
 	return;
 
 }
 
 
+
@@ -118,6 +118,82 @@
 
 #endif
 
+#if defined(SMP) && !defined(XDOUBLE)
+static int imax_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		       FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  BLASLONG idx = MAX_K(args -> m, (FLOAT *)args -> a, args -> lda);
+
+  if (idx > args -> m) idx = args -> m;
+
+  /* Report the index within the whole vector */
+  *(BLASLONG *)args -> c = idx ? args -> n + idx : 0;
+
+  return 0;
+}
+
+static FLOAT imax_value(FLOAT *x, BLASLONG incx, BLASLONG idx){
+
+  x += (idx - 1) * incx * COMPSIZE;
+
+#ifdef USE_ABS
+#ifdef COMPLEX
+  return fabs(x[0]) + fabs(x[1]);
+#else
+  return fabs(x[0]);
+#endif
+#else
+  return x[0];
+#endif
+}
+
+/* The pieces are scanned in order and only a strictly better value */
+/* replaces the current one, so ties go to the lowest index as in   */
+/* the serial kernels.                                              */
+static BLASLONG imax_parallel(BLASLONG n, FLOAT *x, BLASLONG incx, int nthreads){
+
+  BLASLONG result[MAX_CPU_NUMBER * 2 * sizeof(double) / sizeof(BLASLONG)];
+  BLASLONG idx, best;
+  FLOAT value, best_value;
+  int i, pieces, mode;
+
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE;
+#else
+  mode  =  BLAS_SINGLE;
+#endif
+#ifdef COMPLEX
+  mode |=  BLAS_COMPLEX;
+#else
+  mode |=  BLAS_REAL;
+#endif
+
+  pieces = blas_level1_reduce(mode, n, x, incx, NULL, 0, result,
+			      (int (*)(void))imax_thread, nthreads);
+
+  best = 0;
+  best_value = ZERO;
+
+  for (i = 0; i < pieces; i ++) {
+    idx = result[i * 2 * sizeof(double) / sizeof(BLASLONG)];
+    if (idx == 0) continue;
+
+    value = imax_value(x, incx, idx);
+
+#ifndef USE_MIN
+    if (best == 0 || value > best_value) {
+#else
+    if (best == 0 || value < best_value) {
+#endif
+      best       = idx;
+      best_value = value;
+    }
+  }
+
+  return best;
+}
+#endif
+
 #ifndef CBLAS
 
 blasint NAME(blasint *N, FLOAT *x, blasint *INCX){
@@ -125,6 +201,9 @@ blasint NAME(blasint *N, FLOAT *x, blasint *INCX){
   BLASLONG n    = *N;
   BLASLONG incx = *INCX;
   blasint ret;
+#if defined(SMP) && !defined(XDOUBLE)
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -134,6 +213,14 @@ blasint NAME(blasint *N, FLOAT *x, blasint *INCX){
 
   FUNCTION_PROFILE_START();
 
+#if defined(SMP) && !defined(XDOUBLE)
+  nthreads = num_cpu_avail(1);
+
+  if (incx > 0 && nthreads > 1 && n >= 2 * L1_REDUCE_WIDTH) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    ret = (blasint)imax_parallel(n, x, incx, nthreads);
+  } else
+#endif
   ret = (blasint)MAX_K(n, x, incx);
 
   if(ret > n) ret=n;
@@ -154,6 +241,9 @@ CBLAS_INDEX CNAME(blasint n, FLOAT *x, blasint incx){
 #endif
 
   CBLAS_INDEX ret;
+#if defined(SMP) && !defined(XDOUBLE)
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -163,6 +253,14 @@ CBLAS_INDEX CNAME(blasint n, FLOAT *x, blasint incx){
 
   FUNCTION_PROFILE_START();
 
+#if defined(SMP) && !defined(XDOUBLE)
+  nthreads = num_cpu_avail(1);
+
+  if (incx > 0 && nthreads > 1 && n >= 2 * L1_REDUCE_WIDTH) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    ret = imax_parallel(n, x, incx, nthreads);
+  } else
+#endif
   ret = MAX_K(n, x, incx);
 
   if (ret > n) ret=n;
@@ -123,6 +123,7 @@ int NAME(blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA, blasint *ipiv,
   else
          args.nthreads = num_cpu_avail(4);
 
+  FUNCTION_PROFILE_THREADS(args.nthreads);
   if (args.nthreads == 1) {
 #endif
 
@@ -109,6 +109,7 @@ int NAME(blasint *M, blasint *N, FLOAT *a, blasint *ldA, blasint *ipiv, blasint
 	    args.nthreads = (args.m*args.n)/nmax;
   }
 
+  FUNCTION_PROFILE_THREADS(args.nthreads);
   if (args.nthreads == 1) {
 #endif
 
@@ -128,6 +128,7 @@ int NAME(char *TRANS, blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA,
   args.common = NULL;
   args.nthreads = num_cpu_avail(4);
 
+  FUNCTION_PROFILE_THREADS(args.nthreads);
   if (args.nthreads == 1) {
 #endif
 
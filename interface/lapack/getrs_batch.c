@@ -0,0 +1,159 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+void openblas_warning(int verbose, const char * msg);
+
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define ERROR_NAME "DGETRS_BATCH"
+#define GETRS_SMALL dgetrs_small
+#define BATCH_SMALL_THREAD dbatch_small_thread
+#else
+#define ERROR_NAME "SGETRS_BATCH"
+#define GETRS_SMALL sgetrs_small
+#define BATCH_SMALL_THREAD sbatch_small_thread
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_NAME "ZGETRS_BATCH"
+#define GETRS_SMALL zgetrs_small
+#define BATCH_SMALL_THREAD zbatch_small_thread
+#else
+#define ERROR_NAME "CGETRS_BATCH"
+#define GETRS_SMALL cgetrs_small
+#define BATCH_SMALL_THREAD cbatch_small_thread
+#endif
+#endif
+
+/* Solves with the factors of ?getrf_batch, in groups sharing trans, */
+/* n, nrhs, lda and ldb                                              */
+
+int NAME(char *trans_array, blasint *n_array, blasint *nrhs_array,
+	 FLOAT **a_array, blasint *lda_array, blasint **ipiv_array,
+	 FLOAT **b_array, blasint *ldb_array,
+	 blasint *group_count, blasint *group_size, blasint *info_array){
+
+  blas_arg_t *args_array;
+  blasint i, j, matrix_idx, count, total_num;
+  blasint info;
+  int trans_arg, trans;
+
+  PRINT_DEBUG_NAME;
+
+  if (*group_count < 0) {
+    info = 9;
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    return 0;
+  }
+
+  total_num = 0;
+  for (i = 0; i < *group_count; i++) {
+    if (group_size[i] > 0) total_num += group_size[i];
+  }
+
+  if (total_num == 0) return 0;
+
+  args_array = (blas_arg_t *)malloc(total_num * sizeof(blas_arg_t));
+
+  if (args_array == NULL) {
+    openblas_warning(0, "memory alloc failed!\n");
+    return 0;
+  }
+
+  count = 0;
+  matrix_idx = 0;
+
+  for (i = 0; i < *group_count; i++) {
+
+    trans_arg = trans_array[i];
+    TOUPPER(trans_arg);
+
+    trans = -1;
+    if (trans_arg == 'N') trans = 0;
+#ifndef COMPLEX
+    if (trans_arg == 'T') trans = BATCH_SMALL_TRANS;
+    if (trans_arg == 'C') trans = BATCH_SMALL_TRANS;
+#else
+    if (trans_arg == 'T') trans = BATCH_SMALL_TRANS;
+    if (trans_arg == 'C') trans = BATCH_SMALL_TRANS | BATCH_SMALL_CONJ;
+#endif
+
+    info = 0;
+    if (group_size[i] < 0)                   info = 10;
+    if (ldb_array[i] < MAX(1, n_array[i]))   info =  8;
+    if (lda_array[i] < MAX(1, n_array[i]))   info =  5;
+    if (nrhs_array[i] < 0)                   info =  3;
+    if (n_array[i] < 0)                      info =  2;
+    if (trans < 0)                           info =  1;
+
+    if (info) {
+      BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+      for (j = 0; j < group_size[i]; j++) info_array[matrix_idx + j] = -info;
+      if (group_size[i] > 0) matrix_idx += group_size[i];
+      continue;
+    }
+
+    for (j = 0; j < group_size[i]; j++) {
+      info_array[matrix_idx + j] = 0;
+
+      if (n_array[i] == 0 || nrhs_array[i] == 0) continue;
+
+      args_array[count].m   = n_array[i];
+      args_array[count].n   = nrhs_array[i];
+      args_array[count].k   = n_array[i];
+      args_array[count].a   = (void *)a_array[matrix_idx + j];
+      args_array[count].lda = lda_array[i];
+      args_array[count].b   = (void *)b_array[matrix_idx + j];
+      args_array[count].ldb = ldb_array[i];
+      args_array[count].c   = (void *)ipiv_array[matrix_idx + j];
+      args_array[count].d   = (void *)&info_array[matrix_idx + j];
+
+      args_array[count].routine_mode = trans;
+      args_array[count].routine      = (void *)GETRS_SMALL;
+      count++;
+    }
+
+    matrix_idx += group_size[i];
+  }
+
+  if (count > 0) BATCH_SMALL_THREAD(args_array, count);
+
+  free(args_array);
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define ERROR_NAME "DGETRS_ROWMAJOR"
+#else
+#define ERROR_NAME "SGETRS_ROWMAJOR"
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_NAME "ZGETRS_ROWMAJOR"
+#else
+#define ERROR_NAME "CGETRS_ROWMAJOR"
+#endif
+#endif
+
+/* ?getrs with the factors of ?getrf_rowmajor and the n x nrhs right    */
+/* hand sides b stored by rows, for LAPACKE_?getrs_work.               */
+
+int NAME(char *TRANS, blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA,
+  blasint *ipiv, FLOAT *b, blasint *ldB, blasint *Info){
+
+  char trans_arg = *TRANS;
+
+  blas_arg_t args;
+
+  blasint info;
+  int trans;
+  FLOAT *buffer;
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  args.m    = *NRHS;
+  args.n    = *N;
+  args.a    = (void *)a;
+  args.lda  = *ldA;
+  args.b    = (void *)b;
+  args.ldb  = *ldB;
+  args.c    = (void *)ipiv;
+
+  info = 0;
+
+  TOUPPER(trans_arg);
+  trans = -1;
+
+  if (trans_arg == 'N') trans = 0;
+  if (trans_arg == 'T') trans = 1;
+#ifndef COMPLEX
+  if (trans_arg == 'C') trans = 1;
+#else
+  if (trans_arg == 'C') trans = 2;
+#endif
+
+  if (args.ldb  < args.m) info = 8;
+  if (args.lda  < args.n) info = 5;
+  if (args.m    < 0) info = 3;
+  if (args.n    < 0) info = 2;
+  if (trans     < 0) info = 1;
+
+  if (info != 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+  *Info = info;
+
+  if (args.m == 0 || args.n == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  args.common = NULL;
+  args.nthreads = num_cpu_avail(4);
+
+  FUNCTION_PROFILE_THREADS(args.nthreads);
+  if (args.nthreads == 1) {
+#endif
+
+    GETRS_ROWMAJOR_SINGLE(&args, NULL, NULL, sa, sb, trans);
+
+#ifdef SMP
+  } else {
+    GETRS_ROWMAJOR_PARALLEL(&args, NULL, NULL, sa, sb, trans);
+  }
+#endif
+
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.n, 2 * args.n * args.n * args.m);
+
+  IDEBUG_END;
+
+  return 0;
+}
@@ -79,6 +79,7 @@ int NAME(blasint *N, FLOAT *a, blasint *LDA, blasint *K1, blasint *K2, blasint *
 #ifdef SMP
   nthreads = num_cpu_avail(1);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
@@ -114,6 +114,7 @@ int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
   args.common = NULL;
   args.nthreads = num_cpu_avail(4);
 
+  FUNCTION_PROFILE_THREADS(args.nthreads);
   if (args.nthreads == 1) {
 #endif
 
@@ -125,6 +125,7 @@ int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
 	    args.nthreads = args.n/nmax;
   }
 
+  FUNCTION_PROFILE_THREADS(args.nthreads);
   if (args.nthreads == 1) {
 #endif
 
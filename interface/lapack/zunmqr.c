@@ -0,0 +1,174 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifdef XDOUBLE
+#define ERROR_NAME "XUNMQR"
+#elif defined(DOUBLE)
+#define ERROR_NAME "ZUNMQR"
+#else
+#define ERROR_NAME "CUNMQR"
+#endif
+
+int NAME(char *SIDE, char *TRANS, blasint *M, blasint *N, blasint *K, FLOAT *a, blasint *ldA, FLOAT *tau,
+	 FLOAT *c, blasint *ldC, FLOAT *work, blasint *lWork, blasint *Info){
+
+  blas_arg_t args;
+
+  char side_arg  = *SIDE;
+  char trans_arg = *TRANS;
+  blasint side, trans;
+  blasint info;
+  BLASLONG nb, nq, nw, lwkopt;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  args.m    = *M;
+  args.n    = *N;
+  args.k    = *K;
+  args.a    = (void *)a;
+  args.lda  = *ldA;
+  args.b    = (void *)tau;
+  args.c    = (void *)c;
+  args.ldc  = *ldC;
+  args.d    = (void *)work;
+  args.ldd  = *lWork;
+
+  TOUPPER(side_arg);
+  TOUPPER(trans_arg);
+
+  side = -1;
+  if (side_arg  == 'L') side  = 1;
+  if (side_arg  == 'R') side  = 0;
+
+  trans = -1;
+  if (trans_arg == 'N') trans = 0;
+  if (trans_arg == 'C') trans = 2;
+
+  nq = side ? args.m : args.n;
+  nw = side ? args.n : args.m;
+
+  /* reflectors per block, the workspace holds T and the product of a block with C */
+  nb = ((GEMM_Q / 4 + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+  if (nb < 1) nb = 1;
+  args.ldb  = nb;
+
+  lwkopt = MAX(1, nb * (nb + nw));
+  if (args.m == 0 || args.n == 0) lwkopt = 1;
+
+  work[0] = (FLOAT)lwkopt;
+  work[1] = ZERO;
+
+  info  =    0;
+  if (args.ldd != -1 && args.ldd < MAX(1,nw)) info = 12;
+  if (args.ldc < MAX(1,args.m))           info = 10;
+  if (args.lda < MAX(1,nq))               info =  7;
+  if (args.k   < 0 || args.k > nq)        info =  5;
+  if (args.n   < 0)                       info =  4;
+  if (args.m   < 0)                       info =  3;
+  if (trans    < 0)                       info =  2;
+  if (side     < 0)                       info =  1;
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  *Info = 0;
+  if (args.ldd == -1) return 0;
+  if (args.m == 0 || args.n == 0 || args.k == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+#ifdef SMP
+  args.common = NULL;
+
+#ifndef DOUBLE
+  int nmax = 40000;
+#else
+  int nmax = 10000;
+#endif
+  if (args.m*args.n <nmax) {
+    args.nthreads = 1;
+  } else {
+    args.nthreads = num_cpu_avail(4);
+    if ((args.m*args.n)/args.nthreads <nmax)
+	    args.nthreads = (args.m*args.n)/nmax;
+  }
+
+  FUNCTION_PROFILE_THREADS(args.nthreads);
+  if (args.nthreads == 1) {
+#endif
+
+    ORMQR_SINGLE(&args, NULL, NULL, sa, sb, side | trans);
+
+#ifdef SMP
+  } else {
+
+    ORMQR_PARALLEL(&args, NULL, NULL, sa, sb, side | trans);
+  }
+#endif
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  work[0] = (FLOAT)lwkopt;
+  work[1] = ZERO;
+
+  FUNCTION_PROFILE_END(4, args.m * args.n, 4. * args.m * args.n * args.k);
+
+  IDEBUG_END;
+
+  return 0;
+}
@@ -42,6 +42,55 @@
 #include "functable.h"
 #endif
 
+#if defined(SMP) && !defined(XDOUBLE)
+static int nrm2_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		       FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  *(FLOAT *)args -> c = NRM2_K(args -> m, (FLOAT *)args -> a, args -> lda);
+
+  return 0;
+}
+
+/* Partial norms are merged as max * sqrt(sum((norm / max)^2)) */
+static FLOAT nrm2_parallel(BLASLONG n, FLOAT *x, BLASLONG incx, int nthreads){
+
+  FLOAT result[MAX_CPU_NUMBER * 2 * sizeof(double) / sizeof(FLOAT)];
+  FLOAT scale, ssq, t;
+  int i, pieces, mode;
+
+#ifdef DOUBLE
+  mode  =  BLAS_DOUBLE;
+#else
+  mode  =  BLAS_SINGLE;
+#endif
+#ifdef COMPLEX
+  mode |=  BLAS_COMPLEX;
+#else
+  mode |=  BLAS_REAL;
+#endif
+
+  pieces = blas_level1_reduce(mode, n, x, incx, NULL, 0, result,
+			      (int (*)(void))nrm2_thread, nthreads);
+
+  scale = ZERO;
+  for (i = 0; i < pieces; i ++) {
+    t = result[i * 2 * sizeof(double) / sizeof(FLOAT)];
+    if (t != t) return t;
+    if (t > scale) scale = t;
+  }
+
+  if (scale == ZERO || isinf(scale)) return scale;
+
+  ssq = ZERO;
+  for (i = 0; i < pieces; i ++) {
+    t    = result[i * 2 * sizeof(double) / sizeof(FLOAT)] / scale;
+    ssq += t * t;
+  }
+
+  return scale * sqrt(ssq);
+}
+#endif
+
 #ifndef CBLAS
 
 FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
@@ -49,6 +98,9 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
   BLASLONG n    = *N;
   BLASLONG incx = *INCX;
   FLOATRET ret;
+#if defined(SMP) && !defined(XDOUBLE)
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -73,6 +125,14 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
 
   FUNCTION_PROFILE_START();
 
+#if defined(SMP) && !defined(XDOUBLE)
+  nthreads = num_cpu_avail(1);
+
+  if (incx != 0 && nthreads > 1 && n >= 2 * L1_REDUCE_WIDTH) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    ret = (FLOATRET)nrm2_parallel(n, x, incx, nthreads);
+  } else
+#endif
   ret = (FLOATRET)NRM2_K(n, x, incx);
 
   FUNCTION_PROFILE_END(COMPSIZE, n, 2 * n);
@@ -92,6 +152,9 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx){
 #endif
 
   FLOAT ret;
+#if defined(SMP) && !defined(XDOUBLE)
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -117,6 +180,14 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx){
 
   FUNCTION_PROFILE_START();
 
+#if defined(SMP) && !defined(XDOUBLE)
+  nthreads = num_cpu_avail(1);
+
+  if (incx != 0 && nthreads > 1 && n >= 2 * L1_REDUCE_WIDTH) {
+    FUNCTION_PROFILE_THREADS(nthreads);
+    ret = nrm2_parallel(n, x, incx, nthreads);
+  } else
+#endif
   ret = NRM2_K(n, x, incx);
 
   FUNCTION_PROFILE_END(COMPSIZE, n, 2 * n);
@@ -47,6 +47,56 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define BlasNoTrans  0
 #define BlasTrans    1
 
+/* Transposes are copied in square tiles, so that the columns read from */
+/* A and the rows written to B both stay in cache.                      */
+#define MATCOPY_TILE 64
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+/* B := alpha*A for the columns range_n of A (column major) */
+static int omatcopy_n(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	BLASLONG n_from = 0, n_to = args -> n;
+	FLOAT *a = (FLOAT *)args -> a;
+	FLOAT *b = (FLOAT *)args -> b;
+
+	if (range_n) {
+		n_from = range_n[0];
+		n_to   = range_n[1];
+	}
+
+	OMATCOPY_K_CN(args -> m, n_to - n_from, *(FLOAT *)args -> alpha,
+		      a + n_from * args -> lda, args -> lda, b + n_from * args -> ldb, args -> ldb);
+	return 0;
+}
+
+/* B := alpha*A**T for the columns range_n of A (column major) */
+static int omatcopy_t(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	BLASLONG n_from = 0, n_to = args -> n;
+	BLASLONG m = args -> m, lda = args -> lda, ldb = args -> ldb;
+	BLASLONG is, js, min_i, min_j;
+	FLOAT *a = (FLOAT *)args -> a;
+	FLOAT *b = (FLOAT *)args -> b;
+
+	if (range_n) {
+		n_from = range_n[0];
+		n_to   = range_n[1];
+	}
+
+	for (js = n_from; js < n_to; js += MATCOPY_TILE) {
+		min_j = MIN(n_to - js, MATCOPY_TILE);
+		for (is = 0; is < m; is += MATCOPY_TILE) {
+			min_i = MIN(m - is, MATCOPY_TILE);
+			OMATCOPY_K_CT(min_i, min_j, *(FLOAT *)args -> alpha,
+				      a + is + js * lda, lda, b + js + is * ldb, ldb);
+		}
+	}
+	return 0;
+}
+
 #ifndef CBLAS 
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, FLOAT *b, blasint *ldb)
 {
@@ -54,6 +104,11 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
+	blas_arg_t args;
+	int (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+#ifdef SMP
+	int nthreads, mode;
+#endif
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -74,6 +129,11 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 	FLOAT   *alpha; 
 	int order=-1,trans=-1;
 	blasint info = -1;
+	blas_arg_t args;
+	int (*routine)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+#ifdef SMP
+	int nthreads, mode;
+#endif
 
 	if ( CORDER == CblasColMajor ) order = BlasColMajor; 
 	if ( CORDER == CblasRowMajor ) order = BlasRowMajor; 
@@ -113,28 +173,43 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 
 	if ((*rows == 0) || (*cols == 0)) return;
 
+	/* a row major matrix is the column major matrix of its transpose */
 	if ( order == BlasColMajor )
 	{
-		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_CN(*rows, *cols, *alpha, a, *lda, b, *ldb );
-		}
-		else
-		{
-			OMATCOPY_K_CT(*rows, *cols, *alpha, a, *lda, b, *ldb );
-		}
+		args.m = *rows;
+		args.n = *cols;
 	}
 	else
 	{
-		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_RN(*rows, *cols, *alpha, a, *lda, b, *ldb );
-		}
-		else
-		{
-			OMATCOPY_K_RT(*rows, *cols, *alpha, a, *lda, b, *ldb );
-		}
+		args.m = *cols;
+		args.n = *rows;
 	}
+	args.a = (void *)a;
+	args.b = (void *)b;
+	args.lda = *lda;
+	args.ldb = *ldb;
+	args.alpha = (void *)alpha;
+
+	routine = (trans == BlasNoTrans) ? omatcopy_n : omatcopy_t;
+
+#ifdef SMP
+	if ( 1L * args.m * args.n < 65536L * GEMM_MULTITHREAD_THRESHOLD )
+		nthreads = 1;
+	else
+		nthreads = num_cpu_avail(2);
+
+	if (nthreads > 1) {
+#ifdef DOUBLE
+		mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+		mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+		gemm_thread_n(mode, &args, NULL, NULL, routine, NULL, NULL, nthreads);
+		return;
+	}
+#endif
+
+	routine(&args, NULL, NULL, NULL, NULL, 0);
 
 	return;
 
@@ -183,6 +183,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, blasint m, blasi
     else
       nthreads = num_cpu_avail(2);
 
+    FUNCTION_PROFILE_THREADS(nthreads);
     if (nthreads == 1) {
 #endif
         (sbgemv[(int)trans])(m, n, alpha, a, lda, x, incx, beta, y, incy);
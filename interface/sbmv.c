@@ -200,6 +200,7 @@ void CNAME(enum CBLAS_ORDER order,
 #ifdef SMPTEST
   nthreads = num_cpu_avail(2);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
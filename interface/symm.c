@@ -391,7 +391,11 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
 	  args.nthreads = 1;
   } else {
 	 args.nthreads = num_cpu_avail(3);
+	 if (args.nthreads > 1)
+	   args.nthreads = blas_level3_threads(BLAS_MODEL_SYMM, MODE, args.m, args.n, side ? args.n : args.m,
+					       GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, args.nthreads, NULL);
   }
+  FUNCTION_PROFILE_THREADS(args.nthreads);
   if (args.nthreads == 1) {
 #endif
 
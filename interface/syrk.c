@@ -108,7 +108,6 @@ void NAME(char *UPLO, char *TRANS,
 
 #ifdef SMP
   double NNK;
-#ifdef USE_SIMPLE_THREADED_LEVEL3
 #ifndef COMPLEX
 #ifdef XDOUBLE
   int mode  =  BLAS_XDOUBLE | BLAS_REAL;
@@ -126,7 +125,6 @@ void NAME(char *UPLO, char *TRANS,
   int mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
 #endif
 #endif
-#endif
 #endif
 
   blasint info;
@@ -234,7 +232,6 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo, enum CBLAS_TRANSPOSE Tr
 #ifdef SMP
 double NNK;
 
-#ifdef USE_SIMPLE_THREADED_LEVEL3
 #ifndef COMPLEX
 #ifdef XDOUBLE
   int mode  =  BLAS_XDOUBLE | BLAS_REAL;
@@ -252,7 +249,6 @@ double NNK;
   int mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
 #endif
 #endif
-#endif
 #endif
 
   PRINT_DEBUG_CNAME;
@@ -369,8 +365,12 @@ double NNK;
   args.nthreads = 1;
   } else {
   args.nthreads = num_cpu_avail(3);
+  if (args.nthreads > 1)
+    args.nthreads = blas_level3_threads(BLAS_MODEL_SYRK, mode, args.n, args.n, args.k,
+					GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, args.nthreads, NULL);
   }
 
+  FUNCTION_PROFILE_THREADS(args.nthreads);
   if (args.nthreads == 1) {
 #endif
 
@@ -43,6 +43,10 @@
 #include "functable.h"
 #endif
 
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
 #ifdef XDOUBLE
 #define ERROR_NAME "QTBSV "
 #elif defined(DOUBLE)
@@ -64,6 +68,21 @@ static int (*tbsv[])(BLASLONG, BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG, v
 #endif
 };
 
+#ifdef SMP
+static int (*tbsv_thread[])(BLASLONG, BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG, FLOAT *, int) = {
+#ifdef XDOUBLE
+  qtbsv_thread_NUU, qtbsv_thread_NUN, qtbsv_thread_NLU, qtbsv_thread_NLN,
+  qtbsv_thread_TUU, qtbsv_thread_TUN, qtbsv_thread_TLU, qtbsv_thread_TLN,
+#elif defined(DOUBLE)
+  dtbsv_thread_NUU, dtbsv_thread_NUN, dtbsv_thread_NLU, dtbsv_thread_NLN,
+  dtbsv_thread_TUU, dtbsv_thread_TUN, dtbsv_thread_TLU, dtbsv_thread_TLN,
+#else
+  stbsv_thread_NUU, stbsv_thread_NUN, stbsv_thread_NLU, stbsv_thread_NLN,
+  stbsv_thread_TUU, stbsv_thread_TUN, stbsv_thread_TLU, stbsv_thread_TLN,
+#endif
+};
+#endif
+
 #ifndef CBLAS
 
 void NAME(char *UPLO, char *TRANS, char *DIAG,
@@ -84,6 +103,9 @@ void NAME(char *UPLO, char *TRANS, char *DIAG,
   int unit;
   int trans;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -130,6 +152,9 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
   int trans, uplo, unit;
   blasint info;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -201,7 +226,24 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
   buffer = (FLOAT *)blas_memory_alloc(1);
 
-  (tbsv[(trans<<2) | (uplo<<1) | unit])(n, k, a, lda, x, incx, buffer);
+#ifdef SMP
+  nthreads = num_cpu_avail(2);
+
+  if (k < 2 * DTB_ENTRIES || 1L * n * k < 65536L * GEMM_MULTITHREAD_THRESHOLD) nthreads = 1;
+
+  FUNCTION_PROFILE_THREADS(nthreads);
+  if (nthreads == 1) {
+#endif
+
+    (tbsv[(trans<<2) | (uplo<<1) | unit])(n, k, a, lda, x, incx, buffer);
+
+#ifdef SMP
+  } else {
+
+    (tbsv_thread[(trans<<2) | (uplo<<1) | unit])(n, k, a, lda, x, incx, buffer, nthreads);
+
+  }
+#endif
 
   blas_memory_free(buffer);
 
@@ -43,6 +43,10 @@
 #include "functable.h"
 #endif
 
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
 #ifdef XDOUBLE
 #define ERROR_NAME "QTPSV "
 #elif defined(DOUBLE)
@@ -64,6 +68,21 @@ static int (*tpsv[])(BLASLONG, FLOAT *, FLOAT *, BLASLONG, void *) = {
 #endif
 };
 
+#ifdef SMP
+static int (*tpsv_thread[])(BLASLONG, FLOAT *, FLOAT *, BLASLONG, FLOAT *, int) = {
+#ifdef XDOUBLE
+  qtpsv_thread_NUU, qtpsv_thread_NUN, qtpsv_thread_NLU, qtpsv_thread_NLN,
+  qtpsv_thread_TUU, qtpsv_thread_TUN, qtpsv_thread_TLU, qtpsv_thread_TLN,
+#elif defined(DOUBLE)
+  dtpsv_thread_NUU, dtpsv_thread_NUN, dtpsv_thread_NLU, dtpsv_thread_NLN,
+  dtpsv_thread_TUU, dtpsv_thread_TUN, dtpsv_thread_TLU, dtpsv_thread_TLN,
+#else
+  stpsv_thread_NUU, stpsv_thread_NUN, stpsv_thread_NLU, stpsv_thread_NLN,
+  stpsv_thread_TUU, stpsv_thread_TUN, stpsv_thread_TLU, stpsv_thread_TLN,
+#endif
+};
+#endif
+
 #ifndef CBLAS
 
 void NAME(char *UPLO, char *TRANS, char *DIAG,
@@ -81,6 +100,9 @@ void NAME(char *UPLO, char *TRANS, char *DIAG,
   int unit;
   int trans;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -125,6 +147,9 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
   int trans, uplo, unit;
   blasint info;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -192,7 +217,24 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
   buffer = (FLOAT *)blas_memory_alloc(1);
 
-  (tpsv[(trans<<2) | (uplo<<1) | unit])(n, a, x, incx, buffer);
+#ifdef SMP
+  nthreads = num_cpu_avail(2);
+
+  if (1L * n * n < 65536L * GEMM_MULTITHREAD_THRESHOLD) nthreads = 1;
+
+  FUNCTION_PROFILE_THREADS(nthreads);
+  if (nthreads == 1) {
+#endif
+
+    (tpsv[(trans<<2) | (uplo<<1) | unit])(n, a, x, incx, buffer);
+
+#ifdef SMP
+  } else {
+
+    (tpsv_thread[(trans<<2) | (uplo<<1) | unit])(n, a, x, incx, buffer, nthreads);
+
+  }
+#endif
 
   blas_memory_free(buffer);
 
@@ -87,6 +87,11 @@
 #define SMP_FACTOR 128
 #endif
 
+/* Fewer right hand sides than this are solved with the triangle divided */
+#ifndef TASK_RHS
+#define TASK_RHS 64
+#endif
+
 static int (*trsm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
 #ifndef TRMM
   TRSM_LNUU, TRSM_LNUN, TRSM_LNLU, TRSM_LNLN,
@@ -143,6 +148,7 @@ void NAME(char *SIDE, char *UPLO, char *TRANS, char *DIAG,
   int mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
 #endif
 #endif
+  int nthreads, task;
 #endif
 
   blasint info;
@@ -252,6 +258,7 @@ void CNAME(enum CBLAS_ORDER order,
   int mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
 #endif
 #endif
+  int nthreads, task;
 #endif
 
   PRINT_DEBUG_CNAME;
@@ -383,14 +390,36 @@ void CNAME(enum CBLAS_ORDER order,
 	args.nthreads = 1;
   else
 	args.nthreads = num_cpu_avail(3);
-		
 
+  /* the triangular matrix is never split: left side divides n, right side m */
+  task = 0;
+
+  if (args.nthreads > 1) {
+	nthreads = blas_level3_threads(side ? BLAS_MODEL_TRSM_R : BLAS_MODEL_TRSM_L, mode,
+				       args.m, args.n, side ? args.n : args.m,
+				       GEMM_UNROLL_M, GEMM_UNROLL_N, GEMM_Q, args.nthreads, NULL);
+
+	/* too few right hand sides to keep the threads busy: divide the triangle */
+	if ((nthreads < args.nthreads) && ((side ? args.m : args.n) < TASK_RHS)
+	    && ((side ? args.n : args.m) >= 2 * GEMM_Q))
+	  task = 1;
+	else
+	  args.nthreads = nthreads;
+  }
+
+  FUNCTION_PROFILE_THREADS(args.nthreads);
   if (args.nthreads == 1) {
 #endif
 
     (trsm[(side<<4) | (trans<<2) | (uplo<<1) | unit])(&args, NULL, NULL, sa, sb, 0);
 
 #ifdef SMP
+  } else if (task) {
+#ifndef TRMM
+    TRSM_TASK(&args, NULL, NULL, sa, sb, (side<<4) | (trans<<2) | (uplo<<1) | unit);
+#else
+    TRMM_TASK(&args, NULL, NULL, sa, sb, (side<<4) | (trans<<2) | (uplo<<1) | unit);
+#endif
   } else {
     if (!side) {
       gemm_thread_n(mode, &args, NULL, NULL, trsm[(side<<4) | (trans<<2) | (uplo<<1) | unit], sa, sb, args.nthreads);
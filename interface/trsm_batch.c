@@ -0,0 +1,198 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+void openblas_warning(int verbose, const char * msg);
+
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define ERROR_NAME "DTRSM_BATCH "
+#define TRSM_SMALL dtrsm_small
+#define BATCH_SMALL_THREAD dbatch_small_thread
+#else
+#define ERROR_NAME "STRSM_BATCH "
+#define TRSM_SMALL strsm_small
+#define BATCH_SMALL_THREAD sbatch_small_thread
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_NAME "ZTRSM_BATCH "
+#define TRSM_SMALL ztrsm_small
+#define BATCH_SMALL_THREAD zbatch_small_thread
+#else
+#define ERROR_NAME "CTRSM_BATCH "
+#define TRSM_SMALL ctrsm_small
+#define BATCH_SMALL_THREAD cbatch_small_thread
+#endif
+#endif
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_SIDE * side_array, enum CBLAS_UPLO * uplo_array,
+	   enum CBLAS_TRANSPOSE * transa_array, enum CBLAS_DIAG * diag_array,
+	   blasint * m_array, blasint * n_array,
+#ifndef COMPLEX
+	   FLOAT * alpha_array,
+	   FLOAT ** a_array, blasint * lda_array,
+	   FLOAT ** b_array, blasint * ldb_array, blasint group_count, blasint * group_size) {
+#else
+	   void * valpha_array,
+	   void ** va_array, blasint * lda_array,
+	   void ** vb_array, blasint * ldb_array, blasint group_count, blasint * group_size) {
+
+  FLOAT * alpha_array=(FLOAT *)valpha_array;
+  FLOAT ** a_array=(FLOAT**)va_array;
+  FLOAT ** b_array=(FLOAT**)vb_array;
+
+#endif
+  blas_arg_t * args_array=NULL;
+
+  blasint total_num=0;
+
+  blasint i=0, j=0, matrix_idx=0, count=0;
+
+  int side, uplo, trans, unit, group_mode;
+  BLASLONG group_m, group_n, group_lda, group_ldb, nrowa;
+  blasint info;
+
+  PRINT_DEBUG_CNAME;
+
+  for(i=0; i<group_count; i++){
+    total_num+=group_size[i];
+  }
+
+  if (total_num <= 0) return;
+
+  args_array=(blas_arg_t *)malloc(total_num * sizeof(blas_arg_t));
+
+  if(args_array == NULL){
+    openblas_warning(0, "memory alloc failed!\n");
+    return;
+  }
+
+  for(i=0; i<group_count; matrix_idx+=group_size[i], i++){
+
+    side  = -1;
+    uplo  = -1;
+    trans = -1;
+    unit  = -1;
+    info  =  0;
+
+    group_m = group_n = 0;
+
+    if (order == CblasColMajor) {
+      group_m = m_array[i];
+      group_n = n_array[i];
+
+      if (side_array[i] == CblasLeft)  side = 0;
+      if (side_array[i] == CblasRight) side = BATCH_SMALL_RSIDE;
+
+      if (uplo_array[i] == CblasUpper) uplo = 0;
+      if (uplo_array[i] == CblasLower) uplo = BATCH_SMALL_LOWER;
+    } else if (order == CblasRowMajor) {
+      /* Row major B is column major B**T: the side and the triangle flip */
+      group_m = n_array[i];
+      group_n = m_array[i];
+
+      if (side_array[i] == CblasLeft)  side = BATCH_SMALL_RSIDE;
+      if (side_array[i] == CblasRight) side = 0;
+
+      if (uplo_array[i] == CblasUpper) uplo = BATCH_SMALL_LOWER;
+      if (uplo_array[i] == CblasLower) uplo = 0;
+    }
+
+    if (transa_array[i] == CblasNoTrans)     trans = 0;
+    if (transa_array[i] == CblasTrans)       trans = BATCH_SMALL_TRANS;
+#ifndef COMPLEX
+    if (transa_array[i] == CblasConjNoTrans) trans = 0;
+    if (transa_array[i] == CblasConjTrans)   trans = BATCH_SMALL_TRANS;
+#else
+    if (transa_array[i] == CblasConjNoTrans) trans = BATCH_SMALL_CONJ;
+    if (transa_array[i] == CblasConjTrans)   trans = BATCH_SMALL_TRANS | BATCH_SMALL_CONJ;
+#endif
+
+    if (diag_array[i] == CblasUnit)    unit = BATCH_SMALL_UNIT;
+    if (diag_array[i] == CblasNonUnit) unit = 0;
+
+    group_lda = lda_array[i];
+    group_ldb = ldb_array[i];
+
+    nrowa = group_m;
+    if (side == BATCH_SMALL_RSIDE) nrowa = group_n;
+
+    info = -1;
+
+    if (group_ldb < MAX(1, group_m)) info = 11;
+    if (group_lda < MAX(1, nrowa))   info =  9;
+    if (group_n < 0)                 info =  6;
+    if (group_m < 0)                 info =  5;
+    if (unit  < 0)                   info =  4;
+    if (trans < 0)                   info =  3;
+    if (uplo  < 0)                   info =  2;
+    if (side  < 0)                   info =  1;
+
+    if (info >= 0) {
+      BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+      free(args_array);
+      return;
+    }
+
+    if (group_m == 0 || group_n == 0) continue;
+
+    group_mode = side | uplo | trans | unit;
+
+    for(j=0; j<group_size[i]; j++){
+      args_array[count].m=group_m;
+      args_array[count].n=group_n;
+      args_array[count].k=(side == BATCH_SMALL_RSIDE) ? group_n : group_m;
+      args_array[count].lda=group_lda;
+      args_array[count].ldb=group_ldb;
+      args_array[count].alpha=(void *)&alpha_array[i * COMPSIZE];
+      args_array[count].a=(a_array[matrix_idx+j]);
+      args_array[count].b=(b_array[matrix_idx+j]);
+      args_array[count].d=NULL;
+
+      args_array[count].routine_mode=group_mode;
+      args_array[count].routine=(void *)TRSM_SMALL;
+      count++;
+    }
+  }
+
+  if(count>0){
+    BATCH_SMALL_THREAD(args_array,count);
+  }
+
+  free(args_array);
+}
@@ -43,6 +43,10 @@
 #include "functable.h"
 #endif
 
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
 #ifdef XDOUBLE
 #define ERROR_NAME "QTRSV "
 #elif defined(DOUBLE)
@@ -64,6 +68,21 @@ static int (*trsv[])(BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG, void *) = {
 #endif
 };
 
+#ifdef SMP
+static int (*trsv_thread[])(BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG, FLOAT *, int) = {
+#ifdef XDOUBLE
+  qtrsv_thread_NUU, qtrsv_thread_NUN, qtrsv_thread_NLU, qtrsv_thread_NLN,
+  qtrsv_thread_TUU, qtrsv_thread_TUN, qtrsv_thread_TLU, qtrsv_thread_TLN,
+#elif defined(DOUBLE)
+  dtrsv_thread_NUU, dtrsv_thread_NUN, dtrsv_thread_NLU, dtrsv_thread_NLN,
+  dtrsv_thread_TUU, dtrsv_thread_TUN, dtrsv_thread_TLU, dtrsv_thread_TLN,
+#else
+  strsv_thread_NUU, strsv_thread_NUN, strsv_thread_NLU, strsv_thread_NLN,
+  strsv_thread_TUU, strsv_thread_TUN, strsv_thread_TLU, strsv_thread_TLN,
+#endif
+};
+#endif
+
 #ifndef CBLAS
 
 void NAME(char *UPLO, char *TRANS, char *DIAG,
@@ -82,6 +101,9 @@ void NAME(char *UPLO, char *TRANS, char *DIAG,
   int unit;
   int trans;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -127,6 +149,9 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
   int trans, uplo, unit;
   blasint info;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -196,7 +221,24 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
   buffer = (FLOAT *)blas_memory_alloc(1);
 
-  (trsv[(trans<<2) | (uplo<<1) | unit])(n, a, lda, x, incx, buffer);
+#ifdef SMP
+  nthreads = num_cpu_avail(2);
+
+  if (1L * n * n < 65536L * GEMM_MULTITHREAD_THRESHOLD) nthreads = 1;
+
+  FUNCTION_PROFILE_THREADS(nthreads);
+  if (nthreads == 1) {
+#endif
+
+    (trsv[(trans<<2) | (uplo<<1) | unit])(n, a, lda, x, incx, buffer);
+
+#ifdef SMP
+  } else {
+
+    (trsv_thread[(trans<<2) | (uplo<<1) | unit])(n, a, lda, x, incx, buffer, nthreads);
+
+  }
+#endif
 
   blas_memory_free(buffer);
 
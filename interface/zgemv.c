@@ -257,6 +257,7 @@ void CNAME(enum CBLAS_ORDER order,
   else
     nthreads = num_cpu_avail(2);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
@@ -206,6 +206,7 @@ void CNAME(enum CBLAS_ORDER order,
 #ifdef SMPBUG
   nthreads = num_cpu_avail(2);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
@@ -196,6 +196,7 @@ void CNAME(enum CBLAS_ORDER order,
 #ifdef SMP
   nthreads = num_cpu_avail(2);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
@@ -47,6 +47,7 @@ void CNAME(void *VDA, void *VDB, FLOAT *C, void *VS) {
     *C        = ONE;
     *(S  + 0) = ZERO;
     *(S  + 1) = ZERO;
+    FUNCTION_PROFILE_END(4, 4, 4);
     return;
   }
 
@@ -64,11 +65,13 @@ void CNAME(void *VDA, void *VDB, FLOAT *C, void *VS) {
 		    (*DA) = fabsl(db_i);
 		*S = *S1 /(*DA);
 		*(S+1) = *(S1+1) /(*DA);
+		FUNCTION_PROFILE_END(4, 4, 4);
 		return;
 	    } else if ( db_i == ZERO) {
 		    *DA = fabsl(db_r);
 		*S = *S1 /(*DA);
 		*(S+1) = *(S1+1) /(*DA);
+		FUNCTION_PROFILE_END(4, 4, 4);
 		return;
 	    } else {
 	        long double g1 = MAX( fabsl(db_r), fabsl(db_i));
@@ -79,6 +82,7 @@ void CNAME(void *VDA, void *VDB, FLOAT *C, void *VS) {
 		    *(S+1) = *(S1+1) /d;
 		    *DA = d ;
 		    *(DA+1) = ZERO;
+		    FUNCTION_PROFILE_END(4, 4, 4);
 		    return;
     	        } else { // scaled algorithm
 		  long double u = MIN ( safmax, MAX ( safmin, g1));
@@ -89,6 +93,7 @@ void CNAME(void *VDA, void *VDB, FLOAT *C, void *VS) {
 		    *(S + 1) = (gs_i * -1) / d;
 		    *DA = d * u;
 		    *(DA+1) = ZERO;
+		    FUNCTION_PROFILE_END(4, 4, 4);
 		    return;
 	        }
 	    }
@@ -125,6 +130,7 @@ void CNAME(void *VDA, void *VDB, FLOAT *C, void *VS) {
 		    }
 		    *DA=*R;
 		    *(DA+1)=*(R+1);
+		    FUNCTION_PROFILE_END(4, 4, 4);
 		    return;
 	        } else {	// scaled
 		   FLOAT fs_r, fs_i, gs_r, gs_i;
@@ -175,6 +181,7 @@ void CNAME(void *VDA, void *VDB, FLOAT *C, void *VS) {
 		    *C *= w;
 		    *DA *= u;
 		    *(DA+1) *= u;
+		    FUNCTION_PROFILE_END(4, 4, 4);
 		    return;
 		}
 	}
@@ -95,6 +95,7 @@ void CNAME(blasint n, FLOAT alpha_r, void *vx, blasint incx){
   else
 	nthreads = num_cpu_avail(1);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
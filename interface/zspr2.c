@@ -126,6 +126,7 @@ void NAME(char *UPLO, blasint *N, FLOAT  *ALPHA,
 #ifdef SMP
   nthreads = num_cpu_avail(2);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
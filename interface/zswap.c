@@ -94,6 +94,7 @@ FLOAT *y = (FLOAT*)vy;
   else
 	  nthreads = num_cpu_avail(1);
 
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
@@ -43,6 +43,10 @@
 #include "functable.h"
 #endif
 
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
 #ifdef XDOUBLE
 #define ERROR_NAME "XTPSV "
 #elif defined(DOUBLE)
@@ -70,6 +74,27 @@ static int (*tpsv[])(BLASLONG, FLOAT *, FLOAT *, BLASLONG, void *) = {
 #endif
 };
 
+#ifdef SMP
+static int (*tpsv_thread[])(BLASLONG, FLOAT *, FLOAT *, BLASLONG, FLOAT *, int) = {
+#ifdef XDOUBLE
+  xtpsv_thread_NUU, xtpsv_thread_NUN, xtpsv_thread_NLU, xtpsv_thread_NLN,
+  xtpsv_thread_TUU, xtpsv_thread_TUN, xtpsv_thread_TLU, xtpsv_thread_TLN,
+  xtpsv_thread_RUU, xtpsv_thread_RUN, xtpsv_thread_RLU, xtpsv_thread_RLN,
+  xtpsv_thread_CUU, xtpsv_thread_CUN, xtpsv_thread_CLU, xtpsv_thread_CLN,
+#elif defined(DOUBLE)
+  ztpsv_thread_NUU, ztpsv_thread_NUN, ztpsv_thread_NLU, ztpsv_thread_NLN,
+  ztpsv_thread_TUU, ztpsv_thread_TUN, ztpsv_thread_TLU, ztpsv_thread_TLN,
+  ztpsv_thread_RUU, ztpsv_thread_RUN, ztpsv_thread_RLU, ztpsv_thread_RLN,
+  ztpsv_thread_CUU, ztpsv_thread_CUN, ztpsv_thread_CLU, ztpsv_thread_CLN,
+#else
+  ctpsv_thread_NUU, ctpsv_thread_NUN, ctpsv_thread_NLU, ctpsv_thread_NLN,
+  ctpsv_thread_TUU, ctpsv_thread_TUN, ctpsv_thread_TLU, ctpsv_thread_TLN,
+  ctpsv_thread_RUU, ctpsv_thread_RUN, ctpsv_thread_RLU, ctpsv_thread_RLN,
+  ctpsv_thread_CUU, ctpsv_thread_CUN, ctpsv_thread_CLU, ctpsv_thread_CLN,
+#endif
+};
+#endif
+
 #ifndef CBLAS
 
 void NAME(char *UPLO, char *TRANS, char *DIAG,
@@ -87,6 +112,9 @@ void NAME(char *UPLO, char *TRANS, char *DIAG,
   int unit;
   int trans;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -134,6 +162,9 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
   int trans, uplo, unit;
   blasint info;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -201,7 +232,24 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
   buffer = (FLOAT *)blas_memory_alloc(1);
 
-  (tpsv[(trans<<2) | (uplo<<1) | unit])(n, a, x, incx, buffer);
+#ifdef SMP
+  nthreads = num_cpu_avail(2);
+
+  if (1L * n * n < 65536L * GEMM_MULTITHREAD_THRESHOLD) nthreads = 1;
+
+  FUNCTION_PROFILE_THREADS(nthreads);
+  if (nthreads == 1) {
+#endif
+
+    (tpsv[(trans<<2) | (uplo<<1) | unit])(n, a, x, incx, buffer);
+
+#ifdef SMP
+  } else {
+
+    (tpsv_thread[(trans<<2) | (uplo<<1) | unit])(n, a, x, incx, buffer, nthreads);
+
+  }
+#endif
 
   blas_memory_free(buffer);
 
@@ -254,6 +254,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
   STACK_ALLOC(buffer_size, FLOAT, buffer);
 
 #ifdef SMP
+  FUNCTION_PROFILE_THREADS(nthreads);
   if (nthreads == 1) {
 #endif
 
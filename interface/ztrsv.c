@@ -43,6 +43,10 @@
 #include "functable.h"
 #endif
 
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
 #ifdef XDOUBLE
 #define ERROR_NAME "XTRSV "
 #elif defined(DOUBLE)
@@ -70,6 +74,27 @@ static int (*trsv[])(BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG, void *) = {
 #endif
 };
 
+#ifdef SMP
+static int (*trsv_thread[])(BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG, FLOAT *, int) = {
+#ifdef XDOUBLE
+  xtrsv_thread_NUU, xtrsv_thread_NUN, xtrsv_thread_NLU, xtrsv_thread_NLN,
+  xtrsv_thread_TUU, xtrsv_thread_TUN, xtrsv_thread_TLU, xtrsv_thread_TLN,
+  xtrsv_thread_RUU, xtrsv_thread_RUN, xtrsv_thread_RLU, xtrsv_thread_RLN,
+  xtrsv_thread_CUU, xtrsv_thread_CUN, xtrsv_thread_CLU, xtrsv_thread_CLN,
+#elif defined(DOUBLE)
+  ztrsv_thread_NUU, ztrsv_thread_NUN, ztrsv_thread_NLU, ztrsv_thread_NLN,
+  ztrsv_thread_TUU, ztrsv_thread_TUN, ztrsv_thread_TLU, ztrsv_thread_TLN,
+  ztrsv_thread_RUU, ztrsv_thread_RUN, ztrsv_thread_RLU, ztrsv_thread_RLN,
+  ztrsv_thread_CUU, ztrsv_thread_CUN, ztrsv_thread_CLU, ztrsv_thread_CLN,
+#else
+  ctrsv_thread_NUU, ctrsv_thread_NUN, ctrsv_thread_NLU, ctrsv_thread_NLN,
+  ctrsv_thread_TUU, ctrsv_thread_TUN, ctrsv_thread_TLU, ctrsv_thread_TLN,
+  ctrsv_thread_RUU, ctrsv_thread_RUN, ctrsv_thread_RLU, ctrsv_thread_RLN,
+  ctrsv_thread_CUU, ctrsv_thread_CUN, ctrsv_thread_CLU, ctrsv_thread_CLN,
+#endif
+};
+#endif
+
 #ifndef CBLAS
 
 void NAME(char *UPLO, char *TRANS, char *DIAG,
@@ -88,6 +113,9 @@ void NAME(char *UPLO, char *TRANS, char *DIAG,
   int unit;
   int trans;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -138,6 +166,9 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
   int trans, uplo, unit;
   blasint info;
   FLOAT *buffer;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -207,7 +238,24 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
   buffer = (FLOAT *)blas_memory_alloc(1);
 
-  (trsv[(trans<<2) | (uplo<<1) | unit])(n, a, lda, x, incx, buffer);
+#ifdef SMP
+  nthreads = num_cpu_avail(2);
+
+  if (1L * n * n < 65536L * GEMM_MULTITHREAD_THRESHOLD) nthreads = 1;
+
+  FUNCTION_PROFILE_THREADS(nthreads);
+  if (nthreads == 1) {
+#endif
+
+    (trsv[(trans<<2) | (uplo<<1) | unit])(n, a, lda, x, incx, buffer);
+
+#ifdef SMP
+  } else {
+
+    (trsv_thread[(trans<<2) | (uplo<<1) | unit])(n, a, lda, x, incx, buffer, nthreads);
+
+  }
+#endif
 
   blas_memory_free(buffer);
 
@@ -0,0 +1,67 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* NEON primitives for the unpacked small-matrix GEMM template */
+
+#include "common.h"
+#include <arm_neon.h>
+
+#define SMALL_TARGET
+
+#ifdef DOUBLE
+#define VFLOAT        float64x2_t
+#define VL            2
+#define VZERO()       vdupq_n_f64(0.0)
+#define VLOAD(p)      vld1q_f64(p)
+#define VSTORE(p, v)  vst1q_f64(p, v)
+#define VBCAST(x)     vdupq_n_f64(x)
+#define VMUL(a, b)    vmulq_f64(a, b)
+#define VFMA(c, a, b) vfmaq_f64(c, a, b)
+#define VREDUCE(v)    vaddvq_f64(v)
+#else
+#define VFLOAT        float32x4_t
+#define VL            4
+#define VZERO()       vdupq_n_f32(0.0f)
+#define VLOAD(p)      vld1q_f32(p)
+#define VSTORE(p, v)  vst1q_f32(p, v)
+#define VBCAST(x)     vdupq_n_f32(x)
+#define VMUL(a, b)    vmulq_f32(a, b)
+#define VFMA(c, a, b) vfmaq_f32(c, a, b)
+#define VREDUCE(v)    vaddvq_f32(v)
+#endif
+
+#define VL_MAX        VL
+#define VSETUP
+
+#include "../generic/gemm_small_matrix_kernel_template.c"
@@ -0,0 +1,97 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* int8 gemm micro-kernel for ARMv8.6 I8MM cores (8x8).
+ * sudot by element multiplies four signed A bytes of each row with the four
+ * unsigned bytes of one B column picked by lane, which matches the packed
+ * layout without widening.  Plain sdot can not be used since B is unsigned.
+ */
+
+#include "common.h"
+
+#if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 10) || (defined(__clang__) && __clang_major__ >= 11)
+
+#include <arm_neon.h>
+
+#ifdef __clang__
+#define I8_TARGET __attribute__((target("i8mm")))
+#else
+#define I8_TARGET __attribute__((target("+i8mm")))
+#endif
+
+#define I8_DOT(COL, BV, LANE) \
+  acc0[COL] = vsudotq_laneq_s32(acc0[COL], a0, BV, LANE); \
+  acc1[COL] = vsudotq_laneq_s32(acc1[COL], a1, BV, LANE);
+
+I8_TARGET int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, int8_t *a, uint8_t *b, int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j, l;
+  int s;
+  int8_t  *ap;
+  uint8_t *bp;
+  int32_t *cp;
+
+  for (j = 0; j < n; j += 8) {
+    for (i = 0; i < m; i += 8) {
+      int32x4_t acc0[8], acc1[8];
+
+      for (s = 0; s < 8; s++) {
+	acc0[s] = vdupq_n_s32(0);
+	acc1[s] = vdupq_n_s32(0);
+      }
+
+      ap = a + i * k;
+      bp = b + j * k;
+
+      for (l = 0; l < k; l += 4) {
+	int8x16_t  a0 = vld1q_s8(ap);
+	int8x16_t  a1 = vld1q_s8(ap + 16);
+	uint8x16_t b0 = vld1q_u8(bp);
+	uint8x16_t b1 = vld1q_u8(bp + 16);
+
+	I8_DOT(0, b0, 0); I8_DOT(1, b0, 1); I8_DOT(2, b0, 2); I8_DOT(3, b0, 3);
+	I8_DOT(4, b1, 0); I8_DOT(5, b1, 1); I8_DOT(6, b1, 2); I8_DOT(7, b1, 3);
+
+	ap += 32;
+	bp += 32;
+      }
+
+      for (s = 0; s < 8; s++) {
+	cp = c + i + (j + s) * ldc;
+	vst1q_s32(cp,     vaddq_s32(vld1q_s32(cp),     acc0[s]));
+	vst1q_s32(cp + 4, vaddq_s32(vld1q_s32(cp + 4), acc1[s]));
+      }
+    }
+  }
+
+  return 0;
+}
+
+#else
+#include "../generic/i8gemm_kernel.c"
+#endif
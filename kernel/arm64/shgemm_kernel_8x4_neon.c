@@ -0,0 +1,178 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/* fp16 GEMM micro-kernel for ARMv8 NEON.
+ * Packed panels stay in fp16; A is widened with fcvtl/fcvtl2 per k step,
+ * each B sub-panel is widened once per call and products are accumulated
+ * in fp32 with by-lane fmla.
+ */
+
+#include "common.h"
+#include <arm_neon.h>
+
+#define SH_KBLOCK 512
+
+static inline void shgemm_widen(BLASLONG n, hfloat16 *src, float *dst)
+{
+  BLASLONG i = 0;
+
+  for (; i + 4 <= n; i += 4)
+    vst1q_f32(dst + i, vcvt_f32_f16(vld1_f16((const float16_t *)(src + i))));
+  for (; i < n; i++) {
+    __fp16 h;
+    __builtin_memcpy(&h, src + i, sizeof(h));
+    dst[i] = (float)h;
+  }
+}
+
+static inline float32x4_t shgemm_bcast(float *b, int j)
+{
+  return vld1q_dup_f32(b + j);
+}
+
+static inline void shgemm_8xn(BLASLONG kc, const int nr, hfloat16 *a, float *b, float alpha, float *c, BLASLONG ldc)
+{
+  float32x4_t acc0[4], acc1[4], bj;
+  float16x8_t ah;
+  BLASLONG k;
+  int j;
+
+  for (j = 0; j < nr; j++) {
+    acc0[j] = vdupq_n_f32(0.0f);
+    acc1[j] = vdupq_n_f32(0.0f);
+  }
+
+  for (k = 0; k < kc; k++) {
+    ah = vld1q_f16((const float16_t *)(a + k * 8));
+    float32x4_t a0 = vcvt_f32_f16(vget_low_f16(ah));
+    float32x4_t a1 = vcvt_high_f32_f16(ah);
+    if (nr == 4) {
+      float32x4_t b4 = vld1q_f32(b + k * 4);
+      acc0[0] = vfmaq_laneq_f32(acc0[0], a0, b4, 0);
+      acc1[0] = vfmaq_laneq_f32(acc1[0], a1, b4, 0);
+      acc0[1] = vfmaq_laneq_f32(acc0[1], a0, b4, 1);
+      acc1[1] = vfmaq_laneq_f32(acc1[1], a1, b4, 1);
+      acc0[2] = vfmaq_laneq_f32(acc0[2], a0, b4, 2);
+      acc1[2] = vfmaq_laneq_f32(acc1[2], a1, b4, 2);
+      acc0[3] = vfmaq_laneq_f32(acc0[3], a0, b4, 3);
+      acc1[3] = vfmaq_laneq_f32(acc1[3], a1, b4, 3);
+    } else {
+      for (j = 0; j < nr; j++) {
+        bj = shgemm_bcast(b + k * nr, j);
+        acc0[j] = vfmaq_f32(acc0[j], a0, bj);
+        acc1[j] = vfmaq_f32(acc1[j], a1, bj);
+      }
+    }
+  }
+
+  for (j = 0; j < nr; j++) {
+    vst1q_f32(c + j * ldc,     vfmaq_n_f32(vld1q_f32(c + j * ldc),     acc0[j], alpha));
+    vst1q_f32(c + j * ldc + 4, vfmaq_n_f32(vld1q_f32(c + j * ldc + 4), acc1[j], alpha));
+  }
+}
+
+static inline void shgemm_4xn(BLASLONG kc, const int nr, hfloat16 *a, float *b, float alpha, float *c, BLASLONG ldc)
+{
+  float32x4_t acc[4], a0;
+  BLASLONG k;
+  int j;
+
+  for (j = 0; j < nr; j++) acc[j] = vdupq_n_f32(0.0f);
+
+  for (k = 0; k < kc; k++) {
+    a0 = vcvt_f32_f16(vld1_f16((const float16_t *)(a + k * 4)));
+    for (j = 0; j < nr; j++)
+      acc[j] = vfmaq_f32(acc[j], a0, shgemm_bcast(b + k * nr, j));
+  }
+
+  for (j = 0; j < nr; j++)
+    vst1q_f32(c + j * ldc, vfmaq_n_f32(vld1q_f32(c + j * ldc), acc[j], alpha));
+}
+
+static inline void shgemm_mxn_scalar(BLASLONG kc, int mr, int nr, hfloat16 *a, float *b, float alpha, float *c, BLASLONG ldc)
+{
+  float acc[2][4];
+  BLASLONG k;
+  int i, j;
+
+  for (i = 0; i < mr; i++)
+    for (j = 0; j < nr; j++) acc[i][j] = 0.0f;
+
+  for (k = 0; k < kc; k++) {
+    for (i = 0; i < mr; i++) {
+      __fp16 h;
+      __builtin_memcpy(&h, a + k * mr + i, sizeof(h));
+      for (j = 0; j < nr; j++) acc[i][j] += (float)h * b[k * nr + j];
+    }
+  }
+
+  for (j = 0; j < nr; j++)
+    for (i = 0; i < mr; i++) c[i + j * ldc] += alpha * acc[i][j];
+}
+
+#define SH_DISPATCH(func, kc, nr, a, b, alpha, c, ldc)	\
+  switch (nr) {						\
+  case 4:  func(kc, 4, a, b, alpha, c, ldc); break;	\
+  case 2:  func(kc, 2, a, b, alpha, c, ldc); break;	\
+  default: func(kc, 1, a, b, alpha, c, ldc); break;	\
+  }
+
+int CNAME(BLASLONG bm, BLASLONG bn, BLASLONG bk, float alpha, hfloat16 *ba, hfloat16 *bb, float *C, BLASLONG ldc)
+{
+  float bbuf[SH_KBLOCK * 4];
+  BLASLONG ks, kc, i, j;
+  int mr, nr;
+
+  for (ks = 0; ks < bk; ks += kc) {
+    kc = bk - ks;
+    if (kc > SH_KBLOCK) kc = SH_KBLOCK;
+
+    for (j = 0; j < bn; j += nr) {
+      nr = (bn - j >= 4) ? 4 : (bn - j >= 2) ? 2 : 1;
+
+      shgemm_widen(kc * nr, bb + j * bk + ks * nr, bbuf);
+
+      for (i = 0; i < bm; i += mr) {
+        hfloat16 *a = ba + i * bk;
+        float *c = C + i + j * ldc;
+
+        mr = (bm - i >= 8) ? 8 : (bm - i >= 4) ? 4 : (bm - i >= 2) ? 2 : 1;
+        a += ks * mr;
+
+        if (mr == 8) {
+          SH_DISPATCH(shgemm_8xn, kc, nr, a, bbuf, alpha, c, ldc);
+        } else if (mr == 4) {
+          SH_DISPATCH(shgemm_4xn, kc, nr, a, bbuf, alpha, c, ldc);
+        } else {
+          shgemm_mxn_scalar(kc, mr, nr, a, bbuf, alpha, c, ldc);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,273 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/*
+ * Small-matrix GEMM on the caller's operands, without packing, for the
+ * targets that provide the vector primitives below.  The including file
+ * defines one of TRANS_NN, TRANS_NT, TRANS_TN, TRANS_TT and
+ *
+ *   VFLOAT        vector type holding VL elements of FLOAT
+ *   VL, VL_MAX    elements per vector, and an upper bound for it
+ *   VSETUP        declarations needed before the first vector operation
+ *   VZERO()       VLOAD(p)  VSTORE(p, v)  VBCAST(x)  VMUL(a, b)
+ *   VFMA(c, a, b) c + a * b
+ *   VREDUCE(v)    sum of the elements of v
+ *   SMALL_TARGET  attributes for the functions using them
+ *
+ * NN and NT build columns of C from columns of A, TT builds rows of C from
+ * rows of B and TN forms dot products along K, so every vector load is
+ * unit stride.  The rows (TT: columns) left over after the vector blocks
+ * are done in scalar code.
+ */
+
+#include "common.h"
+
+#if defined(TRANS_NN) || defined(TRANS_NT)
+#define A_ELEM(i, l) A[(i) + (l) * lda]
+#else
+#define A_ELEM(i, l) A[(l) + (i) * lda]
+#endif
+
+#if defined(TRANS_NN) || defined(TRANS_TN)
+#define B_ELEM(l, j) B[(l) + (j) * ldb]
+#else
+#define B_ELEM(l, j) B[(j) + (l) * ldb]
+#endif
+
+#define C_ELEM(i, j) C[(i) + (j) * ldc]
+
+#ifdef B0
+#define STORE_C(i, j, v) C_ELEM(i, j) = alpha * (v)
+#define VSTORE_C(i, j, v) VSTORE(&C_ELEM(i, j), VMUL(v, valpha))
+#else
+#define STORE_C(i, j, v) C_ELEM(i, j) = alpha * (v) + beta * C_ELEM(i, j)
+#define VSTORE_C(i, j, v) VSTORE(&C_ELEM(i, j), VFMA(VMUL(v, valpha), VLOAD(&C_ELEM(i, j)), vbeta))
+#endif
+
+/* a vector along a row of C */
+#define VSTORE_ROW(i, j, v) { \
+  BLASLONG x_; \
+  VSTORE(tmp, v); \
+  for (x_ = 0; x_ < VL; x_++) STORE_C(i, (j) + x_, tmp[x_]); \
+}
+
+/* a dot product along K, finished in scalar code past the last full vector */
+#define STORE_DOT(i, j, v) { \
+  BLASLONG x_; \
+  FLOAT s_ = VREDUCE(v); \
+  for (x_ = kv; x_ < K; x_++) s_ += A_ELEM(i, x_) * B_ELEM(x_, j); \
+  STORE_C(i, j, s_); \
+}
+
+#ifndef TRANS_TN
+static void small_block(BLASLONG m_from, BLASLONG m_to, BLASLONG n_from, BLASLONG n_to, BLASLONG K,
+			IFLOAT *A, BLASLONG lda, FLOAT alpha, IFLOAT *B, BLASLONG ldb, FLOAT beta, FLOAT *C, BLASLONG ldc)
+{
+  BLASLONG i, j, l;
+  FLOAT sum;
+
+  for (j = n_from; j < n_to; j++) {
+    for (i = m_from; i < m_to; i++) {
+      sum = ZERO;
+      for (l = 0; l < K; l++) sum += A_ELEM(i, l) * B_ELEM(l, j);
+      STORE_C(i, j, sum);
+    }
+  }
+}
+#endif
+
+#ifdef B0
+SMALL_TARGET int CNAME(BLASLONG M, BLASLONG N, BLASLONG K, IFLOAT *A, BLASLONG lda, FLOAT alpha, IFLOAT *B, BLASLONG ldb, FLOAT *C, BLASLONG ldc)
+#else
+SMALL_TARGET int CNAME(BLASLONG M, BLASLONG N, BLASLONG K, IFLOAT *A, BLASLONG lda, FLOAT alpha, IFLOAT *B, BLASLONG ldb, FLOAT beta, FLOAT *C, BLASLONG ldc)
+#endif
+{
+  BLASLONG i, j, l;
+#if defined(B0) && !defined(TRANS_TN)
+  FLOAT beta = ZERO;
+#endif
+
+  VSETUP;
+
+#if defined(TRANS_NN) || defined(TRANS_NT)
+
+  BLASLONG mv = M - M % VL;
+  VFLOAT valpha = VBCAST(alpha);
+#ifndef B0
+  VFLOAT vbeta = VBCAST(beta);
+#endif
+
+  for (j = 0; j + 4 <= N; j += 4) {
+    for (i = 0; i + 2 * VL <= M; i += 2 * VL) {
+      VFLOAT c00 = VZERO(), c01 = VZERO(), c02 = VZERO(), c03 = VZERO();
+      VFLOAT c10 = VZERO(), c11 = VZERO(), c12 = VZERO(), c13 = VZERO();
+      for (l = 0; l < K; l++) {
+	VFLOAT a0 = VLOAD(&A_ELEM(i, l));
+	VFLOAT a1 = VLOAD(&A_ELEM(i + VL, l));
+	VFLOAT b;
+	b = VBCAST(B_ELEM(l, j));     c00 = VFMA(c00, a0, b); c10 = VFMA(c10, a1, b);
+	b = VBCAST(B_ELEM(l, j + 1)); c01 = VFMA(c01, a0, b); c11 = VFMA(c11, a1, b);
+	b = VBCAST(B_ELEM(l, j + 2)); c02 = VFMA(c02, a0, b); c12 = VFMA(c12, a1, b);
+	b = VBCAST(B_ELEM(l, j + 3)); c03 = VFMA(c03, a0, b); c13 = VFMA(c13, a1, b);
+      }
+      VSTORE_C(i, j,     c00); VSTORE_C(i + VL, j,     c10);
+      VSTORE_C(i, j + 1, c01); VSTORE_C(i + VL, j + 1, c11);
+      VSTORE_C(i, j + 2, c02); VSTORE_C(i + VL, j + 2, c12);
+      VSTORE_C(i, j + 3, c03); VSTORE_C(i + VL, j + 3, c13);
+    }
+    for (; i + VL <= M; i += VL) {
+      VFLOAT c00 = VZERO(), c01 = VZERO(), c02 = VZERO(), c03 = VZERO();
+      for (l = 0; l < K; l++) {
+	VFLOAT a0 = VLOAD(&A_ELEM(i, l));
+	c00 = VFMA(c00, a0, VBCAST(B_ELEM(l, j)));
+	c01 = VFMA(c01, a0, VBCAST(B_ELEM(l, j + 1)));
+	c02 = VFMA(c02, a0, VBCAST(B_ELEM(l, j + 2)));
+	c03 = VFMA(c03, a0, VBCAST(B_ELEM(l, j + 3)));
+      }
+      VSTORE_C(i, j, c00); VSTORE_C(i, j + 1, c01);
+      VSTORE_C(i, j + 2, c02); VSTORE_C(i, j + 3, c03);
+    }
+  }
+
+  for (; j < N; j++) {
+    for (i = 0; i + 2 * VL <= M; i += 2 * VL) {
+      VFLOAT c00 = VZERO(), c10 = VZERO();
+      for (l = 0; l < K; l++) {
+	VFLOAT b = VBCAST(B_ELEM(l, j));
+	c00 = VFMA(c00, VLOAD(&A_ELEM(i, l)), b);
+	c10 = VFMA(c10, VLOAD(&A_ELEM(i + VL, l)), b);
+      }
+      VSTORE_C(i, j, c00); VSTORE_C(i + VL, j, c10);
+    }
+    for (; i + VL <= M; i += VL) {
+      VFLOAT c00 = VZERO();
+      for (l = 0; l < K; l++) c00 = VFMA(c00, VLOAD(&A_ELEM(i, l)), VBCAST(B_ELEM(l, j)));
+      VSTORE_C(i, j, c00);
+    }
+  }
+
+  if (mv < M) small_block(mv, M, 0, N, K, A, lda, alpha, B, ldb, beta, C, ldc);
+
+#elif defined(TRANS_TT)
+
+  BLASLONG nv = N - N % VL;
+  FLOAT tmp[VL_MAX];
+
+  for (i = 0; i + 4 <= M; i += 4) {
+    for (j = 0; j + 2 * VL <= N; j += 2 * VL) {
+      VFLOAT c00 = VZERO(), c10 = VZERO(), c20 = VZERO(), c30 = VZERO();
+      VFLOAT c01 = VZERO(), c11 = VZERO(), c21 = VZERO(), c31 = VZERO();
+      for (l = 0; l < K; l++) {
+	VFLOAT b0 = VLOAD(&B_ELEM(l, j));
+	VFLOAT b1 = VLOAD(&B_ELEM(l, j + VL));
+	VFLOAT a;
+	a = VBCAST(A_ELEM(i, l));     c00 = VFMA(c00, b0, a); c01 = VFMA(c01, b1, a);
+	a = VBCAST(A_ELEM(i + 1, l)); c10 = VFMA(c10, b0, a); c11 = VFMA(c11, b1, a);
+	a = VBCAST(A_ELEM(i + 2, l)); c20 = VFMA(c20, b0, a); c21 = VFMA(c21, b1, a);
+	a = VBCAST(A_ELEM(i + 3, l)); c30 = VFMA(c30, b0, a); c31 = VFMA(c31, b1, a);
+      }
+      VSTORE_ROW(i,     j, c00); VSTORE_ROW(i,     j + VL, c01);
+      VSTORE_ROW(i + 1, j, c10); VSTORE_ROW(i + 1, j + VL, c11);
+      VSTORE_ROW(i + 2, j, c20); VSTORE_ROW(i + 2, j + VL, c21);
+      VSTORE_ROW(i + 3, j, c30); VSTORE_ROW(i + 3, j + VL, c31);
+    }
+    for (; j + VL <= N; j += VL) {
+      VFLOAT c00 = VZERO(), c10 = VZERO(), c20 = VZERO(), c30 = VZERO();
+      for (l = 0; l < K; l++) {
+	VFLOAT b0 = VLOAD(&B_ELEM(l, j));
+	c00 = VFMA(c00, b0, VBCAST(A_ELEM(i, l)));
+	c10 = VFMA(c10, b0, VBCAST(A_ELEM(i + 1, l)));
+	c20 = VFMA(c20, b0, VBCAST(A_ELEM(i + 2, l)));
+	c30 = VFMA(c30, b0, VBCAST(A_ELEM(i + 3, l)));
+      }
+      VSTORE_ROW(i, j, c00); VSTORE_ROW(i + 1, j, c10);
+      VSTORE_ROW(i + 2, j, c20); VSTORE_ROW(i + 3, j, c30);
+    }
+  }
+
+  for (; i < M; i++) {
+    for (j = 0; j + VL <= N; j += VL) {
+      VFLOAT c00 = VZERO();
+      for (l = 0; l < K; l++) c00 = VFMA(c00, VLOAD(&B_ELEM(l, j)), VBCAST(A_ELEM(i, l)));
+      VSTORE_ROW(i, j, c00);
+    }
+  }
+
+  if (nv < N) small_block(0, M, nv, N, K, A, lda, alpha, B, ldb, beta, C, ldc);
+
+#else /* TRANS_TN */
+
+  BLASLONG kv = K - K % VL;
+
+  for (j = 0; j + 2 <= N; j += 2) {
+    for (i = 0; i + 4 <= M; i += 4) {
+      VFLOAT c00 = VZERO(), c10 = VZERO(), c20 = VZERO(), c30 = VZERO();
+      VFLOAT c01 = VZERO(), c11 = VZERO(), c21 = VZERO(), c31 = VZERO();
+      for (l = 0; l < kv; l += VL) {
+	VFLOAT b0 = VLOAD(&B_ELEM(l, j));
+	VFLOAT b1 = VLOAD(&B_ELEM(l, j + 1));
+	VFLOAT a;
+	a = VLOAD(&A_ELEM(i, l));     c00 = VFMA(c00, a, b0); c01 = VFMA(c01, a, b1);
+	a = VLOAD(&A_ELEM(i + 1, l)); c10 = VFMA(c10, a, b0); c11 = VFMA(c11, a, b1);
+	a = VLOAD(&A_ELEM(i + 2, l)); c20 = VFMA(c20, a, b0); c21 = VFMA(c21, a, b1);
+	a = VLOAD(&A_ELEM(i + 3, l)); c30 = VFMA(c30, a, b0); c31 = VFMA(c31, a, b1);
+      }
+      STORE_DOT(i,     j, c00); STORE_DOT(i,     j + 1, c01);
+      STORE_DOT(i + 1, j, c10); STORE_DOT(i + 1, j + 1, c11);
+      STORE_DOT(i + 2, j, c20); STORE_DOT(i + 2, j + 1, c21);
+      STORE_DOT(i + 3, j, c30); STORE_DOT(i + 3, j + 1, c31);
+    }
+    for (; i < M; i++) {
+      VFLOAT c00 = VZERO(), c01 = VZERO();
+      for (l = 0; l < kv; l += VL) {
+	VFLOAT a = VLOAD(&A_ELEM(i, l));
+	c00 = VFMA(c00, a, VLOAD(&B_ELEM(l, j)));
+	c01 = VFMA(c01, a, VLOAD(&B_ELEM(l, j + 1)));
+      }
+      STORE_DOT(i, j, c00); STORE_DOT(i, j + 1, c01);
+    }
+  }
+
+  for (; j < N; j++) {
+    for (i = 0; i < M; i++) {
+      VFLOAT c00 = VZERO();
+      for (l = 0; l < kv; l += VL) c00 = VFMA(c00, VLOAD(&A_ELEM(i, l)), VLOAD(&B_ELEM(l, j)));
+      STORE_DOT(i, j, c00);
+    }
+  }
+
+#endif
+
+  return 0;
+}
@@ -0,0 +1,72 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "common.h"
+
+#ifndef L1_DATA_SIZE
+#define L1_DATA_SIZE 32768
+#endif
+
+#ifndef L2_SIZE
+#define L2_SIZE 262144
+#endif
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+/*
+ * Permit for gemm_small_matrix_kernel_template.c.  Its loops sweep one
+ * operand (A, or B for TT) once per block of four columns (rows) of C while
+ * holding a four-wide panel of the other, so the unpacked kernel only keeps
+ * up with the packed one while the swept operand fits in half of L2 and
+ * the panel in half of L1.  With A transposed the kernels keep more streams
+ * in flight (TN) or scatter their results along rows of C (TT), and they
+ * fall behind once the swept operand passes a quarter of L2.  Problems the
+ * interface would split between threads are left to the threaded driver.
+ */
+int CNAME(int transa, int transb, BLASLONG M, BLASLONG N, BLASLONG K, FLOAT alpha, FLOAT beta)
+{
+	double swept = (transa && transb) ? (double) K * (double) N : (double) M * (double) K;
+
+	if (swept * sizeof(FLOAT) > (transa ? L2_SIZE / 4 : L2_SIZE / 2))
+		return 0;
+	if (4.0 * K * sizeof(FLOAT) > L1_DATA_SIZE / 2)
+		return 0;
+#ifdef SMP
+	if ((double) M * (double) N * (double) K > 65536.0 * GEMM_MULTITHREAD_THRESHOLD && num_cpu_avail(3) > 1)
+		return 0;
+#endif
+	return 1;
+}
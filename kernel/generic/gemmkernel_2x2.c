@@ -13,6 +13,9 @@ bfloat16tof32 (bfloat16 f16)
   return result;
 }
 #define BF16TOF32(x) (bfloat16tof32(x))
+#elif defined(HFLOAT16)
+#include "hf16_common.h"
+#define BF16TOF32(x) (hf16_to_float(x))
 #else
 #define BF16TOF32(x) x
 #endif
@@ -0,0 +1,97 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+#ifndef __HF16_COMMON_H
+#define __HF16_COMMON_H
+
+#include <stdint.h>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+/* Scalar IEEE 754 binary16 <-> binary32 conversions.
+ * - float to half rounds to nearest even, overflow goes to infinity
+ * - half subnormals are produced and consumed exactly
+ * - NAN payloads are truncated, quietness is preserved
+ */
+static inline float hf16_to_float(hfloat16 h)
+{
+#if defined(__F16C__)
+  return _cvtsh_ss(h);
+#elif defined(__aarch64__) && defined(__GNUC__)
+  __fp16 v;
+  __builtin_memcpy(&v, &h, sizeof(v));
+  return (float)v;
+#else
+  union { float f; uint32_t u; } v;
+  uint32_t sign = ((uint32_t)h & 0x8000u) << 16;
+  uint32_t em   = (uint32_t)h & 0x7fffu;
+
+  if (em >= 0x7c00u) {                  /* infinity or NAN */
+    v.u = sign | 0x7f800000u | ((em & 0x3ffu) << 13);
+  } else if (em >= 0x0400u) {           /* normal */
+    v.u = sign | ((em << 13) + 0x38000000u);
+  } else {                              /* subnormal or zero: em * 2^-24 */
+    v.f = (float)em * 5.9604644775390625e-8f;
+    v.u |= sign;
+  }
+  return v.f;
+#endif
+}
+
+static inline hfloat16 hf16_from_float(float f)
+{
+#if defined(__F16C__)
+  return (hfloat16)_cvtss_sh(f, 0);
+#elif defined(__aarch64__) && defined(__GNUC__)
+  __fp16 v = (__fp16)f;
+  hfloat16 h;
+  __builtin_memcpy(&h, &v, sizeof(h));
+  return h;
+#else
+  union { float f; uint32_t u; } v;
+  uint32_t sign, ax;
+
+  v.f  = f;
+  sign = (v.u >> 16) & 0x8000u;
+  ax   = v.u & 0x7fffffffu;
+
+  if (ax >= 0x7f800000u)                /* infinity or NAN */
+    return (hfloat16)(sign | 0x7c00u | (ax > 0x7f800000u ? 0x200u | ((ax >> 13) & 0x3ffu) : 0));
+  if (ax >= 0x477ff000u)                /* rounds beyond 65504 */
+    return (hfloat16)(sign | 0x7c00u);
+  if (ax < 0x38800000u) {               /* half subnormal: let the FPU round */
+    v.u  = ax;
+    v.f += 0.5f;
+    return (hfloat16)(sign | (v.u - 0x3f000000u));
+  }
+  ax += 0xc8000fffu + ((ax >> 13) & 1);  /* rebias exponent, round to nearest even */
+  return (hfloat16)(sign | (ax >> 13));
+#endif
+}
+
+#endif
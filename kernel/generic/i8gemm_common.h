@@ -0,0 +1,56 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* Packed operand layout of the int8 gemm (cblas_gemm_s8u8s32).
+ *
+ * An operand is cut into panels of U rows of A (or U columns of B), U being
+ * I8GEMM_DEFAULT_UNROLL_M or _N; the last panel is zero padded to U.  Within
+ * a panel k runs in groups of four, each group holding the four consecutive
+ * k values of the U rows back to back:
+ *
+ *   panel[(l / 4) * U * 4 + r * 4 + (l % 4)] = X(r, l)
+ *
+ * which is the operand layout of VNNI vpdpbusd and AMX tiles.  k is zero
+ * padded to I8GEMM_ALIGN_K, so a panel takes round_up(k, I8GEMM_ALIGN_K) * U
+ * bytes.
+ */
+
+#ifndef __I8GEMM_COMMON_H
+#define __I8GEMM_COMMON_H
+
+#ifdef I8GEMM_PACK_B
+#define I8_UNROLL	I8GEMM_DEFAULT_UNROLL_N
+typedef uint8_t i8pack_t;
+#else
+#define I8_UNROLL	I8GEMM_DEFAULT_UNROLL_M
+typedef int8_t  i8pack_t;
+#endif
+
+#define I8_ROUND_K(k)	(((k) + I8GEMM_ALIGN_K - 1) & ~((BLASLONG)I8GEMM_ALIGN_K - 1))
+
+#endif
@@ -0,0 +1,70 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* Reference int8 gemm kernel: C(m x n, int32) += A(int8) * B(uint8).
+ * k is a multiple of 4 and the packed panels as well as C are padded to
+ * whole I8GEMM_DEFAULT_UNROLL_M x I8GEMM_DEFAULT_UNROLL_N tiles, so only
+ * full tiles are computed.
+ */
+
+#include "common.h"
+
+#define MR	I8GEMM_DEFAULT_UNROLL_M
+#define NR	I8GEMM_DEFAULT_UNROLL_N
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, int8_t *a, uint8_t *b, int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j, l, r, s;
+  int8_t  *ap;
+  uint8_t *bp;
+  int32_t acc[MR * NR];
+
+  for (j = 0; j < n; j += NR) {
+    for (i = 0; i < m; i += MR) {
+      ap = a + i * k;
+      bp = b + j * k;
+
+      for (r = 0; r < MR * NR; r++) acc[r] = 0;
+
+      for (l = 0; l < k; l += 4) {
+	for (s = 0; s < NR; s++)
+	  for (r = 0; r < MR; r++)
+	    acc[r + s * MR] += ap[r * 4 + 0] * bp[s * 4 + 0] + ap[r * 4 + 1] * bp[s * 4 + 1]
+	                     + ap[r * 4 + 2] * bp[s * 4 + 2] + ap[r * 4 + 3] * bp[s * 4 + 3];
+	ap += MR * 4;
+	bp += NR * 4;
+      }
+
+      for (s = 0; s < NR; s++)
+	for (r = 0; r < MR; r++)
+	  c[i + r + (j + s) * ldc] += acc[r + s * MR];
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* Packs X(p, l) = a[l + p * lda], i.e. the U wide panel runs across columns
+ * of the source.  Used for A transposed and B not transposed.
+ * See i8gemm_common.h for the packed layout.
+ */
+
+#include "common.h"
+#include "i8gemm_common.h"
+
+int CNAME(BLASLONG k, BLASLONG m, i8pack_t *a, BLASLONG lda, i8pack_t *b){
+
+  BLASLONG i, l, r, q, mr;
+  BLASLONG kp = I8_ROUND_K(k);
+  i8pack_t *ap;
+
+  for (i = 0; i < m; i += I8_UNROLL) {
+    mr = m - i;
+    if (mr > I8_UNROLL) mr = I8_UNROLL;
+
+    for (l = 0; l < kp; l += 4) {
+      for (r = 0; r < I8_UNROLL; r++) {
+	ap = a + l + (i + r) * lda;
+	if (r < mr && l + 4 <= k) {
+	  b[0] = ap[0];
+	  b[1] = ap[1];
+	  b[2] = ap[2];
+	  b[3] = ap[3];
+	} else {
+	  for (q = 0; q < 4; q++) b[q] = (r < mr && l + q < k) ? ap[q] : 0;
+	}
+	b += 4;
+      }
+    }
+  }
+
+  return 0;
+}
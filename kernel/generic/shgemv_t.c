@@ -0,0 +1,54 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+#include "hf16_common.h"
+
+/* y = alpha * A^T * x + beta * y, fp16 inputs widened and accumulated in fp32 */
+int CNAME(BLASLONG m, BLASLONG n, float alpha, hfloat16 *a, BLASLONG lda, hfloat16 *x, BLASLONG incx, float beta, float *y, BLASLONG incy)
+{
+  BLASLONG i, j;
+  float temp;
+  hfloat16 *x_ptr;
+
+  if (m < 1 || n < 1) return(0);
+
+  for (j = 0; j < n; j++) {
+    temp  = ZERO;
+    x_ptr = x;
+    for (i = 0; i < m; i++) {
+      temp  += hf16_to_float(a[i]) * hf16_to_float(*x_ptr);
+      x_ptr += incx;
+    }
+    if (beta == ZERO) *y = alpha * temp;
+    else              *y = alpha * temp + beta * *y;
+    a += lda;
+    y += incy;
+  }
+
+  return(0);
+}
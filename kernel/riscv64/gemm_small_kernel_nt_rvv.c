@@ -0,0 +1,2 @@
+#define TRANS_NT
+#include "gemm_small_kernel_template_rvv.c"
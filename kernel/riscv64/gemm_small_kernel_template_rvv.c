@@ -0,0 +1,69 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/*
+ * RVV primitives for the unpacked small-matrix GEMM template.  The vector
+ * length is fixed per call at min(VLMAX, VL_MAX) for LMUL=1, which leaves
+ * the template the whole register file for its accumulators.
+ */
+
+#include "common.h"
+
+#define SMALL_TARGET
+#define VL_MAX        16
+#define VL            ((BLASLONG) vl)
+
+#ifdef DOUBLE
+#define VFLOAT        vfloat64m1_t
+#define VSETUP        size_t vl = __riscv_vsetvl_e64m1(VL_MAX)
+#define VZERO()       __riscv_vfmv_v_f_f64m1(0.0, vl)
+#define VLOAD(p)      __riscv_vle64_v_f64m1(p, vl)
+#define VSTORE(p, v)  __riscv_vse64_v_f64m1(p, v, vl)
+#define VBCAST(x)     __riscv_vfmv_v_f_f64m1(x, vl)
+#define VMUL(a, b)    __riscv_vfmul_vv_f64m1(a, b, vl)
+#define VFMA(c, a, b) __riscv_vfmacc_vv_f64m1(c, a, b, vl)
+#define VREDUCE(v)    __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredusum_vs_f64m1_f64m1(v, VZERO(), vl))
+#else
+#define VFLOAT        vfloat32m1_t
+#define VSETUP        size_t vl = __riscv_vsetvl_e32m1(VL_MAX)
+#define VZERO()       __riscv_vfmv_v_f_f32m1(0.0f, vl)
+#define VLOAD(p)      __riscv_vle32_v_f32m1(p, vl)
+#define VSTORE(p, v)  __riscv_vse32_v_f32m1(p, v, vl)
+#define VBCAST(x)     __riscv_vfmv_v_f_f32m1(x, vl)
+#define VMUL(a, b)    __riscv_vfmul_vv_f32m1(a, b, vl)
+#define VFMA(c, a, b) __riscv_vfmacc_vv_f32m1(c, a, b, vl)
+#define VREDUCE(v)    __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredusum_vs_f32m1_f32m1(v, VZERO(), vl))
+#endif
+
+#include "../generic/gemm_small_matrix_kernel_template.c"
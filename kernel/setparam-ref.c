@@ -55,6 +55,7 @@ gotoblas_t TABLE_NAME = {
   SWITCH_RATIO,
 
   GEMM_DEFAULT_OFFSET_A, GEMM_DEFAULT_OFFSET_B, GEMM_DEFAULT_ALIGN,
+  0, // need_amxtile_permission
 
 #ifdef BUILD_BFLOAT16
   0, 0, 0,
@@ -66,7 +67,6 @@ gotoblas_t TABLE_NAME = {
 #endif
 
   SBGEMM_ALIGN_K,
-  0, // need_amxtile_permission
 
   sbstobf16_kTS, sbdtobf16_kTS, sbf16tos_kTS, dbf16tod_kTS,
 
@@ -125,6 +125,29 @@ gotoblas_t TABLE_NAME = {
 #endif
 #endif
 
+#ifdef BUILD_HFLOAT16
+  SHGEMM_DEFAULT_P, SHGEMM_DEFAULT_Q, SHGEMM_DEFAULT_R,
+  SHGEMM_DEFAULT_UNROLL_M, SHGEMM_DEFAULT_UNROLL_N,
+  MAX(SHGEMM_DEFAULT_UNROLL_M, SHGEMM_DEFAULT_UNROLL_N),
+
+  shstohf16_kTS, shf16tos_kTS,
+  shgemv_nTS, shgemv_tTS,
+
+  shgemm_kernelTS, shgemm_betaTS,
+  shgemm_incopyTS, shgemm_itcopyTS,
+  shgemm_oncopyTS, shgemm_otcopyTS,
+#endif
+
+#if (BUILD_SINGLE==1)
+  I8GEMM_DEFAULT_P, I8GEMM_DEFAULT_Q, I8GEMM_DEFAULT_R,
+  I8GEMM_DEFAULT_UNROLL_M, I8GEMM_DEFAULT_UNROLL_N,
+  I8GEMM_ALIGN_K,
+
+  i8gemm_kernelTS,
+  i8gemm_incopyTS, i8gemm_itcopyTS,
+  i8gemm_oncopyTS, i8gemm_otcopyTS,
+#endif
+
 #if ( BUILD_SINGLE==1) || (BUILD_DOUBLE==1) || (BUILD_COMPLEX==1) || (BUILD_COMPLEX16==1)
   0, 0, 0,
   SGEMM_DEFAULT_UNROLL_M, SGEMM_DEFAULT_UNROLL_N,
@@ -1937,10 +1960,8 @@ static void init_parameter(void) {
 #endif
 
 #ifdef SAPPHIRERAPIDS
-#if (BUILD_BFLOAT16 == 1)
   TABLE_NAME.need_amxtile_permission = 1;
 #endif
-#endif
 
 #if BUILD_COMPLEX==1
 #ifdef CGEMM3M_DEFAULT_P
@@ -2003,56 +2024,56 @@ static void init_parameter(void) {
 #endif
 
 #if BUILD_BFLOAT16==1
-  TABLE_NAME.sbgemm_r = (((BUFFER_SIZE -
+  TABLE_NAME.sbgemm_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.sbgemm_p * TABLE_NAME.sbgemm_q *  4 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 			       ) / (TABLE_NAME.sbgemm_q *  4) - 15) & ~15);
 #endif
 
 #if BUILD_SINGLE==1
-  TABLE_NAME.sgemm_r = (((BUFFER_SIZE -
+  TABLE_NAME.sgemm_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.sgemm_p * TABLE_NAME.sgemm_q *  4 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 			       ) / (TABLE_NAME.sgemm_q *  4) - 15) & ~15);
 #endif
 
 #if BUILD_DOUBLE==1
-  TABLE_NAME.dgemm_r = (((BUFFER_SIZE -
+  TABLE_NAME.dgemm_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.dgemm_p * TABLE_NAME.dgemm_q *  8 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 			       ) / (TABLE_NAME.dgemm_q *  8) - 15) & ~15);
 #endif
 
 #ifdef EXPRECISION
-  TABLE_NAME.qgemm_r = (((BUFFER_SIZE -
+  TABLE_NAME.qgemm_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.qgemm_p * TABLE_NAME.qgemm_q * 16 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 			       ) / (TABLE_NAME.qgemm_q * 16) - 15) & ~15);
 #endif
 
 #if BUILD_COMPLEX ==1 
-  TABLE_NAME.cgemm_r = (((BUFFER_SIZE -
+  TABLE_NAME.cgemm_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.cgemm_p * TABLE_NAME.cgemm_q *  8 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 			       ) / (TABLE_NAME.cgemm_q *  8) - 15) & ~15);
 #endif
 
 #if BUILD_COMPLEX16 ==1
-  TABLE_NAME.zgemm_r = (((BUFFER_SIZE -
+  TABLE_NAME.zgemm_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.zgemm_p * TABLE_NAME.zgemm_q * 16 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 			       ) / (TABLE_NAME.zgemm_q * 16) - 15) & ~15);
 #endif
 
 #if BUILD_COMPLEX == 1
-  TABLE_NAME.cgemm3m_r = (((BUFFER_SIZE -
+  TABLE_NAME.cgemm3m_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.cgemm3m_p * TABLE_NAME.cgemm3m_q *  8 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 			       ) / (TABLE_NAME.cgemm3m_q *  8) - 15) & ~15);
 #endif
 
 #if BUILD_COMPLEX16 == 1
-  TABLE_NAME.zgemm3m_r = (((BUFFER_SIZE -
+  TABLE_NAME.zgemm3m_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.zgemm3m_p * TABLE_NAME.zgemm3m_q * 16 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 			       ) / (TABLE_NAME.zgemm3m_q * 16) - 15) & ~15);
@@ -2061,12 +2082,12 @@ static void init_parameter(void) {
 
 
 #ifdef EXPRECISION
-  TABLE_NAME.xgemm_r = (((BUFFER_SIZE -
+  TABLE_NAME.xgemm_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.xgemm_p * TABLE_NAME.xgemm_q * 32 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 		       ) / (TABLE_NAME.xgemm_q * 32) - 15) & ~15);
 
-  TABLE_NAME.xgemm3m_r = (((BUFFER_SIZE -
+  TABLE_NAME.xgemm3m_r = (((blas_buffer_size() -
 			       ((TABLE_NAME.xgemm3m_p * TABLE_NAME.xgemm3m_q * 32 + TABLE_NAME.offsetA
 				 + TABLE_NAME.align) & ~TABLE_NAME.align)
 		       ) / (TABLE_NAME.xgemm3m_q * 32) - 15) & ~15);
@@ -0,0 +1,2 @@
+#define TRANS_NN
+#include "gemm_small_kernel_template_haswell.c"
@@ -0,0 +1,92 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* AVX2/FMA primitives for the unpacked small-matrix GEMM template */
+
+#include "common.h"
+
+#if (defined(__GNUC__) && __GNUC__ > 6) || (defined(__clang__) && __clang_major__ >= 6)
+
+#include <immintrin.h>
+
+#define SMALL_TARGET __attribute__((target("avx2,fma")))
+
+#ifdef DOUBLE
+#define VFLOAT        __m256d
+#define VL            4
+#define VZERO()       _mm256_setzero_pd()
+#define VLOAD(p)      _mm256_loadu_pd(p)
+#define VSTORE(p, v)  _mm256_storeu_pd(p, v)
+#define VBCAST(x)     _mm256_set1_pd(x)
+#define VMUL(a, b)    _mm256_mul_pd(a, b)
+#define VFMA(c, a, b) _mm256_fmadd_pd(a, b, c)
+
+static inline SMALL_TARGET double small_reduce(__m256d v)
+{
+  __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+#else
+#define VFLOAT        __m256
+#define VL            8
+#define VZERO()       _mm256_setzero_ps()
+#define VLOAD(p)      _mm256_loadu_ps(p)
+#define VSTORE(p, v)  _mm256_storeu_ps(p, v)
+#define VBCAST(x)     _mm256_set1_ps(x)
+#define VMUL(a, b)    _mm256_mul_ps(a, b)
+#define VFMA(c, a, b) _mm256_fmadd_ps(a, b, c)
+
+static inline SMALL_TARGET float small_reduce(__m256 v)
+{
+  __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehdup_ps(s)));
+}
+#endif
+
+#define VL_MAX        VL
+#define VSETUP
+#define VREDUCE(v)    small_reduce(v)
+
+#include "../generic/gemm_small_matrix_kernel_template.c"
+
+#elif defined(TRANS_NN)
+#include "../generic/gemm_small_matrix_kernel_nn.c"
+#elif defined(TRANS_NT)
+#include "../generic/gemm_small_matrix_kernel_nt.c"
+#elif defined(TRANS_TN)
+#include "../generic/gemm_small_matrix_kernel_tn.c"
+#else
+#include "../generic/gemm_small_matrix_kernel_tt.c"
+#endif
@@ -0,0 +1,2 @@
+#define TRANS_TT
+#include "gemm_small_kernel_template_haswell.c"
@@ -0,0 +1,115 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* int8 gemm micro-kernel for AMX-INT8 (Sapphire Rapids), 32x32 per step.
+ * The product is formed transposed, C^T = B^T * A^T, so that the unsigned
+ * B operand lands in the row tile of tdpbusd and the accumulator tiles are
+ * the column major C tiles: tile rows are columns of C.  A is consumed in
+ * the common packed layout (16 groups of four k per tile), B comes from the
+ * Sapphire Rapids copies as rows of 64 consecutive k per column.
+ * The caller must have obtained XTILEDATA permission.
+ */
+
+#include <string.h>
+#include "common.h"
+
+#if (defined(__GNUC__) && __GNUC__ >= 11) || (defined(__clang__) && __clang_major__ >= 12)
+
+#include <immintrin.h>
+
+#define I8_TARGET __attribute__((target("amx-tile,amx-int8")))
+
+typedef struct {
+  uint8_t  palette_id;
+  uint8_t  start_row;
+  uint8_t  reserved[14];
+  uint16_t colsb[16];
+  uint8_t  rows[16];
+} i8_tilecfg_t;
+
+I8_TARGET int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, int8_t *a, uint8_t *b, int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j, l;
+  BLASLONG stride = ldc * sizeof(int32_t);
+  int8_t  *ap;
+  uint8_t *bp;
+  int32_t *cp;
+  i8_tilecfg_t cfg;
+  int t;
+
+  /* tmm0-3 C, tmm4-5 B (16 columns x 64 k), tmm6-7 A (16 groups x 16 rows) */
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.palette_id = 1;
+  for (t = 0; t < 8; t++) {
+    cfg.rows[t]  = 16;
+    cfg.colsb[t] = 64;
+  }
+  _tile_loadconfig(&cfg);
+
+  for (j = 0; j < n; j += 32) {
+    for (i = 0; i < m; i += 32) {
+      cp = c + i + j * ldc;
+
+      _tile_loadd(0, cp,                 stride);
+      _tile_loadd(1, cp + 16,            stride);
+      _tile_loadd(2, cp + 16 * ldc,      stride);
+      _tile_loadd(3, cp + 16 * ldc + 16, stride);
+
+      ap = a + i * k;
+      bp = b + j * k;
+
+      for (l = 0; l < k; l += 64) {
+	_tile_loadd(4, bp,           64);
+	_tile_loadd(5, bp + 16 * 64, 64);
+	_tile_loadd(6, ap,      128);
+	_tile_loadd(7, ap + 64, 128);
+
+	_tile_dpbusd(0, 4, 6);
+	_tile_dpbusd(1, 4, 7);
+	_tile_dpbusd(2, 5, 6);
+	_tile_dpbusd(3, 5, 7);
+
+	ap += 32 * 64;
+	bp += 32 * 64;
+      }
+
+      _tile_stored(0, cp,                 stride);
+      _tile_stored(1, cp + 16,            stride);
+      _tile_stored(2, cp + 16 * ldc,      stride);
+      _tile_stored(3, cp + 16 * ldc + 16, stride);
+    }
+  }
+
+  _tile_release();
+
+  return 0;
+}
+
+#else
+#include "../generic/i8gemm_kernel.c"
+#endif
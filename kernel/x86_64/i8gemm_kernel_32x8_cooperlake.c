@@ -0,0 +1,100 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* int8 gemm micro-kernel for AVX512-VNNI cores (32x8).
+ * vpdpbusd multiplies the four unsigned bytes of a broadcast B group with
+ * the four signed bytes of each A row and adds them into an int32 lane, so
+ * the packed layout feeds it directly; 16 accumulators hide its latency.
+ */
+
+#include <string.h>
+#include "common.h"
+
+#if (defined(__GNUC__) && __GNUC__ >= 8) || (defined(__clang__) && __clang_major__ >= 6)
+
+#include <immintrin.h>
+
+#define I8_TARGET __attribute__((target("avx512f,avx512bw,avx512vnni")))
+
+static inline int32_t i8_load4(const uint8_t *p){
+  int32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+#define I8_FMA(COL) { \
+  __m512i bw = _mm512_set1_epi32(i8_load4(bp + COL * 4)); \
+  acc0[COL] = _mm512_dpbusd_epi32(acc0[COL], bw, a0); \
+  acc1[COL] = _mm512_dpbusd_epi32(acc1[COL], bw, a1); \
+}
+
+I8_TARGET int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, int8_t *a, uint8_t *b, int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j, l;
+  int s;
+  int8_t  *ap;
+  uint8_t *bp;
+  int32_t *cp;
+
+  for (j = 0; j < n; j += 8) {
+    for (i = 0; i < m; i += 32) {
+      __m512i acc0[8], acc1[8];
+
+      for (s = 0; s < 8; s++) {
+	acc0[s] = _mm512_setzero_si512();
+	acc1[s] = _mm512_setzero_si512();
+      }
+
+      ap = a + i * k;
+      bp = b + j * k;
+
+      for (l = 0; l < k; l += 4) {
+	__m512i a0 = _mm512_loadu_si512(ap);
+	__m512i a1 = _mm512_loadu_si512(ap + 64);
+
+	I8_FMA(0); I8_FMA(1); I8_FMA(2); I8_FMA(3);
+	I8_FMA(4); I8_FMA(5); I8_FMA(6); I8_FMA(7);
+
+	ap += 128;
+	bp += 32;
+      }
+
+      for (s = 0; s < 8; s++) {
+	cp = c + i + (j + s) * ldc;
+	_mm512_storeu_si512(cp,      _mm512_add_epi32(_mm512_loadu_si512(cp),      acc0[s]));
+	_mm512_storeu_si512(cp + 16, _mm512_add_epi32(_mm512_loadu_si512(cp + 16), acc1[s]));
+      }
+    }
+  }
+
+  return 0;
+}
+
+#else
+#include "../generic/i8gemm_kernel.c"
+#endif
@@ -0,0 +1,102 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* int8 gemm micro-kernel for AVX2 cores without VNNI (8x4).
+ * Each group of four k values of an A panel is sign extended to int16 and
+ * multiplied with the zero extended B column through vpmaddwd, which is
+ * exact for int8 x uint8 (vpmaddubsw would saturate).  The pairwise sums
+ * are folded into one int32 per row only when the tile is stored.
+ */
+
+#include "common.h"
+
+#if (defined(__GNUC__) && __GNUC__ > 6) || (defined(__clang__) && __clang_major__ >= 6)
+
+#include <immintrin.h>
+
+#define I8_TARGET __attribute__((target("avx2")))
+
+#define I8_STORE(LO, HI, COL) { \
+  __m256i r = _mm256_permute4x64_epi64(_mm256_hadd_epi32(LO, HI), 0xd8); \
+  __m256i *cp = (__m256i *)(c + i + (j + COL) * ldc); \
+  _mm256_storeu_si256(cp, _mm256_add_epi32(_mm256_loadu_si256(cp), r)); \
+}
+
+I8_TARGET int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, int8_t *a, uint8_t *b, int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j, l;
+  int8_t  *ap;
+  uint8_t *bp;
+
+  for (j = 0; j < n; j += 4) {
+    for (i = 0; i < m; i += 8) {
+      __m256i lo0 = _mm256_setzero_si256(), hi0 = _mm256_setzero_si256();
+      __m256i lo1 = _mm256_setzero_si256(), hi1 = _mm256_setzero_si256();
+      __m256i lo2 = _mm256_setzero_si256(), hi2 = _mm256_setzero_si256();
+      __m256i lo3 = _mm256_setzero_si256(), hi3 = _mm256_setzero_si256();
+
+      ap = a + i * k;
+      bp = b + j * k;
+
+      for (l = 0; l < k; l += 4) {
+	__m256i av  = _mm256_loadu_si256((__m256i *)ap);
+	__m256i alo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(av));
+	__m256i ahi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(av, 1));
+	__m128i bv  = _mm_loadu_si128((__m128i *)bp);
+	__m256i bw;
+
+	bw  = _mm256_cvtepu8_epi16(_mm_shuffle_epi32(bv, 0x00));
+	lo0 = _mm256_add_epi32(lo0, _mm256_madd_epi16(alo, bw));
+	hi0 = _mm256_add_epi32(hi0, _mm256_madd_epi16(ahi, bw));
+	bw  = _mm256_cvtepu8_epi16(_mm_shuffle_epi32(bv, 0x55));
+	lo1 = _mm256_add_epi32(lo1, _mm256_madd_epi16(alo, bw));
+	hi1 = _mm256_add_epi32(hi1, _mm256_madd_epi16(ahi, bw));
+	bw  = _mm256_cvtepu8_epi16(_mm_shuffle_epi32(bv, 0xaa));
+	lo2 = _mm256_add_epi32(lo2, _mm256_madd_epi16(alo, bw));
+	hi2 = _mm256_add_epi32(hi2, _mm256_madd_epi16(ahi, bw));
+	bw  = _mm256_cvtepu8_epi16(_mm_shuffle_epi32(bv, 0xff));
+	lo3 = _mm256_add_epi32(lo3, _mm256_madd_epi16(alo, bw));
+	hi3 = _mm256_add_epi32(hi3, _mm256_madd_epi16(ahi, bw));
+
+	ap += 32;
+	bp += 16;
+      }
+
+      I8_STORE(lo0, hi0, 0);
+      I8_STORE(lo1, hi1, 1);
+      I8_STORE(lo2, hi2, 2);
+      I8_STORE(lo3, hi3, 3);
+    }
+  }
+
+  return 0;
+}
+
+#else
+#include "../generic/i8gemm_kernel.c"
+#endif
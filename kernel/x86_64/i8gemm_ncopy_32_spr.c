@@ -0,0 +1,65 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* B panel copy for the AMX int8 kernel, B not transposed (k contiguous).
+ * Each panel of 32 columns is stored as chunks of 64 k, a chunk holding
+ * the 64 consecutive k values of every column in turn (one tile row per
+ * column).  Padding columns and k beyond the end are zero.
+ */
+
+#include <string.h>
+#include "common.h"
+
+int CNAME(BLASLONG k, BLASLONG n, uint8_t *a, BLASLONG lda, uint8_t *b){
+
+  BLASLONG j, l, jj, len, nr;
+  BLASLONG kp = (k + 63) & ~63L;
+
+  for (j = 0; j < n; j += 32) {
+    nr = n - j;
+    if (nr > 32) nr = 32;
+
+    for (l = 0; l < kp; l += 64) {
+      len = k - l;
+      if (len > 64) len = 64;
+      if (len < 0)  len = 0;
+
+      for (jj = 0; jj < 32; jj++) {
+	if (jj < nr) {
+	  if (len) memcpy(b, a + l + (j + jj) * lda, len);
+	  if (len < 64) memset(b + len, 0, 64 - len);
+	} else {
+	  memset(b, 0, 64);
+	}
+	b += 64;
+      }
+    }
+  }
+
+  return 0;
+}
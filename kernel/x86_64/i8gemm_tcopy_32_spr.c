@@ -0,0 +1,59 @@
+/***************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+/* B panel copy for the AMX int8 kernel, B transposed (n contiguous).
+ * Same chunked layout as i8gemm_ncopy_32_spr.c: per 64 k, one row of 64
+ * bytes for each of the 32 columns of the panel.
+ */
+
+#include <string.h>
+#include "common.h"
+
+int CNAME(BLASLONG k, BLASLONG n, uint8_t *a, BLASLONG lda, uint8_t *b){
+
+  BLASLONG j, l, ll, jj, nr;
+  BLASLONG kp = (k + 63) & ~63L;
+  uint8_t *ap;
+
+  for (j = 0; j < n; j += 32) {
+    nr = n - j;
+    if (nr > 32) nr = 32;
+
+    for (l = 0; l < kp; l += 64) {
+      if (nr < 32 || l + 64 > k) memset(b, 0, 32 * 64);
+
+      for (ll = 0; ll < 64 && l + ll < k; ll++) {
+	ap = a + j + (l + ll) * lda;
+	for (jj = 0; jj < nr; jj++) b[jj * 64 + ll] = ap[jj];
+      }
+      b += 32 * 64;
+    }
+  }
+
+  return 0;
+}
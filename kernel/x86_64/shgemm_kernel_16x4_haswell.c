@@ -0,0 +1,209 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/* fp16 GEMM micro-kernel for AVX2/F16C capable cores.
+ * A panels (16 rows) and B panels (4 columns) stay in fp16 in the packing
+ * buffers.  Each B sub-panel is widened once per call into a small fp32
+ * scratch so that it can be broadcast straight from memory, A is widened on
+ * the fly with vcvtph2ps and all products are accumulated in fp32.
+ */
+
+#include "common.h"
+#include "../generic/hf16_common.h"
+
+#if (defined(__GNUC__) && __GNUC__ > 6) || (defined(__clang__) && __clang_major__ >= 6)
+#define HAVE_SHGEMM_F16C_KERNEL
+#include <immintrin.h>
+#define SH_TARGET __attribute__((target("avx2,fma,f16c")))
+#define SH_INLINE static inline __attribute__((always_inline)) SH_TARGET
+#else
+#define SH_TARGET
+#define SH_INLINE static inline
+#endif
+
+#define SH_KBLOCK 512
+
+/* scalar path for the narrow M tails (and for compilers without F16C intrinsics) */
+SH_INLINE void shgemm_mxn_scalar(BLASLONG kc, int mr, int nr, hfloat16 *a, float *b, float alpha, float *c, BLASLONG ldc)
+{
+  float acc[16][4];
+  BLASLONG k;
+  int i, j;
+
+  for (i = 0; i < mr; i++)
+    for (j = 0; j < nr; j++) acc[i][j] = ZERO;
+
+  for (k = 0; k < kc; k++) {
+    for (i = 0; i < mr; i++) {
+      float av = hf16_to_float(a[k * mr + i]);
+      for (j = 0; j < nr; j++) acc[i][j] += av * b[k * nr + j];
+    }
+  }
+
+  for (j = 0; j < nr; j++)
+    for (i = 0; i < mr; i++) c[i + j * ldc] += alpha * acc[i][j];
+}
+
+#ifdef HAVE_SHGEMM_F16C_KERNEL
+
+SH_INLINE void shgemm_16xn(BLASLONG kc, const int nr, hfloat16 *a, float *b, float alpha, float *c, BLASLONG ldc)
+{
+  __m256 acc0[4], acc1[4], a0, a1, bj, va;
+  BLASLONG k;
+  int j;
+
+  for (j = 0; j < nr; j++) {
+    acc0[j] = _mm256_setzero_ps();
+    acc1[j] = _mm256_setzero_ps();
+  }
+
+  for (k = 0; k < kc; k++) {
+    a0 = _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)(a + k * 16)));
+    a1 = _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)(a + k * 16 + 8)));
+    for (j = 0; j < nr; j++) {
+      bj = _mm256_broadcast_ss(b + k * nr + j);
+      acc0[j] = _mm256_fmadd_ps(a0, bj, acc0[j]);
+      acc1[j] = _mm256_fmadd_ps(a1, bj, acc1[j]);
+    }
+  }
+
+  va = _mm256_set1_ps(alpha);
+  for (j = 0; j < nr; j++) {
+    _mm256_storeu_ps(c + j * ldc,     _mm256_fmadd_ps(acc0[j], va, _mm256_loadu_ps(c + j * ldc)));
+    _mm256_storeu_ps(c + j * ldc + 8, _mm256_fmadd_ps(acc1[j], va, _mm256_loadu_ps(c + j * ldc + 8)));
+  }
+}
+
+SH_INLINE void shgemm_8xn(BLASLONG kc, const int nr, hfloat16 *a, float *b, float alpha, float *c, BLASLONG ldc)
+{
+  __m256 acc[4], a0, va;
+  BLASLONG k;
+  int j;
+
+  for (j = 0; j < nr; j++) acc[j] = _mm256_setzero_ps();
+
+  for (k = 0; k < kc; k++) {
+    a0 = _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)(a + k * 8)));
+    for (j = 0; j < nr; j++)
+      acc[j] = _mm256_fmadd_ps(a0, _mm256_broadcast_ss(b + k * nr + j), acc[j]);
+  }
+
+  va = _mm256_set1_ps(alpha);
+  for (j = 0; j < nr; j++)
+    _mm256_storeu_ps(c + j * ldc, _mm256_fmadd_ps(acc[j], va, _mm256_loadu_ps(c + j * ldc)));
+}
+
+SH_INLINE void shgemm_4xn(BLASLONG kc, const int nr, hfloat16 *a, float *b, float alpha, float *c, BLASLONG ldc)
+{
+  __m128 acc[4], a0, va;
+  BLASLONG k;
+  int j;
+
+  for (j = 0; j < nr; j++) acc[j] = _mm_setzero_ps();
+
+  for (k = 0; k < kc; k++) {
+    a0 = _mm_cvtph_ps(_mm_loadl_epi64((__m128i *)(a + k * 4)));
+    for (j = 0; j < nr; j++)
+      acc[j] = _mm_fmadd_ps(a0, _mm_broadcast_ss(b + k * nr + j), acc[j]);
+  }
+
+  va = _mm_set1_ps(alpha);
+  for (j = 0; j < nr; j++)
+    _mm_storeu_ps(c + j * ldc, _mm_fmadd_ps(acc[j], va, _mm_loadu_ps(c + j * ldc)));
+}
+
+SH_INLINE void shgemm_widen(BLASLONG n, hfloat16 *src, float *dst)
+{
+  BLASLONG i = 0;
+
+  for (; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)(src + i))));
+  for (; i < n; i++)
+    dst[i] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(src[i])));
+}
+
+#define SH_DISPATCH(func, kc, nr, a, b, alpha, c, ldc)	\
+  switch (nr) {						\
+  case 4:  func(kc, 4, a, b, alpha, c, ldc); break;	\
+  case 2:  func(kc, 2, a, b, alpha, c, ldc); break;	\
+  default: func(kc, 1, a, b, alpha, c, ldc); break;	\
+  }
+
+#else
+
+static inline void shgemm_widen(BLASLONG n, hfloat16 *src, float *dst)
+{
+  BLASLONG i;
+
+  for (i = 0; i < n; i++) dst[i] = hf16_to_float(src[i]);
+}
+
+#endif
+
+SH_TARGET int CNAME(BLASLONG bm, BLASLONG bn, BLASLONG bk, float alpha, hfloat16 *ba, hfloat16 *bb, float *C, BLASLONG ldc)
+{
+  float bbuf[SH_KBLOCK * 4];
+  BLASLONG ks, kc, i, j;
+  int mr, nr;
+
+  for (ks = 0; ks < bk; ks += kc) {
+    kc = bk - ks;
+    if (kc > SH_KBLOCK) kc = SH_KBLOCK;
+
+    for (j = 0; j < bn; j += nr) {
+      nr = (bn - j >= 4) ? 4 : (bn - j >= 2) ? 2 : 1;
+
+      shgemm_widen(kc * nr, bb + j * bk + ks * nr, bbuf);
+
+      for (i = 0; i < bm; i += mr) {
+        hfloat16 *a = ba + i * bk;
+        float *c = C + i + j * ldc;
+
+        mr = (bm - i >= 16) ? 16 : (bm - i >= 8) ? 8 : (bm - i >= 4) ? 4 : (bm - i >= 2) ? 2 : 1;
+        a += ks * mr;
+
+#ifdef HAVE_SHGEMM_F16C_KERNEL
+        if (mr == 16) {
+          SH_DISPATCH(shgemm_16xn, kc, nr, a, bbuf, alpha, c, ldc);
+          continue;
+        }
+        if (mr == 8) {
+          SH_DISPATCH(shgemm_8xn, kc, nr, a, bbuf, alpha, c, ldc);
+          continue;
+        }
+        if (mr == 4) {
+          SH_DISPATCH(shgemm_4xn, kc, nr, a, bbuf, alpha, c, ldc);
+          continue;
+        }
+#endif
+        shgemm_mxn_scalar(kc, mr, nr, a, bbuf, alpha, c, ldc);
+      }
+    }
+  }
+
+  return 0;
+}
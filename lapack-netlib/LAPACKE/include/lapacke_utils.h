@@ -72,6 +72,44 @@ lapack_logical LAPACKE_lsame( char ca,  char cb )
 #endif
 	;
 
+/* OpenBLAS drivers for row-major matrices, used instead of transposing them */
+#define LAPACK_sgetrf_rowmajor LAPACK_GLOBAL(sgetrf_rowmajor,SGETRF_ROWMAJOR)
+void LAPACK_sgetrf_rowmajor( lapack_int const* m, lapack_int const* n,
+                              float* a, lapack_int const* lda,
+                              lapack_int* ipiv, lapack_int* info );
+#define LAPACK_dgetrf_rowmajor LAPACK_GLOBAL(dgetrf_rowmajor,DGETRF_ROWMAJOR)
+void LAPACK_dgetrf_rowmajor( lapack_int const* m, lapack_int const* n,
+                              double* a, lapack_int const* lda,
+                              lapack_int* ipiv, lapack_int* info );
+#define LAPACK_cgetrf_rowmajor LAPACK_GLOBAL(cgetrf_rowmajor,CGETRF_ROWMAJOR)
+void LAPACK_cgetrf_rowmajor( lapack_int const* m, lapack_int const* n,
+                              lapack_complex_float* a, lapack_int const* lda,
+                              lapack_int* ipiv, lapack_int* info );
+#define LAPACK_zgetrf_rowmajor LAPACK_GLOBAL(zgetrf_rowmajor,ZGETRF_ROWMAJOR)
+void LAPACK_zgetrf_rowmajor( lapack_int const* m, lapack_int const* n,
+                              lapack_complex_double* a, lapack_int const* lda,
+                              lapack_int* ipiv, lapack_int* info );
+#define LAPACK_sgetrs_rowmajor LAPACK_GLOBAL(sgetrs_rowmajor,SGETRS_ROWMAJOR)
+void LAPACK_sgetrs_rowmajor( char const* trans, lapack_int const* n,
+                              lapack_int const* nrhs, const float* a,
+                              lapack_int const* lda, const lapack_int* ipiv,
+                              float* b, lapack_int const* ldb, lapack_int* info );
+#define LAPACK_dgetrs_rowmajor LAPACK_GLOBAL(dgetrs_rowmajor,DGETRS_ROWMAJOR)
+void LAPACK_dgetrs_rowmajor( char const* trans, lapack_int const* n,
+                              lapack_int const* nrhs, const double* a,
+                              lapack_int const* lda, const lapack_int* ipiv,
+                              double* b, lapack_int const* ldb, lapack_int* info );
+#define LAPACK_cgetrs_rowmajor LAPACK_GLOBAL(cgetrs_rowmajor,CGETRS_ROWMAJOR)
+void LAPACK_cgetrs_rowmajor( char const* trans, lapack_int const* n,
+                              lapack_int const* nrhs, const lapack_complex_float* a,
+                              lapack_int const* lda, const lapack_int* ipiv,
+                              lapack_complex_float* b, lapack_int const* ldb, lapack_int* info );
+#define LAPACK_zgetrs_rowmajor LAPACK_GLOBAL(zgetrs_rowmajor,ZGETRS_ROWMAJOR)
+void LAPACK_zgetrs_rowmajor( char const* trans, lapack_int const* n,
+                              lapack_int const* nrhs, const lapack_complex_double* a,
+                              lapack_int const* lda, const lapack_int* ipiv,
+                              lapack_complex_double* b, lapack_int const* ldb, lapack_int* info );
+
 /* Functions to convert column-major to row-major 2d arrays and vice versa. */
 void LAPACKE_cgb_trans( int matrix_layout, lapack_int m, lapack_int n,
                         lapack_int kl, lapack_int ku,
@@ -44,37 +44,20 @@ lapack_int LAPACKE_ctrtri_work( int matrix_layout, char uplo, char diag,
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,n);
-        lapack_complex_float* a_t = NULL;
+        char uplo_t = LAPACKE_lsame( uplo, 'u' ) ? 'l' :
+                      ( LAPACKE_lsame( uplo, 'l' ) ? 'u' : uplo );
         /* Check leading dimension(s) */
         if( lda < n ) {
             info = -6;
             LAPACKE_xerbla( "LAPACKE_ctrtri_work", info );
             return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        /* Transpose input matrices */
-        LAPACKE_ctr_trans( matrix_layout, uplo, diag, n, a, lda, a_t, lda_t );
-        /* Call LAPACK function and adjust info */
-        LAPACK_ctrtri( &uplo, &diag, &n, a_t, &lda_t, &info );
+        /* A by rows is A^T by columns: inverting the other triangle
+           in place leaves inv(A) by rows */
+        LAPACK_ctrtri( &uplo_t, &diag, &n, a, &lda, &info );
         if( info < 0 ) {
             info = info - 1;
         }
-        /* Transpose output matrices */
-        LAPACKE_ctr_trans( LAPACK_COL_MAJOR, uplo, diag, n, a_t, lda_t, a,
-                           lda );
-        /* Release memory and exit */
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
-            LAPACKE_xerbla( "LAPACKE_ctrtri_work", info );
-        }
     } else {
         info = -1;
         LAPACKE_xerbla( "LAPACKE_ctrtri_work", info );
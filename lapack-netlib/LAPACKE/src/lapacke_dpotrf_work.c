@@ -43,35 +43,20 @@ lapack_int LAPACKE_dpotrf_work( int matrix_layout, char uplo, lapack_int n,
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,n);
-        double* a_t = NULL;
+        char uplo_t = LAPACKE_lsame( uplo, 'u' ) ? 'l' :
+                      ( LAPACKE_lsame( uplo, 'l' ) ? 'u' : uplo );
         /* Check leading dimension(s) */
         if( lda < n ) {
             info = -5;
             LAPACKE_xerbla( "LAPACKE_dpotrf_work", info );
             return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        /* Transpose input matrices */
-        LAPACKE_dpo_trans( matrix_layout, uplo, n, a, lda, a_t, lda_t );
-        /* Call LAPACK function and adjust info */
-        LAPACK_dpotrf( &uplo, &n, a_t, &lda_t, &info );
+        /* A by rows is A^T by columns: factoring the other triangle
+           in place leaves the factor of A by rows */
+        LAPACK_dpotrf( &uplo_t, &n, a, &lda, &info );
         if( info < 0 ) {
             info = info - 1;
         }
-        /* Transpose output matrices */
-        LAPACKE_dpo_trans( LAPACK_COL_MAJOR, uplo, n, a_t, lda_t, a, lda );
-        /* Release memory and exit */
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
-            LAPACKE_xerbla( "LAPACKE_dpotrf_work", info );
-        }
     } else {
         info = -1;
         LAPACKE_xerbla( "LAPACKE_dpotrf_work", info );
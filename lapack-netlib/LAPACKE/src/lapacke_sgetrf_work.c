@@ -43,35 +43,17 @@ lapack_int LAPACKE_sgetrf_work( int matrix_layout, lapack_int m, lapack_int n,
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,m);
-        float* a_t = NULL;
         /* Check leading dimension(s) */
         if( lda < n ) {
             info = -5;
             LAPACKE_xerbla( "LAPACKE_sgetrf_work", info );
             return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (float*)LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        /* Transpose input matrices */
-        LAPACKE_sge_trans( matrix_layout, m, n, a, lda, a_t, lda_t );
-        /* Call LAPACK function and adjust info */
-        LAPACK_sgetrf( &m, &n, a_t, &lda_t, ipiv, &info );
+        /* Factor the matrix in place, without transposing it */
+        LAPACK_sgetrf_rowmajor( &m, &n, a, &lda, ipiv, &info );
         if( info < 0 ) {
             info = info - 1;
         }
-        /* Transpose output matrices */
-        LAPACKE_sge_trans( LAPACK_COL_MAJOR, m, n, a_t, lda_t, a, lda );
-        /* Release memory and exit */
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
-            LAPACKE_xerbla( "LAPACKE_sgetrf_work", info );
-        }
     } else {
         info = -1;
         LAPACKE_xerbla( "LAPACKE_sgetrf_work", info );
@@ -0,0 +1,105 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include "common.h"
+
+#include "larfb.c"
+
+/* QR factorization A = Q R of the m x n matrix A, blocked as xGEQRF.
+
+   The nb columns of each panel are factored by xGEQR2 and the reflectors
+   are applied to the trailing columns by xLARFB. args -> b receives tau,
+   args -> ldb is nb and args -> d is the workspace of args -> ldd elements,
+   at least n. */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, lda, mn, nb, lwork, i, ib;
+  BLASLONG nthreads = 1;
+  FLOAT *a, *tau, *work, *t, *w, *buffer, *aii;
+  FLOAT tone[2];
+
+  m     = args -> m;
+  n     = args -> n;
+  a     = (FLOAT *)args -> a;
+  lda   = args -> lda;
+  tau   = (FLOAT *)args -> b;
+  nb    = args -> ldb;
+  work  = (FLOAT *)args -> d;
+  lwork = args -> ldd;
+
+#ifdef PARALLEL
+  nthreads = args -> nthreads;
+#endif
+
+  mn = MIN(m, n);
+
+  if (mn <= 0) return 0;
+
+  if (nb < 2 || nb >= mn) {
+    geqr2(m, n, a, lda, tau, work, sb, nthreads);
+    return 0;
+  }
+
+  buffer = larfb_work(work, lwork, n, &nb, &t, &w, tone);
+
+  if (nb < 2) {
+    geqr2(m, n, a, lda, tau, w, sb, nthreads);
+  } else {
+
+    for (i = 0; i < mn; i += nb) {
+
+      ib  = MIN(mn - i, nb);
+      aii = a + (i + i * lda) * COMPSIZE;
+
+      geqr2(m - i, ib, aii, lda, tau + i * COMPSIZE, w, sb, nthreads);
+
+      if (i + ib < n) {
+	larft(m - i, ib, aii, lda, tau + i * COMPSIZE, t, nb, sb, nthreads);
+
+	larfb(LARFB_LEFT | LARFB_TRANS, m - i, n - i - ib, ib,
+	      aii, lda, t, nb, aii + ib * lda * COMPSIZE, lda, w, n,
+	      nthreads, sa, sb);
+      }
+    }
+  }
+
+  if (buffer) free(buffer);
+
+  return 0;
+}
@@ -0,0 +1,539 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Householder reflectors for the QR drivers, included by geqrf and ormqr.
+
+   A block of reflectors H(i) = I - tau(i) v(i) v(i)^H is kept as in
+   LAPACK: v(i) has a unit i-th element and zeros above it, and is stored
+   below the diagonal of column i. The product H(0) H(1) ... H(k-1) is
+   I - V T V^H with an upper triangular T (xLARFT), and is applied to a
+   matrix with three level 3 calls and two triangular products (xLARFB).
+   The PARALLEL variants run those on all threads. The panel and T are
+   level 2; there the large products with the tall columns go to the
+   threaded gemv/ger drivers. LARFB_NO_PANEL leaves out the factorization
+   of a panel. */
+
+#ifdef XDOUBLE
+#define SAFMIN	(LDBL_MIN / (LDBL_EPSILON * 0.5L))
+#elif defined(DOUBLE)
+#define SAFMIN	(DBL_MIN / (DBL_EPSILON * 0.5))
+#else
+#define SAFMIN	(FLT_MIN / (FLT_EPSILON * 0.5f))
+#endif
+
+#define LARFB_LEFT	1
+#define LARFB_TRANS	2
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+#define LARFB_MODE	(BLAS_XDOUBLE | BLAS_REAL)
+#elif defined(DOUBLE)
+#define LARFB_MODE	(BLAS_DOUBLE  | BLAS_REAL)
+#else
+#define LARFB_MODE	(BLAS_SINGLE  | BLAS_REAL)
+#endif
+#else
+#ifdef XDOUBLE
+#define LARFB_MODE	(BLAS_XDOUBLE | BLAS_COMPLEX)
+#elif defined(DOUBLE)
+#define LARFB_MODE	(BLAS_DOUBLE  | BLAS_COMPLEX)
+#else
+#define LARFB_MODE	(BLAS_SINGLE  | BLAS_COMPLEX)
+#endif
+#endif
+
+#ifndef PARALLEL
+#define LARFB_GEMM(OP, ARGS)	GEMM_##OP(ARGS, NULL, NULL, sa, sb, 0)
+#define LARFB_TRMM(OP, ARGS)	TRMM_##OP(ARGS, NULL, NULL, sa, sb, 0)
+#else
+#define LARFB_GEMM(OP, ARGS)						\
+  if ((ARGS) -> nthreads > 1) GEMM_THREAD_##OP(ARGS, NULL, NULL, sa, sb, 0); \
+  else GEMM_##OP(ARGS, NULL, NULL, sa, sb, 0)
+/* the rows of W are independent */
+#define LARFB_TRMM(OP, ARGS)						\
+  if ((ARGS) -> nthreads > 1)						\
+    gemm_thread_m(LARFB_MODE | BLAS_RSIDE, ARGS, NULL, NULL,		\
+		  (int (*)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG))TRMM_##OP, \
+		  sa, sb, (ARGS) -> nthreads);				\
+  else TRMM_##OP(ARGS, NULL, NULL, sa, sb, 0)
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+#define LARFB_GEMV_THREAD	qgemv_thread_t
+#define LARFB_GER_THREAD	qger_thread
+#elif defined(DOUBLE)
+#define LARFB_GEMV_THREAD	dgemv_thread_t
+#define LARFB_GER_THREAD	dger_thread
+#else
+#define LARFB_GEMV_THREAD	sgemv_thread_t
+#define LARFB_GER_THREAD	sger_thread
+#endif
+#define LARFB_ALPHA(alpha)	(alpha)[0]
+#else
+#ifdef XDOUBLE
+#define LARFB_GEMV_THREAD	xgemv_thread_c
+#define LARFB_GER_THREAD	xger_thread_C
+#elif defined(DOUBLE)
+#define LARFB_GEMV_THREAD	zgemv_thread_c
+#define LARFB_GER_THREAD	zger_thread_C
+#else
+#define LARFB_GEMV_THREAD	cgemv_thread_c
+#define LARFB_GER_THREAD	cger_thread_C
+#endif
+#define LARFB_ALPHA(alpha)	(alpha)
+#endif
+
+/* the same size limit as the gemv interface */
+#define LARFB_LEVEL2_THREADS(m, n, nthreads)				\
+  ((nthreads) > 1 && 1L * (m) * (n) >= 115200L * GEMM_MULTITHREAD_THRESHOLD)
+#endif
+
+/* y += alpha A^H x for the m x n matrix a and unit strides */
+static void larfb_gemv(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda,
+		       FLOAT *x, FLOAT *y, FLOAT *buffer, BLASLONG nthreads) {
+
+#ifdef PARALLEL
+  if (LARFB_LEVEL2_THREADS(m, n, nthreads)) {
+    LARFB_GEMV_THREAD(m, n, LARFB_ALPHA(alpha), a, lda, x, 1, y, 1, buffer, nthreads);
+    return;
+  }
+#endif
+
+#ifndef COMPLEX
+  GEMV_C(m, n, 0, alpha[0], a, lda, x, 1, y, 1, buffer);
+#else
+  GEMV_C(m, n, 0, alpha[0], alpha[1], a, lda, x, 1, y, 1, buffer);
+#endif
+}
+
+#ifndef LARFB_NO_PANEL
+/* |(alpha, xnorm)| without overflow (xLAPY2, xLAPY3) */
+static FLOAT larfg_norm(FLOAT *alpha, FLOAT xnorm) {
+
+  FLOAT big, ar;
+#ifdef COMPLEX
+  FLOAT ai;
+#endif
+
+  ar  = fabs(alpha[0]);
+  big = MAX(ar, xnorm);
+#ifdef COMPLEX
+  ai  = fabs(alpha[1]);
+  big = MAX(big, ai);
+#endif
+
+  if (big == ZERO) return ZERO;
+
+  ar    /= big;
+  xnorm /= big;
+#ifndef COMPLEX
+  return big * sqrt(ar * ar + xnorm * xnorm);
+#else
+  ai    /= big;
+  return big * sqrt(ar * ar + ai * ai + xnorm * xnorm);
+#endif
+}
+
+/* Reflector that zeroes x and maps alpha to a real beta (xLARFG) */
+static void larfg(BLASLONG n, FLOAT *alpha, FLOAT *x, FLOAT *tau) {
+
+  FLOAT xnorm, beta, rsafmn, scale[2];
+  BLASLONG i, knt;
+
+  tau[0] = ZERO;
+#ifdef COMPLEX
+  tau[1] = ZERO;
+#endif
+
+  if (n <= 0) return;
+
+  xnorm = NRM2_K(n - 1, x, 1);
+
+#ifndef COMPLEX
+  if (xnorm == ZERO) return;
+#else
+  if (xnorm == ZERO && alpha[1] == ZERO) return;
+#endif
+
+  beta = -copysign(larfg_norm(alpha, xnorm), alpha[0]);
+
+  knt = 0;
+
+  if (fabs(beta) < SAFMIN) {
+    /* beta may be inaccurate, scale x and recompute it */
+    rsafmn = ONE / SAFMIN;
+
+    do {
+      knt ++;
+      SCAL_K(n - 1, 0, 0, rsafmn,
+#ifdef COMPLEX
+	     ZERO,
+#endif
+	     x, 1, NULL, 0, NULL, 0);
+      beta     *= rsafmn;
+      alpha[0] *= rsafmn;
+#ifdef COMPLEX
+      alpha[1] *= rsafmn;
+#endif
+    } while (fabs(beta) < SAFMIN && knt < 20);
+
+    xnorm = NRM2_K(n - 1, x, 1);
+    beta  = -copysign(larfg_norm(alpha, xnorm), alpha[0]);
+  }
+
+#ifndef COMPLEX
+  tau[0] = (beta - alpha[0]) / beta;
+  scale[0] = ONE / (alpha[0] - beta);
+  SCAL_K(n - 1, 0, 0, scale[0], x, 1, NULL, 0, NULL, 0);
+#else
+  tau[0] = (beta - alpha[0]) / beta;
+  tau[1] = -alpha[1] / beta;
+
+  /* 1 / (alpha - beta) */
+  {
+    FLOAT ar = alpha[0] - beta, ai = alpha[1], ratio, den;
+
+    if (fabs(ar) >= fabs(ai)) {
+      ratio = ai / ar;
+      den   = ONE / (ar * (ONE + ratio * ratio));
+      scale[0] =  den;
+      scale[1] = -ratio * den;
+    } else {
+      ratio = ar / ai;
+      den   = ONE / (ai * (ONE + ratio * ratio));
+      scale[0] =  ratio * den;
+      scale[1] = -den;
+    }
+  }
+  SCAL_K(n - 1, 0, 0, scale[0], scale[1], x, 1, NULL, 0, NULL, 0);
+#endif
+
+  for (i = 0; i < knt; i ++) beta *= SAFMIN;
+
+  alpha[0] = beta;
+#ifdef COMPLEX
+  alpha[1] = ZERO;
+#endif
+}
+
+/* Unblocked QR of the m x n matrix a (xGEQR2). w holds n elements. */
+static void geqr2(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG lda, FLOAT *tau, FLOAT *w, FLOAT *buffer,
+		  BLASLONG nthreads) {
+
+  BLASLONG i, j;
+  FLOAT *aii, save[2], one[2] = {ONE, ZERO};
+#ifdef PARALLEL
+  FLOAT mtau[2];
+#endif
+
+  for (i = 0; i < MIN(m, n); i ++) {
+
+    aii = a + (i + i * lda) * COMPSIZE;
+
+    larfg(m - i, aii, aii + COMPSIZE, tau + i * COMPSIZE);
+
+    if (i + 1 >= n) continue;
+
+    /* apply H(i)^H to the rest of the panel */
+    save[0] = aii[0];
+    aii[0]  = ONE;
+#ifdef COMPLEX
+    save[1] = aii[1];
+    aii[1]  = ZERO;
+#endif
+
+    for (j = 0; j < (n - i - 1) * COMPSIZE; j ++) w[j] = ZERO;
+
+    larfb_gemv(m - i, n - i - 1, one, aii + lda * COMPSIZE, lda, aii, w, buffer, nthreads);
+
+#ifdef PARALLEL
+    if (LARFB_LEVEL2_THREADS(m - i, n - i - 1, nthreads)) {
+      mtau[0] = -tau[i * COMPSIZE];
+#ifdef COMPLEX
+      mtau[1] =  tau[i * 2 + 1];
+#endif
+      LARFB_GER_THREAD(m - i, n - i - 1, LARFB_ALPHA(mtau),
+		       aii, 1, w, 1, aii + lda * COMPSIZE, lda, buffer, nthreads);
+    } else
+#endif
+#ifndef COMPLEX
+    GERC_K(m - i, n - i - 1, 0, -tau[i],
+	   aii, 1, w, 1, aii + lda, lda, buffer);
+#else
+    GERC_K(m - i, n - i - 1, 0, -tau[i * 2], tau[i * 2 + 1],
+	   aii, 1, w, 1, aii + lda * COMPSIZE, lda, buffer);
+#endif
+
+    aii[0] = save[0];
+#ifdef COMPLEX
+    aii[1] = save[1];
+#endif
+  }
+}
+
+#endif
+
+/* T of the k reflectors in the m x k matrix v (xLARFT, forward, by columns) */
+static void larft(BLASLONG m, BLASLONG k, FLOAT *v, BLASLONG ldv, FLOAT *tau, FLOAT *t, BLASLONG ldt, FLOAT *buffer,
+		  BLASLONG nthreads) {
+
+  BLASLONG i, r, c;
+  FLOAT *vii, *ti, save[2], sr, mtau[2];
+#ifdef COMPLEX
+  FLOAT si;
+#endif
+
+  for (i = 0; i < k; i ++) {
+
+    vii = v + (i + i * ldv) * COMPSIZE;
+    ti  = t + i * ldt * COMPSIZE;
+
+    for (r = 0; r < i * COMPSIZE; r ++) ti[r] = ZERO;
+
+    if (i > 0 && (tau[i * COMPSIZE] != ZERO
+#ifdef COMPLEX
+		  || tau[i * 2 + 1] != ZERO
+#endif
+		  )) {
+
+      save[0] = vii[0];
+      vii[0]  = ONE;
+#ifdef COMPLEX
+      save[1] = vii[1];
+      vii[1]  = ZERO;
+#endif
+
+      /* -tau(i) V(i:m, 0:i)^H v(i) */
+      mtau[0] = -tau[i * COMPSIZE];
+#ifdef COMPLEX
+      mtau[1] = -tau[i * 2 + 1];
+#endif
+      larfb_gemv(m - i, i, mtau, v + i * COMPSIZE, ldv, vii, ti, buffer, nthreads);
+
+      vii[0] = save[0];
+#ifdef COMPLEX
+      vii[1] = save[1];
+#endif
+
+      /* times T(0:i, 0:i), from the top so that each row reads its old values */
+      for (r = 0; r < i; r ++) {
+#ifndef COMPLEX
+	sr = ZERO;
+	for (c = r; c < i; c ++) sr += t[r + c * ldt] * ti[c];
+	ti[r] = sr;
+#else
+	sr = ZERO;
+	si = ZERO;
+	for (c = r; c < i; c ++) {
+	  sr += t[(r + c * ldt) * 2] * ti[c * 2]     - t[(r + c * ldt) * 2 + 1] * ti[c * 2 + 1];
+	  si += t[(r + c * ldt) * 2] * ti[c * 2 + 1] + t[(r + c * ldt) * 2 + 1] * ti[c * 2];
+	}
+	ti[r * 2]     = sr;
+	ti[r * 2 + 1] = si;
+#endif
+      }
+    }
+
+    ti[i * COMPSIZE] = tau[i * COMPSIZE];
+#ifdef COMPLEX
+    ti[i * 2 + 1] = tau[i * 2 + 1];
+#endif
+  }
+}
+
+/* Apply I - V T V^H (or its conjugate transpose with LARFB_TRANS) to the
+   m x n matrix c from the left or the right (xLARFB, forward, by columns).
+   v has k columns, w holds n x k (left) or m x k (right) elements. */
+static void larfb(int mode, BLASLONG m, BLASLONG n, BLASLONG k,
+		  FLOAT *v, BLASLONG ldv, FLOAT *t, BLASLONG ldt,
+		  FLOAT *c, BLASLONG ldc, FLOAT *w, BLASLONG ldw,
+		  BLASLONG nthreads, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+  BLASLONG i, j, mw, mv;
+  FLOAT one[2]  = { ONE, ZERO};
+  FLOAT mone[2] = {-ONE, ZERO};
+
+  if (m <= 0 || n <= 0 || k <= 0) return;
+
+  mw = (mode & LARFB_LEFT) ? n : m;
+  mv = (mode & LARFB_LEFT) ? m : n;
+
+  args.nthreads = nthreads;
+  args.beta     = NULL;
+
+  /* W = C^H V (left) or C V (right), starting with the unit triangle V1 */
+  for (j = 0; j < k; j ++) {
+    for (i = 0; i < mw; i ++) {
+      if (mode & LARFB_LEFT) {
+	w[(i + j * ldw) * COMPSIZE] = c[(j + i * ldc) * COMPSIZE];
+#ifdef COMPLEX
+	w[(i + j * ldw) * 2 + 1] = -c[(j + i * ldc) * 2 + 1];
+#endif
+      } else {
+	w[(i + j * ldw) * COMPSIZE] = c[(i + j * ldc) * COMPSIZE];
+#ifdef COMPLEX
+	w[(i + j * ldw) * 2 + 1] = c[(i + j * ldc) * 2 + 1];
+#endif
+      }
+    }
+  }
+
+  args.m   = mw;
+  args.n   = k;
+  args.a   = v;
+  args.lda = ldv;
+  args.b   = w;
+  args.ldb = ldw;
+  LARFB_TRMM(RNLU, &args);
+
+  if (mv > k) {
+    args.m     = mw;
+    args.n     = k;
+    args.k     = mv - k;
+    args.a     = (mode & LARFB_LEFT) ? c + k * COMPSIZE : c + k * ldc * COMPSIZE;
+    args.lda   = ldc;
+    args.b     = v + k * COMPSIZE;
+    args.ldb   = ldv;
+    args.c     = w;
+    args.ldc   = ldw;
+    args.alpha = one;
+
+    if (mode & LARFB_LEFT) {
+      LARFB_GEMM(CN, &args);
+    } else {
+      LARFB_GEMM(NN, &args);
+    }
+  }
+
+  /* W T for H^H from the left and H from the right, W T^H otherwise */
+  args.m   = mw;
+  args.n   = k;
+  args.a   = t;
+  args.lda = ldt;
+  args.b   = w;
+  args.ldb = ldw;
+
+  if (!(mode & LARFB_LEFT) == !(mode & LARFB_TRANS)) {
+    LARFB_TRMM(RNUN, &args);
+  } else {
+    LARFB_TRMM(RCUN, &args);
+  }
+
+  /* C2 -= V2 W^H (left) or W V2^H (right) */
+  if (mv > k) {
+    args.k     = k;
+    args.alpha = mone;
+    args.ldc   = ldc;
+
+    if (mode & LARFB_LEFT) {
+      args.m   = mv - k;
+      args.n   = mw;
+      args.a   = v + k * COMPSIZE;
+      args.lda = ldv;
+      args.b   = w;
+      args.ldb = ldw;
+      args.c   = c + k * COMPSIZE;
+    } else {
+      args.m   = mw;
+      args.n   = mv - k;
+      args.a   = w;
+      args.lda = ldw;
+      args.b   = v + k * COMPSIZE;
+      args.ldb = ldv;
+      args.c   = c + k * ldc * COMPSIZE;
+    }
+
+    LARFB_GEMM(NC, &args);
+  }
+
+  /* C1 -= (W V1^H)^H (left) or W V1^H (right) */
+  args.m   = mw;
+  args.n   = k;
+  args.a   = v;
+  args.lda = ldv;
+  args.b   = w;
+  args.ldb = ldw;
+  LARFB_TRMM(RCLU, &args);
+
+  for (j = 0; j < k; j ++) {
+    for (i = 0; i < mw; i ++) {
+      if (mode & LARFB_LEFT) {
+	c[(j + i * ldc) * COMPSIZE] -= w[(i + j * ldw) * COMPSIZE];
+#ifdef COMPLEX
+	c[(j + i * ldc) * 2 + 1] += w[(i + j * ldw) * 2 + 1];
+#endif
+      } else {
+	c[(i + j * ldc) * COMPSIZE] -= w[(i + j * ldw) * COMPSIZE];
+#ifdef COMPLEX
+	c[(i + j * ldc) * 2 + 1] -= w[(i + j * ldw) * 2 + 1];
+#endif
+      }
+    }
+  }
+}
+
+/* Workspace for T (nb x nb) and W (nw x nb) from work when it is large
+   enough, otherwise allocated; nb is lowered if that fails. */
+static FLOAT *larfb_work(FLOAT *work, BLASLONG lwork, BLASLONG nw, BLASLONG *nb, FLOAT **t, FLOAT **w, FLOAT *tone) {
+
+  FLOAT *buffer = NULL;
+  BLASLONG b = *nb;
+
+  if (b * (b + nw) > lwork) {
+    buffer = (FLOAT *)malloc(b * (b + nw) * COMPSIZE * sizeof(FLOAT));
+
+    if (buffer) {
+      work = buffer;
+    } else {
+      while (b > 1 && b * (b + nw) > lwork) b --;
+    }
+  }
+
+  if (b * (b + nw) <= lwork || buffer) {
+    *t = work;
+    *w = work + b * b * COMPSIZE;
+  } else {
+    /* the smallest workspace has only room for W */
+    *t = tone;
+    *w = work;
+  }
+
+  *nb = b;
+  return buffer;
+}
@@ -76,6 +76,8 @@ double sqrt(double);
 #define	atomic_store_long(p, v)		(*(volatile BLASLONG *)(p)) = (v)
 #endif
 
+#include "getrf_tile.c"
+
 
 
 static __inline BLASLONG FORMULA1(BLASLONG M, BLASLONG N, BLASLONG IS, BLASLONG BK, BLASLONG T) {
@@ -468,6 +470,15 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
     return info;
   }
 
+  if (range_n == NULL && mn >= GEMM_Q * 4) {
+    bk = ((mn / (args -> nthreads * TILE_RATE) + GEMM_UNROLL_N - 1)/GEMM_UNROLL_N) * GEMM_UNROLL_N;
+    if (bk < GEMM_Q / 4) bk = GEMM_Q / 4;
+    if (bk > GEMM_Q) bk = GEMM_Q;
+
+    info = getrf_tile(args, bk, sa, sb, mode);
+    if (info >= 0) return info;
+  }
+
   next_bk = init_bk;
 
   bk = mn;
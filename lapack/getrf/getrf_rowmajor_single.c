@@ -0,0 +1,275 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include "common.h"
+
+/* LU factorization with partial pivoting of an m x n matrix A stored by
+   rows, for LAPACKE. args -> a is read by columns as B = A^T, so the row
+   interchanges of A are interchanges of columns of B and the factors come
+   out transposed: U^T on and below the diagonal of B, the unit L^T above
+   it. ipiv and the return value are what xGETRF gives for A stored by
+   columns.
+
+   The panels of rows of B are split recursively down to a level 2 loop,
+   the rest of B is updated with TRSM_RNUU and GEMM_NN. The PARALLEL
+   variant runs the level 3 updates on args -> nthreads threads. */
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+#define GETRF_MODE	(BLAS_XDOUBLE | BLAS_REAL)
+#elif defined(DOUBLE)
+#define GETRF_MODE	(BLAS_DOUBLE  | BLAS_REAL)
+#else
+#define GETRF_MODE	(BLAS_SINGLE  | BLAS_REAL)
+#endif
+#else
+#ifdef XDOUBLE
+#define GETRF_MODE	(BLAS_XDOUBLE | BLAS_COMPLEX)
+#elif defined(DOUBLE)
+#define GETRF_MODE	(BLAS_DOUBLE  | BLAS_COMPLEX)
+#else
+#define GETRF_MODE	(BLAS_SINGLE  | BLAS_COMPLEX)
+#endif
+#endif
+
+#if defined(XDOUBLE)
+#define SFMIN	LDBL_MIN
+#elif defined(DOUBLE)
+#define SFMIN	DBL_MIN
+#else
+#define SFMIN	FLT_MIN
+#endif
+
+#ifndef PARALLEL
+#define GETRF_GEMM(ARGS)	GEMM_NN(ARGS, NULL, NULL, sa, sb, 0)
+#define GETRF_TRSM(ARGS)	TRSM_RNUU(ARGS, NULL, NULL, sa, sb, 0)
+#else
+#define GETRF_GEMM(ARGS)						\
+  if ((ARGS) -> nthreads > 1) GEMM_THREAD_NN(ARGS, NULL, NULL, sa, sb, 0); \
+  else GEMM_NN(ARGS, NULL, NULL, sa, sb, 0)
+/* the rows of the right hand side are independent */
+#define GETRF_TRSM(ARGS)						\
+  if ((ARGS) -> nthreads > 1)						\
+    gemm_thread_m(GETRF_MODE | BLAS_RSIDE, ARGS, NULL, NULL,		\
+		  (int (*)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG))TRSM_RNUU, \
+		  sa, sb, (ARGS) -> nthreads);				\
+  else TRSM_RNUU(ARGS, NULL, NULL, sa, sb, 0)
+#endif
+
+static FLOAT dm1[] = {-1., 0.};
+
+/* Columns j to j + jb - 1 of A one at a time (xGETF2) */
+static blasint getf2(blas_arg_t *args, BLASLONG j, BLASLONG jb, FLOAT *sb) {
+
+  BLASLONG m, n, lda, c, jp;
+  blasint *ipiv, info;
+  FLOAT *a, *b, *p;
+#ifndef COMPLEX
+  BLASLONG i;
+  FLOAT temp;
+#else
+  FLOAT ratio, den, temp[2];
+#endif
+
+  m    = args -> m;
+  n    = args -> n;
+  a    = (FLOAT *)args -> a;
+  lda  = args -> lda;
+  ipiv = (blasint *)args -> c;
+
+  info = 0;
+
+  for (c = j; c < j + jb; c ++) {
+
+    /* B(c, c), the diagonal element of column c of A */
+    b = a + (c + c * lda) * COMPSIZE;
+
+    jp = IAMAX_K(m - c, b, lda);
+    if (jp > m - c) jp = m - c;
+    jp += c - 1;
+    ipiv[c] = jp + 1;
+
+    p = a + (c + jp * lda) * COMPSIZE;
+
+#ifndef COMPLEX
+    if (p[0] != ZERO) {
+      temp = p[0];
+
+      if (jp != c)
+	SWAP_K(n, 0, 0, ZERO, a + c * lda, 1, a + jp * lda, 1, NULL, 0);
+
+      if (fabs(temp) >= SFMIN) {
+	SCAL_K(m - c - 1, 0, 0, ONE / temp, b + lda, lda, NULL, 0, NULL, 0);
+      } else {
+	for (i = 1; i < m - c; i ++) b[i * lda] /= temp;
+      }
+    } else {
+      if (!info) info = c + 1;
+    }
+
+    if (c + 1 < j + jb)
+      GERU_K(j + jb - c - 1, m - c - 1, 0, dm1[0],
+	    b + 1, 1, b + lda, lda, b + 1 + lda, lda, sb);
+#else
+    if (p[0] != ZERO || p[1] != ZERO) {
+
+      if (fabs(p[0]) >= fabs(p[1])) {
+	ratio = p[1] / p[0];
+	den   = ONE / (p[0] * (ONE + ratio * ratio));
+	temp[0] =  den;
+	temp[1] = -ratio * den;
+      } else {
+	ratio = p[0] / p[1];
+	den   = ONE / (p[1] * (ONE + ratio * ratio));
+	temp[0] =  ratio * den;
+	temp[1] = -den;
+      }
+
+      if (jp != c)
+	SWAP_K(n, 0, 0, ZERO, ZERO, a + c * lda * 2, 1, a + jp * lda * 2, 1, NULL, 0);
+
+      SCAL_K(m - c - 1, 0, 0, temp[0], temp[1], b + lda * 2, lda, NULL, 0, NULL, 0);
+    } else {
+      if (!info) info = c + 1;
+    }
+
+    if (c + 1 < j + jb)
+      GERU_K(j + jb - c - 1, m - c - 1, 0, dm1[0], dm1[1],
+	     b + 2, 1, b + lda * 2, lda, b + (1 + lda) * 2, lda, sb);
+#endif
+  }
+
+  return info;
+}
+
+/* Applies the factored columns j to j + jb - 1 of A to its columns
+   from to to - 1: B(from:to, j:j+jb) := B(from:to, j:j+jb) L11^-T, then
+   B(from:to, j+jb:m) -= B(from:to, j:j+jb) B(j:j+jb, j+jb:m) */
+static void update(blas_arg_t *args, BLASLONG j, BLASLONG jb, BLASLONG from, BLASLONG to,
+		   FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t newarg;
+  FLOAT *a;
+  BLASLONG lda;
+
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+
+#ifdef PARALLEL
+  newarg.common   = NULL;
+  newarg.nthreads = args -> nthreads;
+#endif
+
+  newarg.m    = to - from;
+  newarg.n    = jb;
+  newarg.a    = a + (j + j * lda) * COMPSIZE;
+  newarg.lda  = lda;
+  newarg.b    = a + (from + j * lda) * COMPSIZE;
+  newarg.ldb  = lda;
+  newarg.beta = NULL;
+
+  GETRF_TRSM(&newarg);
+
+  if (j + jb >= args -> m) return;
+
+  newarg.m     = to - from;
+  newarg.n     = args -> m - j - jb;
+  newarg.k     = jb;
+  newarg.a     = a + (from + j * lda) * COMPSIZE;
+  newarg.lda   = lda;
+  newarg.b     = a + (j + (j + jb) * lda) * COMPSIZE;
+  newarg.ldb   = lda;
+  newarg.c     = a + (from + (j + jb) * lda) * COMPSIZE;
+  newarg.ldc   = lda;
+  newarg.alpha = dm1;
+  newarg.beta  = NULL;
+
+  GETRF_GEMM(&newarg);
+}
+
+/* Columns j to j + jb - 1 of A, split in two while wider than the kernels */
+static blasint panel(blas_arg_t *args, BLASLONG j, BLASLONG jb, FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG jb1;
+  blasint info, iinfo;
+
+  if (jb <= GEMM_UNROLL_N * 2) return getf2(args, j, jb, sb);
+
+  jb1 = ((jb / 2 + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+
+  info = panel(args, j, jb1, sa, sb);
+
+  update(args, j, jb1, j + jb1, j + jb, sa, sb);
+
+  iinfo = panel(args, j + jb1, jb - jb1, sa, sb);
+
+  if (iinfo && !info) info = iinfo;
+
+  return info;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, mn, j, jb, blocking;
+  blasint info, iinfo;
+
+  m = args -> m;
+  n = args -> n;
+
+  if (m <= 0 || n <= 0) return 0;
+
+  mn = MIN(m, n);
+
+  blocking = ((mn / 2 + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+  if (blocking > GEMM_Q) blocking = GEMM_Q;
+  if (blocking < GEMM_UNROLL_N) blocking = GEMM_UNROLL_N;
+
+  info = 0;
+
+  for (j = 0; j < mn; j += blocking) {
+
+    jb = MIN(mn - j, blocking);
+
+    iinfo = panel(args, j, jb, sa, sb);
+
+    if (iinfo && !info) info = iinfo;
+
+    if (j + jb < n) update(args, j, jb, j + jb, n, sa, sb);
+  }
+
+  return info;
+}
@@ -0,0 +1,272 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* LU factorization as a graph of tasks, included by getrf_parallel.c.
+
+   The matrix is cut into block columns, called lines here. The first
+   lines are also the panels. A line receives the update from every panel
+   before it, one step at a time: the row interchanges of the panel, the
+   triangular solve with its unit lower triangle and the product with the
+   rest of it. A panel is then factorized by the single threaded driver.
+   Each thread takes the ready task of the lowest line that is not being
+   worked on, so the next panel goes ahead of the rest of the trailing
+   matrix. The interchanges of later panels are applied to the columns on
+   their left at the end.
+
+   A panel may be factorized while the updates of up to "lookahead" steps
+   before it are still pending on later lines. With 0 the steps do not
+   overlap. The depth is OPENBLAS_LOOKAHEAD, or GETRF_LOOKAHEAD when that
+   is not set. */
+
+#ifndef GETRF_LOOKAHEAD
+#define GETRF_LOOKAHEAD 1
+#endif
+
+/* Lines per thread, so that the threads keep busy towards the end */
+#ifndef TILE_RATE
+#define TILE_RATE 2
+#endif
+
+extern int openblas_lookahead_env(void);
+
+typedef struct {
+  volatile BLASULONG lock;
+  volatile BLASLONG version;
+  volatile BLASLONG left;
+  blasint info;
+  BLASLONG lines, panels, blocking, lookahead, factored, nthreads;
+  BLASLONG *count;
+  BLASLONG *busy;
+} tile_t;
+
+static FLOAT tile_dm1[] = {-ONE, ZERO};
+
+/* Apply panel k to the columns js to js + nj */
+static void tile_apply(blas_arg_t *args, tile_t *tile, BLASLONG k, BLASLONG js, BLASLONG nj, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t newarg;
+  BLASLONG m   = args -> m;
+  BLASLONG lda = args -> lda;
+  BLASLONG ks  = k * tile -> blocking;
+  BLASLONG bk  = MIN(MIN(m, args -> n) - ks, tile -> blocking);
+  FLOAT *a = (FLOAT *)args -> a;
+
+  LASWP_PLUS(nj, ks + 1, ks + bk, ZERO,
+#ifdef COMPLEX
+	     ZERO,
+#endif
+	     a + js * lda * COMPSIZE, lda, NULL, 0, (blasint *)args -> c, 1);
+
+  newarg.m     = bk;
+  newarg.n     = nj;
+  newarg.k     = bk;
+  newarg.lda   = lda;
+  newarg.ldb   = lda;
+  newarg.ldc   = lda;
+  newarg.a     = a + (ks + ks * lda) * COMPSIZE;
+  newarg.b     = a + (ks + js * lda) * COMPSIZE;
+  newarg.alpha = tile_dm1;
+  newarg.beta  = NULL;
+
+  TRSM_LNLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  if (m - ks - bk > 0) {
+    newarg.m = m - ks - bk;
+    newarg.a = a + (ks + bk + ks * lda) * COMPSIZE;
+    newarg.b = a + (ks      + js * lda) * COMPSIZE;
+    newarg.c = a + (ks + bk + js * lda) * COMPSIZE;
+
+    GEMM_NN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+}
+
+/* Factorize panel j. Only the last one may be narrower than its line. */
+static void tile_factor(blas_arg_t *args, tile_t *tile, BLASLONG j, FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG js = j * tile -> blocking;
+  BLASLONG bj = MIN(args -> n - js, tile -> blocking);
+  BLASLONG range_N[2];
+  blasint iinfo;
+
+  range_N[0] = js;
+  range_N[1] = js + MIN(MIN(args -> m, args -> n) - js, tile -> blocking);
+
+  iinfo = GETRF_SINGLE(args, NULL, range_N, sa, sb, 0);
+
+  if (range_N[1] < js + bj) tile_apply(args, tile, j, range_N[1], js + bj - range_N[1], sa, sb);
+
+  /* the panels are factorized in order, so the first one is the smallest */
+  blas_lock(&tile -> lock);
+  if (iinfo && !tile -> info) tile -> info = iinfo + js;
+  blas_unlock(&tile -> lock);
+}
+
+static int tile_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  tile_t *tile = (tile_t *)args -> common;
+  BLASLONG j, k, js, bj, front, seen;
+  BLASLONG mn = MIN(args -> m, args -> n);
+
+  while (1) {
+
+    seen = tile -> version;
+
+    blas_lock(&tile -> lock);
+
+    if (tile -> left == 0) {
+      blas_unlock(&tile -> lock);
+      break;
+    }
+
+    /* the oldest step with an update still to do */
+    front = tile -> panels;
+    for (j = tile -> factored; j < tile -> lines; j ++)
+      if (tile -> count[j] < MIN(j, tile -> panels) && tile -> count[j] < front) front = tile -> count[j];
+
+    k = -1;
+    for (j = tile -> factored; j < tile -> lines; j ++) {
+      if (tile -> busy[j]) continue;
+
+      if (tile -> count[j] < MIN(j, tile -> panels)) {
+	if (tile -> count[j] < tile -> factored) {
+	  k = tile -> count[j];
+	  break;
+	}
+      } else if (j < tile -> panels && tile -> count[j] == j) {
+	if (j - front <= tile -> lookahead) {
+	  k = j;
+	  break;
+	}
+      }
+    }
+
+    if (k >= 0) tile -> busy[j] = 1;
+
+    blas_unlock(&tile -> lock);
+
+    if (k < 0) {
+      while (tile -> version == seen) {YIELDING;};
+      continue;
+    }
+
+    if (k < j) {
+      js = j * tile -> blocking;
+      tile_apply(args, tile, k, js, MIN(args -> n - js, tile -> blocking), sa, sb);
+    } else {
+      tile_factor(args, tile, j, sa, sb);
+    }
+
+    blas_lock(&tile -> lock);
+
+    tile -> count[j] ++;
+    tile -> busy[j] = 0;
+    tile -> left --;
+    if (k == j) tile -> factored ++;
+    tile -> version ++;
+
+    blas_unlock(&tile -> lock);
+  }
+
+  /* interchanges of the later panels on the columns of each panel */
+  for (j = mypos; j < tile -> panels; j += tile -> nthreads) {
+    js = j * tile -> blocking;
+    bj = MIN(mn - js, tile -> blocking);
+
+    if (js + bj < mn)
+      LASWP_PLUS(bj, js + bj + 1, mn, ZERO,
+#ifdef COMPLEX
+		 ZERO,
+#endif
+		 (FLOAT *)args -> a + js * args -> lda * COMPSIZE, args -> lda, NULL, 0, (blasint *)args -> c, 1);
+  }
+
+  return 0;
+}
+
+static blasint getrf_tile(blas_arg_t *args, BLASLONG blocking, FLOAT *sa, FLOAT *sb, int mode) {
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  tile_t tile;
+  BLASLONG i, nthreads;
+
+  tile.blocking  = blocking;
+  tile.lines     = (args -> n + blocking - 1) / blocking;
+  tile.panels    = (MIN(args -> m, args -> n) + blocking - 1) / blocking;
+  tile.lookahead = openblas_lookahead_env();
+  if (tile.lookahead < 0) tile.lookahead = GETRF_LOOKAHEAD;
+
+  tile.count = (BLASLONG *)malloc(tile.lines * 2 * sizeof(BLASLONG));
+  if (tile.count == NULL) return -1;
+  tile.busy  = tile.count + tile.lines;
+
+  tile.left = 0;
+  for (i = 0; i < tile.lines; i ++) {
+    tile.count[i] = 0;
+    tile.busy[i]  = 0;
+    tile.left    += MIN(i, tile.panels) + (i < tile.panels);
+  }
+
+  nthreads = MIN(args -> nthreads, MAX_CPU_NUMBER);
+
+  tile.lock     = 0;
+  tile.version  = 0;
+  tile.factored = 0;
+  tile.info     = 0;
+  tile.nthreads = nthreads;
+
+  args -> common = (void *)&tile;
+
+  for (i = 0; i < nthreads; i ++) {
+    queue[i].mode    = mode;
+    queue[i].routine = (void *)tile_thread;
+    queue[i].args    = args;
+    queue[i].range_m = NULL;
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[nthreads - 1].next = NULL;
+
+  exec_blas(nthreads, queue);
+
+  args -> common = NULL;
+
+  free(tile.count);
+
+  return tile.info;
+}
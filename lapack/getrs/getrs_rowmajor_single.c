@@ -0,0 +1,155 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* Solves op(A) X = B with the factors of getrf_rowmajor, for B stored by
+   rows. args -> a holds the transposed factors and args -> b is read by
+   columns as the args -> m x args -> n matrix X^T (args -> m right hand
+   sides), so the triangular solves are from the right and the row
+   interchanges of B swap columns of X^T:
+
+     N:  X^T := X^T P L^-T U^-T
+     T:  X^T := X^T U^-1 L^-1 P^T
+     C:  X^T := X^T conj(U)^-1 conj(L)^-1 P^T
+
+   with L^T above and U^T on and below the diagonal of args -> a. The
+   operation is passed in the last argument, 0 to 2 for N, T and C. The
+   PARALLEL variant divides the right hand sides between args -> nthreads
+   threads. */
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+#define GETRS_MODE	(BLAS_XDOUBLE | BLAS_REAL)
+#elif defined(DOUBLE)
+#define GETRS_MODE	(BLAS_DOUBLE  | BLAS_REAL)
+#else
+#define GETRS_MODE	(BLAS_SINGLE  | BLAS_REAL)
+#endif
+#else
+#ifdef XDOUBLE
+#define GETRS_MODE	(BLAS_XDOUBLE | BLAS_COMPLEX)
+#elif defined(DOUBLE)
+#define GETRS_MODE	(BLAS_DOUBLE  | BLAS_COMPLEX)
+#else
+#define GETRS_MODE	(BLAS_SINGLE  | BLAS_COMPLEX)
+#endif
+#endif
+
+/* Interchanges columns i and ipiv(i) of X^T, from i = 0 up or back down */
+static void laswp(blas_arg_t *args, BLASLONG *range_m, int back) {
+
+  BLASLONG m_from, m_to, n, ldb, i, k, ip;
+  blasint *ipiv;
+  FLOAT *b;
+
+  m_from = 0;
+  m_to   = args -> m;
+  if (range_m) {
+    m_from = range_m[0];
+    m_to   = range_m[1];
+  }
+
+  n    = args -> n;
+  ldb  = args -> ldb;
+  b    = (FLOAT *)args -> b + m_from * COMPSIZE;
+  ipiv = (blasint *)args -> c;
+
+  for (k = 0; k < n; k ++) {
+    i  = back ? n - 1 - k : k;
+    ip = ipiv[i] - 1;
+
+    if (ip != i)
+      SWAP_K(m_to - m_from, 0, 0, ZERO,
+#ifdef COMPLEX
+	     ZERO,
+#endif
+	     b + i * ldb * COMPSIZE, 1, b + ip * ldb * COMPSIZE, 1, NULL, 0);
+  }
+}
+
+static int solve(blas_arg_t *args, BLASLONG *range_m, FLOAT *sa, FLOAT *sb, BLASLONG trans) {
+
+  if (trans == 0) {
+    laswp(args, range_m, 0);
+    TRSM_RNUU(args, range_m, NULL, sa, sb, 0);
+    TRSM_RNLN(args, range_m, NULL, sa, sb, 0);
+  } else {
+    if (trans == 1) {
+      TRSM_RTLN(args, range_m, NULL, sa, sb, 0);
+      TRSM_RTUU(args, range_m, NULL, sa, sb, 0);
+    } else {
+      TRSM_RCLN(args, range_m, NULL, sa, sb, 0);
+      TRSM_RCUU(args, range_m, NULL, sa, sb, 0);
+    }
+    laswp(args, range_m, 1);
+  }
+
+  return 0;
+}
+
+#ifndef PARALLEL
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG trans) {
+
+  return solve(args, range_m, sa, sb, trans);
+}
+
+#else
+
+static int solve_N(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+  return solve(args, range_m, sa, sb, 0);
+}
+
+static int solve_T(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+  return solve(args, range_m, sa, sb, 1);
+}
+
+static int solve_C(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+  return solve(args, range_m, sa, sb, 2);
+}
+
+static int (*solve_thread[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  solve_N, solve_T, solve_C,
+};
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG trans) {
+
+  gemm_thread_m(GETRS_MODE | BLAS_RSIDE, args, range_m, NULL, solve_thread[trans], sa, sb, args -> nthreads);
+
+  return 0;
+}
+
+#endif
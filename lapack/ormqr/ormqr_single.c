@@ -0,0 +1,114 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include "common.h"
+
+#define LARFB_NO_PANEL
+
+#include "../geqrf/larfb.c"
+
+/* Multiplies the m x n matrix C by Q or Q^H from the left or the right,
+   where Q is the product of the k reflectors returned by xGEQRF in a and
+   tau (xORMQR, xUNMQR).
+
+   args -> k, a, lda and b (tau) describe Q, args -> c and ldc the matrix C,
+   args -> ldb is nb and args -> d is the workspace of args -> ldd
+   elements, at least n from the left and m from the right. mode is a
+   combination of LARFB_LEFT and LARFB_TRANS. */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mode) {
+
+  BLASLONG m, n, k, lda, ldc, nq, nw, nb, lwork, i, ib, start, step;
+  BLASLONG nthreads = 1;
+  FLOAT *a, *tau, *c, *work, *t, *w, *buffer;
+  FLOAT tone[2];
+
+  m     = args -> m;
+  n     = args -> n;
+  k     = args -> k;
+  a     = (FLOAT *)args -> a;
+  lda   = args -> lda;
+  tau   = (FLOAT *)args -> b;
+  c     = (FLOAT *)args -> c;
+  ldc   = args -> ldc;
+  nb    = args -> ldb;
+  work  = (FLOAT *)args -> d;
+  lwork = args -> ldd;
+
+#ifdef PARALLEL
+  nthreads = args -> nthreads;
+#endif
+
+  if (m <= 0 || n <= 0 || k <= 0) return 0;
+
+  nq = (mode & LARFB_LEFT) ? m : n;
+  nw = (mode & LARFB_LEFT) ? n : m;
+
+  if (nb > k) nb = k;
+  if (nb < 1) nb = 1;
+
+  buffer = larfb_work(work, lwork, nw, &nb, &t, &w, tone);
+
+  /* Q^H from the left and Q from the right start with H(0) */
+  if (!(mode & LARFB_LEFT) == !(mode & LARFB_TRANS)) {
+    start = 0;
+    step  = nb;
+  } else {
+    start = ((k - 1) / nb) * nb;
+    step  = -nb;
+  }
+
+  for (i = start; i >= 0 && i < k; i += step) {
+
+    ib = MIN(k - i, nb);
+
+    larft(nq - i, ib, a + (i + i * lda) * COMPSIZE, lda, tau + i * COMPSIZE, t, nb, sb, nthreads);
+
+    if (mode & LARFB_LEFT) {
+      larfb(mode, m - i, n, ib, a + (i + i * lda) * COMPSIZE, lda, t, nb,
+	    c + i * COMPSIZE, ldc, w, nw, nthreads, sa, sb);
+    } else {
+      larfb(mode, m, n - i, ib, a + (i + i * lda) * COMPSIZE, lda, t, nb,
+	    c + i * ldc * COMPSIZE, ldc, w, nw, nthreads, sa, sb);
+    }
+  }
+
+  if (buffer) free(buffer);
+
+  return 0;
+}
@@ -39,6 +39,8 @@
 #include <stdio.h>
 #include "common.h"
 
+#include "potrf_tile.c"
+
 blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
 
   BLASLONG n, bk, i, blocking, lda;
@@ -82,6 +84,15 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
     return info;
   }
 
+  if (range_n == NULL && n >= GEMM_Q * 4) {
+    blocking = ((n / (args -> nthreads * TILE_RATE) + GEMM_UNROLL_N - 1)/GEMM_UNROLL_N) * GEMM_UNROLL_N;
+    if (blocking < GEMM_Q / 4) blocking = GEMM_Q / 4;
+    if (blocking > GEMM_Q) blocking = GEMM_Q;
+
+    info = potrf_tile(args, blocking, sa, sb, mode);
+    if (info >= 0) return info;
+  }
+
   newarg.lda = lda;
   newarg.ldb = lda;
   newarg.ldc = lda;
@@ -0,0 +1,295 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+/* Cholesky factorization as a graph of tasks, included by the parallel
+   drivers.
+
+   The matrix is cut into block columns (block rows for the upper
+   triangle), called lines here. A line receives the update from every
+   line before it, one step at a time, and is then factorized: its
+   diagonal block by the single threaded driver and the rest of it by
+   TRSM. Each thread takes the ready task of the lowest line that is not
+   being worked on, so the next panel goes ahead of the rest of the
+   trailing matrix.
+
+   A panel may be factorized while the updates of up to "lookahead" steps
+   before it are still pending on later lines. With 0 the steps do not
+   overlap, as in the loop of the parallel drivers. The depth is
+   OPENBLAS_LOOKAHEAD, or POTRF_LOOKAHEAD when that is not set. */
+
+#ifndef POTRF_LOOKAHEAD
+#define POTRF_LOOKAHEAD 1
+#endif
+
+/* Lines per thread, so that the threads keep busy towards the end */
+#ifndef TILE_RATE
+#define TILE_RATE 2
+#endif
+
+extern int openblas_lookahead_env(void);
+
+typedef struct {
+  volatile BLASULONG lock;
+  volatile BLASLONG version;
+  volatile BLASLONG left;
+  volatile blasint info;
+  BLASLONG lines, blocking, lookahead, factored;
+  BLASLONG *count;
+  BLASLONG *busy;
+} tile_t;
+
+static FLOAT tile_dm1[] = {-ONE, ZERO};
+
+/* Factorize line j */
+static blasint tile_factor(blas_arg_t *args, tile_t *tile, BLASLONG j, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t newarg;
+  BLASLONG n   = args -> n;
+  BLASLONG lda = args -> lda;
+  BLASLONG js  = j * tile -> blocking;
+  BLASLONG bj  = MIN(n - js, tile -> blocking);
+  FLOAT *a = (FLOAT *)args -> a;
+  blasint info;
+
+  newarg.n   = bj;
+  newarg.lda = lda;
+  newarg.ldb = lda;
+  newarg.a   = a + (js + js * lda) * COMPSIZE;
+  newarg.beta = NULL;
+
+#ifndef LOWER
+  info = POTRF_U_SINGLE(&newarg, NULL, NULL, sa, sb, 0);
+#else
+  info = POTRF_L_SINGLE(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+  if (info) return info;
+
+  if (n - js - bj > 0) {
+#ifndef LOWER
+    newarg.m = bj;
+    newarg.n = n - js - bj;
+    newarg.b = a + (js + (js + bj) * lda) * COMPSIZE;
+
+    TRSM_LCUN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+    newarg.m = n - js - bj;
+    newarg.n = bj;
+    newarg.b = a + (js + bj + js * lda) * COMPSIZE;
+
+    TRSM_RCLN(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+  }
+
+  return 0;
+}
+
+/* Apply the factorized line k to line j */
+static void tile_update(blas_arg_t *args, tile_t *tile, BLASLONG k, BLASLONG j, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t newarg;
+  BLASLONG n   = args -> n;
+  BLASLONG lda = args -> lda;
+  BLASLONG ks  = k * tile -> blocking;
+  BLASLONG js  = j * tile -> blocking;
+  BLASLONG bj  = MIN(n - js, tile -> blocking);
+  FLOAT *a = (FLOAT *)args -> a;
+
+  newarg.k     = tile -> blocking;
+  newarg.lda   = lda;
+  newarg.ldb   = lda;
+  newarg.ldc   = lda;
+  newarg.alpha = tile_dm1;
+  newarg.beta  = NULL;
+
+  newarg.n = bj;
+
+#ifndef LOWER
+  newarg.a = a + (ks + js * lda) * COMPSIZE;
+  newarg.c = a + (js + js * lda) * COMPSIZE;
+
+  HERK_UC(&newarg, NULL, NULL, sa, sb, 0);
+
+  if (n - js - bj > 0) {
+    newarg.m = bj;
+    newarg.n = n - js - bj;
+    newarg.b = a + (ks + (js + bj) * lda) * COMPSIZE;
+    newarg.c = a + (js + (js + bj) * lda) * COMPSIZE;
+
+    GEMM_CN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+#else
+  newarg.a = a + (js + ks * lda) * COMPSIZE;
+  newarg.c = a + (js + js * lda) * COMPSIZE;
+
+  HERK_LN(&newarg, NULL, NULL, sa, sb, 0);
+
+  if (n - js - bj > 0) {
+    newarg.m = n - js - bj;
+    newarg.a = a + (js + bj + ks * lda) * COMPSIZE;
+    newarg.b = a + (js      + ks * lda) * COMPSIZE;
+    newarg.c = a + (js + bj + js * lda) * COMPSIZE;
+
+    GEMM_NC(&newarg, NULL, NULL, sa, sb, 0);
+  }
+#endif
+}
+
+static int tile_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  tile_t *tile = (tile_t *)args -> common;
+  BLASLONG j, k, front, seen;
+  blasint info = 0;
+
+  while (1) {
+
+    seen = tile -> version;
+
+    blas_lock(&tile -> lock);
+
+    if (tile -> left == 0 || tile -> info) {
+      blas_unlock(&tile -> lock);
+      break;
+    }
+
+    /* the oldest step with an update still to do */
+    front = tile -> lines;
+    for (j = tile -> factored; j < tile -> lines; j ++)
+      if (tile -> count[j] < front) front = tile -> count[j];
+
+    k = -1;
+    for (j = tile -> factored; j < tile -> lines; j ++) {
+      if (tile -> busy[j]) continue;
+
+      if (tile -> count[j] < j) {
+	if (tile -> count[j] < tile -> factored) {
+	  k = tile -> count[j];
+	  break;
+	}
+      } else {
+	if (j - front <= tile -> lookahead) {
+	  k = j;
+	  break;
+	}
+      }
+    }
+
+    if (k >= 0) tile -> busy[j] = 1;
+
+    blas_unlock(&tile -> lock);
+
+    if (k < 0) {
+      while (tile -> version == seen && !tile -> info) {YIELDING;};
+      continue;
+    }
+
+    if (k < j) {
+      tile_update(args, tile, k, j, sa, sb);
+    } else {
+      info = tile_factor(args, tile, j, sa, sb);
+    }
+
+    blas_lock(&tile -> lock);
+
+    tile -> count[j] ++;
+    tile -> busy[j] = 0;
+    tile -> left --;
+
+    if (k == j) {
+      tile -> factored ++;
+      if (info && !tile -> info) tile -> info = info + j * tile -> blocking;
+    }
+
+    tile -> version ++;
+
+    blas_unlock(&tile -> lock);
+  }
+
+  return 0;
+}
+
+static blasint potrf_tile(blas_arg_t *args, BLASLONG blocking, FLOAT *sa, FLOAT *sb, int mode) {
+
+  blas_arg_t newarg;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  tile_t tile;
+  BLASLONG i, nthreads;
+
+  tile.blocking  = blocking;
+  tile.lines     = (args -> n + blocking - 1) / blocking;
+  tile.lookahead = openblas_lookahead_env();
+  if (tile.lookahead < 0) tile.lookahead = POTRF_LOOKAHEAD;
+
+  tile.count = (BLASLONG *)malloc(tile.lines * 2 * sizeof(BLASLONG));
+  if (tile.count == NULL) return -1;
+  tile.busy  = tile.count + tile.lines;
+
+  for (i = 0; i < tile.lines; i ++) {
+    tile.count[i] = 0;
+    tile.busy[i]  = 0;
+  }
+
+  tile.lock     = 0;
+  tile.version  = 0;
+  tile.factored = 0;
+  tile.info     = 0;
+  tile.left     = tile.lines * (tile.lines + 1) / 2;
+
+  nthreads = MIN(args -> nthreads, MAX_CPU_NUMBER);
+
+  newarg.a      = args -> a;
+  newarg.n      = args -> n;
+  newarg.lda    = args -> lda;
+  newarg.common = (void *)&tile;
+
+  for (i = 0; i < nthreads; i ++) {
+    queue[i].mode    = mode;
+    queue[i].routine = (void *)tile_thread;
+    queue[i].args    = &newarg;
+    queue[i].range_m = NULL;
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[nthreads - 1].next = NULL;
+
+  exec_blas(nthreads, queue);
+
+  free(tile.count);
+
+  return tile.info;
+}
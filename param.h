@@ -81,6 +81,45 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SBGEMM_DEFAULT_Q 256
 #define SBGEMM_ALIGN_K 1  // must be 2^x
 
+#if defined(HASWELL) || defined(ZEN) || defined(SKYLAKEX) || defined(COOPERLAKE) || defined(SAPPHIRERAPIDS)
+#define SHGEMM_DEFAULT_UNROLL_N 4
+#define SHGEMM_DEFAULT_UNROLL_M 16
+#elif defined(ARCH_ARM64)
+#define SHGEMM_DEFAULT_UNROLL_N 4
+#define SHGEMM_DEFAULT_UNROLL_M 8
+#else
+#define SHGEMM_DEFAULT_UNROLL_N 2
+#define SHGEMM_DEFAULT_UNROLL_M 2
+#endif
+#define SHGEMM_DEFAULT_P 256
+#define SHGEMM_DEFAULT_Q 256
+
+/* int8 gemm: packed panels are zero padded to the unroll and to I8GEMM_ALIGN_K */
+#if defined(SAPPHIRERAPIDS)
+#define I8GEMM_DEFAULT_UNROLL_M 32
+#define I8GEMM_DEFAULT_UNROLL_N 32
+#define I8GEMM_ALIGN_K 64
+#elif defined(COOPERLAKE)
+#define I8GEMM_DEFAULT_UNROLL_M 32
+#define I8GEMM_DEFAULT_UNROLL_N 8
+#define I8GEMM_ALIGN_K 4
+#elif defined(HASWELL) || defined(ZEN) || defined(SKYLAKEX)
+#define I8GEMM_DEFAULT_UNROLL_M 8
+#define I8GEMM_DEFAULT_UNROLL_N 4
+#define I8GEMM_ALIGN_K 4
+#elif defined(NEOVERSEN2) || defined(NEOVERSEV1) || defined(NEOVERSEV2)
+#define I8GEMM_DEFAULT_UNROLL_M 8
+#define I8GEMM_DEFAULT_UNROLL_N 8
+#define I8GEMM_ALIGN_K 4
+#else
+#define I8GEMM_DEFAULT_UNROLL_M 4
+#define I8GEMM_DEFAULT_UNROLL_N 4
+#define I8GEMM_ALIGN_K 4
+#endif
+#define I8GEMM_DEFAULT_P 256
+#define I8GEMM_DEFAULT_Q 512
+#define I8GEMM_DEFAULT_R 1024
+
 #ifdef OPTERON
 
 #define SNUMOPT		4
@@ -42,4 +42,21 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SINGLE_EPS 1e-04
 #define DOUBLE_EPS 1e-13
+
+/* size pseudo-random values in [-scale / 2, scale / 2), the same for the
+   same seed. The sequence has no short period, so square blocks of it
+   are not singular. The caller frees the result. */
+static __inline double *utest_fill(BLASLONG size, int seed, double scale)
+{
+    double *x = (double *)malloc(size * sizeof(double));
+    unsigned int r = seed;
+    BLASLONG i;
+
+    for (i = 0; i < size; i++) {
+        r = r * 1103515245u + 12345u;
+        x[i] = ((double)(r >> 8) / 16777216. - .5) * scale;
+    }
+
+    return x;
+}
 #endif
@@ -0,0 +1,275 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#ifdef BUILD_DOUBLE
+
+#define BS_COUNT 48
+
+static void fill(double *x, int size, int seed)
+{
+    unsigned int state = 2654435761u * (unsigned int)(seed + 1);
+    int i;
+
+    for (i = 0; i < size; i++) {
+        state = state * 1103515245u + 12345u;
+        x[i] = (double)((state >> 8) & 0xffff) / 65536. - .5;
+    }
+}
+
+/* Diagonally dominant symmetric matrix, positive definite */
+static void fill_spd(double *a, int n, int lda, int seed)
+{
+    int i, j;
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i <= j; i++) {
+            a[i + j * lda] = (double)((i * 5 + j * 3 + seed) % 11) / 11. - .5;
+            a[j + i * lda] = a[i + j * lda];
+        }
+    for (i = 0; i < n; i++) a[i + i * lda] += n;
+}
+
+static double maxdiff(const double *x, const double *y, int size)
+{
+    double diff, max = 0.;
+    int i;
+
+    for (i = 0; i < size; i++) {
+        diff = fabs(x[i] - y[i]);
+        if (diff > max) max = diff;
+    }
+
+    return max;
+}
+
+CTEST(batch_small, dgetrf_matches_dgetrf)
+{
+    blasint m_array[2] = {5, 24}, n_array[2] = {5, 17}, lda_array[2] = {5, 30};
+    blasint group_count = 2, group_size[2] = {BS_COUNT / 2, BS_COUNT / 2};
+    blasint info_array[BS_COUNT], ipiv[BS_COUNT][24], ipiv_ref[24], info;
+    blasint *ipiv_array[BS_COUNT];
+    double *a_array[BS_COUNT], *ref;
+    int i, g, size;
+
+    for (i = 0; i < BS_COUNT; i++) {
+        g = i / (BS_COUNT / 2);
+        a_array[i] = (double *)malloc(sizeof(double) * lda_array[g] * n_array[g]);
+        fill(a_array[i], lda_array[g] * n_array[g], i);
+        ipiv_array[i] = ipiv[i];
+    }
+
+    /* Singular member: info reports the first zero pivot */
+    memset(a_array[1], 0, sizeof(double) * 5 * 5);
+
+    BLASFUNC(dgetrf_batch)(m_array, n_array, a_array, lda_array, ipiv_array, &group_count, group_size, info_array);
+
+    ASSERT_EQUAL(1, info_array[1]);
+
+    for (i = 0; i < BS_COUNT; i++) {
+        if (i == 1) continue;
+        g = i / (BS_COUNT / 2);
+        size = lda_array[g] * n_array[g];
+        ref = (double *)malloc(sizeof(double) * size);
+        fill(ref, size, i);
+        BLASFUNC(dgetrf)(&m_array[g], &n_array[g], ref, &lda_array[g], ipiv_ref, &info);
+
+        ASSERT_EQUAL(info, info_array[i]);
+        ASSERT_EQUAL(0, memcmp(ipiv_ref, ipiv[i], sizeof(blasint) * (m_array[g] < n_array[g] ? m_array[g] : n_array[g])));
+        ASSERT_DBL_NEAR_TOL(0., maxdiff(ref, a_array[i], size), DOUBLE_EPS * 100);
+        free(ref);
+    }
+
+    for (i = 0; i < BS_COUNT; i++) free(a_array[i]);
+}
+
+CTEST(batch_small, dpotrf_matches_dpotrf)
+{
+    char uplo_array[2] = {'U', 'L'};
+    blasint n_array[2] = {8, 31}, lda_array[2] = {8, 33};
+    blasint group_count = 2, group_size[2] = {BS_COUNT / 2, BS_COUNT / 2};
+    blasint info_array[BS_COUNT], info;
+    double *a_array[BS_COUNT], *ref;
+    int i, g, size;
+
+    for (i = 0; i < BS_COUNT; i++) {
+        g = i / (BS_COUNT / 2);
+        a_array[i] = (double *)calloc(lda_array[g] * n_array[g], sizeof(double));
+        fill_spd(a_array[i], n_array[g], lda_array[g], i);
+    }
+
+    /* Not positive definite from its fourth leading minor on */
+    a_array[BS_COUNT - 1][3 + 3 * lda_array[1]] = -100.;
+
+    BLASFUNC(dpotrf_batch)(uplo_array, n_array, a_array, lda_array, &group_count, group_size, info_array);
+
+    ASSERT_EQUAL(4, info_array[BS_COUNT - 1]);
+
+    for (i = 0; i < BS_COUNT - 1; i++) {
+        g = i / (BS_COUNT / 2);
+        size = lda_array[g] * n_array[g];
+        ref = (double *)calloc(size, sizeof(double));
+        fill_spd(ref, n_array[g], lda_array[g], i);
+        BLASFUNC(dpotrf)(&uplo_array[g], &n_array[g], ref, &lda_array[g], &info);
+
+        ASSERT_EQUAL(0, info_array[i]);
+        ASSERT_DBL_NEAR_TOL(0., maxdiff(ref, a_array[i], size), DOUBLE_EPS * 100);
+        free(ref);
+    }
+
+    for (i = 0; i < BS_COUNT; i++) free(a_array[i]);
+}
+
+CTEST(batch_small, dgetrs_residual)
+{
+    char trans_array[2] = {'N', 'T'};
+    blasint n_array[2] = {12, 12}, nrhs_array[2] = {3, 3}, lda_array[2] = {12, 12}, ldb_array[2] = {12, 12};
+    blasint group_count = 2, group_size[2] = {BS_COUNT / 2, BS_COUNT / 2};
+    blasint info_array[BS_COUNT], ipiv[BS_COUNT][12];
+    blasint *ipiv_array[BS_COUNT];
+    double a[BS_COUNT][144], lu[BS_COUNT][144], x[BS_COUNT][36], b[36];
+    double *lu_array[BS_COUNT], *x_array[BS_COUNT];
+    int i;
+
+    for (i = 0; i < BS_COUNT; i++) {
+        fill(a[i], 144, i);
+        memcpy(lu[i], a[i], sizeof(a[i]));
+        fill(x[i], 36, i + 3);
+        lu_array[i] = lu[i];
+        x_array[i] = x[i];
+        ipiv_array[i] = ipiv[i];
+    }
+
+    BLASFUNC(dgetrf_batch)(n_array, n_array, lu_array, lda_array, ipiv_array, &group_count, group_size, info_array);
+    for (i = 0; i < BS_COUNT; i++) ASSERT_EQUAL(0, info_array[i]);
+
+    BLASFUNC(dgetrs_batch)(trans_array, n_array, nrhs_array, lu_array, lda_array, ipiv_array,
+                           x_array, ldb_array, &group_count, group_size, info_array);
+
+    for (i = 0; i < BS_COUNT; i++) {
+        ASSERT_EQUAL(0, info_array[i]);
+        /* op(A) x must give back the right hand side */
+        fill(b, 36, i + 3);
+        cblas_dgemm(CblasColMajor, (i < BS_COUNT / 2) ? CblasNoTrans : CblasTrans, CblasNoTrans,
+                    12, 3, 12, 1., a[i], 12, x[i], 12, -1., b, 12);
+        ASSERT_DBL_NEAR_TOL(0., cblas_dnrm2(36, b, 1), DOUBLE_EPS * 1000);
+    }
+}
+
+CTEST(batch_small, dtrsm_matches_dtrsm)
+{
+    enum CBLAS_SIDE side[2] = {CblasLeft, CblasRight};
+    enum CBLAS_UPLO uplo[2] = {CblasUpper, CblasLower};
+    enum CBLAS_TRANSPOSE trans[2] = {CblasNoTrans, CblasTrans};
+    enum CBLAS_DIAG diag[2] = {CblasNonUnit, CblasUnit};
+    enum CBLAS_ORDER order[2] = {CblasColMajor, CblasRowMajor};
+
+    enum CBLAS_SIDE side_array[16];
+    enum CBLAS_UPLO uplo_array[16];
+    enum CBLAS_TRANSPOSE trans_array[16];
+    enum CBLAS_DIAG diag_array[16];
+    blasint m_array[16], n_array[16], lda_array[16], ldb_array[16], group_size[16];
+    double alpha_array[16], a[16][100], b[16][70], ref[70];
+    double *a_array[16], *b_array[16];
+    int o, g, i;
+
+    for (o = 0; o < 2; o++) {
+        for (g = 0; g < 16; g++) {
+            side_array[g]  = side[g & 1];
+            uplo_array[g]  = uplo[(g >> 1) & 1];
+            trans_array[g] = trans[(g >> 2) & 1];
+            diag_array[g]  = diag[(g >> 3) & 1];
+            m_array[g] = 7;
+            n_array[g] = 10;
+            lda_array[g] = 10;
+            ldb_array[g] = (order[o] == CblasColMajor) ? 7 : 10;
+            alpha_array[g] = 1.5;
+            group_size[g] = 1;
+
+            fill(a[g], 100, g);
+            for (i = 0; i < 10; i++) a[g][i * 11] += 4.;
+            fill(b[g], 70, g + 1);
+            a_array[g] = a[g];
+            b_array[g] = b[g];
+        }
+
+        cblas_dtrsm_batch(order[o], side_array, uplo_array, trans_array, diag_array, m_array, n_array,
+                          alpha_array, (const double **)a_array, lda_array, b_array, ldb_array, 16, group_size);
+
+        for (g = 0; g < 16; g++) {
+            fill(ref, 70, g + 1);
+            cblas_dtrsm(order[o], side_array[g], uplo_array[g], trans_array[g], diag_array[g],
+                        7, 10, 1.5, a[g], 10, ref, ldb_array[g]);
+            ASSERT_DBL_NEAR_TOL(0., maxdiff(ref, b[g], 70), DOUBLE_EPS * 100);
+        }
+    }
+}
+
+#ifdef BUILD_COMPLEX16
+CTEST(batch_small, zgetrs_conj_residual)
+{
+    char trans = 'C';
+    blasint n = 9, nrhs = 2, group_count = 1, group_size = 8;
+    blasint info_array[8], ipiv[8][9];
+    blasint *ipiv_array[8];
+    double a[8][162], lu[8][162], x[8][36], b[36];
+    double *lu_array[8], *x_array[8];
+    double one[2] = {1., 0.}, mone[2] = {-1., 0.};
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        fill(a[i], 162, i);
+        memcpy(lu[i], a[i], sizeof(a[i]));
+        fill(x[i], 36, i + 5);
+        lu_array[i] = lu[i];
+        x_array[i] = x[i];
+        ipiv_array[i] = ipiv[i];
+    }
+
+    BLASFUNC(zgetrf_batch)(&n, &n, lu_array, &n, ipiv_array, &group_count, &group_size, info_array);
+    BLASFUNC(zgetrs_batch)(&trans, &n, &nrhs, lu_array, &n, ipiv_array, x_array, &n, &group_count, &group_size, info_array);
+
+    for (i = 0; i < 8; i++) {
+        ASSERT_EQUAL(0, info_array[i]);
+        fill(b, 36, i + 5);
+        cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans, 9, 2, 9, one, a[i], 9, x[i], 9, mone, b, 9);
+        ASSERT_DBL_NEAR_TOL(0., cblas_dznrm2(18, b, 1), DOUBLE_EPS * 1000);
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#ifdef BUILD_DOUBLE
+
+#define BACKEND_N 400
+
+/*
+ * Unknown backends are refused, and huge pages are either available
+ * (Linux) or refused without changing the current backend. Buffers
+ * mapped from here on use the chosen backend, which must not change
+ * the result of a dgemm.
+ */
+CTEST(buffer_backend, select)
+{
+    static double a[BACKEND_N * BACKEND_N], b[BACKEND_N * BACKEND_N], c[BACKEND_N * BACKEND_N];
+    double sum, diff, maxdiff = 0.;
+    int i, j, l, backend;
+
+    backend = openblas_get_buffer_backend();
+    ASSERT_TRUE(backend >= OPENBLAS_BUFFER_MMAP && backend <= OPENBLAS_BUFFER_HUGETLB);
+
+    ASSERT_EQUAL(-1, openblas_set_buffer_backend(-1));
+    ASSERT_EQUAL(-1, openblas_set_buffer_backend(OPENBLAS_BUFFER_HUGETLB + 1));
+    ASSERT_EQUAL(backend, openblas_get_buffer_backend());
+
+    if (openblas_set_buffer_backend(OPENBLAS_BUFFER_THP) == 0)
+        ASSERT_EQUAL(OPENBLAS_BUFFER_THP, openblas_get_buffer_backend());
+    else
+        ASSERT_EQUAL(OPENBLAS_BUFFER_MMAP, openblas_get_buffer_backend());
+
+    for (i = 0; i < BACKEND_N * BACKEND_N; i++) {
+        a[i] = (double)(i % 7) - 3.;
+        b[i] = (double)(i % 5) - 2.;
+    }
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, BACKEND_N, BACKEND_N, BACKEND_N,
+                1.0, a, BACKEND_N, b, BACKEND_N, 0.0, c, BACKEND_N);
+
+    for (j = 0; j < BACKEND_N; j++) {
+        for (i = 0; i < BACKEND_N; i++) {
+            sum = 0.;
+            for (l = 0; l < BACKEND_N; l++) sum += a[i + l * BACKEND_N] * b[l + j * BACKEND_N];
+            diff = c[i + j * BACKEND_N] - sum;
+            if (diff < 0.) diff = -diff;
+            if (diff > maxdiff) maxdiff = diff;
+        }
+    }
+
+    ASSERT_DBL_NEAR_TOL(0., maxdiff, 1e-9);
+
+    ASSERT_EQUAL(0, openblas_set_buffer_backend(backend));
+}
+
+#endif
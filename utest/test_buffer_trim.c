@@ -0,0 +1,100 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#ifdef BUILD_DOUBLE
+
+static double trim_check(int m, int n, int k, double *a, double *b, double *c)
+{
+    double sum, diff, maxdiff = 0.;
+    int i, j, l;
+
+    for (i = 0; i < m * k; i++) a[i] = (double)(i % 7) - 3.;
+    for (i = 0; i < k * n; i++) b[i] = (double)(i % 5) - 2.;
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                1.0, a, m, b, k, 0.0, c, m);
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            sum = 0.;
+            for (l = 0; l < k; l++) sum += a[i + l * m] * b[l + j * k];
+            diff = c[i + j * m] - sum;
+            if (diff < 0.) diff = -diff;
+            if (diff > maxdiff) maxdiff = diff;
+        }
+    }
+
+    return maxdiff;
+}
+
+/*
+ * A single-threaded dgemm that is too large for the small-matrix
+ * kernels but far smaller than a whole buffer takes a right-sized
+ * buffer from the pool, which is unmapped again by
+ * openblas_trim_memory() once the call has returned. Calls after a
+ * trim map new buffers as needed.
+ */
+CTEST(buffer_trim, trim)
+{
+    static double a[400 * 400], b[400 * 400], c[400 * 400];
+    int threads = openblas_get_num_threads();
+    size_t trimmed;
+
+    openblas_set_num_threads(1);
+
+    openblas_trim_memory();
+
+    ASSERT_DBL_NEAR_TOL(0., trim_check(300, 280, 260, a, b, c), 1e-10);
+
+    trimmed = openblas_trim_memory();
+#ifndef _WIN32
+    ASSERT_TRUE(trimmed > 0);
+#endif
+
+    ASSERT_DBL_NEAR_TOL(0., trim_check(300, 280, 260, a, b, c), 1e-10);
+    ASSERT_DBL_NEAR_TOL(0., trim_check(400, 400, 400, a, b, c), 1e-10);
+
+    openblas_set_num_threads(threads);
+
+    ASSERT_DBL_NEAR_TOL(0., trim_check(400, 400, 400, a, b, c), 1e-10);
+    openblas_trim_memory();
+    ASSERT_DBL_NEAR_TOL(0., trim_check(400, 400, 400, a, b, c), 1e-10);
+}
+
+#endif
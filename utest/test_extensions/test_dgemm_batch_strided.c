@@ -0,0 +1,134 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#if defined(BUILD_DOUBLE) && !defined(NO_CBLAS)
+
+/**
+ * Check if error function was called with expected function name
+ * and param info
+ *
+ * param order specifies row or column major order
+ * param m - number of rows of op(A) and C
+ * param n - number of columns of op(B) and C
+ * param k - number of columns of op(A) and rows of op(B)
+ * param lda - leading dimension of A
+ * param stridea - distance between the A of two entries
+ * param ldb - leading dimension of B
+ * param strideb - distance between the B of two entries
+ * param stridec - distance between the C of two entries
+ * param batch_size - number of entries
+ * param expected_info - expected invalid parameter number
+ * return TRUE if everything is ok, otherwise FALSE
+ */
+static int check_badargs(enum CBLAS_ORDER order, blasint m, blasint n, blasint k,
+                         blasint lda, blasint stridea, blasint ldb, blasint strideb,
+                         blasint stridec, blasint batch_size, int expected_info)
+{
+    double a[64], b[64], c[64];
+    blasint ldc = (order == CblasColMajor) ? m : n;
+
+    set_xerbla("DGEMM_BATCH_STRIDED ", expected_info);
+
+    cblas_dgemm_batch_strided(order, CblasNoTrans, CblasNoTrans, m, n, k,
+                              1.0, a, lda, stridea, b, ldb, strideb, 0.0, c, ldc, stridec, batch_size);
+
+    return check_error();
+}
+
+/**
+ * A single entry whose C stride is smaller than C itself is valid
+ */
+CTEST(dgemm_batch_strided, single_entry_small_stride_c)
+{
+    blasint m = 5, n = 4, k = 3;
+    double a[15], b[12], c[20], c_ref[20];
+    int i;
+
+    drand_generate(a, m * k);
+    drand_generate(b, k * n);
+    drand_generate(c, m * n);
+    for (i = 0; i < m * n; i++) c_ref[i] = c[i];
+
+    cblas_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                              1.5, a, m, 0, b, k, 0, 0.5, c, m, 0, 1);
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                1.5, a, m, b, k, 0.5, c_ref, m);
+
+    ASSERT_DBL_NEAR_TOL(0.0, dmatrix_difference(c, c_ref, m, n, m), DOUBLE_EPS);
+}
+
+/**
+ * Test error function for an invalid param order.
+ */
+CTEST(dgemm_batch_strided, xerbla_invalid_order)
+{
+    int passed = check_badargs((enum CBLAS_ORDER)'O', 4, 4, 4, 4, 16, 4, 16, 16, 2, 1);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+/**
+ * Test error function for overlapping C entries.
+ */
+CTEST(dgemm_batch_strided, xerbla_overlapping_c)
+{
+    int passed = check_badargs(CblasColMajor, 4, 4, 4, 4, 16, 4, 16, 8, 2, 17);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+/**
+ * Test error function for an invalid param lda in row major order,
+ * where lda must be at least k.
+ */
+CTEST(dgemm_batch_strided, xerbla_rowmajor_invalid_lda)
+{
+    int passed = check_badargs(CblasRowMajor, 4, 6, 5, 4, 30, 6, 30, 24, 2, 9);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+/**
+ * Test error function for an invalid param strideb in row major order.
+ */
+CTEST(dgemm_batch_strided, xerbla_rowmajor_invalid_strideb)
+{
+    int passed = check_badargs(CblasRowMajor, 4, 6, 5, 5, 20, 6, -1, 24, 2, 13);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+#endif
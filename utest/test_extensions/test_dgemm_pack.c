@@ -0,0 +1,221 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define PACK_A    1
+#define PACK_B    2
+#define PACK_AB   3
+
+#if defined(BUILD_DOUBLE) && !defined(NO_CBLAS)
+
+/**
+ * Compare dgemm_pack + dgemm_compute against dgemm
+ *
+ * param order specifies row or column major order
+ * param packed specifies which operands are packed before the multiplication
+ * param transa specifies op(A), the transposition operation applied to A
+ * param transb specifies op(B), the transposition operation applied to B
+ * param m - number of rows of op(A) and C
+ * param n - number of columns of op(B) and C
+ * param k - number of columns of op(A) and rows of op(B)
+ * param alpha - scaling factor for the matrix-matrix product
+ * param beta - scaling factor for matrix C
+ * return norm of differences
+ */
+static double check_dgemm_pack(enum CBLAS_ORDER order, int packed,
+                               enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                               blasint m, blasint n, blasint k, double alpha, double beta)
+{
+    blasint lda, ldb, ldc, cols, rows;
+    double *a, *b, *c, *c_again, *c_ref, *pa = NULL, *pb = NULL;
+    blasint op_a = transa, op_b = transb;
+    double alpha_a = alpha, alpha_b = 1.0;
+    double norm;
+
+    if (order == CblasColMajor) {
+        lda = (transa == CblasNoTrans) ? m : k;
+        ldb = (transb == CblasNoTrans) ? k : n;
+        ldc = m;
+        cols = m;
+        rows = n;
+    } else {
+        lda = (transa == CblasNoTrans) ? k : m;
+        ldb = (transb == CblasNoTrans) ? n : k;
+        ldc = n;
+        cols = n;
+        rows = m;
+    }
+
+    a = (double *)malloc(sizeof(double) * m * k);
+    b = (double *)malloc(sizeof(double) * k * n);
+    c = (double *)malloc(sizeof(double) * m * n);
+    c_again = (double *)malloc(sizeof(double) * m * n);
+    c_ref = (double *)malloc(sizeof(double) * m * n);
+
+    drand_generate(a, m * k);
+    drand_generate(b, k * n);
+    drand_generate(c, m * n);
+    memcpy(c_again, c, sizeof(double) * m * n);
+    memcpy(c_ref, c, sizeof(double) * m * n);
+
+    cblas_dgemm(order, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c_ref, ldc);
+
+    if (packed & PACK_A) {
+        pa = (double *)malloc(cblas_dgemm_pack_get_size(CblasAMatrix, m, n, k));
+        cblas_dgemm_pack(order, CblasAMatrix, transa, m, n, k, alpha_a, a, lda, pa);
+        op_a = CblasPacked;
+    }
+
+    if (packed & PACK_B) {
+        pb = (double *)malloc(cblas_dgemm_pack_get_size(CblasBMatrix, m, n, k));
+        if (!(packed & PACK_A)) alpha_b = alpha;
+        cblas_dgemm_pack(order, CblasBMatrix, transb, m, n, k, alpha_b, b, ldb, pb);
+        op_b = CblasPacked;
+    }
+
+    /* alpha is folded into the packed operand, which can be reused */
+    cblas_dgemm_compute(order, op_a, op_b, m, n, k, pa ? pa : a, lda, pb ? pb : b, ldb, beta, c, ldc);
+    cblas_dgemm_compute(order, op_a, op_b, m, n, k, pa ? pa : a, lda, pb ? pb : b, ldb, beta, c_again, ldc);
+
+    norm = dmatrix_difference(c, c_ref, cols, rows, ldc)
+         + dmatrix_difference(c_again, c_ref, cols, rows, ldc);
+
+    free(a); free(b); free(c); free(c_again); free(c_ref);
+    free(pa); free(pb);
+
+    return norm;
+}
+
+/**
+ * Check that dgemm_compute rejects a buffer that was packed for the other operand
+ *
+ * return TRUE if everything is ok, otherwise FALSE
+ */
+static int check_badargs_role(void)
+{
+    blasint m = 8, n = 8, k = 8;
+    double a[64], c[64];
+    double *pa;
+    int ret;
+
+    drand_generate(a, m * k);
+    pa = (double *)malloc(cblas_dgemm_pack_get_size(CblasAMatrix, m, n, k));
+    cblas_dgemm_pack(CblasColMajor, CblasAMatrix, CblasNoTrans, m, n, k, 1.0, a, m, pa);
+
+    set_xerbla("DGEMM_COMPUTE ", 9);
+    cblas_dgemm_compute(CblasColMajor, CblasNoTrans, CblasPacked, m, n, k, a, m, pa, k, 0.0, c, m);
+    ret = check_error();
+
+    free(pa);
+    return ret;
+}
+
+/**
+ * Column major, packed A, small enough for a single k block
+ */
+CTEST(dgemm_pack, col_major_packed_a_notrans)
+{
+    double norm = check_dgemm_pack(CblasColMajor, PACK_A, CblasNoTrans, CblasNoTrans,
+                                   50, 40, 30, 1.5, 2.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Column major, packed transposed A, several k blocks and threads
+ */
+CTEST(dgemm_pack, col_major_packed_a_trans)
+{
+    double norm = check_dgemm_pack(CblasColMajor, PACK_A, CblasTrans, CblasNoTrans,
+                                   301, 257, 613, 0.5, 0.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Column major, packed transposed B
+ */
+CTEST(dgemm_pack, col_major_packed_b_trans)
+{
+    double norm = check_dgemm_pack(CblasColMajor, PACK_B, CblasTrans, CblasTrans,
+                                   257, 301, 613, -1.0, 1.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Column major, both operands packed
+ */
+CTEST(dgemm_pack, col_major_packed_ab)
+{
+    double norm = check_dgemm_pack(CblasColMajor, PACK_AB, CblasNoTrans, CblasTrans,
+                                   123, 77, 555, 2.0, 0.5);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Row major, packed A
+ */
+CTEST(dgemm_pack, row_major_packed_a)
+{
+    double norm = check_dgemm_pack(CblasRowMajor, PACK_A, CblasNoTrans, CblasTrans,
+                                   211, 97, 400, 1.0, 0.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * Row major, packed B
+ */
+CTEST(dgemm_pack, row_major_packed_b)
+{
+    double norm = check_dgemm_pack(CblasRowMajor, PACK_B, CblasTrans, CblasNoTrans,
+                                   97, 211, 400, 1.0, 3.0);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_TOL);
+}
+
+/**
+ * A buffer packed as A must not be accepted as B
+ */
+CTEST(dgemm_pack, xerbla_wrong_operand)
+{
+    int passed = check_badargs_role();
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+#endif
@@ -35,18 +35,28 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "common.h"
 
 #define DATASIZE 100
+/* above 64k * GEMM_MULTITHREAD_THRESHOLD elements, so the copy is threaded */
+#define DATASIZE_LARGE 620
 
 struct DATA_DIMATCOPY {
     double a_test[DATASIZE* DATASIZE];
     double a_verify[DATASIZE* DATASIZE];
 };
 
+struct DATA_DIMATCOPY_LARGE {
+    double a_test[DATASIZE_LARGE* DATASIZE_LARGE];
+    double a_verify[DATASIZE_LARGE* DATASIZE_LARGE];
+};
+
 #ifdef BUILD_DOUBLE
 static struct DATA_DIMATCOPY data_dimatcopy;
+static struct DATA_DIMATCOPY_LARGE data_dimatcopy_large;
 
 /**
  * Comapare results computed by dimatcopy and reference func
  *
+ * param a_test - matrix A, overwritten by dimatcopy
+ * param a_verify - matrix for the reference result
  * param api specifies tested api (C or Fortran)
  * param order specifies row or column major order
  * param trans specifies op(A), the transposition operation 
@@ -58,8 +68,8 @@ static struct DATA_DIMATCOPY data_dimatcopy;
  * param lda_dst - leading dimension of output matrix A
  * return norm of difference between openblas and reference func
  */
-static double check_dimatcopy(char api, char order, char trans, blasint rows, blasint cols, double alpha, 
-                             blasint lda_src, blasint lda_dst)
+static double check_dimatcopy_data(double *a_test, double *a_verify, char api, char order, char trans,
+                                  blasint rows, blasint cols, double alpha, blasint lda_src, blasint lda_dst)
 {
     blasint m, n;
     blasint rows_out, cols_out;
@@ -80,17 +90,17 @@ static double check_dimatcopy(char api, char order, char trans, blasint rows, bl
         rows_out = m; cols_out = n;
     }
 
-    drand_generate(data_dimatcopy.a_test, lda_src*m);
+    drand_generate(a_test, lda_src*m);
 
     if (trans == 'T' || trans == 'C') {
-        dtranspose(m, n, alpha, data_dimatcopy.a_test, lda_src, data_dimatcopy.a_verify, lda_dst);
+        dtranspose(m, n, alpha, a_test, lda_src, a_verify, lda_dst);
     } 
     else {
-        dcopy(m, n, alpha, data_dimatcopy.a_test, lda_src, data_dimatcopy.a_verify, lda_dst);
+        dcopy(m, n, alpha, a_test, lda_src, a_verify, lda_dst);
     }
 
     if (api == 'F') {
-        BLASFUNC(dimatcopy)(&order, &trans, &rows, &cols, &alpha, data_dimatcopy.a_test, 
+        BLASFUNC(dimatcopy)(&order, &trans, &rows, &cols, &alpha, a_test, 
                             &lda_src, &lda_dst);
     }
 #ifndef NO_CBLAS
@@ -101,13 +111,24 @@ static double check_dimatcopy(char api, char order, char trans, blasint rows, bl
         if (trans == 'N') ctrans = CblasNoTrans;
         if (trans == 'C') ctrans = CblasConjTrans;
         if (trans == 'R') ctrans = CblasConjNoTrans;
-        cblas_dimatcopy(corder, ctrans, rows, cols, alpha, data_dimatcopy.a_test, 
+        cblas_dimatcopy(corder, ctrans, rows, cols, alpha, a_test, 
                     lda_src, lda_dst);
     }
 #endif
 
     // Find the differences between output matrix computed by dimatcopy and reference func
-    return dmatrix_difference(data_dimatcopy.a_test, data_dimatcopy.a_verify, cols_out, rows_out, lda_dst);
+    return dmatrix_difference(a_test, a_verify, cols_out, rows_out, lda_dst);
+}
+
+/**
+ * Compare results computed by dimatcopy and reference func
+ * on the matrices of data_dimatcopy
+ */
+static double check_dimatcopy(char api, char order, char trans, blasint rows, blasint cols, double alpha, 
+                             blasint lda_src, blasint lda_dst)
+{
+    return check_dimatcopy_data(data_dimatcopy.a_test, data_dimatcopy.a_verify, api, order, trans,
+                                rows, cols, alpha, lda_src, lda_dst);
 }
 
 /**
@@ -783,6 +804,100 @@ CTEST(dimatcopy, c_api_rowmajor_notrans_col_100_row_100)
 }
 #endif
 
+/**
+ * Fortran API specific test
+ * Test dimatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Transposition
+ * Rectangular matrix, lda_src != lda_dst
+ * alpha = 2.0
+ */
+CTEST(dimatcopy, colmajor_trans_col_70_row_50_lda_change)
+{
+    blasint m = 50, n = 70;
+    blasint lda_src = 60, lda_dst = 80;
+    char order = 'C';
+    char trans = 'T';
+    double alpha = 2.0;
+
+    double norm = check_dimatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test dimatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Row Major
+ * Copy only
+ * lda_dst > lda_src, so that rows move towards the end
+ * alpha = 2.0
+ */
+CTEST(dimatcopy, rowmajor_notrans_col_70_row_50_lda_grow)
+{
+    blasint m = 50, n = 70;
+    blasint lda_src = 75, lda_dst = 90;
+    char order = 'R';
+    char trans = 'N';
+    double alpha = 2.0;
+
+    double norm = check_dimatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test dimatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Row Major
+ * Transposition
+ * Square matrix larger than one tile, lda_src != lda_dst
+ * alpha = 1.0
+ */
+CTEST(dimatcopy, rowmajor_trans_col_90_row_90_lda_shrink)
+{
+    blasint m = 90, n = 90;
+    blasint lda_src = 100, lda_dst = 95;
+    char order = 'R';
+    char trans = 'T';
+    double alpha = 1.0;
+
+    double norm = check_dimatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test dimatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Transposition
+ * Rectangular matrix larger than the threading threshold,
+ * lda_src != lda_dst
+ * alpha = 2.0
+ */
+CTEST(dimatcopy, colmajor_trans_col_600_row_520_lda_change)
+{
+    blasint m = 520, n = 600;
+    blasint lda_src = 530, lda_dst = 610;
+    char order = 'C';
+    char trans = 'T';
+    double alpha = 2.0;
+
+    double norm = check_dimatcopy_data(data_dimatcopy_large.a_test, data_dimatcopy_large.a_verify,
+                                       'F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
 /**
  * Test error function for an invalid param order.
  * Must be column (C) or row major (R).
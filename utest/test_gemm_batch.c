@@ -0,0 +1,189 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#ifdef BUILD_DOUBLE
+
+#define BATCH_GROUPS 3
+
+/*
+ * Ragged batch: many small members plus one large member that is split into
+ * column slices by the batch scheduler. Every result must match dgemm.
+ */
+CTEST(dgemm_batch, ragged)
+{
+    enum CBLAS_TRANSPOSE transa[BATCH_GROUPS] = { CblasNoTrans, CblasTrans, CblasNoTrans };
+    enum CBLAS_TRANSPOSE transb[BATCH_GROUPS] = { CblasNoTrans, CblasNoTrans, CblasTrans };
+    blasint m[BATCH_GROUPS] = { 7, 33, 190 };
+    blasint n[BATCH_GROUPS] = { 5, 17, 171 };
+    blasint k[BATCH_GROUPS] = { 3, 29, 150 };
+    blasint size[BATCH_GROUPS] = { 9, 4, 1 };
+    double alpha[BATCH_GROUPS] = { 1.0, -0.5, 2.0 };
+    double beta[BATCH_GROUPS] = { 0.0, 1.0, 0.25 };
+    blasint lda[BATCH_GROUPS], ldb[BATCH_GROUPS], ldc[BATCH_GROUPS];
+    double *a[16], *b[16], *c[16], *c_ref[16];
+    int i, j, g, idx, total = 0;
+    double diff, maxdiff = 0.0;
+
+    for (g = 0; g < BATCH_GROUPS; g++) {
+        lda[g] = (transa[g] == CblasNoTrans) ? m[g] : k[g];
+        ldb[g] = (transb[g] == CblasNoTrans) ? k[g] : n[g];
+        ldc[g] = m[g];
+        for (j = 0; j < size[g]; j++) {
+            a[total] = (double *)malloc(sizeof(double) * m[g] * k[g]);
+            b[total] = (double *)malloc(sizeof(double) * k[g] * n[g]);
+            c[total] = (double *)malloc(sizeof(double) * m[g] * n[g]);
+            c_ref[total] = (double *)malloc(sizeof(double) * m[g] * n[g]);
+            for (i = 0; i < m[g] * k[g]; i++) a[total][i] = (double)((i * 7 + total) % 13) - 6.0;
+            for (i = 0; i < k[g] * n[g]; i++) b[total][i] = (double)((i * 5 + total) % 11) - 5.0;
+            for (i = 0; i < m[g] * n[g]; i++) c[total][i] = c_ref[total][i] = (double)(i % 3);
+            total++;
+        }
+    }
+
+    cblas_dgemm_batch(CblasColMajor, transa, transb, m, n, k, alpha,
+                      (const double **)a, lda, (const double **)b, ldb, beta,
+                      c, ldc, BATCH_GROUPS, size);
+
+    idx = 0;
+    for (g = 0; g < BATCH_GROUPS; g++) {
+        for (j = 0; j < size[g]; j++, idx++) {
+            cblas_dgemm(CblasColMajor, transa[g], transb[g], m[g], n[g], k[g], alpha[g],
+                        a[idx], lda[g], b[idx], ldb[g], beta[g], c_ref[idx], ldc[g]);
+            for (i = 0; i < m[g] * n[g]; i++) {
+                diff = fabs(c[idx][i] - c_ref[idx][i]);
+                if (diff > maxdiff) maxdiff = diff;
+            }
+        }
+    }
+
+    for (i = 0; i < total; i++) {
+        free(a[i]); free(b[i]); free(c[i]); free(c_ref[i]);
+    }
+
+    ASSERT_DBL_NEAR_TOL(0.0, maxdiff, DOUBLE_EPS);
+}
+
+static void strided_fill(double *x, int size, int seed)
+{
+    int i;
+
+    for (i = 0; i < size; i++) x[i] = (double)((i * 7 + seed) % 13) - 6.0;
+}
+
+/*
+ * Uniform strided batch in row major, once with shapes small enough for the
+ * small-matrix kernels and once with shapes that go through the GEMM driver.
+ * The strides leave gaps between the entries, which must stay untouched.
+ */
+CTEST(dgemm_batch_strided, rowmajor)
+{
+    blasint shape[2][3] = { { 6, 5, 4 }, { 70, 45, 66 } };
+    blasint batch = 13, m, n, k, lda, ldb, ldc, sa, sb, sc;
+    double *a, *b, *c, *c_ref;
+    double diff, maxdiff = 0.0;
+    int s, i, j;
+
+    for (s = 0; s < 2; s++) {
+        m = shape[s][0]; n = shape[s][1]; k = shape[s][2];
+        lda = m + 1; ldb = n + 2; ldc = n;
+        sa = lda * k + 3; sb = ldb * k + 1; sc = ldc * m + 5;
+
+        a = (double *)malloc(sizeof(double) * sa * batch);
+        b = (double *)malloc(sizeof(double) * sb * batch);
+        c = (double *)malloc(sizeof(double) * sc * batch);
+        c_ref = (double *)malloc(sizeof(double) * sc * batch);
+        strided_fill(a, sa * batch, 1);
+        strided_fill(b, sb * batch, 2);
+        strided_fill(c, sc * batch, 3);
+        memcpy(c_ref, c, sizeof(double) * sc * batch);
+
+        /* A is k x m stored row major, so op(A) = A**T is m x k */
+        cblas_dgemm_batch_strided(CblasRowMajor, CblasTrans, CblasNoTrans, m, n, k,
+                                  0.5, a, lda, sa, b, ldb, sb, -1.0, c, ldc, sc, batch);
+
+        for (j = 0; j < batch; j++)
+            cblas_dgemm(CblasRowMajor, CblasTrans, CblasNoTrans, m, n, k,
+                        0.5, a + j * sa, lda, b + j * sb, ldb, -1.0, c_ref + j * sc, ldc);
+
+        for (i = 0; i < sc * batch; i++) {
+            diff = fabs(c[i] - c_ref[i]);
+            if (diff > maxdiff) maxdiff = diff;
+        }
+
+        free(a); free(b); free(c); free(c_ref);
+    }
+
+    ASSERT_DBL_NEAR_TOL(0.0, maxdiff, DOUBLE_EPS);
+}
+
+/*
+ * One A for every entry, B and C packed back to back: the batch is run as a
+ * single GEMM over all the columns.
+ */
+CTEST(dgemm_batch_strided, shared_a)
+{
+    blasint batch = 9, m = 37, n = 11, k = 23;
+    double *a, *b, *c, *c_ref;
+    double diff, maxdiff = 0.0;
+    int i, j;
+
+    a = (double *)malloc(sizeof(double) * m * k);
+    b = (double *)malloc(sizeof(double) * k * n * batch);
+    c = (double *)malloc(sizeof(double) * m * n * batch);
+    c_ref = (double *)malloc(sizeof(double) * m * n * batch);
+    strided_fill(a, m * k, 4);
+    strided_fill(b, k * n * batch, 5);
+    strided_fill(c, m * n * batch, 6);
+    memcpy(c_ref, c, sizeof(double) * m * n * batch);
+
+    cblas_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                              2.0, a, m, 0, b, k, k * n, 0.25, c, m, m * n, batch);
+
+    for (j = 0; j < batch; j++)
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                    2.0, a, m, b + j * k * n, k, 0.25, c_ref + j * m * n, m);
+
+    for (i = 0; i < m * n * batch; i++) {
+        diff = fabs(c[i] - c_ref[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(c); free(c_ref);
+
+    ASSERT_DBL_NEAR_TOL(0.0, maxdiff, DOUBLE_EPS);
+}
+
+#endif
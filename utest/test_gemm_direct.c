@@ -0,0 +1,131 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+/*
+ * Mid-sized products, which the small-matrix permit may hand to the
+ * unpacked kernels, for every transposition with padded leading
+ * dimensions and shapes that leave row, column and K remainders.
+ */
+
+#ifdef BUILD_DOUBLE
+static double check_dgemm(char transa, char transb, blasint m, blasint n, blasint k, double beta)
+{
+    blasint lda = (transa == 'N' ? m : k) + 3, ldb = (transb == 'N' ? k : n) + 2, ldc = m + 1;
+    double *a = (double *)malloc(sizeof(double) * lda * (transa == 'N' ? k : m));
+    double *b = (double *)malloc(sizeof(double) * ldb * (transb == 'N' ? n : k));
+    double *c = (double *)malloc(sizeof(double) * ldc * n);
+    double *r = (double *)malloc(sizeof(double) * ldc * n);
+    double alpha = 1.5, sum, diff, maxdiff = 0.;
+    BLASLONG i, j, l;
+
+    for (i = 0; i < lda * (transa == 'N' ? k : m); i++) a[i] = (double)((i * 7 + 1) % 13) / 13. - .5;
+    for (i = 0; i < ldb * (transb == 'N' ? n : k); i++) b[i] = (double)((i * 5 + 2) % 11) / 11. - .5;
+    for (i = 0; i < ldc * n; i++) c[i] = r[i] = (double)((i * 3 + 3) % 7) / 7. - .5;
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            sum = 0.;
+            for (l = 0; l < k; l++)
+                sum += (transa == 'N' ? a[i + l * lda] : a[l + i * lda]) * (transb == 'N' ? b[l + j * ldb] : b[j + l * ldb]);
+            r[i + j * ldc] = alpha * sum + (beta == 0. ? 0. : beta * r[i + j * ldc]);
+        }
+    }
+
+    BLASFUNC(dgemm)(&transa, &transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+
+    for (i = 0; i < ldc * n; i++) {
+        diff = fabs(c[i] - r[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(c); free(r);
+    return maxdiff;
+}
+
+CTEST(gemm_direct, dgemm_nn)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm('N', 'N', 67, 45, 29, 0.), 1e-12);
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm('N', 'N', 13, 70, 51, 0.5), 1e-12);
+}
+
+CTEST(gemm_direct, dgemm_nt)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm('N', 'T', 67, 45, 29, 0.), 1e-12);
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm('N', 'T', 9, 3, 77, -1.), 1e-12);
+}
+
+CTEST(gemm_direct, dgemm_tn)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm('T', 'N', 67, 45, 29, 0.), 1e-12);
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm('T', 'N', 5, 31, 66, 2.), 1e-12);
+}
+
+CTEST(gemm_direct, dgemm_tt)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm('T', 'T', 67, 45, 29, 0.), 1e-12);
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm('T', 'T', 30, 1, 17, 0.25), 1e-12);
+}
+#endif
+
+#ifdef BUILD_SINGLE
+CTEST(gemm_direct, sgemm_tt)
+{
+    blasint m = 37, n = 53, k = 41, lda = k, ldb = n, ldc = m;
+    float *a = (float *)malloc(sizeof(float) * lda * m);
+    float *b = (float *)malloc(sizeof(float) * ldb * k);
+    float *c = (float *)malloc(sizeof(float) * ldc * n);
+    float alpha = 1.f, beta = 0.f;
+    double sum, diff, maxdiff = 0.;
+    char trans = 'T';
+    BLASLONG i, j, l;
+
+    for (i = 0; i < lda * m; i++) a[i] = (float)((i * 7 + 1) % 13) / 13.f - .5f;
+    for (i = 0; i < ldb * k; i++) b[i] = (float)((i * 5 + 2) % 11) / 11.f - .5f;
+
+    BLASFUNC(sgemm)(&trans, &trans, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            sum = 0.;
+            for (l = 0; l < k; l++) sum += (double)a[l + i * lda] * b[j + l * ldb];
+            diff = fabs(c[i + j * ldc] - sum);
+            if (diff > maxdiff) maxdiff = diff;
+        }
+    }
+
+    free(a); free(b); free(c);
+    ASSERT_DBL_NEAR_TOL(0., maxdiff, 1e-4);
+}
+#endif
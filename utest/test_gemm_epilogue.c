@@ -0,0 +1,224 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#if defined(BUILD_SINGLE) || defined(BUILD_DOUBLE)
+
+/* Applies the epilogue to a column major m x n matrix that holds the plain gemm result */
+static void ref_epilogue(blasint m, blasint n, double *c, blasint ldc,
+                         OPENBLAS_BIAS bias, double *bv, OPENBLAS_ACTIVATION act,
+                         double lo, double hi)
+{
+    blasint i, j;
+    double v;
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            v = c[i + j * ldc];
+            if (bias == OpenblasBiasRow) v += bv[i];
+            if (bias == OpenblasBiasCol) v += bv[j];
+            if (act == OpenblasActReLU && v < 0.) v = 0.;
+            if (act == OpenblasActGELU) v = 0.5 * v * (1. + erf(v * 0.70710678118654752440));
+            if (act == OpenblasActClamp) v = (v < lo) ? lo : ((v > hi) ? hi : v);
+            c[i + j * ldc] = v;
+        }
+    }
+}
+
+static uint16_t ref_bf16(float f)
+{
+    union { float f; uint32_t u; } x;
+
+    x.f = f;
+    if ((x.u & 0x7fffffff) > 0x7f800000) return (uint16_t)((x.u >> 16) | 0x40);
+    return (uint16_t)((x.u + 0x7fff + ((x.u >> 16) & 1)) >> 16);
+}
+#endif
+
+#ifdef BUILD_SINGLE
+static float check_sgemm_epilogue(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                                  enum CBLAS_TRANSPOSE transb, blasint m, blasint n, blasint k,
+                                  float alpha, float beta, OPENBLAS_BIAS bias,
+                                  OPENBLAS_ACTIVATION act, int with_bf16)
+{
+    /* a row major matrix is stored like its column major transpose */
+    blasint rows = (order == CblasColMajor) ? m : n;
+    blasint cols = (order == CblasColMajor) ? n : m;
+    int a_plain = ((transa == CblasNoTrans) == (order == CblasColMajor));
+    int b_plain = ((transb == CblasNoTrans) == (order == CblasColMajor));
+    blasint ka = a_plain ? k : m, kb = b_plain ? n : k;
+    blasint lda = (a_plain ? m : k) + 2, ldb = (b_plain ? k : n) + 1, ldc = rows + 3;
+    blasint i, j;
+    float *a, *b, *c, *c_ref, *bv, maxerr = 0.f;
+    double *r, *bvd;
+    bfloat16 *out = NULL;
+    openblas_gemm_epilogue ep;
+
+    a = malloc(sizeof(float) * lda * ka);
+    b = malloc(sizeof(float) * ldb * kb);
+    c = malloc(sizeof(float) * ldc * cols);
+    c_ref = malloc(sizeof(float) * ldc * cols);
+    r = malloc(sizeof(double) * ldc * cols);
+    bv = malloc(sizeof(float) * (m + n));
+    bvd = malloc(sizeof(double) * (m + n));
+
+    for (i = 0; i < lda * ka; i++) a[i] = (float)rand() / RAND_MAX - 0.5f;
+    for (i = 0; i < ldb * kb; i++) b[i] = (float)rand() / RAND_MAX - 0.5f;
+    for (i = 0; i < ldc * cols; i++) c[i] = c_ref[i] = (float)rand() / RAND_MAX - 0.5f;
+    for (i = 0; i < m + n; i++) bvd[i] = bv[i] = (float)rand() / RAND_MAX - 0.5f;
+    if (with_bf16) out = malloc(sizeof(bfloat16) * ldc * cols);
+
+    cblas_sgemm(order, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c_ref, ldc);
+
+    /* the reference works on the stored layout, where a row bias of the caller
+       follows the stored columns in row major */
+    for (i = 0; i < ldc * cols; i++) r[i] = c_ref[i];
+    if (order == CblasColMajor)
+        ref_epilogue(rows, cols, r, ldc, bias, bvd, act, -0.25, 0.5);
+    else
+        ref_epilogue(rows, cols, r, ldc,
+                     bias == OpenblasBiasRow ? OpenblasBiasCol : (bias == OpenblasBiasCol ? OpenblasBiasRow : bias),
+                     bvd, act, -0.25, 0.5);
+
+    ep.bias = bias;
+    ep.bias_vector = bv;
+    ep.activation = act;
+    ep.clamp_min = -0.25;
+    ep.clamp_max = 0.5;
+    ep.bf16_out = out;
+    ep.ld_bf16 = ldc;
+    cblas_sgemm_epilogue(order, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, &ep);
+
+    for (j = 0; j < cols; j++) {
+        for (i = 0; i < rows; i++) {
+            float d = fabsf(c[i + j * ldc] - (float)r[i + j * ldc]);
+            if (d > maxerr) maxerr = d;
+            if (out && out[i + j * ldc] != ref_bf16(c[i + j * ldc])) maxerr = 1.f;
+        }
+    }
+    /* the padding rows of C are left alone */
+    for (j = 0; j < cols; j++)
+        for (i = rows; i < ldc; i++)
+            if (c[i + j * ldc] != c_ref[i + j * ldc]) maxerr = 1.f;
+
+    free(a); free(b); free(c); free(c_ref); free(r); free(bv); free(bvd);
+    if (out) free(out);
+    return maxerr;
+}
+
+CTEST(gemm_epilogue, sgemm_bias_and_activation)
+{
+    float tol = 1e-4f;
+
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, 37, 23, 45, 1.0f, 0.0f, OpenblasBiasNone, OpenblasActNone, 0), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, 37, 23, 45, 1.0f, 0.0f, OpenblasBiasRow, OpenblasActReLU, 0), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasTrans, CblasNoTrans, 37, 23, 45, 0.5f, 1.0f, OpenblasBiasCol, OpenblasActGELU, 0), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasNoTrans, CblasTrans, 37, 23, 45, 1.0f, -1.0f, OpenblasBiasRow, OpenblasActClamp, 0), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasTrans, CblasTrans, 37, 23, 45, 2.0f, 0.5f, OpenblasBiasCol, OpenblasActReLU, 0), tol);
+}
+
+CTEST(gemm_epilogue, sgemm_row_major)
+{
+    float tol = 1e-4f;
+
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasRowMajor, CblasNoTrans, CblasNoTrans, 29, 13, 51, 1.0f, 0.0f, OpenblasBiasRow, OpenblasActGELU, 0), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasRowMajor, CblasTrans, CblasNoTrans, 29, 13, 51, 1.0f, 1.0f, OpenblasBiasCol, OpenblasActReLU, 1), tol);
+}
+
+CTEST(gemm_epilogue, sgemm_bf16_output)
+{
+    float tol = 1e-4f;
+
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, 33, 65, 17, 1.0f, 0.0f, OpenblasBiasCol, OpenblasActNone, 1), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasNoTrans, CblasTrans, 33, 65, 17, 1.0f, 0.0f, OpenblasBiasRow, OpenblasActClamp, 1), tol);
+}
+
+/* several k blocks, and big enough to go through the threaded driver */
+CTEST(gemm_epilogue, sgemm_long_k_and_threads)
+{
+    float tol = 1e-3f;
+
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, 40, 9, 1300, 1.0f, 1.0f, OpenblasBiasRow, OpenblasActReLU, 0), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasTrans, CblasNoTrans, 301, 277, 350, 1.0f, 0.0f, OpenblasBiasCol, OpenblasActGELU, 1), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasRowMajor, CblasNoTrans, CblasTrans, 277, 301, 350, 1.0f, 0.0f, OpenblasBiasRow, OpenblasActClamp, 0), tol);
+}
+
+/* with k = 0 or alpha = 0 the epilogue still runs on beta*C */
+CTEST(gemm_epilogue, sgemm_no_product)
+{
+    float tol = 1e-6f;
+
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, 20, 30, 0, 1.0f, 1.0f, OpenblasBiasRow, OpenblasActReLU, 1), tol);
+    ASSERT_DBL_NEAR_TOL(0.f, check_sgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, 20, 30, 10, 0.0f, 0.5f, OpenblasBiasCol, OpenblasActClamp, 0), tol);
+}
+#endif
+
+#ifdef BUILD_DOUBLE
+CTEST(gemm_epilogue, dgemm_bias_gelu)
+{
+    blasint m = 67, n = 41, k = 90, i;
+    double *a, *b, *c, *r, *bv, maxerr = 0.;
+    openblas_gemm_epilogue ep;
+
+    a = malloc(sizeof(double) * m * k);
+    b = malloc(sizeof(double) * k * n);
+    c = malloc(sizeof(double) * m * n);
+    r = malloc(sizeof(double) * m * n);
+    bv = malloc(sizeof(double) * m);
+
+    for (i = 0; i < m * k; i++) a[i] = (double)rand() / RAND_MAX - 0.5;
+    for (i = 0; i < k * n; i++) b[i] = (double)rand() / RAND_MAX - 0.5;
+    for (i = 0; i < m * n; i++) c[i] = r[i] = (double)rand() / RAND_MAX - 0.5;
+    for (i = 0; i < m; i++) bv[i] = (double)rand() / RAND_MAX - 0.5;
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, a, m, b, k, 0.5, r, m);
+    ref_epilogue(m, n, r, m, OpenblasBiasRow, bv, OpenblasActGELU, 0., 0.);
+
+    ep.bias = OpenblasBiasRow;
+    ep.bias_vector = bv;
+    ep.activation = OpenblasActGELU;
+    ep.clamp_min = ep.clamp_max = 0.;
+    ep.bf16_out = NULL;
+    ep.ld_bf16 = 0;
+    cblas_dgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, a, m, b, k, 0.5, c, m, &ep);
+
+    for (i = 0; i < m * n; i++)
+        if (fabs(c[i] - r[i]) > maxerr) maxerr = fabs(c[i] - r[i]);
+    ASSERT_DBL_NEAR_TOL(0., maxerr, 1e-12);
+
+    free(a); free(b); free(c); free(r); free(bv);
+}
+#endif
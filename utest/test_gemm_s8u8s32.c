@@ -0,0 +1,187 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#ifdef BUILD_SINGLE
+
+/* Column major reference for C := alpha*(op(A)+ao)*(op(B)+bo) + beta*C + co */
+static void ref_gemm_s8u8s32(enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                             enum CBLAS_OFFSET offsetc, blasint m, blasint n, blasint k,
+                             float alpha, int8_t *a, blasint lda, int8_t ao,
+                             uint8_t *b, blasint ldb, int8_t bo, float beta,
+                             int32_t *c, blasint ldc, int32_t *co)
+{
+    blasint i, j, l;
+    long long s;
+    double r;
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            s = 0;
+            for (l = 0; l < k; l++) {
+                int av = (transa == CblasNoTrans) ? a[i + l * lda] : a[l + i * lda];
+                int bv = (transb == CblasNoTrans) ? b[l + j * ldb] : b[j + l * ldb];
+                s += (long long)(av + ao) * (bv + bo);
+            }
+            r = (double)alpha * (double)s + (double)beta * c[i + j * ldc];
+            if (offsetc == CblasFixOffset) r += co[0];
+            if (offsetc == CblasColOffset) r += co[i];
+            if (offsetc == CblasRowOffset) r += co[j];
+            r = rint(r);
+            if (r > 2147483647.0) r = 2147483647.0;
+            if (r < -2147483648.0) r = -2147483648.0;
+            c[i + j * ldc] = (int32_t)r;
+        }
+    }
+}
+
+static int check_gemm_s8u8s32(enum CBLAS_ORDER order,
+                              enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                              enum CBLAS_OFFSET offsetc, blasint m, blasint n, blasint k,
+                              float alpha, int8_t ao, int8_t bo, float beta)
+{
+    /* a row major operand is the column major transpose */
+    enum CBLAS_TRANSPOSE ta = transa, tb = transb;
+    blasint rows_a, cols_a, rows_b, cols_b, lda, ldb, ldc, i, j, errors = 0;
+    int8_t *a;
+    uint8_t *b;
+    int32_t *c, *c_ref, *co;
+
+    if (order == CblasRowMajor) {
+        ta = (transa == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+        tb = (transb == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+    }
+
+    rows_a = (ta == CblasNoTrans) ? m : k;
+    cols_a = (ta == CblasNoTrans) ? k : m;
+    rows_b = (tb == CblasNoTrans) ? k : n;
+    cols_b = (tb == CblasNoTrans) ? n : k;
+    lda = rows_a + 3;
+    ldb = rows_b + 1;
+    ldc = m + 2;
+
+    a = malloc(sizeof(int8_t) * lda * cols_a);
+    b = malloc(sizeof(uint8_t) * ldb * cols_b);
+    c = malloc(sizeof(int32_t) * ldc * n);
+    c_ref = malloc(sizeof(int32_t) * ldc * n);
+    co = malloc(sizeof(int32_t) * (m + n));
+
+    for (i = 0; i < lda * cols_a; i++) a[i] = (int8_t)(rand() % 256 - 128);
+    for (i = 0; i < ldb * cols_b; i++) b[i] = (uint8_t)(rand() % 256);
+    for (i = 0; i < ldc * n; i++) c[i] = c_ref[i] = rand() % 20001 - 10000;
+    for (i = 0; i < m + n; i++) co[i] = rand() % 201 - 100;
+
+    ref_gemm_s8u8s32(ta, tb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                     beta, c_ref, ldc, co);
+
+    /* in row major the same storage of C is the transpose, so swap roles */
+    if (order == CblasColMajor) {
+        cblas_gemm_s8u8s32(order, transa, transb, offsetc, m, n, k, alpha,
+                           a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+        for (j = 0; j < n; j++)
+            for (i = 0; i < m; i++)
+                if (c[i + j * ldc] != c_ref[i + j * ldc]) errors++;
+    } else {
+        int32_t *ct = malloc(sizeof(int32_t) * (n + 2) * m);
+        blasint ldct = n + 2;
+
+        for (j = 0; j < n; j++)
+            for (i = 0; i < m; i++)
+                ct[j + i * ldct] = c[i + j * ldc];
+        cblas_gemm_s8u8s32(order, transa, transb, offsetc, m, n, k, alpha,
+                           a, lda, ao, b, ldb, bo, beta, ct, ldct, co);
+        for (j = 0; j < n; j++)
+            for (i = 0; i < m; i++)
+                if (ct[j + i * ldct] != c_ref[i + j * ldc]) errors++;
+        free(ct);
+    }
+
+    free(a); free(b); free(c); free(c_ref); free(co);
+    return errors;
+}
+
+/* Odd sizes exercise every M/N tail and the k padding of the packed panels. */
+CTEST(gemm_s8u8s32, tails_all_transposes)
+{
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasFixOffset, 37, 23, 45, 1.0f, 0, 0, 0.0f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasTrans,   CblasNoTrans, CblasFixOffset, 37, 23, 45, 1.0f, 0, 0, 0.0f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasTrans,   CblasFixOffset, 37, 23, 45, 1.0f, 0, 0, 0.0f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasTrans,   CblasTrans,   CblasFixOffset, 37, 23, 45, 1.0f, 0, 0, 0.0f));
+}
+
+/* Offsets on A, B and C, with every offset mode for C. */
+CTEST(gemm_s8u8s32, offsets)
+{
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasFixOffset, 19, 33, 70, 1.0f, -5, 7, 1.0f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasTrans,   CblasColOffset, 19, 33, 70, 1.0f, 3, -128, 1.0f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasTrans,   CblasNoTrans, CblasRowOffset, 19, 33, 70, 1.0f, 127, 2, -1.0f));
+}
+
+/* Non integral alpha and beta round once, to nearest even. */
+CTEST(gemm_s8u8s32, scaling)
+{
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasFixOffset, 21, 17, 33, 0.5f, 1, -1, 0.25f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasTrans,   CblasTrans,   CblasColOffset, 21, 17, 33, 0.0f, 0, 0, 2.5f));
+}
+
+CTEST(gemm_s8u8s32, row_major)
+{
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasRowMajor, CblasNoTrans, CblasNoTrans, CblasColOffset, 29, 13, 51, 1.0f, -3, 4, 0.5f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasRowMajor, CblasTrans,   CblasNoTrans, CblasRowOffset, 29, 13, 51, 1.0f, 0, 9, 0.0f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasRowMajor, CblasNoTrans, CblasTrans,   CblasFixOffset, 29, 13, 51, 2.0f, 6, 0, 1.0f));
+}
+
+/* k spans several Q blocks; large m and n spread the work over threads. */
+CTEST(gemm_s8u8s32, long_k_and_threads)
+{
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasFixOffset, 40, 9, 1300, 1.0f, 2, -2, 1.0f));
+    ASSERT_EQUAL(0, check_gemm_s8u8s32(CblasColMajor, CblasTrans,   CblasNoTrans, CblasRowOffset, 301, 277, 150, 1.0f, -1, 1, 0.0f));
+}
+
+/* Results beyond the int32 range saturate. */
+CTEST(gemm_s8u8s32, saturation)
+{
+    int8_t a[2] = { 100, -100 };
+    uint8_t b[2] = { 200, 200 };
+    int32_t c[2] = { 0, 0 }, co = 0;
+
+    cblas_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasFixOffset, 2, 1, 1,
+                       1.0e6f, a, 2, 0, b, 1, 0, 0.0f, c, 2, &co);
+    ASSERT_EQUAL(2147483647, c[0]);
+    ASSERT_EQUAL(-2147483647 - 1, c[1]);
+}
+
+#endif
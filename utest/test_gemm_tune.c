@@ -0,0 +1,91 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+#include <stdio.h>
+#include <cblas.h>
+
+#ifdef BUILD_DOUBLE
+
+#define TUNE_N       300
+#define TUNE_PROFILE "openblas_utest_gemm_profile.txt"
+
+/*
+ * Lines for other cores are skipped and the one for this core is applied;
+ * a blocking of 96 makes a 300 x 300 dgemm run through several P, Q and R
+ * steps, which must not change its result. Without DYNAMIC_ARCH the
+ * blocking is fixed and loading fails.
+ */
+CTEST(gemm_tune, load_profile)
+{
+    static double a[TUNE_N * TUNE_N], b[TUNE_N * TUNE_N], c[TUNE_N * TUNE_N];
+    double sum, diff, maxdiff = 0.;
+    FILE *fp;
+    int i, j, l, ret;
+
+    ASSERT_EQUAL(-1, openblas_gemm_load_profile("openblas_utest_no_such_profile"));
+
+    fp = fopen(TUNE_PROFILE, "w");
+    ASSERT_TRUE(fp != NULL);
+    fprintf(fp, "# core routine P Q R\n");
+    fprintf(fp, "NoSuchCore dgemm 8 8 8\n");
+    fprintf(fp, "%s dgemm 96 96 192\n", openblas_get_corename());
+    fclose(fp);
+
+    ret = openblas_gemm_load_profile(TUNE_PROFILE);
+    remove(TUNE_PROFILE);
+    ASSERT_TRUE(ret == -1 || ret == 1);
+
+    for (i = 0; i < TUNE_N * TUNE_N; i++) {
+        a[i] = (double)(i % 7) - 3.;
+        b[i] = (double)(i % 5) - 2.;
+    }
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, TUNE_N, TUNE_N, TUNE_N,
+                1.0, a, TUNE_N, b, TUNE_N, 0.0, c, TUNE_N);
+
+    for (j = 0; j < TUNE_N; j++) {
+        for (i = 0; i < TUNE_N; i++) {
+            sum = 0.;
+            for (l = 0; l < TUNE_N; l++) sum += a[i + l * TUNE_N] * b[l + j * TUNE_N];
+            diff = c[i + j * TUNE_N] - sum;
+            if (diff < 0.) diff = -diff;
+            if (diff > maxdiff) maxdiff = diff;
+        }
+    }
+
+    ASSERT_DBL_NEAR_TOL(0., maxdiff, 1e-9);
+}
+
+#endif
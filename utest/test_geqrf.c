@@ -0,0 +1,225 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+/*
+ * QR factorizations on several threads. Q^H A must give back R, and
+ * multiplying by Q and then by Q^H, from either side, must give back the
+ * matrix. The workspace is given at its optimal size and at the minimum.
+ */
+
+#define QR_M 700
+#define QR_N 500
+
+#ifdef BUILD_DOUBLE
+static double check_dgeqrf(blasint m, blasint n, int minwork)
+{
+    blasint lda = m + 2, k = MIN(m, n), lwork = -1, info;
+    double *a = utest_fill((BLASLONG)lda * n, 1, 1.), *f, *tau, *work, *b, *c, query, diff, maxdiff = 0.;
+    char left = 'L', right = 'R', notrans = 'N', trans = 'T';
+    int threads = openblas_get_num_threads();
+    BLASLONG i, j;
+
+    f   = (double *)malloc((BLASLONG)lda * n * sizeof(double));
+    tau = (double *)malloc(k * sizeof(double));
+    for (i = 0; i < (BLASLONG)lda * n; i++) f[i] = a[i];
+
+    openblas_set_num_threads(4);
+
+    BLASFUNC(dgeqrf)(&m, &n, f, &lda, tau, &query, &lwork, &info);
+    if (info) return (double)info;
+
+    lwork = minwork ? MAX(m, n) : (blasint)query;
+    work  = (double *)malloc(lwork * sizeof(double));
+
+    BLASFUNC(dgeqrf)(&m, &n, f, &lda, tau, work, &lwork, &info);
+    if (info) return (double)info;
+
+    /* Q^T A against R */
+    BLASFUNC(dormqr)(&left, &trans, &m, &n, &k, f, &lda, tau, a, &lda, work, &lwork, &info);
+    if (info) return (double)info;
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            diff = fabs(a[i + j * lda] - ((i <= j) ? f[i + j * lda] : 0.));
+            if (diff > maxdiff) maxdiff = diff;
+        }
+    }
+
+    /* Q (Q^T B) and (C Q) Q^T */
+    b = utest_fill((BLASLONG)m * n, 2, 1.);
+    c = (double *)malloc((BLASLONG)m * n * sizeof(double));
+    for (i = 0; i < (BLASLONG)m * n; i++) c[i] = b[i];
+
+    BLASFUNC(dormqr)(&left, &trans,   &m, &n, &k, f, &lda, tau, c, &m, work, &lwork, &info);
+    BLASFUNC(dormqr)(&left, &notrans, &m, &n, &k, f, &lda, tau, c, &m, work, &lwork, &info);
+    if (info) return (double)info;
+
+    for (i = 0; i < (BLASLONG)m * n; i++) {
+        diff = fabs(b[i] - c[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(b); free(c);
+    b = utest_fill((BLASLONG)n * m, 3, 1.);
+    c = (double *)malloc((BLASLONG)n * m * sizeof(double));
+    for (i = 0; i < (BLASLONG)n * m; i++) c[i] = b[i];
+
+    BLASFUNC(dormqr)(&right, &notrans, &n, &m, &k, f, &lda, tau, c, &n, work, &lwork, &info);
+    BLASFUNC(dormqr)(&right, &trans,   &n, &m, &k, f, &lda, tau, c, &n, work, &lwork, &info);
+    if (info) return (double)info;
+
+    for (i = 0; i < (BLASLONG)n * m; i++) {
+        diff = fabs(b[i] - c[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    openblas_set_num_threads(threads);
+
+    free(a); free(f); free(tau); free(work); free(b); free(c);
+    return maxdiff;
+}
+
+CTEST(geqrf, dgeqrf_tall)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgeqrf(QR_M, QR_N, 0), 1e-11);
+}
+
+CTEST(geqrf, dgeqrf_wide)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgeqrf(QR_N, QR_M, 0), 1e-11);
+}
+
+CTEST(geqrf, dgeqrf_minwork)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgeqrf(QR_M, QR_N, 1), 1e-11);
+}
+
+CTEST(geqrf, dgeqrf_errors)
+{
+    blasint m = 10, n = 10, lda = 9, lwork = 10, info;
+    double a[100], tau[10], work[10];
+    char side = 'L', trans = 'C';
+
+    BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, work, &lwork, &info);
+    ASSERT_EQUAL(-4, info);
+
+    lda = 10;
+    BLASFUNC(dormqr)(&side, &trans, &m, &n, &n, a, &lda, tau, a, &lda, work, &lwork, &info);
+    ASSERT_EQUAL(-2, info);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+static double check_zgeqrf(blasint m, blasint n)
+{
+    blasint lda = m, k = MIN(m, n), lwork = -1, info;
+    double *a = utest_fill((BLASLONG)lda * n * 2, 4, 1.), *f, *tau, *work, *b, *c, query[2], diff, maxdiff = 0.;
+    char left = 'L', right = 'R', notrans = 'N', trans = 'C';
+    int threads = openblas_get_num_threads();
+    BLASLONG i, j;
+
+    f   = (double *)malloc((BLASLONG)lda * n * 2 * sizeof(double));
+    tau = (double *)malloc(k * 2 * sizeof(double));
+    for (i = 0; i < (BLASLONG)lda * n * 2; i++) f[i] = a[i];
+
+    openblas_set_num_threads(4);
+
+    BLASFUNC(zgeqrf)(&m, &n, f, &lda, tau, query, &lwork, &info);
+    if (info) return (double)info;
+
+    lwork = MAX((blasint)query[0], MAX(m, n));
+    work  = (double *)malloc(lwork * 2 * sizeof(double));
+
+    BLASFUNC(zgeqrf)(&m, &n, f, &lda, tau, work, &lwork, &info);
+    if (info) return (double)info;
+
+    /* Q^H A against R, which has a real diagonal */
+    BLASFUNC(zunmqr)(&left, &trans, &m, &n, &k, f, &lda, tau, a, &lda, work, &lwork, &info);
+    if (info) return (double)info;
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            diff = fabs(a[(i + j * lda) * 2]     - ((i <= j) ? f[(i + j * lda) * 2]     : 0.))
+                 + fabs(a[(i + j * lda) * 2 + 1] - ((i <= j) ? f[(i + j * lda) * 2 + 1] : 0.));
+            if (diff > maxdiff) maxdiff = diff;
+        }
+        if (j < k && f[(j + j * lda) * 2 + 1] != 0.) return 1.;
+    }
+
+    /* Q (Q^H B) and (C Q) Q^H */
+    b = utest_fill((BLASLONG)m * n * 2, 5, 1.);
+    c = (double *)malloc((BLASLONG)m * n * 2 * sizeof(double));
+    for (i = 0; i < (BLASLONG)m * n * 2; i++) c[i] = b[i];
+
+    BLASFUNC(zunmqr)(&left, &trans,   &m, &n, &k, f, &lda, tau, c, &m, work, &lwork, &info);
+    BLASFUNC(zunmqr)(&left, &notrans, &m, &n, &k, f, &lda, tau, c, &m, work, &lwork, &info);
+    if (info) return (double)info;
+
+    for (i = 0; i < (BLASLONG)m * n * 2; i++) {
+        diff = fabs(b[i] - c[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(b); free(c);
+    b = utest_fill((BLASLONG)n * m * 2, 6, 1.);
+    c = (double *)malloc((BLASLONG)n * m * 2 * sizeof(double));
+    for (i = 0; i < (BLASLONG)n * m * 2; i++) c[i] = b[i];
+
+    BLASFUNC(zunmqr)(&right, &notrans, &n, &m, &k, f, &lda, tau, c, &n, work, &lwork, &info);
+    BLASFUNC(zunmqr)(&right, &trans,   &n, &m, &k, f, &lda, tau, c, &n, work, &lwork, &info);
+    if (info) return (double)info;
+
+    for (i = 0; i < (BLASLONG)n * m * 2; i++) {
+        diff = fabs(b[i] - c[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    openblas_set_num_threads(threads);
+
+    free(a); free(f); free(tau); free(work); free(b); free(c);
+    return maxdiff;
+}
+
+CTEST(geqrf, zgeqrf_tall)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_zgeqrf(QR_M, QR_N), 1e-11);
+}
+
+CTEST(geqrf, zgeqrf_wide)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_zgeqrf(QR_N, QR_M), 1e-11);
+}
+#endif
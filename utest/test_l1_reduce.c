@@ -0,0 +1,179 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+/*
+ * Vectors long enough for the interface to split the reductions between
+ * threads must still give the serial answer, including index ties that
+ * fall in different pieces and norms that overflow when squared.
+ */
+
+#define L1_N 300001
+
+#ifdef BUILD_DOUBLE
+CTEST(l1_reduce, dnrm2_scaled)
+{
+    blasint n = L1_N, inc = 1;
+    double *x = utest_fill(n, 1, 1.);
+    double sum = 0., ret;
+    BLASLONG i;
+
+    for (i = 0; i < n; i++) {
+        x[i] *= 1e300;
+        sum += (x[i] / 1e300) * (x[i] / 1e300);
+    }
+
+    ret = BLASFUNC(dnrm2)(&n, x, &inc);
+    free(x);
+
+    ASSERT_DBL_NEAR_TOL(sqrt(sum), ret / 1e300, 1e-8);
+}
+
+CTEST(l1_reduce, dasum)
+{
+    blasint n = L1_N, inc = 1;
+    double *x = utest_fill(n, 2, 1.);
+    double sum = 0., ret;
+    BLASLONG i;
+
+    for (i = 0; i < n; i++) sum += fabs(x[i]);
+
+    ret = BLASFUNC(dasum)(&n, x, &inc);
+    free(x);
+
+    ASSERT_DBL_NEAR_TOL(sum, ret, 1e-6);
+}
+
+CTEST(l1_reduce, ddot_negative_inc)
+{
+    blasint n = L1_N, incx = 2, incy = -1;
+    double *x = utest_fill((BLASLONG)n * 2, 3, 1.), *y = utest_fill(n, 4, 1.);
+    double sum = 0., ret;
+    BLASLONG i;
+
+    for (i = 0; i < n; i++) sum += x[i * 2] * y[n - 1 - i];
+
+    ret = BLASFUNC(ddot)(&n, x, &incx, y, &incy);
+    free(x); free(y);
+
+    ASSERT_DBL_NEAR_TOL(sum, ret, 1e-8);
+}
+
+CTEST(l1_reduce, idamax_tie)
+{
+    blasint n = L1_N, inc = 1;
+    double *x = utest_fill(n, 5, 1.);
+    blasint ret;
+
+    /* equal magnitudes far apart, the first one has to win */
+    x[n - 10] = 7.;
+    x[100]    = -7.;
+
+    ret = BLASFUNC(idamax)(&n, x, &inc);
+    free(x);
+
+    ASSERT_EQUAL(101, ret);
+}
+
+CTEST(l1_reduce, idamin_last)
+{
+    blasint n = L1_N, inc = 1;
+    double *x = utest_fill(n, 6, 1.);
+    blasint ret;
+    BLASLONG i;
+
+    for (i = 0; i < n; i++) x[i] += 1.;
+    x[n - 3] = 1e-3;
+
+    ret = BLASFUNC(idamin)(&n, x, &inc);
+    free(x);
+
+    ASSERT_EQUAL(n - 2, ret);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+CTEST(l1_reduce, izamax_tie)
+{
+    blasint n = L1_N, inc = 1;
+    double *x = utest_fill((BLASLONG)n * 2, 7, 1.);
+    blasint ret;
+
+    x[(n - 5) * 2]     = 3.;
+    x[(n - 5) * 2 + 1] = 4.;
+    x[20 * 2]          = -4.;
+    x[20 * 2 + 1]      = 3.;
+
+    ret = BLASFUNC(izamax)(&n, x, &inc);
+    free(x);
+
+    ASSERT_EQUAL(21, ret);
+}
+
+CTEST(l1_reduce, dznrm2)
+{
+    blasint n = L1_N, inc = 1;
+    double *x = utest_fill((BLASLONG)n * 2, 8, 1.);
+    double sum = 0., ret;
+    BLASLONG i;
+
+    for (i = 0; i < n * 2; i++) sum += x[i] * x[i];
+
+    ret = BLASFUNC(dznrm2)(&n, x, &inc);
+    free(x);
+
+    ASSERT_DBL_NEAR_TOL(sqrt(sum), ret, 1e-8);
+}
+#endif
+
+#ifdef BUILD_SINGLE
+CTEST(l1_reduce, snrm2)
+{
+    blasint n = L1_N, inc = 1;
+    float *x = (float *)malloc(n * sizeof(float));
+    double sum = 0.;
+    float ret;
+    BLASLONG i;
+
+    for (i = 0; i < n; i++) {
+        x[i] = (float)((i * 5 + 1) % 11) / 11.f - .5f;
+        sum += (double)x[i] * x[i];
+    }
+
+    ret = BLASFUNC(snrm2)(&n, x, &inc);
+    free(x);
+
+    ASSERT_DBL_NEAR_TOL(sqrt(sum), (double)ret, 1e-3);
+}
+#endif
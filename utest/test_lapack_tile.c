@@ -0,0 +1,276 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+/*
+ * Factorizations large enough for the parallel getrf and potrf to use
+ * the task scheduler. A times a vector must equal the factors applied to
+ * it one after the other, and a failing factorization must report the
+ * same column as the single threaded one.
+ */
+
+#define TL_N 1600
+
+#ifdef BUILD_DOUBLE
+/* a symmetric matrix with a dominant diagonal */
+static double *dspd(blasint n, blasint lda)
+{
+    double *a = utest_fill((BLASLONG)lda * n, 1, 1.);
+    BLASLONG i, j;
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < j; i++) a[j + i * lda] = a[i + j * lda];
+        a[j + j * lda] += n;
+    }
+
+    return a;
+}
+
+static double check_dpotrf(char uplo)
+{
+    blasint n = TL_N, lda = TL_N + 3, one = 1, info;
+    double *a = dspd(n, lda), *v = utest_fill(n, 2, 1.), *y, *w, done = 1., zero = 0., diff, maxdiff = 0.;
+    char notrans = 'N', trans = 'T', diag = 'N';
+    int threads = openblas_get_num_threads();
+    BLASLONG i;
+
+    y = (double *)malloc(n * sizeof(double));
+    w = (double *)malloc(n * sizeof(double));
+    for (i = 0; i < n; i++) w[i] = v[i];
+
+    /* only the referenced triangle is used */
+    BLASFUNC(dsymv)(&uplo, &n, &done, a, &lda, v, &one, &zero, y, &one);
+
+    openblas_set_num_threads(4);
+    BLASFUNC(dpotrf)(&uplo, &n, a, &lda, &info);
+    openblas_set_num_threads(threads);
+
+    if (info) return (double)info;
+
+    if (uplo == 'L') {
+        BLASFUNC(dtrmv)(&uplo, &trans,   &diag, &n, a, &lda, w, &one);
+        BLASFUNC(dtrmv)(&uplo, &notrans, &diag, &n, a, &lda, w, &one);
+    } else {
+        BLASFUNC(dtrmv)(&uplo, &notrans, &diag, &n, a, &lda, w, &one);
+        BLASFUNC(dtrmv)(&uplo, &trans,   &diag, &n, a, &lda, w, &one);
+    }
+
+    for (i = 0; i < n; i++) {
+        diff = fabs(y[i] - w[i]) / n;
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(v); free(y); free(w);
+    return maxdiff;
+}
+
+static double check_dgetrf(blasint m, blasint n)
+{
+    blasint lda = m + 1, mn = MIN(m, n), one = 1, info, *ipiv;
+    double *a = utest_fill((BLASLONG)lda * n, 3, 1.), *v = utest_fill(n, 4, 1.), *y, *w, *z, *f;
+    double done = 1., zero = 0., t, diff, maxdiff = 0.;
+    char notrans = 'N';
+    int threads = openblas_get_num_threads();
+    BLASLONG i, j;
+
+    y = (double *)malloc(m * sizeof(double));
+    w = (double *)malloc(mn * sizeof(double));
+    z = (double *)malloc(m * sizeof(double));
+    f = (double *)malloc((BLASLONG)lda * n * sizeof(double));
+    ipiv = (blasint *)malloc(mn * sizeof(blasint));
+
+    BLASFUNC(dgemv)(&notrans, &m, &n, &done, a, &lda, v, &one, &zero, y, &one);
+
+    for (i = 0; i < (BLASLONG)lda * n; i++) f[i] = a[i];
+
+    openblas_set_num_threads(4);
+    BLASFUNC(dgetrf)(&m, &n, f, &lda, ipiv, &info);
+    openblas_set_num_threads(threads);
+
+    if (info) return (double)info;
+
+    /* P A v, with the interchanges in the order they were made */
+    for (i = 0; i < mn; i++) {
+        t = y[i]; y[i] = y[ipiv[i] - 1]; y[ipiv[i] - 1] = t;
+    }
+
+    /* U v, then L (U v) */
+    for (i = 0; i < mn; i++) {
+        w[i] = 0.;
+        for (j = i; j < n; j++) w[i] += f[i + j * lda] * v[j];
+    }
+    for (i = 0; i < m; i++) {
+        z[i] = (i < mn) ? w[i] : 0.;
+        for (j = 0; j < MIN(i, mn); j++) z[i] += f[i + j * lda] * w[j];
+    }
+
+    for (i = 0; i < m; i++) {
+        diff = fabs(y[i] - z[i]) / n;
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(v); free(y); free(w); free(z); free(f); free(ipiv);
+    return maxdiff;
+}
+
+CTEST(lapack_tile, dpotrf_lower)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dpotrf('L'), 1e-12);
+}
+
+CTEST(lapack_tile, dpotrf_upper)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dpotrf('U'), 1e-12);
+}
+
+CTEST(lapack_tile, dpotrf_not_positive)
+{
+    blasint n = TL_N, info1, info4;
+    double *a = dspd(n, n), *b = dspd(n, n);
+    char uplo = 'L';
+    int threads = openblas_get_num_threads();
+
+    a[1000 + 1000 * n] = b[1000 + 1000 * n] = -1.;
+
+    openblas_set_num_threads(1);
+    BLASFUNC(dpotrf)(&uplo, &n, a, &n, &info1);
+    openblas_set_num_threads(4);
+    BLASFUNC(dpotrf)(&uplo, &n, b, &n, &info4);
+    openblas_set_num_threads(threads);
+
+    ASSERT_EQUAL(1001, info1);
+    ASSERT_EQUAL(info1, info4);
+
+    free(a); free(b);
+}
+
+CTEST(lapack_tile, dgetrf_square)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgetrf(TL_N, TL_N), 1e-12);
+}
+
+CTEST(lapack_tile, dgetrf_wide)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgetrf(TL_N - 300, TL_N), 1e-12);
+}
+
+CTEST(lapack_tile, dgetrf_tall)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgetrf(TL_N + 300, TL_N), 1e-12);
+}
+
+CTEST(lapack_tile, dgetrf_singular)
+{
+    blasint n = TL_N, info;
+    blasint *ipiv = (blasint *)malloc(n * sizeof(blasint));
+    double *a = utest_fill((BLASLONG)n * n, 5, 1.);
+    int threads = openblas_get_num_threads();
+    BLASLONG i;
+
+    /* the factorization goes on past the zero pivot */
+    for (i = 0; i < n; i++) a[i + 700 * n] = 0.;
+
+    openblas_set_num_threads(4);
+    BLASFUNC(dgetrf)(&n, &n, a, &n, ipiv, &info);
+    openblas_set_num_threads(threads);
+
+    ASSERT_EQUAL(701, info);
+    for (i = 0; i < n; i++) {
+        ASSERT_TRUE(ipiv[i] > i && ipiv[i] <= n);
+    }
+
+    free(a); free(ipiv);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+static double check_zpotrf(char uplo)
+{
+    blasint n = TL_N, lda = TL_N, one = 1, info;
+    double *a = utest_fill((BLASLONG)lda * n * 2, 6, 1.), *v = utest_fill(n * 2, 7, 1.), *y, *w;
+    double alpha[2] = {1., 0.}, zero[2] = {0., 0.}, diff, maxdiff = 0.;
+    char notrans = 'N', trans = 'C', diag = 'N';
+    int threads = openblas_get_num_threads();
+    BLASLONG i, j;
+
+    /* Hermitian with a dominant diagonal */
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < j; i++) {
+            a[(j + i * lda) * 2]     =  a[(i + j * lda) * 2];
+            a[(j + i * lda) * 2 + 1] = -a[(i + j * lda) * 2 + 1];
+        }
+        a[(j + j * lda) * 2]    += 2 * n;
+        a[(j + j * lda) * 2 + 1] = 0.;
+    }
+
+    y = (double *)malloc(n * 2 * sizeof(double));
+    w = (double *)malloc(n * 2 * sizeof(double));
+    for (i = 0; i < n * 2; i++) w[i] = v[i];
+
+    BLASFUNC(zhemv)(&uplo, &n, alpha, a, &lda, v, &one, zero, y, &one);
+
+    openblas_set_num_threads(4);
+    BLASFUNC(zpotrf)(&uplo, &n, a, &lda, &info);
+    openblas_set_num_threads(threads);
+
+    if (info) return (double)info;
+
+    if (uplo == 'L') {
+        BLASFUNC(ztrmv)(&uplo, &trans,   &diag, &n, a, &lda, w, &one);
+        BLASFUNC(ztrmv)(&uplo, &notrans, &diag, &n, a, &lda, w, &one);
+    } else {
+        BLASFUNC(ztrmv)(&uplo, &notrans, &diag, &n, a, &lda, w, &one);
+        BLASFUNC(ztrmv)(&uplo, &trans,   &diag, &n, a, &lda, w, &one);
+    }
+
+    for (i = 0; i < n * 2; i++) {
+        diff = fabs(y[i] - w[i]) / n;
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(v); free(y); free(w);
+    return maxdiff;
+}
+
+CTEST(lapack_tile, zpotrf_lower)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_zpotrf('L'), 1e-12);
+}
+
+CTEST(lapack_tile, zpotrf_upper)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_zpotrf('U'), 1e-12);
+}
+#endif
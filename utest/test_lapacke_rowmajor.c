@@ -0,0 +1,236 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+/*
+ * Row major LAPACKE getrf, getrs, potrf and trtri work on the matrices in
+ * place. They must give what the column major routines give for the
+ * transposed copies: the same pivots and info, and the same factors.
+ */
+
+#define LAPACK_ROW_MAJOR 101
+
+blasint LAPACKE_dgetrf(int, blasint, blasint, double *, blasint, blasint *);
+blasint LAPACKE_dgetrs(int, char, blasint, blasint, const double *, blasint, const blasint *, double *, blasint);
+blasint LAPACKE_dpotrf(int, char, blasint, double *, blasint);
+blasint LAPACKE_dtrtri(int, char, char, blasint, double *, blasint);
+blasint LAPACKE_zgetrf(int, blasint, blasint, double *, blasint, blasint *);
+blasint LAPACKE_zgetrs(int, char, blasint, blasint, const double *, blasint, const blasint *, double *, blasint);
+blasint LAPACKE_zpotrf(int, char, blasint, double *, blasint);
+blasint LAPACKE_ztrtri(int, char, char, blasint, double *, blasint);
+
+#define RM_N    230
+#define RM_NRHS 7
+
+/* column major copy, leading dimension m, of the m x n row major a */
+static double *transpose(blasint m, blasint n, double *a, blasint lda, int cs)
+{
+    double *t = (double *)malloc((BLASLONG)m * n * cs * sizeof(double));
+    BLASLONG i, j, k;
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+            for (k = 0; k < cs; k++)
+                t[(i + j * m) * cs + k] = a[(i * lda + j) * cs + k];
+
+    return t;
+}
+
+static double maxdiff(blasint m, blasint n, double *a, blasint lda, double *t, int cs)
+{
+    double diff, worst = 0.;
+    BLASLONG i, j, k;
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+            for (k = 0; k < cs; k++) {
+                diff = fabs(a[(i * lda + j) * cs + k] - t[(i + j * m) * cs + k]);
+                if (diff > worst) worst = diff;
+            }
+
+    return worst;
+}
+
+/* make the n x n row major a Hermitian positive definite */
+static void posdef(blasint n, double *a, blasint lda, int cs)
+{
+    BLASLONG i, j;
+
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < i; j++) {
+            a[(j * lda + i) * cs] = a[(i * lda + j) * cs];
+            if (cs == 2) a[(j * lda + i) * cs + 1] = -a[(i * lda + j) * cs + 1];
+        }
+        a[(i * lda + i) * cs] = n;
+        if (cs == 2) a[(i * lda + i) * cs + 1] = 0.;
+    }
+}
+
+/* getrf of an m x n matrix then, when square, getrs with each trans */
+static double check_getrf(blasint m, blasint n, int cs, int singular)
+{
+    blasint lda = n + 3, ldb = RM_NRHS + 1, nrhs = RM_NRHS, info, cinfo, k;
+    double *a = utest_fill((BLASLONG)m * lda * cs, 1, 1.), *t, *b, *bt, worst;
+    blasint *ipiv = (blasint *)malloc(MIN(m, n) * sizeof(blasint));
+    blasint *cipiv = (blasint *)malloc(MIN(m, n) * sizeof(blasint));
+    char trans[] = "NTC";
+    BLASLONG i;
+
+    if (singular)
+        for (i = 0; i < m; i++) a[(i * lda + 5) * cs] = a[(i * lda + 5) * cs + cs - 1] = 0.;
+
+    t = transpose(m, n, a, lda, cs);
+
+    if (cs == 1) {
+        info = LAPACKE_dgetrf(LAPACK_ROW_MAJOR, m, n, a, lda, ipiv);
+        BLASFUNC(dgetrf)(&m, &n, t, &m, cipiv, &cinfo);
+    } else {
+        info = LAPACKE_zgetrf(LAPACK_ROW_MAJOR, m, n, a, lda, ipiv);
+        BLASFUNC(zgetrf)(&m, &n, t, &m, cipiv, &cinfo);
+    }
+
+    if (info != cinfo) return 1.;
+    for (i = 0; i < MIN(m, n); i++)
+        if (ipiv[i] != cipiv[i]) return 1.;
+
+    worst = maxdiff(m, n, a, lda, t, cs);
+
+    if (m == n && !singular) {
+        for (k = 0; k < 3; k++) {
+            b  = utest_fill((BLASLONG)n * ldb * cs, 2 + k, 1.);
+            bt = transpose(n, nrhs, b, ldb, cs);
+
+            if (cs == 1) {
+                info = LAPACKE_dgetrs(LAPACK_ROW_MAJOR, trans[k], n, nrhs, a, lda, ipiv, b, ldb);
+                BLASFUNC(dgetrs)(&trans[k], &n, &nrhs, t, &m, cipiv, bt, &n, &cinfo);
+            } else {
+                info = LAPACKE_zgetrs(LAPACK_ROW_MAJOR, trans[k], n, nrhs, a, lda, ipiv, b, ldb);
+                BLASFUNC(zgetrs)(&trans[k], &n, &nrhs, t, &m, cipiv, bt, &n, &cinfo);
+            }
+            if (info || cinfo) return 1.;
+
+            worst = MAX(worst, maxdiff(n, nrhs, b, ldb, bt, cs));
+            free(b); free(bt);
+        }
+    }
+
+    free(a); free(t); free(ipiv); free(cipiv);
+    return worst;
+}
+
+/* potrf then trtri of its factor, for uplo */
+static double check_potrf(char uplo, int cs)
+{
+    blasint n = RM_N, lda = n + 2, info, cinfo;
+    double *a = utest_fill((BLASLONG)n * lda * cs, 7, 1.), *t, worst;
+    char diag = 'N';
+    BLASLONG i, j, k;
+
+    posdef(n, a, lda, cs);
+    t = transpose(n, n, a, lda, cs);
+
+    if (cs == 1) {
+        info = LAPACKE_dpotrf(LAPACK_ROW_MAJOR, uplo, n, a, lda);
+        BLASFUNC(dpotrf)(&uplo, &n, t, &n, &cinfo);
+    } else {
+        info = LAPACKE_zpotrf(LAPACK_ROW_MAJOR, uplo, n, a, lda);
+        BLASFUNC(zpotrf)(&uplo, &n, t, &n, &cinfo);
+    }
+    if (info || cinfo) return 1.;
+
+    if (cs == 1) {
+        info = LAPACKE_dtrtri(LAPACK_ROW_MAJOR, uplo, diag, n, a, lda);
+        BLASFUNC(dtrtri)(&uplo, &diag, &n, t, &n, &cinfo);
+    } else {
+        info = LAPACKE_ztrtri(LAPACK_ROW_MAJOR, uplo, diag, n, a, lda);
+        BLASFUNC(ztrtri)(&uplo, &diag, &n, t, &n, &cinfo);
+    }
+    if (info || cinfo) return 1.;
+
+    /* only the uplo triangle is referenced */
+    worst = 0.;
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            if ((uplo == 'U') ? (j >= i) : (j <= i))
+                for (k = 0; k < cs; k++)
+                    worst = MAX(worst, fabs(a[(i * lda + j) * cs + k] - t[(i + j * n) * cs + k]));
+
+    free(a); free(t);
+    return worst;
+}
+
+#ifdef BUILD_DOUBLE
+CTEST(lapacke_rowmajor, dgetrf_square)
+{
+    int threads = openblas_get_num_threads();
+
+    openblas_set_num_threads(4);
+    ASSERT_DBL_NEAR_TOL(0., check_getrf(RM_N, RM_N, 1, 0), 1e-10);
+    openblas_set_num_threads(1);
+    ASSERT_DBL_NEAR_TOL(0., check_getrf(RM_N, RM_N, 1, 0), 1e-10);
+    openblas_set_num_threads(threads);
+}
+
+CTEST(lapacke_rowmajor, dgetrf_rectangular)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_getrf(RM_N + 40, RM_N, 1, 0), 1e-10);
+    ASSERT_DBL_NEAR_TOL(0., check_getrf(RM_N, RM_N + 40, 1, 0), 1e-10);
+    ASSERT_DBL_NEAR_TOL(0., check_getrf(RM_N, RM_N, 1, 1), 1e-10);
+}
+
+CTEST(lapacke_rowmajor, dpotrf_dtrtri)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_potrf('U', 1), 1e-10);
+    ASSERT_DBL_NEAR_TOL(0., check_potrf('L', 1), 1e-10);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+CTEST(lapacke_rowmajor, zgetrf)
+{
+    int threads = openblas_get_num_threads();
+
+    openblas_set_num_threads(4);
+    ASSERT_DBL_NEAR_TOL(0., check_getrf(RM_N, RM_N, 2, 0), 1e-10);
+    openblas_set_num_threads(threads);
+    ASSERT_DBL_NEAR_TOL(0., check_getrf(RM_N + 40, RM_N, 2, 1), 1e-10);
+}
+
+CTEST(lapacke_rowmajor, zpotrf_ztrtri)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_potrf('U', 2), 1e-10);
+    ASSERT_DBL_NEAR_TOL(0., check_potrf('L', 2), 1e-10);
+}
+#endif
@@ -0,0 +1,129 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#ifdef BUILD_DOUBLE
+
+/*
+ * Skinny shapes, for which the threaded drivers split only one of m and n
+ * or use few threads, must still give the serial result.
+ */
+
+static double check_dgemm(blasint m, blasint n, blasint k)
+{
+    double *a = utest_fill((BLASLONG)m * k, 1, 1.), *b = utest_fill((BLASLONG)k * n, 2, 1.), *c = utest_fill((BLASLONG)m * n, 3, 1.);
+    double sum, diff, maxdiff = 0.;
+    blasint i, j, l;
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                1.0, a, m, b, k, 0.0, c, m);
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            sum = 0.;
+            for (l = 0; l < k; l++) sum += a[i + (BLASLONG)l * m] * b[l + (BLASLONG)j * k];
+            diff = fabs(c[i + (BLASLONG)j * m] - sum);
+            if (diff > maxdiff) maxdiff = diff;
+        }
+    }
+
+    free(a); free(b); free(c);
+    return maxdiff;
+}
+
+CTEST(level3_threads, dgemm_tall_skinny)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm(20000, 7, 33), 1e-10);
+}
+
+CTEST(level3_threads, dgemm_short_wide)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm(5, 20000, 33), 1e-10);
+}
+
+CTEST(level3_threads, dgemm_deep)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dgemm(9, 11, 30000), 1e-9);
+}
+
+CTEST(level3_threads, dtrsm_narrow)
+{
+    blasint m = 300, n = 3, i, j, l;
+    double *a = utest_fill((BLASLONG)m * m, 4, 1.), *b = utest_fill((BLASLONG)m * n, 5, 1.);
+    double *x = (double *)malloc((BLASLONG)m * n * sizeof(double));
+    double sum, diff, maxdiff = 0.;
+
+    for (i = 0; i < m; i++) a[i + (BLASLONG)i * m] = 4. + (double)m;
+    for (i = 0; i < m * n; i++) x[i] = b[i];
+
+    cblas_dtrsm(CblasColMajor, CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit,
+                m, n, 1.0, a, m, x, m);
+
+    /* multiply back and compare with the right hand side */
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < m; i++) {
+            sum = 0.;
+            for (l = 0; l <= i; l++) sum += a[i + (BLASLONG)l * m] * x[l + (BLASLONG)j * m];
+            diff = fabs(sum - b[i + (BLASLONG)j * m]);
+            if (diff > maxdiff) maxdiff = diff;
+        }
+    }
+
+    free(a); free(b); free(x);
+    ASSERT_DBL_NEAR_TOL(0., maxdiff, 1e-10);
+}
+
+CTEST(level3_threads, dsyrk_thin)
+{
+    blasint n = 700, k = 2, i, j, l;
+    double *a = utest_fill((BLASLONG)n * k, 6, 1.), *c = utest_fill((BLASLONG)n * n, 7, 1.);
+    double sum, diff, maxdiff = 0.;
+
+    cblas_dsyrk(CblasColMajor, CblasUpper, CblasNoTrans, n, k, 1.0, a, n, 0.0, c, n);
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i <= j; i++) {
+            sum = 0.;
+            for (l = 0; l < k; l++) sum += a[i + (BLASLONG)l * n] * a[j + (BLASLONG)l * n];
+            diff = fabs(c[i + (BLASLONG)j * n] - sum);
+            if (diff > maxdiff) maxdiff = diff;
+        }
+    }
+
+    free(a); free(c);
+    ASSERT_DBL_NEAR_TOL(0., maxdiff, 1e-12);
+}
+
+#endif
@@ -0,0 +1,104 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+#include <string.h>
+#include <cblas.h>
+
+#ifdef BUILD_DOUBLE
+
+#define PROF_N       64
+#define PROF_ENTRIES 64
+
+static void profile_count(const openblas_profile_event *event, void *data)
+{
+    if (strstr(event->name, "dgemm")) (*(int *)data)++;
+}
+
+static openblas_profile_entry *find_dgemm(openblas_profile_entry *entries, int num)
+{
+    int i;
+
+    for (i = 0; i < num; i++)
+        if (strstr(entries[i].name, "dgemm") && entries[i].flops > 0.) return &entries[i];
+
+    return NULL;
+}
+
+/*
+ * Every dgemm call made while profiling is on is counted once, with its
+ * flop count, and reported to the callback; nothing is recorded once off.
+ */
+CTEST(profile, dgemm)
+{
+    static double a[PROF_N * PROF_N], b[PROF_N * PROF_N], c[PROF_N * PROF_N];
+    openblas_profile_entry entries[PROF_ENTRIES], *entry;
+    int i, num, events = 0, was_enabled = openblas_profile_enabled();
+
+    for (i = 0; i < PROF_N * PROF_N; i++) {
+        a[i] = (double)(i % 7);
+        b[i] = (double)(i % 5);
+    }
+
+    openblas_profile_enable(1);
+    openblas_profile_reset();
+    openblas_profile_set_callback(profile_count, &events);
+
+    for (i = 0; i < 3; i++)
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, PROF_N, PROF_N, PROF_N,
+                    1.0, a, PROF_N, b, PROF_N, 0.0, c, PROF_N);
+
+    num = openblas_profile_snapshot(entries, PROF_ENTRIES);
+    if (num > PROF_ENTRIES) num = PROF_ENTRIES;
+
+    entry = find_dgemm(entries, num);
+    ASSERT_TRUE(entry != NULL);
+    ASSERT_EQUAL(3, (int)entry->calls);
+    ASSERT_DBL_NEAR_TOL(3. * 2. * PROF_N * PROF_N * PROF_N, entry->flops, 1.);
+    ASSERT_EQUAL(3, events);
+
+    openblas_profile_enable(0);
+    openblas_profile_reset();
+
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, PROF_N, PROF_N, PROF_N,
+                1.0, a, PROF_N, b, PROF_N, 0.0, c, PROF_N);
+
+    ASSERT_EQUAL(0, openblas_profile_snapshot(entries, PROF_ENTRIES));
+    ASSERT_EQUAL(3, events);
+
+    openblas_profile_set_callback(NULL, NULL);
+    openblas_profile_enable(was_enabled);
+}
+
+#endif
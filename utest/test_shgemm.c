@@ -0,0 +1,155 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#ifdef BUILD_HFLOAT16
+
+/*
+ * Small integers are exact in fp16, and their products and sums stay exact
+ * in fp32 for these sizes, so shgemm must match sgemm bit for bit.
+ */
+static void fill_small_ints(float *x, blasint n)
+{
+    blasint i;
+    for (i = 0; i < n; i++) x[i] = (float)(rand() % 7 - 3);
+}
+
+static float check_shgemm(enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                          blasint m, blasint n, blasint k)
+{
+    blasint lda = (transa == CblasNoTrans) ? m : k;
+    blasint ldb = (transb == CblasNoTrans) ? k : n;
+    blasint asize = lda * ((transa == CblasNoTrans) ? k : m);
+    blasint bsize = ldb * ((transb == CblasNoTrans) ? n : k);
+    float *a = malloc(sizeof(float) * asize);
+    float *b = malloc(sizeof(float) * bsize);
+    float *c = malloc(sizeof(float) * m * n);
+    float *c_ref = malloc(sizeof(float) * m * n);
+    hfloat16 *ha = malloc(sizeof(hfloat16) * asize);
+    hfloat16 *hb = malloc(sizeof(hfloat16) * bsize);
+    float diff, maxdiff = 0.0f;
+    blasint i;
+
+    fill_small_ints(a, asize);
+    fill_small_ints(b, bsize);
+    fill_small_ints(c, m * n);
+    for (i = 0; i < m * n; i++) c_ref[i] = c[i];
+
+    cblas_shstohf16(asize, a, 1, ha, 1);
+    cblas_shstohf16(bsize, b, 1, hb, 1);
+
+    cblas_shgemm(CblasColMajor, transa, transb, m, n, k, 1.5f, ha, lda, hb, ldb, 0.5f, c, m);
+    cblas_sgemm(CblasColMajor, transa, transb, m, n, k, 1.5f, a, lda, b, ldb, 0.5f, c_ref, m);
+
+    for (i = 0; i < m * n; i++) {
+        diff = fabsf(c[i] - c_ref[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(c); free(c_ref); free(ha); free(hb);
+    return maxdiff;
+}
+
+/* Odd sizes exercise every M/N tail of the micro-kernels. */
+CTEST(shgemm, tails_all_transposes)
+{
+    ASSERT_DBL_NEAR_TOL(0.0, check_shgemm(CblasNoTrans, CblasNoTrans, 37, 23, 45), SINGLE_EPS);
+    ASSERT_DBL_NEAR_TOL(0.0, check_shgemm(CblasTrans,   CblasNoTrans, 37, 23, 45), SINGLE_EPS);
+    ASSERT_DBL_NEAR_TOL(0.0, check_shgemm(CblasNoTrans, CblasTrans,   37, 23, 45), SINGLE_EPS);
+    ASSERT_DBL_NEAR_TOL(0.0, check_shgemm(CblasTrans,   CblasTrans,   37, 23, 45), SINGLE_EPS);
+}
+
+/* A k dimension larger than one widening block of the kernel. */
+CTEST(shgemm, long_k)
+{
+    ASSERT_DBL_NEAR_TOL(0.0, check_shgemm(CblasNoTrans, CblasNoTrans, 20, 6, 1100), SINGLE_EPS);
+}
+
+CTEST(shgemv, notrans_and_trans)
+{
+    blasint m = 29, n = 17, i;
+    float a[29 * 17], x[2 * 29], y[29], y_ref[29];
+    hfloat16 ha[29 * 17], hx[2 * 29];
+    float diff, maxdiff = 0.0f;
+
+    fill_small_ints(a, m * n);
+    fill_small_ints(x, 2 * m);
+    cblas_shstohf16(m * n, a, 1, ha, 1);
+    cblas_shstohf16(2 * m, x, 1, hx, 1);
+
+    fill_small_ints(y, m);
+    for (i = 0; i < m; i++) y_ref[i] = y[i];
+    cblas_shgemv(CblasColMajor, CblasNoTrans, m, n, 2.0f, ha, m, hx, 2, -1.0f, y, 1);
+    cblas_sgemv(CblasColMajor, CblasNoTrans, m, n, 2.0f, a, m, x, 2, -1.0f, y_ref, 1);
+    for (i = 0; i < m; i++) {
+        diff = fabsf(y[i] - y_ref[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    for (i = 0; i < n; i++) y_ref[i] = y[i] = 0.0f;
+    cblas_shgemv(CblasColMajor, CblasTrans, m, n, 1.0f, ha, m, hx, 2, 0.0f, y, 1);
+    cblas_sgemv(CblasColMajor, CblasTrans, m, n, 1.0f, a, m, x, 2, 0.0f, y_ref, 1);
+    for (i = 0; i < n; i++) {
+        diff = fabsf(y[i] - y_ref[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    ASSERT_DBL_NEAR_TOL(0.0, maxdiff, SINGLE_EPS);
+}
+
+/* Rounding is to nearest even; overflow saturates to infinity. */
+CTEST(shstohf16, rounding)
+{
+    float in[8] = { 1.0f, -0.0f, 65504.0f, 65520.0f,
+                    1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f,
+                    1.0f / 16777216.0f, -2.0f };
+    hfloat16 expect[8] = { 0x3c00, 0x8000, 0x7bff, 0x7c00,
+                           0x3c00, 0x3c02, 0x0001, 0xc000 };
+    hfloat16 out[8];
+    float back[8];
+    int i;
+
+    cblas_shstohf16(8, in, 1, out, 1);
+    for (i = 0; i < 8; i++) ASSERT_EQUAL(expect[i], out[i]);
+
+    cblas_shf16tos(8, out, 1, back, 1);
+    ASSERT_DBL_NEAR_TOL(1.0, back[0], 0.0);
+    ASSERT_DBL_NEAR_TOL(65504.0, back[2], 0.0);
+    ASSERT_TRUE(isinf(back[3]));
+    ASSERT_DBL_NEAR_TOL(1.0 / 16777216.0, back[6], 0.0);
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+#ifdef BUILD_DOUBLE
+
+#define ST_N       64
+#define ST_STREAMS 4
+
+static void fill(double *x, int size, int seed)
+{
+    int i;
+
+    for (i = 0; i < size; i++) x[i] = (double)((i * 7 + seed) % 13) / 13. - .5;
+}
+
+static double maxdiff(const double *x, const double *y, int size)
+{
+    double diff, max = 0.;
+    int i;
+
+    for (i = 0; i < size; i++) {
+        diff = fabs(x[i] - y[i]);
+        if (diff > max) max = diff;
+    }
+
+    return max;
+}
+
+/*
+ * A chain across streams: every stream multiplies its own operands, then
+ * waits for the previous stream's event before adding that stream's
+ * result to its own. The results must match the same calls made in order.
+ */
+CTEST(stream, dgemm_event_chain)
+{
+    static double a[ST_STREAMS][ST_N * ST_N], b[ST_STREAMS][ST_N * ST_N];
+    static double c[ST_STREAMS][ST_N * ST_N], r[ST_STREAMS][ST_N * ST_N];
+    openblas_stream_t stream[ST_STREAMS];
+    openblas_event_t event[ST_STREAMS];
+    int i, n = ST_N;
+
+    for (i = 0; i < ST_STREAMS; i++) {
+        fill(a[i], n * n, i + 1);
+        fill(b[i], n * n, i + 5);
+
+        cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasTrans, n, n, n, 1., a[i], n, b[i], n, 0., r[i], n);
+        if (i > 0) cblas_daxpy(n * n, .5, r[i - 1], 1, r[i], 1);
+    }
+
+    for (i = 0; i < ST_STREAMS; i++) {
+        stream[i] = openblas_stream_create();
+        event[i]  = openblas_event_create();
+        ASSERT_TRUE(stream[i] != NULL);
+        ASSERT_TRUE(event[i] != NULL);
+    }
+
+    for (i = 0; i < ST_STREAMS; i++) {
+        openblas_stream_dgemm(stream[i], CblasRowMajor, CblasNoTrans, CblasTrans, n, n, n, 1., a[i], n, b[i], n, 0., c[i], n);
+        if (i > 0) {
+            openblas_stream_wait_event(stream[i], event[i - 1]);
+            openblas_stream_daxpy(stream[i], n * n, .5, c[i - 1], 1, c[i], 1);
+        }
+        openblas_event_record(event[i], stream[i]);
+    }
+
+    openblas_event_synchronize(event[ST_STREAMS - 1]);
+
+    for (i = 0; i < ST_STREAMS; i++) {
+        ASSERT_EQUAL(1, openblas_event_query(event[i]));
+        ASSERT_DBL_NEAR_TOL(0., maxdiff(c[i], r[i], n * n), DOUBLE_EPS);
+    }
+
+    for (i = 0; i < ST_STREAMS; i++) {
+        openblas_stream_destroy(stream[i]);
+        openblas_event_destroy(event[i]);
+    }
+}
+
+/*
+ * Row major trsm is handed to the column major routine with its side and
+ * triangle swapped; calls on one stream see the results of earlier ones.
+ */
+CTEST(stream, dtrsm_rowmajor)
+{
+    static double a[ST_N * ST_N], x[ST_N * ST_N], y[ST_N * ST_N];
+    openblas_stream_t stream = openblas_stream_create();
+    int i, m = ST_N - 7, n = ST_N;
+
+    fill(a, n * n, 3);
+    for (i = 0; i < n; i++) a[i * n + i] += 4.;
+    fill(x, m * n, 4);
+    for (i = 0; i < m * n; i++) y[i] = x[i];
+
+    openblas_stream_dtrsm(stream, CblasRowMajor, CblasRight, CblasLower, CblasTrans, CblasNonUnit, m, n, 2., a, n, x, n);
+    openblas_stream_dtrsm(stream, CblasRowMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasUnit, m, n, 1., a, n, x, n);
+    openblas_stream_synchronize(stream);
+
+    cblas_dtrsm(CblasRowMajor, CblasRight, CblasLower, CblasTrans, CblasNonUnit, m, n, 2., a, n, y, n);
+    cblas_dtrsm(CblasRowMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasUnit, m, n, 1., a, n, y, n);
+
+    ASSERT_DBL_NEAR_TOL(0., maxdiff(x, y, m * n), DOUBLE_EPS);
+
+    openblas_stream_destroy(stream);
+}
+
+/*
+ * An event that was never recorded is complete, waiting on it does not
+ * hold a stream, and calls without a stream run before returning.
+ */
+CTEST(stream, unrecorded_event)
+{
+    double x[8], y[8];
+    openblas_stream_t stream = openblas_stream_create();
+    openblas_event_t event = openblas_event_create();
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        x[i] = i;
+        y[i] = 1.;
+    }
+
+    ASSERT_EQUAL(1, openblas_event_query(event));
+
+    openblas_stream_wait_event(stream, event);
+    openblas_stream_daxpy(stream, 8, 2., x, 1, y, 1);
+    openblas_event_record(event, stream);
+    openblas_event_synchronize(event);
+
+    openblas_stream_daxpy(NULL, 8, -1., x, 1, y, 1);
+
+    for (i = 0; i < 8; i++) ASSERT_DBL_NEAR_TOL(1. + i, y[i], DOUBLE_EPS);
+
+    openblas_event_destroy(event);
+    openblas_stream_destroy(stream);
+}
+
+#endif
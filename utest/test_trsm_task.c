@@ -0,0 +1,186 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+#include <cblas.h>
+
+/*
+ * Triangles large enough, with few enough right hand sides, for the
+ * interface to divide the triangle between threads. Solving and
+ * multiplying back must give the right hand side for each direction of
+ * the substitution, and trmm must agree with gemm on the full triangle.
+ */
+
+#define TS_N   1200
+#define TS_RHS 3
+
+#ifdef BUILD_DOUBLE
+static double check_dtrsm(char side, char uplo, char trans, char diag)
+{
+    blasint n = TS_N, k = TS_RHS, lda = TS_N + 1;
+    blasint m = (side == 'L') ? n : k, ncol = (side == 'L') ? k : n, ldb = m + 2;
+    double *a = utest_fill((BLASLONG)lda * n, 1, 1. / TS_N), *b = utest_fill((BLASLONG)ldb * ncol, 2, 1. / TS_N), *x;
+    double alpha = 2., beta = .5, diff, maxdiff = 0.;
+    int threads = openblas_get_num_threads();
+    BLASLONG i, j;
+
+    for (i = 0; i < n; i++) a[i + i * lda] = 2. + a[i + i * lda];
+
+    x = (double *)malloc((BLASLONG)ldb * ncol * sizeof(double));
+    for (i = 0; i < (BLASLONG)ldb * ncol; i++) x[i] = b[i];
+
+    openblas_set_num_threads(4);
+    BLASFUNC(dtrsm)(&side, &uplo, &trans, &diag, &m, &ncol, &alpha, a, &lda, x, &ldb);
+    BLASFUNC(dtrmm)(&side, &uplo, &trans, &diag, &m, &ncol, &beta, a, &lda, x, &ldb);
+    openblas_set_num_threads(threads);
+
+    for (j = 0; j < ncol; j++)
+        for (i = 0; i < m; i++) {
+            diff = fabs(x[i + j * ldb] - b[i + j * ldb]);
+            if (diff > maxdiff) maxdiff = diff;
+        }
+
+    free(a); free(b); free(x);
+    return maxdiff;
+}
+
+static double check_dtrmm(char side, char uplo, char trans, char diag)
+{
+    blasint n = TS_N, k = TS_RHS, lda = TS_N;
+    blasint m = (side == 'L') ? n : k, ncol = (side == 'L') ? k : n, ldb = m;
+    double *a = utest_fill((BLASLONG)lda * n, 3, 1. / TS_N), *b = utest_fill((BLASLONG)ldb * ncol, 4, 1. / TS_N), *t, *c;
+    double alpha = 1.5, zero = 0., diff, maxdiff = 0.;
+    char notrans = 'N';
+    int threads = openblas_get_num_threads();
+    BLASLONG i, j;
+
+    /* the triangle of A as a full matrix */
+    t = (double *)calloc((BLASLONG)n * n, sizeof(double));
+    for (j = 0; j < n; j++)
+        for (i = 0; i < n; i++)
+            if ((uplo == 'U') ? (i < j) : (i > j)) t[i + j * n] = a[i + j * lda];
+    for (i = 0; i < n; i++) t[i + i * n] = (diag == 'U') ? 1. : a[i + i * lda];
+
+    c = (double *)malloc((BLASLONG)ldb * ncol * sizeof(double));
+
+    if (side == 'L')
+        BLASFUNC(dgemm)(&trans, &notrans, &m, &ncol, &n, &alpha, t, &n, b, &ldb, &zero, c, &ldb);
+    else
+        BLASFUNC(dgemm)(&notrans, &trans, &m, &ncol, &n, &alpha, b, &ldb, t, &n, &zero, c, &ldb);
+
+    openblas_set_num_threads(4);
+    BLASFUNC(dtrmm)(&side, &uplo, &trans, &diag, &m, &ncol, &alpha, a, &lda, b, &ldb);
+    openblas_set_num_threads(threads);
+
+    for (i = 0; i < (BLASLONG)ldb * ncol; i++) {
+        diff = fabs(c[i] - b[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(t); free(c);
+    return maxdiff;
+}
+
+CTEST(trsm_task, dtrsm_left_lower_notrans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrsm('L', 'L', 'N', 'N'), 1e-12);
+}
+
+CTEST(trsm_task, dtrsm_left_upper_notrans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrsm('L', 'U', 'N', 'N'), 1e-12);
+}
+
+CTEST(trsm_task, dtrsm_left_upper_trans_unit)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrsm('L', 'U', 'T', 'U'), 1e-12);
+}
+
+CTEST(trsm_task, dtrsm_right_upper_notrans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrsm('R', 'U', 'N', 'N'), 1e-12);
+}
+
+CTEST(trsm_task, dtrsm_right_lower_trans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrsm('R', 'L', 'T', 'N'), 1e-12);
+}
+
+CTEST(trsm_task, dtrmm_left_lower_notrans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrmm('L', 'L', 'N', 'N'), 1e-12);
+}
+
+CTEST(trsm_task, dtrmm_left_lower_trans_unit)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrmm('L', 'L', 'T', 'U'), 1e-12);
+}
+
+CTEST(trsm_task, dtrmm_right_upper_trans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrmm('R', 'U', 'T', 'N'), 1e-12);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+CTEST(trsm_task, ztrsm_left_upper_conjtrans)
+{
+    blasint n = TS_N, k = TS_RHS, lda = TS_N;
+    double *a = utest_fill((BLASLONG)lda * n * 2, 5, 1. / TS_N), *b = utest_fill((BLASLONG)n * k * 2, 6, 1. / TS_N), *x;
+    double alpha[2] = {1., 1.}, beta[2] = {.5, -.5}, diff, maxdiff = 0.;
+    char side = 'L', uplo = 'U', trans = 'C', diag = 'N';
+    int threads = openblas_get_num_threads();
+    BLASLONG i;
+
+    for (i = 0; i < n; i++) {
+        a[(i + i * lda) * 2]     += 2.;
+        a[(i + i * lda) * 2 + 1] += 1.;
+    }
+
+    x = (double *)malloc((BLASLONG)n * k * 2 * sizeof(double));
+    for (i = 0; i < (BLASLONG)n * k * 2; i++) x[i] = b[i];
+
+    openblas_set_num_threads(4);
+    BLASFUNC(ztrsm)(&side, &uplo, &trans, &diag, &n, &k, alpha, a, &lda, x, &n);
+    BLASFUNC(ztrmm)(&side, &uplo, &trans, &diag, &n, &k, beta, a, &lda, x, &n);
+    openblas_set_num_threads(threads);
+
+    for (i = 0; i < (BLASLONG)n * k * 2; i++) {
+        diff = fabs(x[i] - b[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(x);
+    ASSERT_DBL_NEAR_TOL(0., maxdiff, 1e-12);
+}
+#endif
@@ -0,0 +1,183 @@
+/*****************************************************************************
+Copyright (c) 2025, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+/*
+ * Systems large enough for the interface to pipeline the substitution
+ * between threads; multiplying the solution back must give the right hand
+ * side for every storage format, side of the diagonal and transposition.
+ */
+
+#define SV_N 1200
+#define SV_K 300
+
+#ifdef BUILD_DOUBLE
+static double check_dtrsv(char uplo, char trans, char diag, blasint inc)
+{
+    blasint n = SV_N, lda = SV_N + 1;
+    double *a = utest_fill((BLASLONG)lda * n, 1, 1. / SV_N), *b = utest_fill((BLASLONG)n * inc, 2, 1. / SV_N), *x;
+    double diff, maxdiff = 0.;
+    BLASLONG i;
+
+    for (i = 0; i < n; i++) a[i + i * lda] = 2. + a[i + i * lda];
+
+    x = (double *)malloc((BLASLONG)n * inc * sizeof(double));
+    for (i = 0; i < (BLASLONG)n * inc; i++) x[i] = b[i];
+
+    BLASFUNC(dtrsv)(&uplo, &trans, &diag, &n, a, &lda, x, &inc);
+    BLASFUNC(dtrmv)(&uplo, &trans, &diag, &n, a, &lda, x, &inc);
+
+    for (i = 0; i < n; i++) {
+        diff = fabs(x[i * inc] - b[i * inc]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(x);
+    return maxdiff;
+}
+
+static double check_dtpsv(char uplo, char trans)
+{
+    blasint n = SV_N, inc = 1;
+    double *a = utest_fill((BLASLONG)n * (n + 1) / 2, 3, 1. / SV_N), *b = utest_fill(n, 4, 1. / SV_N), *x;
+    double diff, maxdiff = 0.;
+    BLASLONG i, p = 0;
+    char diag = 'N';
+
+    for (i = 0; i < n; i++) {
+        p += (uplo == 'U') ? i : 0;
+        a[p] += 2.;
+        p += (uplo == 'U') ? 1 : n - i;
+    }
+
+    x = (double *)malloc(n * sizeof(double));
+    for (i = 0; i < n; i++) x[i] = b[i];
+
+    BLASFUNC(dtpsv)(&uplo, &trans, &diag, &n, a, x, &inc);
+    BLASFUNC(dtpmv)(&uplo, &trans, &diag, &n, a, x, &inc);
+
+    for (i = 0; i < n; i++) {
+        diff = fabs(x[i] - b[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(x);
+    return maxdiff;
+}
+
+static double check_dtbsv(char uplo, char trans)
+{
+    blasint n = SV_N, k = SV_K, lda = SV_K + 1, inc = 1;
+    double *a = utest_fill((BLASLONG)lda * n, 5, 1. / SV_N), *b = utest_fill(n, 6, 1. / SV_N), *x;
+    double diff, maxdiff = 0.;
+    BLASLONG i;
+    char diag = 'N';
+
+    for (i = 0; i < n; i++) a[((uplo == 'U') ? k : 0) + i * lda] += 2.;
+
+    x = (double *)malloc(n * sizeof(double));
+    for (i = 0; i < n; i++) x[i] = b[i];
+
+    BLASFUNC(dtbsv)(&uplo, &trans, &diag, &n, &k, a, &lda, x, &inc);
+    BLASFUNC(dtbmv)(&uplo, &trans, &diag, &n, &k, a, &lda, x, &inc);
+
+    for (i = 0; i < n; i++) {
+        diff = fabs(x[i] - b[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(x);
+    return maxdiff;
+}
+
+CTEST(trsv_thread, dtrsv_upper_notrans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrsv('U', 'N', 'N', 1), 1e-12);
+}
+
+CTEST(trsv_thread, dtrsv_lower_trans_unit_inc)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtrsv('L', 'T', 'U', 3), 1e-12);
+}
+
+CTEST(trsv_thread, dtpsv_lower_notrans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtpsv('L', 'N'), 1e-12);
+}
+
+CTEST(trsv_thread, dtpsv_upper_trans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtpsv('U', 'T'), 1e-12);
+}
+
+CTEST(trsv_thread, dtbsv_upper_notrans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtbsv('U', 'N'), 1e-12);
+}
+
+CTEST(trsv_thread, dtbsv_lower_trans)
+{
+    ASSERT_DBL_NEAR_TOL(0., check_dtbsv('L', 'T'), 1e-12);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+CTEST(trsv_thread, ztrsv_upper_conjtrans)
+{
+    blasint n = SV_N, lda = SV_N, inc = 1;
+    double *a = utest_fill((BLASLONG)lda * n * 2, 7, 1. / SV_N), *b = utest_fill((BLASLONG)n * 2, 8, 1. / SV_N), *x;
+    double diff, maxdiff = 0.;
+    char uplo = 'U', trans = 'C', diag = 'N';
+    BLASLONG i;
+
+    for (i = 0; i < n; i++) {
+        a[(i + i * lda) * 2]     += 2.;
+        a[(i + i * lda) * 2 + 1] += 1.;
+    }
+
+    x = (double *)malloc((BLASLONG)n * 2 * sizeof(double));
+    for (i = 0; i < n * 2; i++) x[i] = b[i];
+
+    BLASFUNC(ztrsv)(&uplo, &trans, &diag, &n, a, &lda, x, &inc);
+    BLASFUNC(ztrmv)(&uplo, &trans, &diag, &n, a, &lda, x, &inc);
+
+    for (i = 0; i < n * 2; i++) {
+        diff = fabs(x[i] - b[i]);
+        if (diff > maxdiff) maxdiff = diff;
+    }
+
+    free(a); free(b); free(x);
+    ASSERT_DBL_NEAR_TOL(0., maxdiff, 1e-12);
+}
+#endif